@@ -39,6 +39,10 @@ echo copy Project64-bridge
 xcopy "%base_dir%/Source/Android/Bridge" "%base_dir%/Android/jni/Project64-bridge/" /D /I /F /Y /E
 IF %ERRORLEVEL% NEQ 0 (exit /B 1)
 
+echo copy Project64-bench
+xcopy "%base_dir%/Source/Project64-bench" "%base_dir%/Android/jni/Project64-bench/" /D /I /F /Y /E
+IF %ERRORLEVEL% NEQ 0 (exit /B 1)
+
 echo copy Project64-audio
 xcopy "%base_dir%/Source/Project64-audio" "%base_dir%/Android/jni/Project64-audio/" /D /I /F /Y /E
 IF %ERRORLEVEL% NEQ 0 (exit /B 1)
@@ -321,6 +321,7 @@ public enum LanguageStringID
     CORE_INTERPTER(540),
     CORE_RECOMPILER(541),
     CORE_SYNC(542),
+    CORE_CACHED_INTERPTER(543),
 
     //Self Mod Methods
     SMCM_NONE(560),
@@ -2,6 +2,7 @@
 #include "StdString.h"
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 
 CIniFileBase::CIniFileBase(CFileBase & FileObject, const char * FileName) :
     m_lastSectionSearch(0),
@@ -3,6 +3,7 @@
 #include "path.h"
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
 
 CLog::CLog(void) :
     m_FlushOnWrite(false),
@@ -3,6 +3,7 @@
 #ifndef _WIN32
 #include <alloca.h>
 #include <stdarg.h>
+#include <strings.h>
 
 #define stricmp strcasecmp
 #define _stricmp strcasecmp
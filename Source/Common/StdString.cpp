@@ -2,6 +2,7 @@
 #include "Platform.h"
 #include <algorithm>
 #include <malloc.h>
+#include <string.h>
 #ifdef _WIN32
 #include <Windows.h>
 #endif
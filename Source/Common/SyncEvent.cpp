@@ -2,7 +2,9 @@
 #ifdef _WIN32
 #include <Windows.h>
 #else
+#include <errno.h>
 #include <pthread.h>
+#include <sys/time.h>
 #endif
 
 SyncEvent::SyncEvent(bool bManualReset)
@@ -48,12 +50,32 @@ bool SyncEvent::IsTriggered(int32_t iWaitTime) const
     return (WAIT_OBJECT_0 == WaitForSingleObject(m_Event, iWaitTime));
 #else
     pthread_mutex_lock((pthread_mutex_t *)m_Event);
-    while (!m_signalled)
+    if ((uint32_t)iWaitTime == INFINITE_TIMEOUT)
     {
-        pthread_cond_wait((pthread_cond_t *)m_cond, (pthread_mutex_t *)m_Event);
+        while (!m_signalled)
+        {
+            pthread_cond_wait((pthread_cond_t *)m_cond, (pthread_mutex_t *)m_Event);
+        }
     }
+    else if (iWaitTime > 0)
+    {
+        struct timeval now;
+        gettimeofday(&now, nullptr);
+        uint64_t EndTime = (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_usec * 1000 + (uint64_t)iWaitTime * 1000000;
+        struct timespec timeout;
+        timeout.tv_sec = (time_t)(EndTime / 1000000000);
+        timeout.tv_nsec = (long)(EndTime % 1000000000);
+        while (!m_signalled)
+        {
+            if (pthread_cond_timedwait((pthread_cond_t *)m_cond, (pthread_mutex_t *)m_Event, &timeout) == ETIMEDOUT)
+            {
+                break;
+            }
+        }
+    }
+    bool Signalled = m_signalled;
     pthread_mutex_unlock((pthread_mutex_t *)m_Event);
-    return true;
+    return Signalled;
 #endif
 }
 
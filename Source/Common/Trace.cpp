@@ -3,12 +3,16 @@
 #include "Platform.h"
 #include "StdString.h"
 #include "Thread.h"
+#include "TraceAsyncLog.h"
+#include "Util.h"
+#include <atomic>
 #include <map>
 #include <vector>
 #ifdef _WIN32
 #include <Windows.h>
 #else
 #include <sys/time.h>
+#include <time.h>
 #endif
 
 typedef std::map<uint32_t, stdstr> ModuleNameMap;
@@ -21,9 +25,17 @@ class CTraceLog
 {
     std::vector<CTraceModule *> m_Modules;
     CriticalSection m_CS;
+    std::atomic<bool> m_HaveModules;
+    std::atomic<CTraceAsyncLog *> m_AsyncModule;
+    std::atomic<uint32_t> m_AsyncWriters;
+
+    void WaitForAsyncWriters(void);
 
 public:
-    CTraceLog()
+    CTraceLog() :
+        m_HaveModules(false),
+        m_AsyncModule(nullptr),
+        m_AsyncWriters(0)
     {
     }
     ~CTraceLog()
@@ -31,10 +43,33 @@ public:
         CloseTrace();
     }
 
+    bool HaveModules(void) const
+    {
+        return m_HaveModules.load(std::memory_order_relaxed);
+    }
+
+    // A writer is counted before it loads the async module, so once the module has been
+    // cleared and the count drops to zero nothing can still be using it
+    CTraceAsyncLog * AcquireAsyncModule(void)
+    {
+        m_AsyncWriters.fetch_add(1);
+        CTraceAsyncLog * AsyncModule = m_AsyncModule.load();
+        if (AsyncModule == nullptr)
+        {
+            m_AsyncWriters.fetch_sub(1);
+        }
+        return AsyncModule;
+    }
+    void ReleaseAsyncModule(void)
+    {
+        m_AsyncWriters.fetch_sub(1);
+    }
+
     void TraceMessage(uint32_t module, uint8_t severity, const char * file, int line, const char * function, const char * Message);
 
     CTraceModule * AddTraceModule(CTraceModule * TraceModule);
     CTraceModule * RemoveTraceModule(CTraceModule * TraceModule);
+    CTraceAsyncLog * SetAsyncModule(CTraceAsyncLog * TraceModule);
     void CloseTrace(void);
     void FlushTrace(void);
 };
@@ -52,15 +87,25 @@ void TraceSetModuleName(uint8_t module, const char * Name)
 
 void WriteTraceFull(uint32_t module, uint8_t severity, const char * file, int line, const char * function, const char * format, ...)
 {
+    CTraceLog & TraceLog = GetTraceObjet();
     va_list args;
     va_start(args, format);
-    size_t nlen = _vscprintf(format, args) + 1;
-    char * Message = (char *)alloca(nlen * sizeof(char));
-    Message[nlen - 1] = 0;
-    if (Message != nullptr)
+    CTraceAsyncLog * AsyncModule = TraceLog.AcquireAsyncModule();
+    if (AsyncModule != nullptr)
+    {
+        AsyncModule->WriteArgs(module, severity, function, format, args);
+        TraceLog.ReleaseAsyncModule();
+    }
+    if (TraceLog.HaveModules())
     {
-        vsprintf(Message, format, args);
-        GetTraceObjet().TraceMessage(module, severity, file, line, function, Message);
+        size_t nlen = _vscprintf(format, args) + 1;
+        char * Message = (char *)alloca(nlen * sizeof(char));
+        Message[nlen - 1] = 0;
+        if (Message != nullptr)
+        {
+            vsprintf(Message, format, args);
+            TraceLog.TraceMessage(module, severity, file, line, function, Message);
+        }
     }
     va_end(args);
 }
@@ -108,6 +153,7 @@ CTraceModule * CTraceLog::AddTraceModule(CTraceModule * TraceModule)
         }
     }
     m_Modules.push_back(TraceModule);
+    m_HaveModules = true;
     return TraceModule;
 }
 
@@ -120,16 +166,36 @@ CTraceModule * CTraceLog::RemoveTraceModule(CTraceModule * TraceModule)
         if ((*itr) == TraceModule)
         {
             m_Modules.erase(itr);
+            m_HaveModules = !m_Modules.empty();
             return TraceModule;
         }
     }
     return nullptr;
 }
 
+CTraceAsyncLog * CTraceLog::SetAsyncModule(CTraceAsyncLog * TraceModule)
+{
+    CGuard Guard(m_CS);
+    CTraceAsyncLog * OldModule = m_AsyncModule.exchange(TraceModule);
+    WaitForAsyncWriters();
+    return OldModule;
+}
+
+void CTraceLog::WaitForAsyncWriters(void)
+{
+    while (m_AsyncWriters.load() != 0)
+    {
+        pjutil::Sleep(0);
+    }
+}
+
 void CTraceLog::CloseTrace(void)
 {
     CGuard Guard(m_CS);
     m_Modules.clear();
+    m_HaveModules = false;
+    m_AsyncModule = nullptr;
+    WaitForAsyncWriters();
 
     if (g_ModuleLogLevel)
     {
@@ -145,6 +211,11 @@ void CTraceLog::FlushTrace(void)
     {
         m_Modules[i]->FlushTrace();
     }
+    CTraceAsyncLog * AsyncModule = m_AsyncModule;
+    if (AsyncModule != nullptr)
+    {
+        AsyncModule->FlushTrace();
+    }
 }
 
 void CTraceLog::TraceMessage(uint32_t module, uint8_t severity, const char * file, int line, const char * function, const char * Message)
@@ -172,6 +243,16 @@ CTraceModule * TraceRemoveModule(CTraceModule * TraceModule)
     return GetTraceObjet().RemoveTraceModule(TraceModule);
 }
 
+CTraceAsyncLog * TraceSetAsyncModule(CTraceAsyncLog * TraceModule)
+{
+    if (g_TraceClosed && TraceModule != nullptr)
+    {
+        return nullptr;
+    }
+    GetTraceObjet().SetAsyncModule(TraceModule);
+    return TraceModule;
+}
+
 const char * TraceSeverity(uint8_t severity)
 {
     switch (severity)
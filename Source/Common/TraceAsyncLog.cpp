@@ -0,0 +1,789 @@
+#include "TraceAsyncLog.h"
+#include "Platform.h"
+#include "Thread.h"
+#include "Util.h"
+#include <stddef.h>
+#include <string.h>
+#include <vector>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/time.h>
+#include <time.h>
+#endif
+
+enum FORMAT_ARG
+{
+    FormatArg_Int,
+    FormatArg_Long,
+    FormatArg_LongLong,
+    FormatArg_SizeT,
+    FormatArg_PtrDiff,
+    FormatArg_IntMax,
+    FormatArg_Double,
+    FormatArg_LongDouble,
+    FormatArg_String,
+    FormatArg_Pointer,
+    FormatArg_Percent,
+    FormatArg_Unsupported,
+};
+
+struct FORMAT_SPEC
+{
+    const char * Start;
+    const char * End;
+    bool WidthArg;
+    bool PrecisionArg;
+    FORMAT_ARG Arg;
+};
+
+// Splits one printf conversion starting at the '%', only what is needed to know
+// which arguments it takes
+static void ParseFormatSpec(const char * Pos, FORMAT_SPEC & Spec)
+{
+    enum
+    {
+        Length_None,
+        Length_Long,
+        Length_LongLong,
+        Length_LongDouble,
+        Length_SizeT,
+        Length_PtrDiff,
+        Length_IntMax,
+    } Length = Length_None;
+
+    Spec.Start = Pos++;
+    Spec.WidthArg = false;
+    Spec.PrecisionArg = false;
+
+    while (*Pos != 0 && strchr("-+ #0'", *Pos) != nullptr)
+    {
+        Pos++;
+    }
+    if (*Pos == '*')
+    {
+        Spec.WidthArg = true;
+        Pos++;
+    }
+    while (*Pos >= '0' && *Pos <= '9')
+    {
+        Pos++;
+    }
+    if (*Pos == '.')
+    {
+        Pos++;
+        if (*Pos == '*')
+        {
+            Spec.PrecisionArg = true;
+            Pos++;
+        }
+        while (*Pos >= '0' && *Pos <= '9')
+        {
+            Pos++;
+        }
+    }
+
+    switch (*Pos)
+    {
+    case 'h':
+        Pos += Pos[1] == 'h' ? 2 : 1;
+        break;
+    case 'l':
+        if (Pos[1] == 'l')
+        {
+            Length = Length_LongLong;
+            Pos += 2;
+        }
+        else
+        {
+            Length = Length_Long;
+            Pos += 1;
+        }
+        break;
+    case 'q':
+        Length = Length_LongLong;
+        Pos += 1;
+        break;
+    case 'L':
+        Length = Length_LongDouble;
+        Pos += 1;
+        break;
+    case 'z':
+        Length = Length_SizeT;
+        Pos += 1;
+        break;
+    case 't':
+        Length = Length_PtrDiff;
+        Pos += 1;
+        break;
+    case 'j':
+        Length = Length_IntMax;
+        Pos += 1;
+        break;
+    case 'I':
+        if (Pos[1] == '6' && Pos[2] == '4')
+        {
+            Length = Length_LongLong;
+            Pos += 3;
+        }
+        else if (Pos[1] == '3' && Pos[2] == '2')
+        {
+            Pos += 3;
+        }
+        else
+        {
+            Length = Length_SizeT;
+            Pos += 1;
+        }
+        break;
+    }
+
+    switch (*Pos)
+    {
+    case 'd':
+    case 'i':
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+        switch (Length)
+        {
+        case Length_Long: Spec.Arg = FormatArg_Long; break;
+        case Length_LongLong: Spec.Arg = FormatArg_LongLong; break;
+        case Length_LongDouble: Spec.Arg = FormatArg_LongLong; break;
+        case Length_SizeT: Spec.Arg = FormatArg_SizeT; break;
+        case Length_PtrDiff: Spec.Arg = FormatArg_PtrDiff; break;
+        case Length_IntMax: Spec.Arg = FormatArg_IntMax; break;
+        default: Spec.Arg = FormatArg_Int; break;
+        }
+        break;
+    case 'c':
+        Spec.Arg = Length == Length_None ? FormatArg_Int : FormatArg_Unsupported;
+        break;
+    case 's':
+        Spec.Arg = Length == Length_None ? FormatArg_String : FormatArg_Unsupported;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        Spec.Arg = Length == Length_LongDouble ? FormatArg_LongDouble : FormatArg_Double;
+        break;
+    case 'p':
+        Spec.Arg = FormatArg_Pointer;
+        break;
+    case '%':
+        Spec.Arg = FormatArg_Percent;
+        break;
+    default:
+        Spec.Arg = FormatArg_Unsupported;
+        break;
+    }
+    Spec.End = *Pos != 0 ? Pos + 1 : Pos;
+}
+
+static std::atomic<uint32_t> g_NextLogId(1);
+
+static CriticalSection & LiveLogsCS(void)
+{
+    static CriticalSection cs;
+    return cs;
+}
+
+static std::vector<uint32_t> & LiveLogs(void)
+{
+    static std::vector<uint32_t> Logs;
+    return Logs;
+}
+
+// Hands the ring back when the thread owning it exits so a later thread can use it
+struct TRACE_THREAD_RING
+{
+    TRACE_THREAD_RING() :
+        LogId(0),
+        Ring(nullptr)
+    {
+    }
+    ~TRACE_THREAD_RING()
+    {
+        if (Ring != nullptr)
+        {
+            CTraceAsyncLog::ReleaseRing(LogId, Ring);
+        }
+    }
+
+    uint32_t LogId;
+    CTraceAsyncLog::TRACE_RING * Ring;
+};
+
+static thread_local TRACE_THREAD_RING g_ThreadRing;
+
+CTraceAsyncLog::CTraceAsyncLog(const char * FileName, CLog::LOG_OPEN_MODE eMode, size_t dwMaxFileSize) :
+    m_Id(g_NextLogId++),
+    m_Thread(nullptr),
+    m_RingCount(0),
+    m_Sequence(0),
+    m_Dropped(0),
+    m_FlushRequest(0),
+    m_FlushDone(0),
+    m_Running(true),
+    m_DroppedReported(0)
+{
+    memset(m_Rings, 0, sizeof(m_Rings));
+
+    m_hLogFile.SetFlush(false);
+    m_hLogFile.SetTruncateFile(true);
+    if (dwMaxFileSize < 3 || dwMaxFileSize > 2047)
+    { // Clamp file size to 5MB if it exceeds 2047 or falls short of 3
+        dwMaxFileSize = 5;
+    }
+    m_hLogFile.SetMaxFileSize((uint32_t)(dwMaxFileSize * CLog::MB));
+    m_hLogFile.Open(FileName, eMode);
+
+    {
+        CGuard Guard(LiveLogsCS());
+        LiveLogs().push_back(m_Id);
+    }
+
+    m_Thread = new CThread((CThread::CTHREAD_START_ROUTINE)stLoggingThread);
+    m_Thread->Start(this);
+}
+
+CTraceAsyncLog::~CTraceAsyncLog()
+{
+    m_Running = false;
+    if (m_Thread != nullptr)
+    {
+        while (m_Thread->isRunning())
+        {
+            pjutil::Sleep(1);
+        }
+        delete m_Thread;
+        m_Thread = nullptr;
+    }
+    WriteRecords();
+    m_hLogFile.Flush();
+
+    {
+        CGuard Guard(LiveLogsCS());
+        std::vector<uint32_t> & Logs = LiveLogs();
+        for (std::vector<uint32_t>::iterator itr = Logs.begin(); itr != Logs.end(); itr++)
+        {
+            if (*itr == m_Id)
+            {
+                Logs.erase(itr);
+                break;
+            }
+        }
+    }
+    for (uint32_t i = 0, n = m_RingCount; i < n; i++)
+    {
+        delete m_Rings[i];
+        m_Rings[i] = nullptr;
+    }
+}
+
+void CTraceAsyncLog::Write(uint32_t module, uint8_t severity, const char * /*file*/, int /*line*/, const char * function, const char * Message)
+{
+    TRACE_RING * Ring = ThreadRing();
+    TRACE_RECORD * Record = AllocRecord(Ring, module, severity, function);
+    if (Record == nullptr)
+    {
+        return;
+    }
+    size_t Length = strlen(Message);
+    if (Length >= sizeof(Record->Data))
+    {
+        Length = sizeof(Record->Data) - 1;
+    }
+    memcpy(Record->Data, Message, Length);
+    Record->Data[Length] = 0;
+    Record->DataLength = (uint16_t)(Length + 1);
+    Record->Formatted = true;
+    CommitRecord(Ring);
+}
+
+void CTraceAsyncLog::WriteArgs(uint32_t module, uint8_t severity, const char * function, const char * format, va_list args)
+{
+    TRACE_RING * Ring = ThreadRing();
+    TRACE_RECORD * Record = AllocRecord(Ring, module, severity, function);
+    if (Record == nullptr)
+    {
+        return;
+    }
+    EncodeArgs(*Record, format, args);
+    CommitRecord(Ring);
+}
+
+void CTraceAsyncLog::FlushTrace(void)
+{
+    if (!m_Running || m_Thread == nullptr)
+    {
+        return;
+    }
+    uint32_t Request = ++m_FlushRequest;
+    for (uint32_t Waited = 0; (int32_t)(m_FlushDone.load() - Request) < 0 && Waited < FlushTimeout; Waited++)
+    {
+        pjutil::Sleep(1);
+    }
+}
+
+uint64_t CTraceAsyncLog::Dropped(void) const
+{
+    uint64_t Dropped = m_Dropped.load(std::memory_order_relaxed);
+    for (uint32_t i = 0, n = m_RingCount.load(std::memory_order_acquire); i < n; i++)
+    {
+        Dropped += m_Rings[i]->Dropped.load(std::memory_order_relaxed);
+    }
+    return Dropped;
+}
+
+CTraceAsyncLog::TRACE_RING * CTraceAsyncLog::ThreadRing(void)
+{
+    TRACE_THREAD_RING & ThreadRing = g_ThreadRing;
+    if (ThreadRing.Ring != nullptr && ThreadRing.LogId == m_Id)
+    {
+        return ThreadRing.Ring;
+    }
+    if (ThreadRing.Ring != nullptr)
+    {
+        ReleaseRing(ThreadRing.LogId, ThreadRing.Ring);
+        ThreadRing.Ring = nullptr;
+    }
+    ThreadRing.Ring = AcquireRing();
+    ThreadRing.LogId = m_Id;
+    return ThreadRing.Ring;
+}
+
+CTraceAsyncLog::TRACE_RING * CTraceAsyncLog::AcquireRing(void)
+{
+    CGuard Guard(m_CS);
+
+    uint32_t RingCount = m_RingCount.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < RingCount; i++)
+    {
+        bool InUse = false;
+        if (m_Rings[i]->InUse.compare_exchange_strong(InUse, true, std::memory_order_acquire))
+        {
+            return m_Rings[i];
+        }
+    }
+    if (RingCount == MaxRings)
+    {
+        return nullptr;
+    }
+    TRACE_RING * Ring = new TRACE_RING;
+    Ring->Head = 0;
+    Ring->Tail = 0;
+    Ring->Dropped = 0;
+    Ring->Pending = NoPending;
+    Ring->InUse = true;
+    m_Rings[RingCount] = Ring;
+    m_RingCount.store(RingCount + 1, std::memory_order_release);
+    return Ring;
+}
+
+CTraceAsyncLog::TRACE_RECORD * CTraceAsyncLog::AllocRecord(TRACE_RING * Ring, uint32_t module, uint8_t severity, const char * function)
+{
+    if (Ring == nullptr)
+    {
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    uint32_t Tail = Ring->Tail.load(std::memory_order_relaxed);
+    if (Tail - Ring->Head.load(std::memory_order_acquire) >= RingRecords)
+    {
+        Ring->Dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    TRACE_RECORD * Record = &Ring->Records[Tail % RingRecords];
+    Ring->Pending.store(m_Sequence.load());
+    Record->Sequence = m_Sequence.fetch_add(1);
+    Record->Time = CurrentTime();
+    Record->Function = function;
+    Record->Module = module;
+    Record->ThreadId = CThread::GetCurrentThreadId();
+    Record->Severity = severity;
+    Record->Formatted = false;
+    Record->DataLength = 0;
+    return Record;
+}
+
+void CTraceAsyncLog::CommitRecord(TRACE_RING * Ring)
+{
+    Ring->Tail.store(Ring->Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    Ring->Pending.store(NoPending);
+}
+
+bool CTraceAsyncLog::WriteRecords(void)
+{
+    bool Written = false;
+    uint32_t RingCount = m_RingCount.load(std::memory_order_acquire);
+
+    // Every sequence below the limit has either been committed or is still being filled in,
+    // the ones still being filled in hold the limit back
+    uint64_t Limit = m_Sequence.load();
+    for (uint32_t i = 0; i < RingCount; i++)
+    {
+        uint64_t Pending = m_Rings[i]->Pending.load();
+        if (Pending < Limit)
+        {
+            Limit = Pending;
+        }
+    }
+
+    for (;;)
+    {
+        // Records are taken across the rings in the order they were written
+        TRACE_RING * Next = nullptr;
+        const TRACE_RECORD * NextRecord = nullptr;
+        for (uint32_t i = 0; i < RingCount; i++)
+        {
+            TRACE_RING * Ring = m_Rings[i];
+            uint32_t Head = Ring->Head.load(std::memory_order_relaxed);
+            if (Head == Ring->Tail.load(std::memory_order_acquire))
+            {
+                continue;
+            }
+            const TRACE_RECORD * Record = &Ring->Records[Head % RingRecords];
+            if (NextRecord == nullptr || Record->Sequence < NextRecord->Sequence)
+            {
+                Next = Ring;
+                NextRecord = Record;
+            }
+        }
+        if (Next == nullptr || NextRecord->Sequence >= Limit)
+        {
+            break;
+        }
+        WriteRecord(*NextRecord);
+        Next->Head.store(Next->Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        Written = true;
+    }
+
+    uint64_t Dropped = this->Dropped();
+    if (Dropped != m_DroppedReported)
+    {
+        WriteDropped(Dropped - m_DroppedReported);
+        m_DroppedReported = Dropped;
+        Written = true;
+    }
+    return Written;
+}
+
+void CTraceAsyncLog::WriteRecord(const TRACE_RECORD & Record)
+{
+    if (!m_hLogFile.IsOpen())
+    {
+        return;
+    }
+
+    LogTime(Record.Time, Record.ThreadId);
+    m_hLogFile.Log(TraceSeverity(Record.Severity));
+    m_hLogFile.Log(",");
+    m_hLogFile.Log(TraceModule(Record.Module));
+    m_hLogFile.Log(",");
+    m_hLogFile.Log(Record.Function);
+    m_hLogFile.Log(",");
+    if (Record.Formatted)
+    {
+        m_hLogFile.Log(Record.Data);
+    }
+    else
+    {
+        stdstr Message;
+        DecodeArgs(Record, Message);
+        m_hLogFile.Log(Message.c_str());
+    }
+    m_hLogFile.Log("\r\n");
+}
+
+void CTraceAsyncLog::WriteDropped(uint64_t Dropped)
+{
+    if (!m_hLogFile.IsOpen())
+    {
+        return;
+    }
+    LogTime(CurrentTime(), CThread::GetCurrentThreadId());
+    m_hLogFile.Log(TraceSeverity(TraceWarning));
+    m_hLogFile.Log(",Trace,,");
+    m_hLogFile.Log(stdstr_f("%llu trace records dropped", (unsigned long long)Dropped).c_str());
+    m_hLogFile.Log("\r\n");
+}
+
+void CTraceAsyncLog::LogTime(uint64_t Time, uint32_t ThreadId)
+{
+#ifdef _WIN32
+    FILETIME fileTime, localFileTime;
+    fileTime.dwLowDateTime = (DWORD)Time;
+    fileTime.dwHighDateTime = (DWORD)(Time >> 32);
+    SYSTEMTIME sysTime;
+    FileTimeToLocalFileTime(&fileTime, &localFileTime);
+    FileTimeToSystemTime(&localFileTime, &sysTime);
+    stdstr_f timestamp("%04d/%02d/%02d %02d:%02d:%02d.%03d %05d,", sysTime.wYear, sysTime.wMonth, sysTime.wDay, sysTime.wHour, sysTime.wMinute, sysTime.wSecond, sysTime.wMilliseconds, ThreadId);
+#else
+    time_t ltime = (time_t)(Time / 1000000);
+    struct tm result = {0};
+    localtime_r(&ltime, &result);
+    int milliseconds = (int)((Time % 1000000) / 1000);
+
+    stdstr_f timestamp("%04d/%02d/%02d %02d:%02d:%02d.%03d %05d,", result.tm_year + 1900, result.tm_mon + 1, result.tm_mday, result.tm_hour, result.tm_min, result.tm_sec, milliseconds, ThreadId);
+#endif
+    m_hLogFile.Log(timestamp.c_str());
+}
+
+void CTraceAsyncLog::EncodeArgs(TRACE_RECORD & Record, const char * format, va_list args)
+{
+    // Layout is the format string followed by each argument, strings are copied as
+    // the memory they point to may be gone by the time the record is written
+    char * Data = Record.Data;
+    size_t Size = sizeof(Record.Data), Used = strlen(format) + 1;
+    bool Encoded = Used <= Size;
+    if (Encoded)
+    {
+        memcpy(Data, format, Used);
+    }
+
+    va_list ArgList;
+    va_copy(ArgList, args);
+    for (const char * Pos = strchr(format, '%'); Encoded && Pos != nullptr; Pos = strchr(Pos, '%'))
+    {
+        FORMAT_SPEC Spec;
+        ParseFormatSpec(Pos, Spec);
+        Pos = Spec.End;
+
+        int StarArgs[2], StarCount = 0;
+        if (Spec.WidthArg)
+        {
+            StarArgs[StarCount++] = va_arg(ArgList, int);
+        }
+        if (Spec.PrecisionArg)
+        {
+            StarArgs[StarCount++] = va_arg(ArgList, int);
+        }
+        if (Used + StarCount * sizeof(int) > Size)
+        {
+            Encoded = false;
+            break;
+        }
+        memcpy(&Data[Used], StarArgs, StarCount * sizeof(int));
+        Used += StarCount * sizeof(int);
+
+        uint64_t Value = 0;
+        switch (Spec.Arg)
+        {
+        case FormatArg_Int: Value = (uint64_t)(int64_t)va_arg(ArgList, int); break;
+        case FormatArg_Long: Value = (uint64_t)(int64_t)va_arg(ArgList, long); break;
+        case FormatArg_LongLong: Value = (uint64_t)va_arg(ArgList, long long); break;
+        case FormatArg_SizeT: Value = (uint64_t)va_arg(ArgList, size_t); break;
+        case FormatArg_PtrDiff: Value = (uint64_t)(int64_t)va_arg(ArgList, ptrdiff_t); break;
+        case FormatArg_IntMax: Value = (uint64_t)va_arg(ArgList, intmax_t); break;
+        case FormatArg_Pointer: Value = (uint64_t)(uintptr_t)va_arg(ArgList, void *); break;
+        case FormatArg_Percent: continue;
+        case FormatArg_Double:
+            if (Used + sizeof(double) > Size)
+            {
+                Encoded = false;
+                continue;
+            }
+            {
+                double Double = va_arg(ArgList, double);
+                memcpy(&Data[Used], &Double, sizeof(Double));
+                Used += sizeof(Double);
+            }
+            continue;
+        case FormatArg_LongDouble:
+            if (Used + sizeof(long double) > Size)
+            {
+                Encoded = false;
+                continue;
+            }
+            {
+                long double Double = va_arg(ArgList, long double);
+                memcpy(&Data[Used], &Double, sizeof(Double));
+                Used += sizeof(Double);
+            }
+            continue;
+        case FormatArg_String:
+        {
+            const char * String = va_arg(ArgList, const char *);
+            if (String == nullptr)
+            {
+                String = "(null)";
+            }
+            if (Used >= Size)
+            {
+                Encoded = false;
+                continue;
+            }
+            size_t Length = strlen(String);
+            if (Length > Size - Used - 1)
+            {
+                Length = Size - Used - 1;
+            }
+            memcpy(&Data[Used], String, Length);
+            Data[Used + Length] = 0;
+            Used += Length + 1;
+        }
+            continue;
+        default:
+            Encoded = false;
+            continue;
+        }
+        if (Used + sizeof(Value) > Size)
+        {
+            Encoded = false;
+            break;
+        }
+        memcpy(&Data[Used], &Value, sizeof(Value));
+        Used += sizeof(Value);
+    }
+    va_end(ArgList);
+
+    if (!Encoded)
+    {
+        // Arguments that can not be kept (wide strings, %n or too much data) are formatted now
+        va_copy(ArgList, args);
+        vsnprintf(Data, Size, format, ArgList);
+        va_end(ArgList);
+        Data[Size - 1] = 0;
+        Used = strlen(Data) + 1;
+        Record.Formatted = true;
+    }
+    Record.DataLength = (uint16_t)Used;
+}
+
+void CTraceAsyncLog::DecodeArgs(const TRACE_RECORD & Record, stdstr & Message)
+{
+    const char * format = Record.Data;
+    const char * Data = Record.Data;
+    size_t Used = strlen(format) + 1;
+
+    const char * Pos = format;
+    for (const char * Next = strchr(Pos, '%'); Next != nullptr; Next = strchr(Pos, '%'))
+    {
+        Message.append(Pos, Next - Pos);
+
+        FORMAT_SPEC Spec;
+        ParseFormatSpec(Next, Spec);
+        Pos = Spec.End;
+        if (Spec.Arg == FormatArg_Percent)
+        {
+            Message += '%';
+            continue;
+        }
+
+        // '*' is replaced with the value that was passed so each conversion is formatted on its own
+        stdstr SpecText;
+        for (const char * Char = Spec.Start; Char < Spec.End; Char++)
+        {
+            if (*Char != '*')
+            {
+                SpecText += *Char;
+                continue;
+            }
+            int StarArg;
+            memcpy(&StarArg, &Data[Used], sizeof(StarArg));
+            Used += sizeof(StarArg);
+            if (Char > Spec.Start && Char[-1] == '.')
+            {
+                if (StarArg < 0)
+                {
+                    SpecText.resize(SpecText.size() - 1);
+                    continue;
+                }
+            }
+            SpecText += stdstr_f("%d", StarArg);
+        }
+
+        uint64_t Value = 0;
+        if (Spec.Arg != FormatArg_String && Spec.Arg != FormatArg_Double && Spec.Arg != FormatArg_LongDouble)
+        {
+            memcpy(&Value, &Data[Used], sizeof(Value));
+            Used += sizeof(Value);
+        }
+        switch (Spec.Arg)
+        {
+        case FormatArg_Int: Message += stdstr_f(SpecText.c_str(), (int)Value); break;
+        case FormatArg_Long: Message += stdstr_f(SpecText.c_str(), (long)Value); break;
+        case FormatArg_LongLong: Message += stdstr_f(SpecText.c_str(), (long long)Value); break;
+        case FormatArg_SizeT: Message += stdstr_f(SpecText.c_str(), (size_t)Value); break;
+        case FormatArg_PtrDiff: Message += stdstr_f(SpecText.c_str(), (ptrdiff_t)Value); break;
+        case FormatArg_IntMax: Message += stdstr_f(SpecText.c_str(), (intmax_t)Value); break;
+        case FormatArg_Pointer: Message += stdstr_f(SpecText.c_str(), (void *)(uintptr_t)Value); break;
+        case FormatArg_Double:
+        {
+            double Double;
+            memcpy(&Double, &Data[Used], sizeof(Double));
+            Used += sizeof(Double);
+            Message += stdstr_f(SpecText.c_str(), Double);
+        }
+        break;
+        case FormatArg_LongDouble:
+        {
+            long double Double;
+            memcpy(&Double, &Data[Used], sizeof(Double));
+            Used += sizeof(Double);
+            Message += stdstr_f(SpecText.c_str(), Double);
+        }
+        break;
+        case FormatArg_String:
+            Message += stdstr_f(SpecText.c_str(), &Data[Used]);
+            Used += strlen(&Data[Used]) + 1;
+            break;
+        default:
+            break;
+        }
+    }
+    Message += Pos;
+}
+
+uint64_t CTraceAsyncLog::CurrentTime(void)
+{
+#ifdef _WIN32
+    FILETIME fileTime;
+    GetSystemTimeAsFileTime(&fileTime);
+    return ((uint64_t)fileTime.dwHighDateTime << 32) | fileTime.dwLowDateTime;
+#else
+    struct timeval curTime;
+    gettimeofday(&curTime, nullptr);
+    return ((uint64_t)curTime.tv_sec * 1000000) + curTime.tv_usec;
+#endif
+}
+
+void CTraceAsyncLog::ReleaseRing(uint32_t LogId, TRACE_RING * Ring)
+{
+    CGuard Guard(LiveLogsCS());
+    std::vector<uint32_t> & Logs = LiveLogs();
+    for (size_t i = 0, n = Logs.size(); i < n; i++)
+    {
+        if (Logs[i] == LogId)
+        {
+            Ring->InUse.store(false, std::memory_order_release);
+            break;
+        }
+    }
+}
+
+uint32_t CTraceAsyncLog::stLoggingThread(CTraceAsyncLog * _this)
+{
+    while (_this->m_Running)
+    {
+        uint32_t FlushRequest = _this->m_FlushRequest.load();
+        bool Written = _this->WriteRecords();
+        if (FlushRequest != _this->m_FlushDone.load())
+        {
+            _this->m_hLogFile.Flush();
+            _this->m_FlushDone.store(FlushRequest);
+        }
+        if (!Written)
+        {
+            pjutil::Sleep(IdleSleep);
+        }
+    }
+    return 0;
+}
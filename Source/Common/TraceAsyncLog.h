@@ -0,0 +1,102 @@
+#pragma once
+#include "CriticalSection.h"
+#include "StdString.h"
+#include "Trace.h"
+#include <atomic>
+#include <stdarg.h>
+
+class CThread;
+
+// Trace module that keeps formatting and file output off the thread writing the
+// trace. WriteTraceFull hands the format and the raw arguments to WriteArgs, which
+// copies them in to a ring owned by the calling thread. A background thread merges
+// the rings in sequence order, formats each record and writes it to the log. The
+// merge stops at the lowest sequence a writer has taken but not committed yet, so a
+// record that is slow to fill in is not overtaken by later ones. When a ring is full
+// the record is dropped and counted, the writer never waits. Messages that do not
+// fit in a record are cut short.
+class CTraceAsyncLog :
+    public CTraceModule
+{
+public:
+    CTraceAsyncLog(const char * FileName, CLog::LOG_OPEN_MODE eMode, size_t dwMaxFileSize = 5);
+    virtual ~CTraceAsyncLog();
+
+    void Write(uint32_t module, uint8_t severity, const char * file, int line, const char * function, const char * Message);
+    void WriteArgs(uint32_t module, uint8_t severity, const char * function, const char * format, va_list args);
+    void FlushTrace(void);
+
+    uint64_t Dropped(void) const;
+
+private:
+    CTraceAsyncLog(void);
+    CTraceAsyncLog(const CTraceAsyncLog &);
+    CTraceAsyncLog & operator=(const CTraceAsyncLog &);
+
+    enum
+    {
+        RecordSize = 512,
+        RecordHeader = 40,
+        RingRecords = 0x800,
+        MaxRings = 64,
+        IdleSleep = 5,
+        FlushTimeout = 1000,
+    };
+
+    static const uint64_t NoPending = (uint64_t)-1;
+
+    struct TRACE_RECORD
+    {
+        uint64_t Sequence;
+        uint64_t Time;
+        const char * Function;
+        uint32_t Module;
+        uint32_t ThreadId;
+        uint8_t Severity;
+        uint8_t Formatted;
+        uint16_t DataLength;
+        char Data[RecordSize - RecordHeader];
+    };
+
+    struct TRACE_RING
+    {
+        TRACE_RECORD Records[RingRecords];
+        std::atomic<uint32_t> Head;
+        std::atomic<uint32_t> Tail;
+        std::atomic<uint64_t> Dropped;
+        std::atomic<uint64_t> Pending; // Lowest sequence the record being filled in can have
+        std::atomic<bool> InUse;
+    };
+
+    TRACE_RING * ThreadRing(void);
+    TRACE_RING * AcquireRing(void);
+    TRACE_RECORD * AllocRecord(TRACE_RING * Ring, uint32_t module, uint8_t severity, const char * function);
+    void CommitRecord(TRACE_RING * Ring);
+    bool WriteRecords(void);
+    void WriteRecord(const TRACE_RECORD & Record);
+    void WriteDropped(uint64_t Dropped);
+    void LogTime(uint64_t Time, uint32_t ThreadId);
+
+    static void EncodeArgs(TRACE_RECORD & Record, const char * format, va_list args);
+    static void DecodeArgs(const TRACE_RECORD & Record, stdstr & Message);
+    static uint64_t CurrentTime(void);
+    static void ReleaseRing(uint32_t LogId, TRACE_RING * Ring);
+    static uint32_t stLoggingThread(CTraceAsyncLog * _this);
+
+    friend struct TRACE_THREAD_RING;
+
+    const uint32_t m_Id;
+    CLog m_hLogFile;
+    CThread * m_Thread;
+    CriticalSection m_CS;
+    TRACE_RING * m_Rings[MaxRings];
+    std::atomic<uint32_t> m_RingCount;
+    std::atomic<uint64_t> m_Sequence;
+    std::atomic<uint64_t> m_Dropped;
+    std::atomic<uint32_t> m_FlushRequest;
+    std::atomic<uint32_t> m_FlushDone;
+    std::atomic<bool> m_Running;
+    uint64_t m_DroppedReported;
+};
+
+CTraceAsyncLog * TraceSetAsyncModule(CTraceAsyncLog * TraceModule);
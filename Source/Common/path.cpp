@@ -15,6 +15,8 @@
 #else
 #include <dirent.h>
 #include <errno.h>
+#include <limits.h>
+#include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -264,7 +266,6 @@ CPath::CPath(DIR_CURRENT_DIRECTORY /*sdt*/, const char * NameExten)
     }
 }
 
-#ifdef _WIN32
 CPath::CPath(DIR_MODULE_DIRECTORY /*sdt*/, const char * NameExten)
 {
     // The directory where the executable of this app is
@@ -282,7 +283,6 @@ CPath::CPath(DIR_MODULE_FILE /*sdt*/)
     Init();
     Module();
 }
-#endif
 
 /*
 Post: Returns the drive component without a colon, e.g. "c"
@@ -914,6 +914,25 @@ void CPath::ModuleDirectory(void * hInstance)
 
 // Task: Set path to the directory of current module
 
+void CPath::ModuleDirectory()
+{
+    Module();
+    SetNameExtension("");
+}
+#else
+
+// Task: Set path to the name of the running executable
+
+void CPath::Module()
+{
+    char buff_path[PATH_MAX];
+    ssize_t Length = readlink("/proc/self/exe", buff_path, sizeof(buff_path) - 1);
+    buff_path[Length > 0 ? Length : 0] = '\0';
+    m_strPath = buff_path;
+}
+
+// Task: Set path to the directory of the running executable
+
 void CPath::ModuleDirectory()
 {
     Module();
@@ -10,7 +10,6 @@ public:
     {
         CURRENT_DIRECTORY = 1
     };
-#ifdef _WIN32
     enum DIR_MODULE_DIRECTORY
     {
         MODULE_DIRECTORY = 2
@@ -19,7 +18,6 @@ public:
     {
         MODULE_FILE = 3
     };
-#endif
 
     enum
     {
@@ -53,10 +51,8 @@ public:
     CPath(const std::string & strPath, const std::string & NameExten);
 
     CPath(DIR_CURRENT_DIRECTORY sdt, const char * NameExten = nullptr);
-#ifdef _WIN32
     CPath(DIR_MODULE_DIRECTORY sdt, const char * NameExten = nullptr);
     CPath(DIR_MODULE_FILE sdt);
-#endif
     virtual ~CPath();
 
     // Operators
@@ -123,10 +119,10 @@ public:
         m_strPath.erase();
     }
     void CurrentDirectory();
-#ifdef _WIN32
     void Module();
-    void Module(void * hInstance);
     void ModuleDirectory();
+#ifdef _WIN32
+    void Module(void * hInstance);
     void ModuleDirectory(void * hInstance);
 #endif
 
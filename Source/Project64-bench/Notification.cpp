@@ -0,0 +1,107 @@
+#include "Notification.h"
+#include <Common/StdString.h>
+#include <Common/Trace.h>
+#include <Project64-core/N64System/N64System.h>
+#include <Project64-core/N64System/SystemGlobals.h>
+#include <Project64-core/Settings.h>
+#include <stdio.h>
+
+CNotificationImp & Notify(void)
+{
+    static CNotificationImp Notify;
+    return Notify;
+}
+
+CNotificationImp::CNotificationImp()
+{
+}
+
+CNotificationImp::~CNotificationImp()
+{
+}
+
+// stdout is kept for the benchmark results, anything the core reports goes to stderr
+void CNotificationImp::DisplayError(const char * Message) const
+{
+    fprintf(stderr, "Error: %s\n", Message);
+}
+
+void CNotificationImp::DisplayError(LanguageStringID StringID) const
+{
+    if (g_Lang)
+    {
+        DisplayError(g_Lang->GetString(StringID).c_str());
+    }
+}
+
+void CNotificationImp::FatalError(LanguageStringID StringID) const
+{
+    if (g_Lang)
+    {
+        FatalError(g_Lang->GetString(StringID).c_str());
+    }
+}
+
+void CNotificationImp::FatalError(const char * Message) const
+{
+    WriteTrace(TraceUserInterface, TraceError, Message);
+    DisplayError(Message);
+    if (g_BaseSystem)
+    {
+        g_BaseSystem->CloseCpu();
+    }
+}
+
+void CNotificationImp::DisplayWarning(const char * Message) const
+{
+    fprintf(stderr, "Warning: %s\n", Message);
+}
+
+void CNotificationImp::DisplayWarning(LanguageStringID StringID) const
+{
+    if (g_Lang)
+    {
+        DisplayWarning(g_Lang->GetString(StringID).c_str());
+    }
+}
+
+void CNotificationImp::DisplayMessage(int DisplayTime, LanguageStringID StringID) const
+{
+    DisplayMessage(DisplayTime, g_Lang->GetString(StringID).c_str());
+}
+
+// User feedback
+void CNotificationImp::DisplayMessage(int /*DisplayTime*/, const char * Message) const
+{
+    WriteTrace(TraceUserInterface, TraceInfo, "%s", Message);
+}
+
+void CNotificationImp::DisplayMessage2(const char * Message) const
+{
+    WriteTrace(TraceUserInterface, TraceInfo, "%s", Message);
+}
+
+// Ask a yes/no question to the user, yes = true, no = false
+bool CNotificationImp::AskYesNoQuestion(const char * /*Question*/) const
+{
+    return false;
+}
+
+void CNotificationImp::BreakPoint(const char * FileName, int32_t LineNumber)
+{
+    TraceFlushLog();
+    FatalError(stdstr_f("Break point found at\n%s\nLine: %d", FileName, LineNumber).c_str());
+}
+
+void CNotificationImp::AppInitDone(void)
+{
+}
+
+bool CNotificationImp::ProcessGuiMessages(void) const
+{
+    return false;
+}
+
+void CNotificationImp::ChangeFullScreen(void) const
+{
+}
@@ -0,0 +1,69 @@
+#include <Project64-plugin-spec/Audio.h>
+#include <stdio.h>
+#include <string.h>
+
+// Audio plugin that drops every buffer, the audio interface timing is left to
+// the core (fixed audio timing) so emulation is never held back by playback
+
+EXPORT void CALL AiDacrateChanged(int32_t /*SystemType*/)
+{
+}
+
+EXPORT void CALL AiLenChanged(void)
+{
+}
+
+EXPORT uint32_t CALL AiReadLength(void)
+{
+    return 0;
+}
+
+EXPORT void CALL AiUpdate(int32_t /*Wait*/)
+{
+}
+
+EXPORT void CALL CloseDLL(void)
+{
+}
+
+EXPORT void CALL DllAbout(void * /*hParent*/)
+{
+}
+
+EXPORT void CALL DllConfig(void * /*hParent*/)
+{
+}
+
+EXPORT void CALL DllTest(void * /*hParent*/)
+{
+}
+
+EXPORT void CALL GetDllInfo(PLUGIN_INFO * PluginInfo)
+{
+    PluginInfo->Version = AUDIO_SPECS_VERSION;
+    PluginInfo->Type = PLUGIN_TYPE_AUDIO;
+    sprintf(PluginInfo->Name, "Null audio plugin");
+    PluginInfo->Reserved2 = true;
+    PluginInfo->Reserved1 = false;
+}
+
+EXPORT int32_t CALL InitiateAudio(AUDIO_INFO /*Audio_Info*/)
+{
+    return true;
+}
+
+EXPORT void CALL PluginLoaded(void)
+{
+}
+
+EXPORT void CALL ProcessAList(void)
+{
+}
+
+EXPORT void CALL RomClosed(void)
+{
+}
+
+EXPORT void CALL RomOpen(void)
+{
+}
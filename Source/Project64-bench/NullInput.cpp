@@ -0,0 +1,77 @@
+#include <Project64-plugin-spec/Input.h>
+#include <stdio.h>
+#include <string.h>
+
+// Input plugin with a single controller plugged in that never has a button pressed
+
+EXPORT void CALL CloseDLL(void)
+{
+}
+
+EXPORT void CALL ControllerCommand(int32_t /*Control*/, uint8_t * /*Command*/)
+{
+}
+
+EXPORT void CALL DllAbout(void * /*hParent*/)
+{
+}
+
+EXPORT void CALL DllConfig(void * /*hParent*/)
+{
+}
+
+EXPORT void CALL DllTest(void * /*hParent*/)
+{
+}
+
+EXPORT void CALL GetDllInfo(PLUGIN_INFO * PluginInfo)
+{
+    PluginInfo->Version = CONTROLLER_SPECS_VERSION;
+    PluginInfo->Type = PLUGIN_TYPE_CONTROLLER;
+    sprintf(PluginInfo->Name, "Null input plugin");
+    PluginInfo->Reserved2 = true;
+    PluginInfo->Reserved1 = false;
+}
+
+EXPORT void CALL GetKeys(int32_t /*Control*/, BUTTONS * Keys)
+{
+    memset(Keys, 0, sizeof(BUTTONS));
+}
+
+EXPORT void CALL InitiateControllers(CONTROL_INFO * ControlInfo)
+{
+    for (int32_t i = 0; i < 4; i++)
+    {
+        ControlInfo->Controls[i].Present = i == 0 ? PRESENT_CONT : PRESENT_NONE;
+        ControlInfo->Controls[i].RawData = false;
+        ControlInfo->Controls[i].Plugin = PLUGIN_NONE;
+    }
+}
+
+EXPORT void CALL PluginLoaded(void)
+{
+}
+
+EXPORT void CALL ReadController(int /*Control*/, uint8_t * /*Command*/)
+{
+}
+
+EXPORT void CALL RomClosed(void)
+{
+}
+
+EXPORT void CALL RomOpen(void)
+{
+}
+
+EXPORT void CALL WM_KeyDown(uint32_t /*wParam*/, uint32_t /*lParam*/)
+{
+}
+
+EXPORT void CALL WM_KeyUp(uint32_t /*wParam*/, uint32_t /*lParam*/)
+{
+}
+
+EXPORT void CALL WM_KillFocus(uint32_t /*wParam*/, uint32_t /*lParam*/)
+{
+}
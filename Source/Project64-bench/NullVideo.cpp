@@ -0,0 +1,110 @@
+#include <Project64-plugin-spec/Video.h>
+#include <stdio.h>
+#include <string.h>
+
+// Video plugin that draws nothing, display lists are completed straight away
+// so the emulated system keeps running at the speed of the CPU core
+
+enum
+{
+    MI_INTR_DP = 0x20,
+};
+
+static GFX_INFO g_GfxInfo;
+
+EXPORT void CALL CaptureScreen(const char * /*Directory*/)
+{
+}
+
+EXPORT void CALL ChangeWindow(void)
+{
+}
+
+EXPORT void CALL CloseDLL(void)
+{
+}
+
+EXPORT void CALL DllAbout(void * /*hParent*/)
+{
+}
+
+EXPORT void CALL DllConfig(void * /*hParent*/)
+{
+}
+
+EXPORT void CALL DrawScreen(void)
+{
+}
+
+EXPORT void CALL GetDllInfo(PLUGIN_INFO * PluginInfo)
+{
+    PluginInfo->Version = VIDEO_SPECS_VERSION;
+    PluginInfo->Type = PLUGIN_TYPE_VIDEO;
+    sprintf(PluginInfo->Name, "Null video plugin");
+    PluginInfo->Reserved2 = true;
+    PluginInfo->Reserved1 = false;
+}
+
+EXPORT int CALL InitiateGFX(GFX_INFO Gfx_Info)
+{
+    g_GfxInfo = Gfx_Info;
+    return true;
+}
+
+EXPORT void CALL MoveScreen(int /*xpos*/, int /*ypos*/)
+{
+}
+
+EXPORT void CALL PluginLoaded(void)
+{
+}
+
+EXPORT void CALL ProcessDList(void)
+{
+    *g_GfxInfo.MI_INTR_REG |= MI_INTR_DP;
+    g_GfxInfo.CheckInterrupts();
+}
+
+EXPORT void CALL ProcessRDPList(void)
+{
+    *g_GfxInfo.DPC_START_REG = *g_GfxInfo.DPC_END_REG;
+    *g_GfxInfo.DPC_CURRENT_REG = *g_GfxInfo.DPC_END_REG;
+}
+
+EXPORT void CALL RomClosed(void)
+{
+}
+
+EXPORT void CALL RomOpen(void)
+{
+}
+
+EXPORT void CALL ShowCFB(void)
+{
+}
+
+EXPORT void CALL SoftReset(void)
+{
+}
+
+EXPORT void CALL UpdateScreen(void)
+{
+}
+
+EXPORT void CALL ViStatusChanged(void)
+{
+}
+
+EXPORT void CALL ViWidthChanged(void)
+{
+}
+
+#ifdef ANDROID
+EXPORT void CALL SurfaceCreated(void)
+{
+}
+
+EXPORT void CALL SurfaceChanged(int /*width*/, int /*height*/)
+{
+}
+#endif
@@ -0,0 +1,159 @@
+#include "Notification.h"
+#include <Common/StdString.h>
+#include <Common/SyncEvent.h>
+#include <Common/path.h>
+#include <Project64-core/AppInit.h>
+#include <Project64-core/N64System/N64System.h>
+#include <Project64-core/N64System/SystemGlobals.h>
+#include <Project64-core/Plugins/Plugin.h>
+#include <Project64-core/Settings.h>
+#include <stdio.h>
+#include <string.h>
+
+// Replays a sync trace recorded by Project64-bench --record-trace with the
+// interpreter and reports the first sync point where the two cores differ
+
+#ifdef _WIN32
+static const char * NullVideoPlugin = "Project64-null-video.dll";
+static const char * NullAudioPlugin = "Project64-null-audio.dll";
+static const char * NullInputPlugin = "Project64-null-input.dll";
+static const char * BenchRspPlugin = "Project64-bench-rsp.dll";
+#else
+static const char * NullVideoPlugin = "libProject64-null-video.so";
+static const char * NullAudioPlugin = "libProject64-null-audio.so";
+static const char * NullInputPlugin = "libProject64-null-input.so";
+static const char * BenchRspPlugin = "libProject64-bench-rsp.so";
+#endif
+
+static SyncEvent g_CpuStopped;
+
+static void GameCpuRunning(void * /*NotUsed*/)
+{
+    if (!g_Settings->LoadBool(GameRunning_CPU_Running))
+    {
+        g_CpuStopped.Trigger();
+    }
+}
+
+// Directories given on the command line may be relative to where the runner was
+// started, the core only works with absolute ones
+static stdstr AbsoluteDirectory(const char * Directory)
+{
+    stdstr Dir = Directory;
+    if (Dir.empty() || (Dir[Dir.length() - 1] != '/' && Dir[Dir.length() - 1] != '\\'))
+    {
+        Dir += '/';
+    }
+    return (const char *)CPath(Dir).NormalizePath(CPath(CPath::CURRENT_DIRECTORY));
+}
+
+static void ShowUsage(const char * Program)
+{
+    fprintf(stderr, "Usage: %s [options] <trace> <rom>\n", Program);
+    fprintf(stderr, "  --plugin-dir <dir>    directory with the null and RSP plugins (default: directory of the tool)\n");
+    fprintf(stderr, "  --base-dir <dir>      directory used for config and save data (default: plugin directory)\n");
+}
+
+int main(int argc, char ** argv)
+{
+    const char * TraceFile = nullptr;
+    const char * RomFile = nullptr;
+    stdstr PluginDir, BaseDir;
+
+    for (int i = 1; i < argc; i++)
+    {
+        int ArgsLeft = argc - i - 1;
+        if (strcmp(argv[i], "--plugin-dir") == 0 && ArgsLeft >= 1)
+        {
+            PluginDir = AbsoluteDirectory(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--base-dir") == 0 && ArgsLeft >= 1)
+        {
+            BaseDir = AbsoluteDirectory(argv[++i]);
+        }
+        else if (ArgsLeft == 1 && argv[i][0] != '-')
+        {
+            TraceFile = argv[i];
+            RomFile = argv[++i];
+        }
+        else
+        {
+            ShowUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (TraceFile == nullptr || RomFile == nullptr)
+    {
+        ShowUsage(argv[0]);
+        return 1;
+    }
+    if (PluginDir.empty())
+    {
+        PluginDir = (const char *)CPath(CPath::MODULE_DIRECTORY);
+    }
+    if (BaseDir.empty())
+    {
+        BaseDir = PluginDir;
+    }
+
+    if (!AppInit(&Notify(), BaseDir.c_str(), 0, nullptr))
+    {
+        AppCleanup();
+        return 1;
+    }
+
+    g_Settings->SaveString(Directory_PluginSelected, PluginDir.c_str());
+    g_Settings->SaveBool(Directory_PluginUseSelected, true);
+    g_Settings->SaveString(Plugin_GFX_Current, NullVideoPlugin);
+    g_Settings->SaveString(Plugin_AUDIO_Current, NullAudioPlugin);
+    g_Settings->SaveString(Plugin_CONT_Current, NullInputPlugin);
+    g_Settings->SaveString(Plugin_RSP_Current, BenchRspPlugin);
+
+    // Must match the settings Project64-bench recorded the trace with
+    g_Settings->SaveBool(Setting_AutoStart, false);
+    g_Settings->SaveBool(Setting_ForceInterpreterCPU, true);
+    g_Settings->SaveBool(UserInterface_BasicMode, false);
+    g_Settings->SaveBool(UserInterface_DisplayFrameRate, false);
+    g_Settings->SaveString(Setting_SyncTraceFile, TraceFile);
+    g_Settings->SaveBool(Setting_SyncTraceReplay, true);
+
+    int Result = 1;
+    if (CN64System::RunFileImage(RomFile) && g_BaseSystem != nullptr)
+    {
+        g_Settings->SaveBool(GameRunning_LimitFPS, false);
+        g_Settings->SaveBool(Game_SyncViaAudio, false);
+        g_Settings->SaveBool(Game_FixedAudio, true);
+        g_BaseSystem->RefreshGameSettings();
+        g_Settings->RegisterChangeCB(GameRunning_CPU_Running, nullptr, (CSettings::SettingChangedFunc)GameCpuRunning);
+
+        const CSyncTrace * SyncTrace = g_BaseSystem->SyncTrace();
+        if (SyncTrace == nullptr)
+        {
+            fprintf(stderr, "Failed to open sync trace %s\n", TraceFile);
+        }
+        else
+        {
+            g_BaseSystem->StartEmulation(true);
+            if (g_Plugins->initilized())
+            {
+                g_CpuStopped.IsTriggered(SyncEvent::INFINITE_TIMEOUT);
+                printf("{\n");
+                printf("  \"trace\": \"%s\",\n", TraceFile);
+                printf("  \"rom\": \"%s\",\n", g_Settings->LoadStringVal(Game_GameName).c_str());
+                printf("  \"records_matched\": %llu,\n", (unsigned long long)SyncTrace->Records());
+                printf("  \"diverged\": %s,\n", SyncTrace->Diverged() ? "true" : "false");
+                printf("  \"completed\": %s\n", SyncTrace->Completed() ? "true" : "false");
+                printf("}\n");
+                Result = SyncTrace->Diverged() ? 2 : SyncTrace->Completed() ? 0 : 1;
+            }
+        }
+        g_Settings->UnregisterChangeCB(GameRunning_CPU_Running, nullptr, (CSettings::SettingChangedFunc)GameCpuRunning);
+        CN64System::CloseSystem();
+    }
+    else
+    {
+        fprintf(stderr, "Failed to load %s\n", RomFile);
+    }
+    AppCleanup();
+    return Result;
+}
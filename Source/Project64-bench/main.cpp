@@ -0,0 +1,216 @@
+#include "Notification.h"
+#include <Common/HighResTimeStamp.h>
+#include <Common/StdString.h>
+#include <Common/SyncEvent.h>
+#include <Common/path.h>
+#include <Project64-core/AppInit.h>
+#include <Project64-core/N64System/N64System.h>
+#include <Project64-core/N64System/SystemGlobals.h>
+#include <Project64-core/Plugins/Plugin.h>
+#include <Project64-core/Settings.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Runs a ROM headless for a fixed number of VI refreshes as fast as the core
+// can go and prints the throughput as JSON, so changes to the core can be
+// compared with a single reproducible number
+
+#ifdef _WIN32
+static const char * NullVideoPlugin = "Project64-null-video.dll";
+static const char * NullAudioPlugin = "Project64-null-audio.dll";
+static const char * NullInputPlugin = "Project64-null-input.dll";
+static const char * BenchRspPlugin = "Project64-bench-rsp.dll";
+#else
+static const char * NullVideoPlugin = "libProject64-null-video.so";
+static const char * NullAudioPlugin = "libProject64-null-audio.so";
+static const char * NullInputPlugin = "libProject64-null-input.so";
+static const char * BenchRspPlugin = "libProject64-bench-rsp.so";
+#endif
+
+static SyncEvent g_CpuStopped;
+static HighResTimeStamp g_StartTime;
+static HighResTimeStamp g_EndTime;
+
+static void GameCpuRunning(void * /*NotUsed*/)
+{
+    if (g_Settings->LoadBool(GameRunning_CPU_Running))
+    {
+        g_StartTime.SetToNow();
+    }
+    else
+    {
+        g_EndTime.SetToNow();
+        g_CpuStopped.Trigger();
+    }
+}
+
+// Directories given on the command line may be relative to where the runner was
+// started, the core only works with absolute ones
+static stdstr AbsoluteDirectory(const char * Directory)
+{
+    stdstr Dir = Directory;
+    if (Dir.empty() || (Dir[Dir.length() - 1] != '/' && Dir[Dir.length() - 1] != '\\'))
+    {
+        Dir += '/';
+    }
+    return (const char *)CPath(Dir).NormalizePath(CPath(CPath::CURRENT_DIRECTORY));
+}
+
+static void ShowUsage(const char * Program)
+{
+    fprintf(stderr, "Usage: %s [options] <rom>\n", Program);
+    fprintf(stderr, "  --frames <count>      number of VI refreshes to run (default 1800)\n");
+    fprintf(stderr, "  --interpreter         use the interpreter instead of the game's CPU core\n");
+    fprintf(stderr, "  --plugin-dir <dir>    directory with the null and RSP plugins (default: directory of the runner)\n");
+    fprintf(stderr, "  --base-dir <dir>      directory used for config and save data (default: plugin directory)\n");
+    fprintf(stderr, "  --record-trace <file> record a sync trace of the recompiler for Project64-sync-replay\n");
+}
+
+static void PrintResults(uint32_t ViLimit, bool Interpreter)
+{
+    static const struct
+    {
+        PROFILE_TIMERS Timer;
+        const char * Name;
+    } Timers[] =
+        {
+            {Timer_R4300, "r4300i"},
+            {Timer_RSP_Dlist, "rsp_dlist"},
+            {Timer_RSP_Alist, "rsp_alist"},
+            {Timer_RSP_Unknown, "rsp_unknown"},
+            {Timer_RefreshScreen, "refresh_screen"},
+            {Timer_UpdateScreen, "update_screen"},
+            {Timer_UpdateFPS, "update_fps"},
+            {Timer_Idel, "idle"},
+        };
+
+    uint64_t ElapsedMicroSeconds = g_EndTime.GetMicroSeconds() - g_StartTime.GetMicroSeconds();
+    double Seconds = ElapsedMicroSeconds != 0 ? ElapsedMicroSeconds / 1000000.0 : 1.0;
+    uint32_t ViCount = g_BaseSystem->ViCount();
+    uint64_t Cycles = g_BaseSystem->SystemTimer().TotalCycles();
+    const CProfiling & CPU_Usage = g_BaseSystem->CPU_Usage();
+
+    printf("{\n");
+    printf("  \"rom\": \"%s\",\n", g_Settings->LoadStringVal(Game_GameName).c_str());
+    printf("  \"cpu\": \"%s\",\n", Interpreter ? "interpreter" : "default");
+    printf("  \"frames_requested\": %u,\n", ViLimit);
+    printf("  \"frames\": %u,\n", ViCount);
+    printf("  \"seconds\": %.6f,\n", Seconds);
+    printf("  \"vi_per_second\": %.2f,\n", ViCount / Seconds);
+    printf("  \"cycles\": %llu,\n", (unsigned long long)Cycles);
+    printf("  \"cycles_per_second\": %.0f,\n", Cycles / Seconds);
+    printf("  \"recompiled_bytes\": %llu,\n", (unsigned long long)g_BaseSystem->RecompiledBytes());
+    printf("  \"timers_us\": {\n");
+    for (size_t i = 0, n = sizeof(Timers) / sizeof(Timers[0]); i < n; i++)
+    {
+        printf("    \"%s\": %llu%s\n", Timers[i].Name, (unsigned long long)CPU_Usage.TotalTime(Timers[i].Timer), i + 1 < n ? "," : "");
+    }
+    printf("  }\n");
+    printf("}\n");
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t ViLimit = 1800;
+    bool Interpreter = false;
+    const char * RomFile = nullptr;
+    stdstr PluginDir, BaseDir, TraceFile;
+
+    for (int i = 1; i < argc; i++)
+    {
+        int ArgsLeft = argc - i - 1;
+        if (strcmp(argv[i], "--frames") == 0 && ArgsLeft >= 1)
+        {
+            ViLimit = strtoul(argv[++i], nullptr, 0);
+        }
+        else if (strcmp(argv[i], "--interpreter") == 0)
+        {
+            Interpreter = true;
+        }
+        else if (strcmp(argv[i], "--plugin-dir") == 0 && ArgsLeft >= 1)
+        {
+            PluginDir = AbsoluteDirectory(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--base-dir") == 0 && ArgsLeft >= 1)
+        {
+            BaseDir = AbsoluteDirectory(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--record-trace") == 0 && ArgsLeft >= 1)
+        {
+            TraceFile = argv[++i];
+        }
+        else if (ArgsLeft == 0 && argv[i][0] != '-')
+        {
+            RomFile = argv[i];
+        }
+        else
+        {
+            ShowUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (RomFile == nullptr || ViLimit == 0)
+    {
+        ShowUsage(argv[0]);
+        return 1;
+    }
+    if (PluginDir.empty())
+    {
+        PluginDir = (const char *)CPath(CPath::MODULE_DIRECTORY);
+    }
+    if (BaseDir.empty())
+    {
+        BaseDir = PluginDir;
+    }
+
+    if (!AppInit(&Notify(), BaseDir.c_str(), 0, nullptr))
+    {
+        AppCleanup();
+        return 1;
+    }
+
+    g_Settings->SaveString(Directory_PluginSelected, PluginDir.c_str());
+    g_Settings->SaveBool(Directory_PluginUseSelected, true);
+    g_Settings->SaveString(Plugin_GFX_Current, NullVideoPlugin);
+    g_Settings->SaveString(Plugin_AUDIO_Current, NullAudioPlugin);
+    g_Settings->SaveString(Plugin_CONT_Current, NullInputPlugin);
+    g_Settings->SaveString(Plugin_RSP_Current, BenchRspPlugin);
+
+    // Nothing may hold the CPU back: no speed limiter, no syncing to audio and the
+    // AI timing is handled by the core as the null audio plugin never plays anything
+    g_Settings->SaveBool(Setting_AutoStart, false);
+    g_Settings->SaveBool(Setting_ForceInterpreterCPU, Interpreter);
+    g_Settings->SaveBool(UserInterface_BasicMode, false);
+    g_Settings->SaveBool(UserInterface_DisplayFrameRate, false);
+    g_Settings->SaveBool(UserInterface_ShowCPUPer, true);
+    g_Settings->SaveString(Setting_SyncTraceFile, TraceFile.c_str());
+    g_Settings->SaveBool(Setting_SyncTraceReplay, false);
+
+    int Result = 1;
+    if (CN64System::RunFileImage(RomFile) && g_BaseSystem != nullptr)
+    {
+        g_Settings->SaveBool(GameRunning_LimitFPS, false);
+        g_Settings->SaveBool(Game_SyncViaAudio, false);
+        g_Settings->SaveBool(Game_FixedAudio, true);
+        g_BaseSystem->RefreshGameSettings();
+        g_Settings->RegisterChangeCB(GameRunning_CPU_Running, nullptr, (CSettings::SettingChangedFunc)GameCpuRunning);
+
+        g_BaseSystem->SetViLimit(ViLimit);
+        g_BaseSystem->StartEmulation(true);
+        if (g_Plugins->initilized())
+        {
+            g_CpuStopped.IsTriggered(SyncEvent::INFINITE_TIMEOUT);
+            PrintResults(ViLimit, Interpreter);
+            Result = g_BaseSystem->ViCount() >= ViLimit ? 0 : 1;
+        }
+        g_Settings->UnregisterChangeCB(GameRunning_CPU_Running, nullptr, (CSettings::SettingChangedFunc)GameCpuRunning);
+        CN64System::CloseSystem();
+    }
+    else
+    {
+        fprintf(stderr, "Failed to load %s\n", RomFile);
+    }
+    AppCleanup();
+    return Result;
+}
@@ -3,4 +3,6 @@
 #include "../../3rdParty/zlib/contrib/minizip/unzip.h"
 #include "../../3rdParty/zlib/contrib/minizip/zip.h"
 
-#include "../../3rdParty/zlib/contrib/minizip/iowin32.h"
\ No newline at end of file
+#ifdef _WIN32
+#include "../../3rdParty/zlib/contrib/minizip/iowin32.h"
+#endif
\ No newline at end of file
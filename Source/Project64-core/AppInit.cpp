@@ -1,6 +1,7 @@
 #include "stdafx.h"
 
 #include <Common/Trace.h>
+#include <Common/TraceAsyncLog.h>
 #include <Common/Util.h>
 #include <Common/path.h>
 
@@ -20,6 +21,7 @@ static void IncreaseThreadPriority(void);
 #endif
 
 static CTraceFileLog * g_LogFile = nullptr;
+static CTraceAsyncLog * g_AsyncLogFile = nullptr;
 
 void LogFlushChanged(CTraceFileLog * LogFile)
 {
@@ -44,6 +46,12 @@ void AddLogModule(void)
         LogFilePath.DirectoryCreate();
     }
 
+    if (g_Settings->LoadBool(Debugger_AppLogAsync))
+    {
+        g_AsyncLogFile = new CTraceAsyncLog(LogFilePath, CLog::Log_New, 500);
+        TraceSetAsyncModule(g_AsyncLogFile);
+        return;
+    }
     g_LogFile = new CTraceFileLog(LogFilePath, g_Settings->LoadDword(Debugger_AppLogFlush) != 0, CLog::Log_New, 500);
     TraceAddModule(g_LogFile);
 }
@@ -120,7 +128,10 @@ void SetupTrace(void)
     g_Settings->RegisterChangeCB(Debugger_TraceTLB, nullptr, (CSettings::SettingChangedFunc)UpdateTraceLevel);
     g_Settings->RegisterChangeCB(Debugger_TraceUserInterface, nullptr, (CSettings::SettingChangedFunc)UpdateTraceLevel);
     g_Settings->RegisterChangeCB(Debugger_TraceRomList, nullptr, (CSettings::SettingChangedFunc)UpdateTraceLevel);
-    g_Settings->RegisterChangeCB(Debugger_AppLogFlush, g_LogFile, (CSettings::SettingChangedFunc)LogFlushChanged);
+    if (g_LogFile)
+    {
+        g_Settings->RegisterChangeCB(Debugger_AppLogFlush, g_LogFile, (CSettings::SettingChangedFunc)LogFlushChanged);
+    }
     UpdateTraceLevel(nullptr);
 
     WriteTrace(TraceAppInit, TraceInfo, "Application Starting %s", VER_FILE_VERSION_STR);
@@ -150,11 +161,21 @@ void CleanupTrace(void)
     g_Settings->UnregisterChangeCB(Debugger_TraceTLB, nullptr, (CSettings::SettingChangedFunc)UpdateTraceLevel);
     g_Settings->UnregisterChangeCB(Debugger_TraceUserInterface, nullptr, (CSettings::SettingChangedFunc)UpdateTraceLevel);
     g_Settings->UnregisterChangeCB(Debugger_TraceRomList, nullptr, (CSettings::SettingChangedFunc)UpdateTraceLevel);
-    g_Settings->UnregisterChangeCB(Debugger_AppLogFlush, g_LogFile, (CSettings::SettingChangedFunc)LogFlushChanged);
+    if (g_LogFile)
+    {
+        g_Settings->UnregisterChangeCB(Debugger_AppLogFlush, g_LogFile, (CSettings::SettingChangedFunc)LogFlushChanged);
+    }
 }
 
 void TraceDone(void)
 {
+    if (g_AsyncLogFile)
+    {
+        // The logging thread traces when it stops, so it has to go before the trace is closed
+        TraceSetAsyncModule(nullptr);
+        delete g_AsyncLogFile;
+        g_AsyncLogFile = nullptr;
+    }
     CloseTrace();
     if (g_LogFile)
     {
@@ -71,6 +71,7 @@ enum LanguageStringID
     MENU_RESET_HARD = 134,
     MENU_SWAPDISK = 135,
     MENU_ENHANCEMENT = 136,
+    MENU_REWIND = 137,
 
     // Options menu
     MENU_OPTIONS = 140,
@@ -335,6 +336,7 @@ enum LanguageStringID
     CORE_INTERPTER = 540,
     CORE_RECOMPILER = 541,
     CORE_SYNC = 542,
+    CORE_CACHED_INTERPTER = 543,
 
     // Self-mod methods
     SMCM_NONE = 560,
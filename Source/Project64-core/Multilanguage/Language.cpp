@@ -60,6 +60,7 @@ void CLanguage::LoadDefaultStrings(void)
     DEF_STR(MENU_RESET_HARD, "&Hard Reset");
     DEF_STR(MENU_SWAPDISK, "Swap &Disk");
     DEF_STR(MENU_ENHANCEMENT, "&Enhancements...");
+    DEF_STR(MENU_REWIND, "Re&wind");
 
     // Options menu
     DEF_STR(MENU_OPTIONS, "&Options");
@@ -283,6 +284,7 @@ void CLanguage::LoadDefaultStrings(void)
     DEF_STR(CORE_INTERPTER, "Interpreter");
     DEF_STR(CORE_RECOMPILER, "Recompiler");
     DEF_STR(CORE_SYNC, "Synchronize cores");
+    DEF_STR(CORE_CACHED_INTERPTER, "Cached interpreter");
 
     // Self-mod methods
     DEF_STR(SMCM_NONE, "None");
@@ -48,7 +48,9 @@ R4300iOp::R4300iOp(CN64System & System, bool Force32bit) :
     m_LLBit(System.m_Reg.m_LLBit),
     m_InstructionRegion(0),
     m_InstructionMemory(nullptr),
-    m_InstructionPtr(nullptr)
+    m_InstructionPtr(nullptr),
+    m_DecodedPages(nullptr),
+    m_DecodedPageCount(0)
 {
     m_Opcode.Value = 0;
     BuildInterpreter(Force32bit);
@@ -56,6 +58,7 @@ R4300iOp::R4300iOp(CN64System & System, bool Force32bit) :
 
 R4300iOp::~R4300iOp()
 {
+    FreeDecodedCode();
 }
 
 void R4300iOp::InPermLoop()
@@ -213,6 +216,175 @@ void R4300iOp::ExecuteOps(uint32_t Cycles)
     g_SystemTimer->UpdateTimers();
 }
 
+void R4300iOp::ExecuteCachedOps(uint32_t Cycles)
+{
+    if (HaveDebugger())
+    {
+        // Breakpoints and stepping are checked per opcode, only the plain interpreter loop handles them
+        ExecuteOps(Cycles);
+        return;
+    }
+
+    bool & Done = m_System.m_EndEmulation;
+    PIPELINE_STAGE & PipelineStage = m_System.m_PipelineStage;
+    uint64_t & JumpToLocation = m_System.m_JumpToLocation;
+    uint64_t & JumpDelayLocation = m_System.m_JumpDelayLocation;
+    bool & TestTimer = m_System.m_TestTimer;
+    CSystemEvents & SystemEvents = m_System.m_SystemEvents;
+    const bool & DoSomething = SystemEvents.DoSomething();
+    uint32_t CountPerOp = m_System.CountPerOp();
+    int32_t & NextTimer = *g_NextTimer;
+    bool CheckTimer = false;
+    bool updateInstructionMemory = true;
+    DecodedOp * Op = nullptr;
+    m_InstructionRegion = (uint64_t)-1;
+
+    if (m_DecodedPageCount != (m_MMU.RdramSize() >> 12))
+    {
+        FreeDecodedCode();
+        m_DecodedPageCount = m_MMU.RdramSize() >> 12;
+        m_DecodedPages = new DecodedOp *[m_DecodedPageCount];
+        memset(m_DecodedPages, 0, sizeof(DecodedOp *) * m_DecodedPageCount);
+    }
+
+    while (!Done && Cycles > 0)
+    {
+        if (updateInstructionMemory)
+        {
+            UpdateInstructionMemory();
+            updateInstructionMemory = false;
+            DecodedOp * DecodedPage = DecodedCodePage();
+            Op = DecodedPage != nullptr ? &DecodedPage[(m_PROGRAM_COUNTER & 0xFFF) >> 2] : nullptr;
+
+            // Stores and DMA in to RDRAM clear decoded pages as they are written, the entry opcode is
+            // checked once per block to catch anything else that changed the code underneath
+            if (Op != nullptr && Op->Handler != nullptr && Op->Value != *m_InstructionPtr)
+            {
+                ClearDecodedCode_Phys((uint32_t)(m_InstructionMemory - m_MMU.Rdram()), 0x1000);
+            }
+        }
+        if (Op != nullptr)
+        {
+            if (Op->Handler == nullptr)
+            {
+                Op->Value = *m_InstructionPtr;
+                m_Opcode.Value = Op->Value;
+                Op->Handler = DecodeHandler(m_Opcode);
+            }
+            else
+            {
+                m_Opcode.Value = Op->Value;
+            }
+            (this->*Op->Handler)();
+            Op++;
+        }
+        else
+        {
+            m_Opcode.Value = *m_InstructionPtr;
+            (this->*Jump_Opcode[m_Opcode.op])();
+        }
+        m_GPR[0].DW = 0; // MIPS $zero hard-wired to 0
+        NextTimer -= CountPerOp;
+        if (Cycles != (uint32_t)-1)
+        {
+            Cycles -= CountPerOp;
+        }
+
+        m_PROGRAM_COUNTER += 4;
+        if ((((uint32_t)m_PROGRAM_COUNTER) & 0xFFFUL) == 0)
+        {
+            updateInstructionMemory = true;
+        }
+        m_InstructionPtr++;
+
+        if (PipelineStage == PIPELINE_STAGE_NORMAL)
+        {
+            continue;
+        }
+
+        switch (PipelineStage)
+        {
+        case PIPELINE_STAGE_DELAY_SLOT:
+            PipelineStage = PIPELINE_STAGE_JUMP;
+            break;
+        case PIPELINE_STAGE_PERMLOOP_DO_DELAY:
+            PipelineStage = PIPELINE_STAGE_PERMLOOP_DELAY_DONE;
+            break;
+        case PIPELINE_STAGE_JUMP:
+            CheckTimer = (JumpToLocation < m_PROGRAM_COUNTER - 4 || TestTimer);
+            m_PROGRAM_COUNTER = JumpToLocation;
+            PipelineStage = PIPELINE_STAGE_NORMAL;
+            if ((m_PROGRAM_COUNTER & 0x3) != 0)
+            {
+                m_Reg.DoAddressError((int32_t)JumpToLocation, true);
+                m_PROGRAM_COUNTER = JumpToLocation;
+                PipelineStage = PIPELINE_STAGE_NORMAL;
+            }
+            else if (CheckTimer)
+            {
+                TestTimer = false;
+                if (NextTimer < 0)
+                {
+                    g_SystemTimer->TimerDone();
+                }
+                if (DoSomething)
+                {
+                    SystemEvents.ExecuteEvents();
+                }
+            }
+            updateInstructionMemory = true;
+            break;
+        case PIPELINE_STAGE_JUMP_DELAY_SLOT:
+            PipelineStage = PIPELINE_STAGE_JUMP;
+            m_PROGRAM_COUNTER = JumpToLocation;
+            JumpToLocation = JumpDelayLocation;
+            updateInstructionMemory = true;
+            break;
+        case PIPELINE_STAGE_PERMLOOP_DELAY_DONE:
+            m_PROGRAM_COUNTER = JumpToLocation;
+            PipelineStage = PIPELINE_STAGE_NORMAL;
+            InPermLoop();
+            g_SystemTimer->TimerDone();
+            if (DoSomething)
+            {
+                SystemEvents.ExecuteEvents();
+            }
+            updateInstructionMemory = true;
+            break;
+        default:
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+    }
+    g_SystemTimer->UpdateTimers();
+}
+
+void R4300iOp::ClearDecodedCode_Phys(uint32_t PAddr, uint32_t Length)
+{
+    if (m_DecodedPages == nullptr || Length == 0)
+    {
+        return;
+    }
+    uint32_t EndPage = (PAddr + Length - 1) >> 12;
+    for (uint32_t Page = PAddr >> 12; Page <= EndPage && Page < m_DecodedPageCount; Page++)
+    {
+        DecodedOp * DecodedPage = m_DecodedPages[Page];
+        if (DecodedPage == nullptr)
+        {
+            continue;
+        }
+        for (uint32_t i = 0; i < 0x400; i++)
+        {
+            DecodedPage[i].Handler = nullptr;
+        }
+    }
+}
+
+void R4300iOp::ResetDecodedCode(void)
+{
+    // Pages stay allocated as ExecuteCachedOps may still be holding an op in them
+    ClearDecodedCode_Phys(0, m_DecodedPageCount << 12);
+}
+
 void R4300iOp::SPECIAL()
 {
     (this->*Jump_Special[m_Opcode.funct])();
@@ -4001,3 +4173,87 @@ void R4300iOp::UpdateInstructionMemory()
     }
     m_InstructionPtr = (uint32_t *)(((uint8_t *)m_InstructionMemory) + (m_PROGRAM_COUNTER & 0xFFFLL));
 }
+
+R4300iOp::Func R4300iOp::DecodeHandler(const R4300iOpcode & Opcode) const
+{
+    Func Handler = Jump_Opcode[Opcode.op];
+    if (Handler == &R4300iOp::SPECIAL)
+    {
+        return Jump_Special[Opcode.funct];
+    }
+    if (Handler == &R4300iOp::REGIMM)
+    {
+        return Jump_Regimm[Opcode.rt];
+    }
+    if (Handler == &R4300iOp::COP0)
+    {
+        Handler = Jump_CoP0[Opcode.rs];
+        return Handler == &R4300iOp::COP0_CO ? Jump_CoP0_Function[Opcode.funct] : Handler;
+    }
+    if (Handler == &R4300iOp::COP1)
+    {
+        Handler = Jump_CoP1[Opcode.fmt];
+        if (Handler == &R4300iOp::COP1_BC)
+        {
+            return Jump_CoP1_BC[Opcode.ft];
+        }
+        if (Handler == &R4300iOp::COP1_S)
+        {
+            return Jump_CoP1_S[Opcode.funct];
+        }
+        if (Handler == &R4300iOp::COP1_D)
+        {
+            return Jump_CoP1_D[Opcode.funct];
+        }
+        if (Handler == &R4300iOp::COP1_W)
+        {
+            return Jump_CoP1_W[Opcode.funct];
+        }
+        if (Handler == &R4300iOp::COP1_L)
+        {
+            return Jump_CoP1_L[Opcode.funct];
+        }
+        return Handler;
+    }
+    if (Handler == &R4300iOp::COP2)
+    {
+        return Jump_CoP2[Opcode.fmt];
+    }
+    return Handler;
+}
+
+R4300iOp::DecodedOp * R4300iOp::DecodedCodePage(void)
+{
+    // Only code running from RDRAM is decoded, everything else is dispatched directly
+    uint8_t * Rdram = m_MMU.Rdram();
+    if (m_DecodedPages == nullptr || m_InstructionMemory < Rdram || m_InstructionMemory >= Rdram + (m_DecodedPageCount << 12))
+    {
+        return nullptr;
+    }
+    uint32_t Page = (uint32_t)((m_InstructionMemory - Rdram) >> 12);
+    if (m_DecodedPages[Page] == nullptr)
+    {
+        m_DecodedPages[Page] = new DecodedOp[0x400];
+        for (uint32_t i = 0; i < 0x400; i++)
+        {
+            m_DecodedPages[Page][i].Handler = nullptr;
+            m_DecodedPages[Page][i].Value = 0;
+        }
+    }
+    return m_DecodedPages[Page];
+}
+
+void R4300iOp::FreeDecodedCode(void)
+{
+    if (m_DecodedPages == nullptr)
+    {
+        return;
+    }
+    for (uint32_t i = 0; i < m_DecodedPageCount; i++)
+    {
+        delete[] m_DecodedPages[i];
+    }
+    delete[] m_DecodedPages;
+    m_DecodedPages = nullptr;
+    m_DecodedPageCount = 0;
+}
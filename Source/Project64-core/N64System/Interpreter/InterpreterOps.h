@@ -5,12 +5,16 @@
 #include <Project64-core/Settings/DebugSettings.h>
 
 class CX86RecompilerOps;
+class CX64RecompilerOps;
+class CAarch64RecompilerOps;
 
 class R4300iOp :
     public CLogging,
     private CDebugSettings
 {
     friend CX86RecompilerOps;
+    friend CX64RecompilerOps;
+    friend CAarch64RecompilerOps;
 
 public:
     R4300iOp(CN64System & System, bool Force32bit);
@@ -18,8 +22,16 @@ public:
 
     void ExecuteCPU();
     void ExecuteOps(uint32_t Cycles);
+    void ExecuteCachedOps(uint32_t Cycles);
+    void ClearDecodedCode_Phys(uint32_t PAddr, uint32_t Length);
+    void ResetDecodedCode(void);
     void InPermLoop();
 
+    bool HaveDecodedCode(uint32_t PAddr) const
+    {
+        return (PAddr >> 12) < m_DecodedPageCount && m_DecodedPages[PAddr >> 12] != nullptr;
+    }
+
     R4300iOpcode Opcode(void) const
     {
         return m_Opcode;
@@ -34,6 +46,16 @@ private:
 
     typedef void (R4300iOp::*Func)();
 
+    typedef struct
+    {
+        Func Handler;
+        uint32_t Value;
+    } DecodedOp;
+
+    Func DecodeHandler(const R4300iOpcode & Opcode) const;
+    DecodedOp * DecodedCodePage(void);
+    void FreeDecodedCode(void);
+
     void SPECIAL();
     void REGIMM();
     void COP0();
@@ -305,6 +327,8 @@ private:
     uint64_t m_InstructionRegion;
     uint8_t * m_InstructionMemory;
     uint32_t * m_InstructionPtr;
+    DecodedOp ** m_DecodedPages;
+    uint32_t m_DecodedPageCount;
 
     Func Jump_Opcode[64];
     Func Jump_Special[64];
@@ -1,7 +1,7 @@
 #pragma once
 #include "MemoryHandler.h"
-#include <Project64-core\Settings\DebugSettings.h>
-#include <Project64-core\Settings\GameSettings.h>
+#include <Project64-core/Settings/DebugSettings.h>
+#include <Project64-core/Settings/GameSettings.h>
 
 enum
 {
@@ -1,8 +1,8 @@
 #pragma once
 #include "MemoryHandler.h"
-#include <Project64-core\N64System\SaveType\FlashRam.h>
-#include <Project64-core\N64System\SaveType\Sram.h>
-#include <Project64-core\Settings\DebugSettings.h>
+#include <Project64-core/N64System/SaveType/FlashRam.h>
+#include <Project64-core/N64System/SaveType/Sram.h>
+#include <Project64-core/Settings/DebugSettings.h>
 
 class CN64System;
 class CMipsMemoryVM;
@@ -3,8 +3,8 @@
 #include "ISViewerHandler.h"
 #include <Common/File.h>
 #include <Common/path.h>
-#include <Project64-core\N64System\N64Rom.h>
-#include <Project64-core\N64System\N64System.h>
+#include <Project64-core/N64System/N64Rom.h>
+#include <Project64-core/N64System/N64System.h>
 
 ISViewerHandler::ISViewerHandler(CN64System & System, RomMemoryHandler & RomHandler, CN64Rom & Rom) :
     m_RomMemoryHandler(RomHandler),
@@ -1,8 +1,8 @@
 #include "stdafx.h"
 
 #include "MIPSInterfaceHandler.h"
-#include <Project64-core\N64System\Mips\Register.h>
-#include <Project64-core\N64System\SystemGlobals.h>
+#include <Project64-core/N64System/Mips/Register.h>
+#include <Project64-core/N64System/SystemGlobals.h>
 
 MIPSInterfaceReg::MIPSInterfaceReg(uint32_t * MipsInterface) :
     MI_INIT_MODE_REG(MipsInterface[0]),
@@ -1,15 +1,15 @@
 #include "stdafx.h"
 
 #include "PeripheralInterfaceHandler.h"
-#include <Common\MemoryManagement.h>
-#include <Project64-core\Debugger.h>
-#include <Project64-core\N64System\Mips\Disk.h>
-#include <Project64-core\N64System\Mips\MemoryVirtualMem.h>
-#include <Project64-core\N64System\Mips\Register.h>
-#include <Project64-core\N64System\N64Disk.h>
-#include <Project64-core\N64System\N64Rom.h>
-#include <Project64-core\N64System\N64System.h>
-#include <Project64-core\N64System\SystemGlobals.h>
+#include <Common/MemoryManagement.h>
+#include <Project64-core/Debugger.h>
+#include <Project64-core/N64System/Mips/Disk.h>
+#include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
+#include <Project64-core/N64System/Mips/Register.h>
+#include <Project64-core/N64System/N64Disk.h>
+#include <Project64-core/N64System/N64Rom.h>
+#include <Project64-core/N64System/N64System.h>
+#include <Project64-core/N64System/SystemGlobals.h>
 
 PeripheralInterfaceReg::PeripheralInterfaceReg(uint32_t * PeripheralInterface) :
     PI_DRAM_ADDR_REG(PeripheralInterface[0]),
@@ -33,6 +33,7 @@ PeripheralInterfaceReg::PeripheralInterfaceReg(uint32_t * PeripheralInterface) :
 PeripheralInterfaceHandler::PeripheralInterfaceHandler(CN64System & System, CMipsMemoryVM & MMU, CRegisters & Reg, CartridgeDomain2Address2Handler & Domain2Address2Handler) :
     PeripheralInterfaceReg(Reg.m_Peripheral_Interface),
     MIPSInterfaceReg(Reg.m_Mips_Interface),
+    m_System(System),
     m_Domain2Address2Handler(Domain2Address2Handler),
     m_MMU(MMU),
     m_Reg(Reg),
@@ -382,6 +383,7 @@ void PeripheralInterfaceHandler::PI_DMA_WRITE()
         {
             g_Recompiler->ClearRecompCode_Phys(WritePos & ~0xFFF, Length, CRecompiler::Remove_DMA);
         }
+        m_System.m_OpCodes.ClearDecodedCode_Phys(WritePos & ~0xFFF, Length);
 
         PI_WR_LEN_REG = Length <= 8 ? 0x7F - (PI_DRAM_ADDR_REG & 7) : 0x7F;
 
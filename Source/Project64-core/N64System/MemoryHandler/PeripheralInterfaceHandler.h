@@ -86,6 +86,7 @@ private:
     void OnFirstDMA();
     void ReadBlock(uint32_t Address, uint8_t * Block, uint32_t BlockLen);
 
+    CN64System & m_System;
     CartridgeDomain2Address2Handler & m_Domain2Address2Handler;
     CMipsMemoryVM & m_MMU;
     CRegisters & m_Reg;
@@ -1,10 +1,10 @@
 #include "stdafx.h"
 
 #include "SPRegistersHandler.h"
-#include <Project64-core\N64System\Mips\MemoryVirtualMem.h>
-#include <Project64-core\N64System\Mips\Register.h>
-#include <Project64-core\N64System\N64System.h>
-#include <Project64-core\N64System\SystemGlobals.h>
+#include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
+#include <Project64-core/N64System/Mips/Register.h>
+#include <Project64-core/N64System/N64System.h>
+#include <Project64-core/N64System/SystemGlobals.h>
 
 SPRegistersReg::SPRegistersReg(uint32_t * SignalProcessorInterface) :
     SP_MEM_ADDR_REG(SignalProcessorInterface[0]),
@@ -1,12 +1,12 @@
 #include "stdafx.h"
 
-#include <Common\MemoryManagement.h>
-#include <Project64-core\Debugger.h>
-#include <Project64-core\N64System\Mips\Disk.h>
-#include <Project64-core\N64System\Mips\MemoryVirtualMem.h>
-#include <Project64-core\N64System\N64Rom.h>
-#include <Project64-core\N64System\N64System.h>
-#include <Project64-core\N64System\SystemGlobals.h>
+#include <Common/MemoryManagement.h>
+#include <Project64-core/Debugger.h>
+#include <Project64-core/N64System/Mips/Disk.h>
+#include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
+#include <Project64-core/N64System/N64Rom.h>
+#include <Project64-core/N64System/N64System.h>
+#include <Project64-core/N64System/SystemGlobals.h>
 #include <stdio.h>
 
 uint32_t CMipsMemoryVM::RegModValue;
@@ -429,6 +429,15 @@ bool CMipsMemoryVM::LD_Memory(uint64_t VAddr, uint64_t & Value)
     return LD_VAddr32(VAddr32, Value);
 }
 
+void CMipsMemoryVM::ClearDecodedCode(const uint8_t * Dest)
+{
+    uint32_t PAddr = (uint32_t)((uintptr_t)Dest - (uintptr_t)m_RDRAM);
+    if (PAddr < m_AllocatedRdramSize && m_System.m_OpCodes.HaveDecodedCode(PAddr))
+    {
+        m_System.m_OpCodes.ClearDecodedCode_Phys(PAddr & ~0xFFF, 0x1000);
+    }
+}
+
 bool CMipsMemoryVM::SB_Memory(uint64_t VAddr, uint32_t Value)
 {
     if ((uint64_t)((int32_t)VAddr) != VAddr)
@@ -450,6 +459,7 @@ bool CMipsMemoryVM::SB_Memory(uint64_t VAddr, uint32_t Value)
     uint8_t * MemoryPtr = (uint8_t *)m_MemoryWriteMap[VAddr32 >> 12];
     if (MemoryPtr != (uint8_t *)-1)
     {
+        ClearDecodedCode(MemoryPtr + VAddr32);
         *(uint8_t *)(MemoryPtr + (VAddr32 ^ 3)) = (uint8_t)Value;
         return true;
     }
@@ -482,6 +492,7 @@ bool CMipsMemoryVM::SH_Memory(uint64_t VAddr, uint32_t Value)
     uint8_t * MemoryPtr = (uint8_t *)m_MemoryWriteMap[VAddr32 >> 12];
     if (MemoryPtr != (uint8_t *)-1)
     {
+        ClearDecodedCode(MemoryPtr + VAddr32);
         *(uint16_t *)(MemoryPtr + (VAddr32 ^ 2)) = (uint16_t)Value;
         return true;
     }
@@ -514,6 +525,7 @@ bool CMipsMemoryVM::SW_Memory(uint64_t VAddr, uint32_t Value)
     uint8_t * MemoryPtr = (uint8_t *)m_MemoryWriteMap[VAddr32 >> 12];
     if (MemoryPtr != (uint8_t *)-1)
     {
+        ClearDecodedCode(MemoryPtr + VAddr32);
         *(uint32_t *)(MemoryPtr + VAddr32) = Value;
         return true;
     }
@@ -546,6 +558,7 @@ bool CMipsMemoryVM::SD_Memory(uint64_t VAddr, uint64_t Value)
     uint8_t * MemoryPtr = (uint8_t *)m_MemoryWriteMap[VAddr32 >> 12];
     if (MemoryPtr != (uint8_t *)-1)
     {
+        ClearDecodedCode(MemoryPtr + VAddr32);
         *(uint32_t *)(MemoryPtr + VAddr32 + 0) = *((uint32_t *)(&Value) + 1);
         *(uint32_t *)(MemoryPtr + VAddr32 + 4) = *((uint32_t *)(&Value));
         return true;
@@ -818,6 +831,7 @@ bool CMipsMemoryVM::SB_PhysicalAddress(uint32_t PAddr, uint32_t Value)
         if (PAddr < RdramSize())
         {
             g_Recompiler->ClearRecompCode_Phys(PAddr & ~0xFFF, 0xFFC, CRecompiler::Remove_ProtectedMem);
+            m_System.m_OpCodes.ClearDecodedCode_Phys(PAddr & ~0xFFF, 0x1000);
             *(uint8_t *)(m_RDRAM + (PAddr ^ 3)) = (uint8_t)Value;
         }
         break;
@@ -853,6 +867,7 @@ bool CMipsMemoryVM::SH_PhysicalAddress(uint32_t PAddr, uint32_t Value)
             if (CGameSettings::bSMM_StoreInstruc())
             {
                 g_Recompiler->ClearRecompCode_Phys(PAddr & ~0xFFF, 0x1000, CRecompiler::Remove_ProtectedMem);
+                m_System.m_OpCodes.ClearDecodedCode_Phys(PAddr & ~0xFFF, 0x1000);
                 m_TLB_WriteMap[(0x80000000 + PAddr) >> 12] = PAddr - (0x80000000 + PAddr);
                 m_TLB_WriteMap[(0xA0000000 + PAddr) >> 12] = PAddr - (0xA0000000 + PAddr);
                 *(uint16_t *)(m_RDRAM + (PAddr ^ 2)) = (uint16_t)Value;
@@ -892,6 +907,7 @@ bool CMipsMemoryVM::SW_PhysicalAddress(uint32_t PAddr, uint32_t Value)
             if (CGameSettings::bSMM_StoreInstruc())
             {
                 g_Recompiler->ClearRecompCode_Phys(PAddr & ~0xFFF, 0x1000, CRecompiler::Remove_ProtectedMem);
+                m_System.m_OpCodes.ClearDecodedCode_Phys(PAddr & ~0xFFF, 0x1000);
                 m_TLB_WriteMap[(0x80000000 + PAddr) >> 12] = PAddr - (0x80000000 + PAddr);
                 m_TLB_WriteMap[(0xA0000000 + PAddr) >> 12] = PAddr - (0xA0000000 + PAddr);
                 *(uint32_t *)(m_RDRAM + PAddr) = Value;
@@ -945,6 +961,7 @@ bool CMipsMemoryVM::SD_PhysicalAddress(uint32_t PAddr, uint64_t Value)
         if (PAddr < RdramSize())
         {
             g_Recompiler->ClearRecompCode_Phys(PAddr & ~0xFFF, 0xFFC, CRecompiler::Remove_ProtectedMem);
+            m_System.m_OpCodes.ClearDecodedCode_Phys(PAddr & ~0xFFF, 0x1000);
             *(uint64_t *)(m_RDRAM + PAddr) = Value;
         }
         break;
@@ -977,6 +994,15 @@ void CMipsMemoryVM::ClearMemoryWriteMap(uint32_t VAddr, uint32_t Length)
     }
 }
 
+void CMipsMemoryVM::RestoreMemoryWriteMap(uint32_t PAddr, uint32_t Length)
+{
+    for (uint32_t i = PAddr & ~0xFFF, n = PAddr + Length; i < n && i < m_AllocatedRdramSize; i += 0x1000)
+    {
+        m_MemoryWriteMap[(i + 0x80000000) >> 12] = (size_t)((m_RDRAM + i) - (i + 0x80000000));
+        m_MemoryWriteMap[(i + 0xA0000000) >> 12] = (size_t)((m_RDRAM + i) - (i + 0xA0000000));
+    }
+}
+
 const char * CMipsMemoryVM::LabelName(uint32_t Address) const
 {
     sprintf(m_strLabelName, "0x%08X", Address);
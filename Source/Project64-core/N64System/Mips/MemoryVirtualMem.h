@@ -1,25 +1,25 @@
 #pragma once
-#include <Project64-core\N64System\Interpreter\InterpreterOps.h>
-#include <Project64-core\N64System\MemoryHandler\AudioInterfaceHandler.h>
-#include <Project64-core\N64System\MemoryHandler\CartridgeDomain1Address1Handler.h>
-#include <Project64-core\N64System\MemoryHandler\CartridgeDomain1Address3Handler.h>
-#include <Project64-core\N64System\MemoryHandler\CartridgeDomain2Address1Handler.h>
-#include <Project64-core\N64System\MemoryHandler\CartridgeDomain2Address2Handler.h>
-#include <Project64-core\N64System\MemoryHandler\DisplayControlRegHandler.h>
-#include <Project64-core\N64System\MemoryHandler\ISViewerHandler.h>
-#include <Project64-core\N64System\MemoryHandler\MIPSInterfaceHandler.h>
-#include <Project64-core\N64System\MemoryHandler\PeripheralInterfaceHandler.h>
-#include <Project64-core\N64System\MemoryHandler\PifRamHandler.h>
-#include <Project64-core\N64System\MemoryHandler\RDRAMInterfaceHandler.h>
-#include <Project64-core\N64System\MemoryHandler\RDRAMRegistersHandler.h>
-#include <Project64-core\N64System\MemoryHandler\RomMemoryHandler.h>
-#include <Project64-core\N64System\MemoryHandler\SPRegistersHandler.h>
-#include <Project64-core\N64System\MemoryHandler\SerialInterfaceHandler.h>
-#include <Project64-core\N64System\MemoryHandler\VideoInterfaceHandler.h>
-#include <Project64-core\N64System\Mips\MemoryVirtualMem.h>
-#include <Project64-core\N64System\Recompiler\RecompilerOps.h>
-#include <Project64-core\N64System\SaveType\FlashRam.h>
-#include <Project64-core\Settings\GameSettings.h>
+#include <Project64-core/N64System/Interpreter/InterpreterOps.h>
+#include <Project64-core/N64System/MemoryHandler/AudioInterfaceHandler.h>
+#include <Project64-core/N64System/MemoryHandler/CartridgeDomain1Address1Handler.h>
+#include <Project64-core/N64System/MemoryHandler/CartridgeDomain1Address3Handler.h>
+#include <Project64-core/N64System/MemoryHandler/CartridgeDomain2Address1Handler.h>
+#include <Project64-core/N64System/MemoryHandler/CartridgeDomain2Address2Handler.h>
+#include <Project64-core/N64System/MemoryHandler/DisplayControlRegHandler.h>
+#include <Project64-core/N64System/MemoryHandler/ISViewerHandler.h>
+#include <Project64-core/N64System/MemoryHandler/MIPSInterfaceHandler.h>
+#include <Project64-core/N64System/MemoryHandler/PeripheralInterfaceHandler.h>
+#include <Project64-core/N64System/MemoryHandler/PifRamHandler.h>
+#include <Project64-core/N64System/MemoryHandler/RDRAMInterfaceHandler.h>
+#include <Project64-core/N64System/MemoryHandler/RDRAMRegistersHandler.h>
+#include <Project64-core/N64System/MemoryHandler/RomMemoryHandler.h>
+#include <Project64-core/N64System/MemoryHandler/SPRegistersHandler.h>
+#include <Project64-core/N64System/MemoryHandler/SerialInterfaceHandler.h>
+#include <Project64-core/N64System/MemoryHandler/VideoInterfaceHandler.h>
+#include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
+#include <Project64-core/N64System/Recompiler/RecompilerOps.h>
+#include <Project64-core/N64System/SaveType/FlashRam.h>
+#include <Project64-core/Settings/GameSettings.h>
 
 #ifdef __arm__
 #include <sys/ucontext.h>
@@ -43,8 +43,12 @@
 
 #if defined(__i386__) || defined(_M_IX86)
 class CX86RecompilerOps;
+#elif defined(__amd64__) || defined(_M_X64)
+class CX64RecompilerOps;
 #elif defined(__arm__) || defined(_M_ARM)
 class CArmRecompilerOps;
+#elif defined(__aarch64__)
+class CAarch64RecompilerOps;
 #endif
 
 class CMipsMemoryVM :
@@ -108,6 +112,7 @@ public:
     int32_t MemoryFilter(uint32_t dwExptCode, void * lpExceptionPointer);
 
     void ClearMemoryWriteMap(uint32_t VAddr, uint32_t Length);
+    void RestoreMemoryWriteMap(uint32_t PAddr, uint32_t Length);
 
     // Functions for TLB notification
     void TLB_Mapped(uint32_t VAddr, uint32_t Len, uint32_t PAddr, bool bReadOnly);
@@ -144,9 +149,13 @@ private:
     friend class R4300iOp;
 #if defined(__i386__) || defined(_M_IX86)
     friend class CX86RecompilerOps;
+#elif defined(__amd64__) || defined(_M_X64)
+    friend class CX64RecompilerOps;
 #elif defined(__arm__) || defined(_M_ARM)
     friend class CArmRegInfo;
     friend class CArmRecompilerOps;
+#elif defined(__aarch64__)
+    friend class CAarch64RecompilerOps;
 #endif
 
     static void RdramChanged(CMipsMemoryVM * _this);
@@ -168,6 +177,7 @@ private:
     bool SH_VAddr32(uint32_t VAddr, uint32_t Value);
     bool SW_VAddr32(uint32_t VAddr, uint32_t Value);
     bool SD_VAddr32(uint32_t VAddr, uint64_t Value);
+    void ClearDecodedCode(const uint8_t * Dest);
 
     bool SB_PhysicalAddress(uint32_t PAddr, uint32_t Value);
     bool SH_PhysicalAddress(uint32_t PAddr, uint32_t Value);
@@ -49,6 +49,8 @@ const char * SystemEventName(SystemEvent event)
     case SysEvent_ResetFunctionTimes: return "SysEvent_ResetFunctionTimes";
     case SysEvent_DumpFunctionTimes: return "SysEvent_DumpFunctionTimes";
     case SysEvent_ResetRecompilerCode: return "SysEvent_ResetRecompilerCode";
+    case SysEvent_SaveSnapshot: return "SysEvent_SaveSnapshot";
+    case SysEvent_LoadSnapshot: return "SysEvent_LoadSnapshot";
     }
     static char unknown[100];
     sprintf(unknown, "Unknown(%d)", event);
@@ -159,6 +161,19 @@ void CSystemEvents::ExecuteEvents()
                 bLoadedSave = true;
             }
             break;
+        case SysEvent_SaveSnapshot:
+            if (!m_System.SaveSnapshot())
+            {
+                m_Events.push_back(SysEvent_SaveSnapshot);
+                m_DoSomething = true;
+            }
+            break;
+        case SysEvent_LoadSnapshot:
+            if (m_System.LoadSnapshot(1))
+            {
+                bLoadedSave = true;
+            }
+            break;
         case SysEvent_ChangePlugins:
             ChangePluginFunc();
             break;
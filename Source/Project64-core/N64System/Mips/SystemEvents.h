@@ -46,6 +46,8 @@ enum SystemEvent
     SysEvent_ResetFunctionTimes,
     SysEvent_DumpFunctionTimes,
     SysEvent_ResetRecompilerCode,
+    SysEvent_SaveSnapshot,
+    SysEvent_LoadSnapshot,
 };
 
 const char * SystemEventName(SystemEvent event);
@@ -10,6 +10,7 @@
 CSystemTimer::CSystemTimer(CN64System & System) :
     m_System(System),
     m_LastUpdate(0),
+    m_TotalCycles(0),
     m_NextTimer(System.m_NextTimer),
     m_Current(UnknownTimer),
     m_inFixTimer(false),
@@ -161,6 +162,7 @@ void CSystemTimer::UpdateTimers()
     if (TimeTaken != 0)
     {
         int32_t random, wired;
+        m_TotalCycles += m_LastUpdate - m_NextTimer;
         m_LastUpdate = m_NextTimer;
         m_Reg.COUNT_REGISTER += TimeTaken;
         random = (uint32_t)m_Reg.RANDOM_REGISTER - ((TimeTaken * CGameSettings::OverClockModifier()) / m_System.CountPerOp());
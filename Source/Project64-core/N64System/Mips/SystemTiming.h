@@ -10,6 +10,9 @@ class RomMemoryHandler;
 
 class CSystemTimer
 {
+    friend class CSnapshotRing;
+    friend class CSyncTrace;
+
 public:
     enum TimerType
     {
@@ -62,6 +65,10 @@ public:
     {
         return m_Current;
     }
+    uint64_t TotalCycles() const
+    {
+        return m_TotalCycles;
+    }
 
     bool operator==(const CSystemTimer & rSystemTimer) const;
     bool operator!=(const CSystemTimer & rSystemTimer) const;
@@ -77,6 +84,7 @@ private:
     CN64System & m_System;
     TIMER_DETAILS m_TimerDetatils[MaxTimer];
     int32_t m_LastUpdate;
+    uint64_t m_TotalCycles;
     int32_t & m_NextTimer;
     TimerType m_Current;
     bool m_inFixTimer;
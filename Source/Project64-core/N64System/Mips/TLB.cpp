@@ -12,11 +12,14 @@ CTLB::CTLB(CMipsMemoryVM & MMU, CRegisters & Reg, CRecompiler *& Recomp) :
     m_Reg(Reg),
     m_Recomp(Recomp),
     m_PrivilegeMode(PrivilegeMode_Kernel),
-    m_AddressSize32bit(true)
+    m_AddressSize32bit(true),
+    m_LookupHits(0),
+    m_LookupMisses(0)
 {
     WriteTrace(TraceTLB, TraceDebug, "Start");
     memset(m_tlb, 0, sizeof(m_tlb));
     memset(m_FastTlb, 0, sizeof(m_FastTlb));
+    memset(m_LookupCache, 0, sizeof(m_LookupCache));
     Reset(true);
     WriteTrace(TraceTLB, TraceDebug, "Done");
 }
@@ -31,6 +34,10 @@ void CTLB::Reset(bool InvalidateTLB)
 {
     uint32_t count;
 
+    WriteTrace(TraceTLB, TraceInfo, "Lookup cache hits: %u misses: %u", m_LookupHits, m_LookupMisses);
+    m_LookupHits = 0;
+    m_LookupMisses = 0;
+
     for (count = 0; count < 64; count++)
     {
         m_FastTlb[count].ValidEntry = false;
@@ -53,6 +60,21 @@ void CTLB::Reset(bool InvalidateTLB)
     COP0StatusChanged();
 }
 
+void CTLB::LoadEntries(const TLB_ENTRY * Entries)
+{
+    // The mappings of the current entries have to go before the entries they came from are replaced
+    for (uint32_t FastIndx = 0; FastIndx < 64; FastIndx++)
+    {
+        if (m_FastTlb[FastIndx].ValidEntry && m_FastTlb[FastIndx].VALID)
+        {
+            TLB_Unmaped(m_FastTlb[FastIndx].VSTART, m_FastTlb[FastIndx].Length);
+        }
+        m_FastTlb[FastIndx].VALID = false;
+    }
+    memcpy(m_tlb, Entries, sizeof(m_tlb));
+    Reset(false);
+}
+
 bool CTLB::AddressDefined(uint64_t VAddr, bool & Dirty)
 {
     Dirty = true;
@@ -188,6 +210,7 @@ void CTLB::WriteEntry(uint32_t Index, bool Random)
     m_tlb[Index].EntryLo1.PFN = m_Reg.ENTRYLO1_REGISTER.PFN & 0xFFFFF;
     m_tlb[Index].EntryLo1.GLOBAL = Gloabl;
     m_tlb[Index].EntryDefined = true;
+    InvalidateLookupCache();
     SetupTLB_Entry(Index, Random);
     if (g_Debugger != nullptr)
     {
@@ -197,6 +220,7 @@ void CTLB::WriteEntry(uint32_t Index, bool Random)
 
 void CTLB::COP0StatusChanged(void)
 {
+    InvalidateLookupCache();
     m_PrivilegeMode = m_Reg.STATUS_REGISTER.PrivilegeMode;
     switch (m_PrivilegeMode)
     {
@@ -314,29 +338,25 @@ bool CTLB::VAddrToPAddr(uint64_t VAddr, uint32_t & PAddr, bool & MemoryUnused)
     MemorySegment Segment = VAddrMemorySegment(VAddr);
     if (Segment == MemorySegment_Mapped)
     {
-        for (uint32_t i = 0; i < 32; i++)
+        // Pages are at least 4KB, so the translation of the start of the page holds for the rest of it
+        TLB_LOOKUP & Lookup = m_LookupCache[(VAddr >> 12) & (LookupCacheSize - 1)];
+        uint8_t ASID = (uint8_t)m_Reg.ENTRYHI_REGISTER.ASID();
+        if (Lookup.Valid && Lookup.VPage == (VAddr >> 12) && Lookup.ASID == ASID)
         {
-            if (m_tlb[i].EntryLo0.GLOBAL == 0)
-            {
-                continue;
-            }
-            if ((VAddr & 0xE000000000000000) != ((uint64_t)m_tlb[i].EntryHi.R() << 62))
-            {
-                continue;
-            }
-            uint64_t PageMask = (m_tlb[i].PageMask.Mask << 12);
-            uint64_t AddressMaskHi = ~(PageMask | 0x1fff) & 0xFFFFFFFFFF;
-            uint64_t AddressRegion = ((uint64_t)m_tlb[i].EntryHi.VPN2() << 13);
-            if ((VAddr & AddressMaskHi) != AddressRegion)
-            {
-                continue;
-            }
-            uint64_t AddressSelect = ((m_tlb[i].PageMask.Mask << 12) | 0xfff) + 1;
-            COP0EntryLo EntryLo = (VAddr & AddressSelect) != 0 ? m_tlb[i].EntryLo1 : m_tlb[i].EntryLo0;
-            PAddr = (uint32_t)((EntryLo.PFN << 12) + (VAddr & (PageMask | 0x1fff)));
+            m_LookupHits += 1;
+            PAddr = Lookup.PAddr + (uint32_t)(VAddr & 0xFFF);
             return true;
         }
-        return false;
+        m_LookupMisses += 1;
+        if (!LookupVAddr(VAddr, PAddr))
+        {
+            return false;
+        }
+        Lookup.VPage = VAddr >> 12;
+        Lookup.PAddr = PAddr & ~0xFFF;
+        Lookup.ASID = ASID;
+        Lookup.Valid = true;
+        return true;
     }
     if (Segment == MemorySegment_Unused)
     {
@@ -351,6 +371,41 @@ bool CTLB::VAddrToPAddr(uint64_t VAddr, uint32_t & PAddr, bool & MemoryUnused)
     return false;
 }
 
+bool CTLB::LookupVAddr(uint64_t VAddr, uint32_t & PAddr)
+{
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        if (m_tlb[i].EntryLo0.GLOBAL == 0)
+        {
+            continue;
+        }
+        if ((VAddr & 0xE000000000000000) != ((uint64_t)m_tlb[i].EntryHi.R() << 62))
+        {
+            continue;
+        }
+        uint64_t PageMask = (m_tlb[i].PageMask.Mask << 12);
+        uint64_t AddressMaskHi = ~(PageMask | 0x1fff) & 0xFFFFFFFFFF;
+        uint64_t AddressRegion = ((uint64_t)m_tlb[i].EntryHi.VPN2() << 13);
+        if ((VAddr & AddressMaskHi) != AddressRegion)
+        {
+            continue;
+        }
+        uint64_t AddressSelect = ((m_tlb[i].PageMask.Mask << 12) | 0xfff) + 1;
+        COP0EntryLo EntryLo = (VAddr & AddressSelect) != 0 ? m_tlb[i].EntryLo1 : m_tlb[i].EntryLo0;
+        PAddr = (uint32_t)((EntryLo.PFN << 12) + (VAddr & (PageMask | 0x1fff)));
+        return true;
+    }
+    return false;
+}
+
+void CTLB::InvalidateLookupCache(void)
+{
+    for (uint32_t i = 0; i < LookupCacheSize; i++)
+    {
+        m_LookupCache[i].Valid = false;
+    }
+}
+
 MemorySegment CTLB::VAddrMemorySegment(uint64_t VAddr)
 {
     if (m_AddressSize32bit)
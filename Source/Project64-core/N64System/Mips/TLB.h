@@ -49,6 +49,20 @@ class CTLB :
         bool Probed;
     };
 
+    // Pages translated by VAddrToPAddr, the scan of m_tlb is only done when the page is not here
+    struct TLB_LOOKUP
+    {
+        uint64_t VPage;
+        uint32_t PAddr;
+        uint8_t ASID;
+        bool Valid;
+    };
+
+    enum
+    {
+        LookupCacheSize = 64,
+    };
+
 public:
     CTLB(CMipsMemoryVM & MMU, CRegisters & Reg, CRecompiler *& Recomp);
     ~CTLB();
@@ -57,6 +71,7 @@ public:
     void Probe();
     void ReadEntry();
     void WriteEntry(uint32_t Index, bool Random);
+    void LoadEntries(const TLB_ENTRY * Entries);
     void COP0StatusChanged(void);
     bool AddressDefined(uint64_t VAddr, bool & Dirty);
     TLB_ENTRY & TlbEntry(int32_t Entry);
@@ -65,6 +80,15 @@ public:
     bool PAddrToVAddr(uint32_t PAddr, uint32_t & VAddr, uint32_t & Index);
     void RecordDifference(CLog & LogFile, const CTLB & rTLB);
 
+    uint32_t LookupCacheHits() const
+    {
+        return m_LookupHits;
+    }
+    uint32_t LookupCacheMisses() const
+    {
+        return m_LookupMisses;
+    }
+
     bool operator==(const CTLB & rTLB) const;
     bool operator!=(const CTLB & rTLB) const;
 
@@ -76,6 +100,8 @@ private:
     void SetupTLB_Entry(uint32_t Index, bool Random);
     void TLB_Unmaped(uint32_t VAddr, uint32_t Len);
     MemorySegment VAddrMemorySegment(uint64_t VAddr);
+    bool LookupVAddr(uint64_t VAddr, uint32_t & PAddr);
+    void InvalidateLookupCache(void);
 
     PRIVILEGE_MODE m_PrivilegeMode;
     bool m_AddressSize32bit;
@@ -84,6 +110,9 @@ private:
     CRecompiler *& m_Recomp;
     TLB_ENTRY m_tlb[32];
     FASTTLB m_FastTlb[64];
+    TLB_LOOKUP m_LookupCache[LookupCacheSize];
+    uint32_t m_LookupHits;
+    uint32_t m_LookupMisses;
 };
 
 #pragma warning(pop)
@@ -32,12 +32,17 @@ CN64System::CN64System(CPlugins * Plugins, uint32_t randomizer_seed, bool SavesR
     //m_Cheats(m_MMU_VM),
     m_Reg(*this, m_SystemEvents),
     m_TLB(m_MMU_VM, m_Reg, m_Recomp),
-    m_OpCodes(*this, !SyncSystem && g_Settings->LoadDword(Game_CpuType) != CPU_Interpreter && b32BitCore()),
+    m_OpCodes(*this, !SyncSystem && !g_Settings->LoadBool(Setting_SyncTraceReplay) && g_Settings->LoadDword(Game_CpuType) != CPU_Interpreter && g_Settings->LoadDword(Game_CpuType) != CPU_CachedInterpreter && b32BitCore()),
     m_Recomp(nullptr),
     m_InReset(false),
     m_NextTimer(0),
     m_SystemTimer(*this),
     m_bCleanFrameBox(true),
+    m_ViCount(0),
+    m_ViLimit(0),
+    m_RewindInterval(SyncSystem ? 0 : g_Settings->LoadDword(Setting_RewindInterval)),
+    m_Snapshots(nullptr),
+    m_SyncTrace(nullptr),
     m_TestTimer(false),
     m_PipelineStage(PIPELINE_STAGE_NORMAL),
     m_JumpToLocation(0),
@@ -101,6 +106,29 @@ CN64System::CN64System(CPlugins * Plugins, uint32_t randomizer_seed, bool SavesR
             m_SyncCPU = new CN64System(m_SyncPlugins, randomizer_seed, true, true);
         }
 
+        std::string SyncTraceFile = g_Settings->LoadStringVal(Setting_SyncTraceFile);
+        if (!SyncTraceFile.empty())
+        {
+            bool Replay = g_Settings->LoadBool(Setting_SyncTraceReplay);
+            if (Replay || CpuType == CPU_Recompiler)
+            {
+                m_SyncTrace = new CSyncTrace(*this, SyncTraceFile.c_str(), Replay ? CSyncTrace::Trace_Replay : CSyncTrace::Trace_Record);
+                if (!m_SyncTrace->IsOpen())
+                {
+                    delete m_SyncTrace;
+                    m_SyncTrace = nullptr;
+                }
+                else if (Replay)
+                {
+                    m_Random.set_state(m_SyncTrace->RandomSeed());
+                }
+            }
+            else
+            {
+                WriteTrace(TraceN64System, TraceWarning, "Sync trace can only be recorded with the recompiler");
+            }
+        }
+
         Reset(true, true);
 
         if (CpuType == CPU_Recompiler || CpuType == CPU_SyncCores)
@@ -135,6 +163,16 @@ CN64System::~CN64System()
         delete m_Recomp;
         m_Recomp = nullptr;
     }
+    if (m_Snapshots)
+    {
+        delete m_Snapshots;
+        m_Snapshots = nullptr;
+    }
+    if (m_SyncTrace)
+    {
+        delete m_SyncTrace;
+        m_SyncTrace = nullptr;
+    }
     if (m_SyncPlugins)
     {
         delete m_SyncPlugins;
@@ -224,6 +262,8 @@ void CN64System::ExternalEvent(SystemEvent action)
     case SysEvent_ExecuteInterrupt:
     case SysEvent_SaveMachineState:
     case SysEvent_LoadMachineState:
+    case SysEvent_SaveSnapshot:
+    case SysEvent_LoadSnapshot:
     case SysEvent_ChangingFullScreen:
     case SysEvent_GSButtonPressed:
     case SysEvent_ResetCPU_SoftDone:
@@ -867,6 +907,7 @@ void CN64System::PluginReset()
     {
         m_Recomp->Reset();
     }
+    m_OpCodes.ResetDecodedCode();
     m_Plugins->RomOpened();
     if (m_SyncCPU)
     {
@@ -900,6 +941,10 @@ void CN64System::Reset(bool bInitReg, bool ClearMenory)
 
     m_CyclesToSkip = 0;
     m_SyncCount = 0;
+    if (m_Snapshots)
+    {
+        m_Snapshots->Clear();
+    }
 
     for (int i = 0, n = (sizeof(m_LastSuccessSyncPC) / sizeof(m_LastSuccessSyncPC[0])); i < n; i++)
     {
@@ -928,6 +973,7 @@ void CN64System::Reset(bool bInitReg, bool ClearMenory)
     {
         m_Recomp->Reset();
     }
+    m_OpCodes.ResetDecodedCode();
     if (m_Plugins && g_Settings->LoadBool(GameRunning_CPU_Running))
     {
         m_Plugins->RomClosed();
@@ -957,6 +1003,11 @@ bool CN64System::SetActiveSystem(bool bActive)
         if (g_BaseSystem == this)
         {
             g_SyncSystem = m_SyncCPU;
+            if (m_SyncTrace != nullptr && m_SyncTrace->Mode() == CSyncTrace::Trace_Record)
+            {
+                // The recompiler only emits the sync calls when there is a sync system
+                g_SyncSystem = this;
+            }
         }
         g_Recompiler = m_Recomp;
         g_MMU = &m_MMU_VM;
@@ -1022,11 +1073,19 @@ void CN64System::ExecuteCPU()
         cpuType = (CPU_TYPE)g_Settings->LoadDword(Game_CpuType);
     }
 
-    switch (cpuType)
+    if (m_SyncTrace != nullptr && m_SyncTrace->Mode() == CSyncTrace::Trace_Replay)
     {
-    case CPU_Recompiler: ExecuteRecompiler(); break;
-    case CPU_SyncCores: ExecuteSyncCPU(); break;
-    default: ExecuteInterpret(); break;
+        m_SyncTrace->Replay();
+    }
+    else
+    {
+        switch (cpuType)
+        {
+        case CPU_Recompiler: ExecuteRecompiler(); break;
+        case CPU_SyncCores: ExecuteSyncCPU(); break;
+        case CPU_CachedInterpreter: ExecuteCachedInterpret(); break;
+        default: ExecuteInterpret(); break;
+        }
     }
     WriteTrace(TraceN64System, TraceDebug, "CPU finished executing");
     CpuStopped();
@@ -1051,6 +1110,12 @@ void CN64System::ExecuteInterpret()
     m_OpCodes.ExecuteOps((uint32_t)-1);
 }
 
+void CN64System::ExecuteCachedInterpret()
+{
+    SetActiveSystem();
+    m_OpCodes.ExecuteCachedOps((uint32_t)-1);
+}
+
 void CN64System::ExecuteRecompiler()
 {
     m_Recomp->Run();
@@ -1078,6 +1143,11 @@ void CN64System::CpuStopped()
 
 void CN64System::UpdateSyncCPU(uint32_t const Cycles)
 {
+    if (m_SyncTrace != nullptr)
+    {
+        m_SyncTrace->AddCycles(Cycles);
+        return;
+    }
     if (m_SyncCPU == nullptr)
     {
         return;
@@ -1104,6 +1174,12 @@ void CN64System::UpdateSyncCPU(uint32_t const Cycles)
 
 void CN64System::SyncSystemPC(void)
 {
+    if (m_SyncTrace != nullptr)
+    {
+        g_SystemTimer->UpdateTimers();
+        m_SyncTrace->RecordSync(true);
+        return;
+    }
     if (m_SyncCPU == nullptr)
     {
         return;
@@ -1143,6 +1219,12 @@ void CN64System::SyncSystemPC(void)
 
 void CN64System::SyncSystem()
 {
+    if (m_SyncTrace != nullptr)
+    {
+        g_SystemTimer->UpdateTimers();
+        m_SyncTrace->RecordSync(false);
+        return;
+    }
     if (m_SyncCPU == nullptr)
     {
         return;
@@ -1641,7 +1723,21 @@ bool CN64System::SaveState()
     uint32_t RdramSize = m_MMU_VM.RdramSize();
     uint32_t MiInterReg = g_Reg->MI_INTR_REG;
     uint32_t NextViTimer = m_SystemTimer.GetTimer(CSystemTimer::ViTimer);
-    if (g_Settings->LoadDword(Setting_AutoZipInstantSave))
+    bool FastSaveState = g_Settings->LoadBool(Setting_FastSaveStates);
+    if (FastSaveState)
+    {
+        WriteTrace(TraceN64System, TraceDebug, "SaveFile: %s (fast)", (const char *)SaveFile);
+        ZipFile.Delete();
+        ExtraInfo.Delete();
+        if (!SaveFastState(SaveFile, NextViTimer))
+        {
+            g_Notify->DisplayError(GS(MSG_FAIL_OPEN_SAVE));
+            m_Reg.MI_INTR_REG = MiInterReg;
+            WriteTrace(TraceN64System, TraceDebug, "Done - Failed to write");
+            return true;
+        }
+    }
+    else if (g_Settings->LoadDword(Setting_AutoZipInstantSave))
     {
         ZipFile.Delete();
         zipFile file = zipOpen(ZipFile, 0);
@@ -1769,7 +1865,7 @@ bool CN64System::SaveState()
     m_Reg.MI_INTR_REG = MiInterReg;
     g_Settings->SaveString(GameRunning_InstantSaveFile, "");
     g_Settings->SaveDword(Game_LastSaveTime, (uint32_t)time(nullptr));
-    if (g_Settings->LoadDword(Setting_AutoZipInstantSave))
+    if (!FastSaveState && g_Settings->LoadDword(Setting_AutoZipInstantSave))
     {
         SaveFile = ZipFile;
     }
@@ -1807,6 +1903,13 @@ bool CN64System::LoadState()
         FileName.SetNameExtension(stdstr_f("%s.pj", g_Settings->LoadStringVal(Rdb_GoodName).c_str()).c_str());
     }
 
+    if (FileName.Exists() && IsFastSaveState(FileName))
+    {
+        bool Result = LoadState(FileName);
+        WriteTrace(TraceN64System, TraceDebug, "Done (res: %s)", Result ? "True" : "False");
+        return Result;
+    }
+
     CPath ZipFileName;
     ZipFileName = (const std::string &)FileName + ".zip";
 
@@ -1860,7 +1963,12 @@ bool CN64System::LoadState(const char * FileName)
 
     CPath SaveFile(FileName);
 
-    if (g_Settings->LoadDword(Setting_AutoZipInstantSave) || _stricmp(SaveFile.GetExtension().c_str(), ".zip") == 0)
+    bool LoadedFastState = SaveFile.Exists() && IsFastSaveState(SaveFile);
+    if (LoadedFastState && !LoadFastState(SaveFile, NextVITimer))
+    {
+        return false;
+    }
+    if (!LoadedFastState && (g_Settings->LoadDword(Setting_AutoZipInstantSave) || _stricmp(SaveFile.GetExtension().c_str(), ".zip") == 0))
     {
         // If zipping save add .zip on the end
         if (!SaveFile.Exists() && _stricmp(SaveFile.GetExtension().c_str(), ".zip") != 0)
@@ -1868,8 +1976,13 @@ bool CN64System::LoadState(const char * FileName)
             SaveFile.SetNameExtension(stdstr_f("%s.zip", SaveFile.GetNameExtension().c_str()).c_str());
         }
         zlib_filefunc64_def ffunc;
+#ifdef _WIN32
         fill_win32_filefunc64W(&ffunc);
         unzFile file = unzOpen2_64(stdstr(std::string(SaveFile)).ToUTF16().c_str(), &ffunc);
+#else
+        fill_fopen64_filefunc(&ffunc);
+        unzFile file = unzOpen2_64((const char *)SaveFile, &ffunc);
+#endif
         int port = -1;
         if (file != nullptr)
         {
@@ -2023,7 +2136,7 @@ bool CN64System::LoadState(const char * FileName)
         }
         unzClose(file);
     }
-    if (!LoadedZipFile)
+    if (!LoadedFastState && !LoadedZipFile)
     {
         CFile hSaveFile(SaveFile, CFileBase::modeRead);
         if (!hSaveFile.IsOpen())
@@ -2235,6 +2348,295 @@ bool CN64System::LoadState(const char * FileName)
     return true;
 }
 
+bool CN64System::IsFastSaveState(const CPath & SaveFile) const
+{
+    CFile hSaveFile(SaveFile, CFileBase::modeRead);
+    uint32_t SaveID = 0;
+    return hSaveFile.IsOpen() && hSaveFile.Read(&SaveID, sizeof(SaveID)) == sizeof(SaveID) && SaveID == SaveID_3;
+}
+
+bool CN64System::SaveFastState(const CPath & SaveFile, uint32_t NextViTimer)
+{
+    bool Compress = g_Settings->LoadBool(Setting_AutoZipInstantSave);
+    uint32_t RdramSize = m_MMU_VM.RdramSize();
+    CSaveStateChunks Rdram(m_MMU_VM.Rdram(), RdramSize);
+    if (Compress && !Rdram.Compress())
+    {
+        return false;
+    }
+
+    SaveFile.Delete();
+    CFile hSaveFile(SaveFile, CFileBase::modeWrite | CFileBase::modeCreate);
+    if (!hSaveFile.IsOpen())
+    {
+        return false;
+    }
+
+    SAVE_STATE_HEADER Header;
+    memset(&Header, 0, sizeof(Header));
+    Header.SaveID = SaveID_3;
+    Header.HeaderSize = sizeof(Header);
+    Header.RdramSize = RdramSize;
+    Header.RdramChunkSize = CSaveStateChunks::ChunkSize;
+    Header.RdramChunks = Rdram.Chunks();
+    Header.RdramCompressed = Compress ? 1 : 0;
+    if (EnableDisk() && g_Disk)
+    {
+        // Keep base ROM information (64DD IPL / compatible game ROM)
+        memcpy(Header.RomHeader, &g_Rom->GetRomAddress()[0x10], 0x20);
+        memcpy(&Header.RomHeader[0x20], g_Disk->GetDiskAddressID(), 0x20);
+    }
+    else
+    {
+        memcpy(Header.RomHeader, g_Rom->GetRomAddress(), 0x40);
+    }
+    hSaveFile.Write(&Header, sizeof(Header));
+
+    Header.MachineOffset = hSaveFile.GetPosition();
+    hSaveFile.Write(&NextViTimer, sizeof(uint32_t));
+    hSaveFile.Write(&m_Reg.m_PROGRAM_COUNTER, sizeof(int64_t));
+    hSaveFile.Write(m_Reg.m_GPR, sizeof(int64_t) * 32);
+    hSaveFile.Write(m_Reg.m_FPR, sizeof(int64_t) * 32);
+    hSaveFile.Write(m_Reg.m_CP0, sizeof(uint64_t) * 32);
+    hSaveFile.Write(m_Reg.m_FPCR, sizeof(uint32_t) * 32);
+    hSaveFile.Write(&m_Reg.m_HI, sizeof(int64_t));
+    hSaveFile.Write(&m_Reg.m_LO, sizeof(int64_t));
+    hSaveFile.Write(m_Reg.m_RDRAM_Registers, sizeof(uint32_t) * 10);
+    hSaveFile.Write(m_Reg.m_SigProcessor_Interface, sizeof(uint32_t) * 10);
+    hSaveFile.Write(m_Reg.m_Display_ControlReg, sizeof(uint32_t) * 10);
+    hSaveFile.Write(m_Reg.m_Mips_Interface, sizeof(uint32_t) * 4);
+    hSaveFile.Write(m_Reg.m_Video_Interface, sizeof(uint32_t) * 14);
+    hSaveFile.Write(m_Reg.m_Audio_Interface, sizeof(uint32_t) * 6);
+    hSaveFile.Write(m_Reg.m_Peripheral_Interface, sizeof(uint32_t) * 13);
+    hSaveFile.Write(m_Reg.m_RDRAM_Interface, sizeof(uint32_t) * 8);
+    hSaveFile.Write(m_Reg.m_SerialInterface, sizeof(uint32_t) * 4);
+    hSaveFile.Write(m_Reg.m_DiskInterface, sizeof(uint32_t) * 22);
+    hSaveFile.Write(&m_TLB.TlbEntry(0), sizeof(TLB_ENTRY) * 32);
+    hSaveFile.Write(m_MMU_VM.PifRam().PifRam(), 0x40);
+    hSaveFile.Write(m_MMU_VM.Dmem(), 0x1000);
+    hSaveFile.Write(m_MMU_VM.Imem(), 0x1000);
+    Header.MachineSize = hSaveFile.GetPosition() - Header.MachineOffset;
+
+    Header.TimerOffset = hSaveFile.GetPosition();
+    m_SystemTimer.SaveData(hSaveFile);
+    Header.TimerSize = hSaveFile.GetPosition() - Header.TimerOffset;
+
+    uint32_t TableEnd = hSaveFile.GetPosition();
+    if (Compress)
+    {
+        Header.ChunkTableOffset = TableEnd;
+        hSaveFile.Write(Rdram.Table(), sizeof(SAVE_STATE_CHUNK) * Rdram.Chunks());
+        TableEnd = hSaveFile.GetPosition();
+    }
+
+    // RDRAM starts on a page boundary so a raw state can be mapped straight from the file
+    Header.RdramOffset = (TableEnd + 0xFFF) & ~0xFFF;
+    static const uint8_t Padding[0x1000] = {0};
+    hSaveFile.Write(Padding, Header.RdramOffset - TableEnd);
+    if (Compress)
+    {
+        for (uint32_t i = 0; i < Rdram.Chunks(); i++)
+        {
+            hSaveFile.Write(Rdram.ChunkData(i), Rdram.Table()[i].Length);
+        }
+    }
+    else
+    {
+        hSaveFile.Write(m_MMU_VM.Rdram(), RdramSize);
+    }
+
+    hSaveFile.Seek(0, CFileBase::begin);
+    hSaveFile.Write(&Header, sizeof(Header));
+    hSaveFile.Close();
+#if defined(ANDROID)
+    utimes((const char *)SaveFile, nullptr);
+#endif
+    return true;
+}
+
+static bool FastStateBlockInFile(uint32_t Offset, uint32_t Length, uint32_t FileLength)
+{
+    return Offset <= FileLength && Length <= FileLength - Offset;
+}
+
+static void ReadFastStateBlock(const uint8_t *& Pos, void * Dest, uint32_t Length)
+{
+    memcpy(Dest, Pos, Length);
+    Pos += Length;
+}
+
+bool CN64System::LoadFastState(const CPath & SaveFile, uint32_t & NextVITimer)
+{
+    CFile hSaveFile(SaveFile, CFileBase::modeRead);
+    if (!hSaveFile.IsOpen())
+    {
+        g_Notify->DisplayMessage(3, stdstr_f("%s %s", GS(MSG_UNABLED_LOAD_STATE), (const char *)SaveFile).c_str());
+        return false;
+    }
+
+    // Sizes of the blocks as written by SaveFastState
+    const uint32_t MachineSize = sizeof(uint32_t) + sizeof(int64_t) * (1 + 32 + 32 + 32 + 1 + 1) +
+                                 sizeof(uint32_t) * (32 + 10 + 10 + 10 + 4 + 14 + 6 + 13 + 8 + 4 + 22) +
+                                 sizeof(TLB_ENTRY) * 32 + 0x40 + 0x1000 + 0x1000;
+    const uint32_t TimerFixedSize = sizeof(uint32_t) * 2 + sizeof(int32_t) * 2 + sizeof(CSystemTimer::TimerType);
+
+    uint32_t FileLength = hSaveFile.GetLength();
+    SAVE_STATE_HEADER Header;
+    if (hSaveFile.Read(&Header, sizeof(Header)) != sizeof(Header) || Header.SaveID != SaveID_3 || Header.HeaderSize != sizeof(Header))
+    {
+        return false;
+    }
+    if (Header.RdramSize == 0 || Header.RdramSize > m_MMU_VM.RdramSize() || Header.RdramChunkSize != CSaveStateChunks::ChunkSize ||
+        Header.RdramChunks != (Header.RdramSize + CSaveStateChunks::ChunkSize - 1) / CSaveStateChunks::ChunkSize || Header.RdramCompressed > 1 ||
+        Header.MachineSize != MachineSize || !FastStateBlockInFile(Header.MachineOffset, Header.MachineSize, FileLength) ||
+        Header.TimerSize < TimerFixedSize || !FastStateBlockInFile(Header.TimerOffset, Header.TimerSize, FileLength) ||
+        (Header.RdramCompressed != 0 && (!FastStateBlockInFile(Header.ChunkTableOffset, sizeof(SAVE_STATE_CHUNK) * Header.RdramChunks, FileLength) || Header.RdramOffset > FileLength)) ||
+        (Header.RdramCompressed == 0 && !FastStateBlockInFile(Header.RdramOffset, Header.RdramSize, FileLength)))
+    {
+        WriteTrace(TraceN64System, TraceError, "Invalid save state layout (RDRAM size: 0x%X chunks: %d machine: 0x%X/0x%X timer: 0x%X/0x%X file length: 0x%X)", Header.RdramSize, Header.RdramChunks, Header.MachineOffset, Header.MachineSize, Header.TimerOffset, Header.TimerSize, FileLength);
+        g_Notify->DisplayMessage(3, stdstr_f("%s %s", GS(MSG_UNABLED_LOAD_STATE), (const char *)SaveFile).c_str());
+        return false;
+    }
+
+    if (EnableDisk() && g_Disk)
+    {
+        // Base ROM information (64DD IPL / compatible game ROM) and disk info check
+        if ((memcmp(Header.RomHeader, &g_Rom->GetRomAddress()[0x10], 0x20) != 0 ||
+             memcmp(&Header.RomHeader[0x20], g_Disk->GetDiskAddressID(), 0x20) != 0) &&
+            !g_Notify->AskYesNoQuestion(g_Lang->GetString(MSG_SAVE_STATE_HEADER).c_str()))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if (memcmp(Header.RomHeader, g_Rom->GetRomAddress(), 0x40) != 0 &&
+            !g_Notify->AskYesNoQuestion(g_Lang->GetString(MSG_SAVE_STATE_HEADER).c_str()))
+        {
+            return false;
+        }
+    }
+
+    // Everything is read and checked before the system is reset, a damaged file then leaves the running game alone.
+    // Raw RDRAM has been bounds checked against the file and is read straight into RDRAM after the reset
+    std::vector<uint8_t> Machine(MachineSize);
+    hSaveFile.Seek(Header.MachineOffset, CFileBase::begin);
+    bool Valid = hSaveFile.Read(Machine.data(), MachineSize) == MachineSize;
+
+    uint32_t TimerDetailsSize = 0, TimerEntries = 0;
+    hSaveFile.Seek(Header.TimerOffset, CFileBase::begin);
+    Valid = Valid && hSaveFile.Read(&TimerDetailsSize, sizeof(TimerDetailsSize)) == sizeof(TimerDetailsSize) &&
+            hSaveFile.Read(&TimerEntries, sizeof(TimerEntries)) == sizeof(TimerEntries) &&
+            TimerDetailsSize == sizeof(CSystemTimer::TIMER_DETAILS) && TimerEntries <= CSystemTimer::MaxTimer &&
+            Header.TimerSize == TimerFixedSize + TimerEntries * TimerDetailsSize;
+
+    std::vector<uint8_t> Rdram;
+    if (Valid && Header.RdramCompressed != 0)
+    {
+        Rdram.resize(Header.RdramSize);
+        std::vector<SAVE_STATE_CHUNK> Table(Header.RdramChunks);
+        uint32_t TableSize = sizeof(SAVE_STATE_CHUNK) * Header.RdramChunks;
+        hSaveFile.Seek(Header.ChunkTableOffset, CFileBase::begin);
+        Valid = hSaveFile.Read(Table.data(), TableSize) == TableSize;
+
+        std::vector<uint8_t> Compressed(FileLength - Header.RdramOffset);
+        hSaveFile.Seek(Header.RdramOffset, CFileBase::begin);
+        Valid = Valid && hSaveFile.Read(Compressed.data(), (uint32_t)Compressed.size()) == Compressed.size();
+
+        CSaveStateChunks Chunks(Rdram.data(), Header.RdramSize);
+        Valid = Valid && Chunks.Decompress(Compressed.data(), (uint32_t)Compressed.size(), Table.data());
+    }
+    if (!Valid)
+    {
+        WriteTrace(TraceN64System, TraceError, "Failed to read save state");
+        g_Notify->DisplayMessage(3, stdstr_f("%s %s", GS(MSG_UNABLED_LOAD_STATE), (const char *)SaveFile).c_str());
+        return false;
+    }
+
+    Reset(false, true);
+    g_Settings->SaveDword(Game_RDRamSize, Header.RdramSize);
+
+    const uint8_t * Pos = Machine.data();
+    ReadFastStateBlock(Pos, &NextVITimer, sizeof(NextVITimer));
+    uint64_t ReadProgramCounter;
+    ReadFastStateBlock(Pos, &ReadProgramCounter, sizeof(ReadProgramCounter));
+    m_Reg.m_PROGRAM_COUNTER = (int32_t)ReadProgramCounter;
+    ReadFastStateBlock(Pos, m_Reg.m_GPR, sizeof(int64_t) * 32);
+    ReadFastStateBlock(Pos, m_Reg.m_FPR, sizeof(int64_t) * 32);
+    ReadFastStateBlock(Pos, m_Reg.m_CP0, sizeof(uint64_t) * 32);
+    ReadFastStateBlock(Pos, m_Reg.m_FPCR, sizeof(uint32_t) * 32);
+    ReadFastStateBlock(Pos, &m_Reg.m_HI, sizeof(int64_t));
+    ReadFastStateBlock(Pos, &m_Reg.m_LO, sizeof(int64_t));
+    ReadFastStateBlock(Pos, m_Reg.m_RDRAM_Registers, sizeof(uint32_t) * 10);
+    ReadFastStateBlock(Pos, m_Reg.m_SigProcessor_Interface, sizeof(uint32_t) * 10);
+    ReadFastStateBlock(Pos, m_Reg.m_Display_ControlReg, sizeof(uint32_t) * 10);
+    ReadFastStateBlock(Pos, m_Reg.m_Mips_Interface, sizeof(uint32_t) * 4);
+    ReadFastStateBlock(Pos, m_Reg.m_Video_Interface, sizeof(uint32_t) * 14);
+    ReadFastStateBlock(Pos, m_Reg.m_Audio_Interface, sizeof(uint32_t) * 6);
+    ReadFastStateBlock(Pos, m_Reg.m_Peripheral_Interface, sizeof(uint32_t) * 13);
+    ReadFastStateBlock(Pos, m_Reg.m_RDRAM_Interface, sizeof(uint32_t) * 8);
+    ReadFastStateBlock(Pos, m_Reg.m_SerialInterface, sizeof(uint32_t) * 4);
+    ReadFastStateBlock(Pos, m_Reg.m_DiskInterface, sizeof(uint32_t) * 22);
+    ReadFastStateBlock(Pos, (void *)&m_TLB.TlbEntry(0), sizeof(TLB_ENTRY) * 32);
+    ReadFastStateBlock(Pos, m_MMU_VM.PifRam().PifRam(), 0x40);
+    ReadFastStateBlock(Pos, m_MMU_VM.Dmem(), 0x1000);
+    ReadFastStateBlock(Pos, m_MMU_VM.Imem(), 0x1000);
+
+    // Recover disk seek address (if the save state is done while loading/saving data)
+    if (g_Disk)
+    {
+        DiskBMReadWrite(false);
+    }
+
+    // The timer block has been checked above, so this can not fail part way through
+    hSaveFile.Seek(Header.TimerOffset, CFileBase::begin);
+    m_SystemTimer.LoadData(hSaveFile);
+    if (Header.RdramCompressed != 0)
+    {
+        memcpy(m_MMU_VM.Rdram(), Rdram.data(), Header.RdramSize);
+    }
+    else
+    {
+        hSaveFile.Seek(Header.RdramOffset, CFileBase::begin);
+        if (hSaveFile.Read(m_MMU_VM.Rdram(), Header.RdramSize) != Header.RdramSize)
+        {
+            WriteTrace(TraceN64System, TraceError, "Failed to read RDRAM from save state");
+            g_Notify->DisplayMessage(3, stdstr_f("%s %s", GS(MSG_UNABLED_LOAD_STATE), (const char *)SaveFile).c_str());
+            return false;
+        }
+    }
+    hSaveFile.Close();
+    return true;
+}
+
+bool CN64System::SaveSnapshot()
+{
+    if (m_Snapshots == nullptr)
+    {
+        uint32_t DeltaPages = (g_Settings->LoadDword(Setting_RewindBufferSize) << 20) >> 12;
+        m_Snapshots = new CSnapshotRing(*this, g_Settings->LoadDword(Setting_RewindSnapshots), DeltaPages);
+    }
+    return m_Snapshots->Capture();
+}
+
+bool CN64System::LoadSnapshot(uint32_t StepsBack)
+{
+    WriteTrace(TraceN64System, TraceDebug, "Start (StepsBack: %d)", StepsBack);
+    if (m_Snapshots == nullptr || m_SyncCPU != nullptr)
+    {
+        WriteTrace(TraceN64System, TraceDebug, "Done - no snapshots to load");
+        return false;
+    }
+    if (!m_Snapshots->Restore(StepsBack))
+    {
+        WriteTrace(TraceN64System, TraceDebug, "Done - snapshot ring is empty");
+        return false;
+    }
+    NotifyCallback(CN64SystemCB_LoadedGameState);
+    WriteTrace(TraceN64System, TraceDebug, "Done (Snapshots left: %d)", m_Snapshots->Count());
+    return true;
+}
+
 uint32_t CN64System::GetButtons(int32_t Control) const
 {
     CControl_Plugin::fnGetKeys GetKeys = m_Plugins->Control()->GetKeys;
@@ -2397,6 +2799,15 @@ void CN64System::RefreshScreen()
     {
         g_Enhancements->ApplyActive(m_MMU_VM, g_BaseSystem->m_Plugins, !m_SyncSystem);
     }
+    m_ViCount += 1;
+    if (m_ViLimit != 0 && m_ViCount == m_ViLimit)
+    {
+        m_SystemEvents.QueueEvent(SysEvent_CloseCPU);
+    }
+    if (m_RewindInterval != 0 && (m_ViCount % m_RewindInterval) == 0)
+    {
+        m_SystemEvents.QueueEvent(SysEvent_SaveSnapshot);
+    }
     //    if (bProfiling)    { m_Profile.StartTimer(ProfilingAddr != Timer_None ? ProfilingAddr : Timer_R4300); }
 }
 
@@ -3,6 +3,7 @@
 #include <Common/Random.h>
 #include <Common/SyncEvent.h>
 #include <Common/Thread.h>
+#include <Common/path.h>
 #include <Project64-core/Logging.h>
 #include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
 #include <Project64-core/N64System/Mips/Mempak.h>
@@ -16,7 +17,10 @@
 
 #include "FramePerSecond.h"
 #include "Mips/TLB.h"
+#include "SaveStateFile.h"
+#include "SnapshotRing.h"
 #include "SpeedLimiter.h"
+#include "SyncTrace.h"
 
 typedef std::list<SystemEvent> EVENT_LIST;
 
@@ -97,6 +101,8 @@ public:
     bool SaveState();
     bool LoadState(const char * FileName);
     bool LoadState();
+    bool SaveSnapshot();
+    bool LoadSnapshot(uint32_t StepsBack);
     uint32_t GetButtons(int32_t Control) const;
 
     // Variable used to track that the SP is being handled and stays the same as the real SP in sync core
@@ -112,6 +118,10 @@ public:
     {
         return m_Plugins;
     }
+    const CSyncTrace * SyncTrace() const
+    {
+        return m_SyncTrace;
+    }
     PIPELINE_STAGE PipelineStage() const
     {
         return m_PipelineStage;
@@ -121,6 +131,28 @@ public:
         return m_JumpToLocation;
     }
 
+    // End emulation once this many VI refreshes have been processed, 0 runs without limit
+    void SetViLimit(uint32_t ViLimit)
+    {
+        m_ViLimit = ViLimit;
+    }
+    uint32_t ViCount() const
+    {
+        return m_ViCount;
+    }
+    const CProfiling & CPU_Usage() const
+    {
+        return m_CPU_Usage;
+    }
+    const CSystemTimer & SystemTimer() const
+    {
+        return m_SystemTimer;
+    }
+    uint64_t RecompiledBytes() const
+    {
+        return m_Recomp != nullptr ? m_Recomp->CompiledBytes() : 0;
+    }
+
 private:
     struct SETTING_CHANGED_CB
     {
@@ -140,14 +172,19 @@ private:
     friend class CRecompiler;
     friend class CRecompilerOpsBase;
     friend class CX86RecompilerOps;
+    friend class CX64RecompilerOps;
     friend class CArmRecompilerOps;
+    friend class CAarch64RecompilerOps;
     friend class CCodeBlock;
     friend class CMipsMemoryVM;
     friend class R4300iOp;
     friend class CSystemEvents;
     friend class VideoInterfaceHandler;
     friend class PifRamHandler;
+    friend class PeripheralInterfaceHandler;
     friend class CRegisters;
+    friend class CSnapshotRing;
+    friend class CSyncTrace;
 
     // Used for loading and potentially executing the CPU in its own thread
     static void StartEmulationThread(CThread * thread);
@@ -166,11 +203,17 @@ private:
     // CPU methods
     void ExecuteRecompiler();
     void ExecuteInterpret();
+    void ExecuteCachedInterpret();
     void ExecuteSyncCPU();
 
     // Mark information saying that the CPU has stopped
     void CpuStopped();
 
+    // Save states in the fast container (SaveID_3)
+    bool IsFastSaveState(const CPath & SaveFile) const;
+    bool SaveFastState(const CPath & SaveFile, uint32_t NextViTimer);
+    bool LoadFastState(const CPath & SaveFile, uint32_t & NextVITimer);
+
     // Functions in CTLB_CB
     void TLB_Unmaped(uint32_t VAddr, uint32_t Len);
 
@@ -193,6 +236,11 @@ private:
     int32_t m_NextTimer;
     CSystemTimer m_SystemTimer;
     bool m_bCleanFrameBox;
+    uint32_t m_ViCount;
+    uint32_t m_ViLimit;
+    uint32_t m_RewindInterval;
+    CSnapshotRing * m_Snapshots;
+    CSyncTrace * m_SyncTrace;
     uint32_t m_Buttons[4];
     bool m_TestTimer;
     PIPELINE_STAGE m_PipelineStage;
@@ -222,4 +270,5 @@ private:
     const uint32_t SaveID_0_1 = 0x25EF3FAC; // Main save state info (*.pj)
     const uint32_t SaveID_1 = 0x56D2CD23;   // Extra data v1 (system timing) info (*.dat)
     const uint32_t SaveID_2 = 0x750A6BEB;   // Extra data v2 (timing + disk registers) (*.dat)
+    const uint32_t SaveID_3 = 0x4F1B82D7;   // Fast save state, single file with section offsets (*.pj)
 };
@@ -34,7 +34,8 @@ enum CPU_TYPE
     CPU_Default = -1,
     CPU_Interpreter = 1,
     CPU_Recompiler = 2,
-    CPU_SyncCores = 3
+    CPU_SyncCores = 3,
+    CPU_CachedInterpreter = 4
 };
 
 enum FRAMERATE_TYPE
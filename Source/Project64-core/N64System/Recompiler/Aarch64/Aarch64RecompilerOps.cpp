@@ -1,12 +1,95 @@
 #include "stdafx.h"
+
 #if defined(__aarch64__)
 
+#include <Project64-core/Debugger.h>
+#include <Project64-core/N64System/Interpreter/InterpreterOps.h>
+#include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
+#include <Project64-core/N64System/Mips/R4300iInstruction.h>
+#include <Project64-core/N64System/N64System.h>
 #include <Project64-core/N64System/Recompiler/Aarch64/Aarch64RecompilerOps.h>
-#include <Project64-core/Notification.h>
-
-CAarch64RecompilerOps::CAarch64RecompilerOps(CMipsMemoryVM & /*MMU*/, CCodeBlock & CodeBlock) :
+#include <Project64-core/N64System/Recompiler/CodeSection.h>
+#include <Project64-core/N64System/Recompiler/Recompiler.h>
+#include <Project64-core/N64System/Recompiler/SectionInfo.h>
+#include <Project64-core/N64System/SystemGlobals.h>
+#include <stdio.h>
+
+uint32_t CAarch64RecompilerOps::m_TempValue32 = 0;
+uint64_t CAarch64RecompilerOps::m_TempValue64 = 0;
+
+void CAarch64RecompilerOps::Aarch64CompilerBreakPoint()
+{
+    g_Settings->SaveBool(Debugger_SteppingOps, true);
+    do
+    {
+        g_Debugger->WaitForStep();
+        if (CDebugSettings::SkipOp())
+        {
+            // Skip command if instructed by the debugger
+            g_Settings->SaveBool(Debugger_SkipOp, false);
+            g_Reg->m_PROGRAM_COUNTER += 4;
+
+            uint32_t OpcodeValue;
+            if (!g_MMU->MemoryValue32((uint32_t)g_Reg->m_PROGRAM_COUNTER, OpcodeValue))
+            {
+                g_Reg->TriggerAddressException(g_Reg->m_PROGRAM_COUNTER, EXC_RMISS);
+                g_Reg->m_PROGRAM_COUNTER = g_System->JumpToLocation();
+                g_System->m_PipelineStage = PIPELINE_STAGE_NORMAL;
+                continue;
+            }
+            continue;
+        }
+        g_System->m_OpCodes.ExecuteOps(g_System->CountPerOp());
+        if (g_SyncSystem)
+        {
+            g_System->UpdateSyncCPU(g_System->CountPerOp());
+            g_System->SyncSystem();
+        }
+
+    } while (CDebugSettings::isStepping());
+
+    if (g_System->PipelineStage() != PIPELINE_STAGE_NORMAL)
+    {
+        g_System->m_OpCodes.ExecuteOps(g_System->CountPerOp());
+        if (g_SyncSystem)
+        {
+            g_System->UpdateSyncCPU(g_System->CountPerOp());
+            g_System->SyncSystem();
+        }
+    }
+}
+
+void CAarch64RecompilerOps::Aarch64BreakPointDelaySlot()
+{
+    g_System->m_OpCodes.ExecuteOps(g_System->CountPerOp());
+    if (g_SyncSystem)
+    {
+        g_System->UpdateSyncCPU(g_System->CountPerOp());
+        g_System->SyncSystem();
+    }
+    if (g_Debugger->ExecutionBP((uint32_t)g_Reg->m_PROGRAM_COUNTER))
+    {
+        Aarch64CompilerBreakPoint();
+    }
+    if (g_System->PipelineStage() != PIPELINE_STAGE_NORMAL)
+    {
+        g_System->m_OpCodes.ExecuteOps(g_System->CountPerOp());
+        if (g_SyncSystem)
+        {
+            g_System->UpdateSyncCPU(g_System->CountPerOp());
+            g_System->SyncSystem();
+        }
+    }
+}
+
+CAarch64RecompilerOps::CAarch64RecompilerOps(CN64System & m_System, CCodeBlock & CodeBlock) :
+    CRecompilerOpsBase(m_System, CodeBlock),
     m_Assembler(CodeBlock),
-    m_RegWorkingSet(CodeBlock, m_Assembler)
+    m_PipelineStage(PIPELINE_STAGE_NORMAL),
+    m_CompilePC(m_Instruction.Address32()),
+    m_RegWorkingSet(CodeBlock, m_Assembler),
+    m_RegBeforeDelay(CodeBlock, m_Assembler),
+    m_EffectDelaySlot(false)
 {
 }
 
@@ -14,867 +97,2960 @@ CAarch64RecompilerOps::~CAarch64RecompilerOps()
 {
 }
 
-void CAarch64RecompilerOps::Compile_TrapCompare(RecompilerTrapCompare /*CompareType*/)
-{
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-}
-
-void CAarch64RecompilerOps::Compile_BranchCompare(RecompilerBranchCompare /*CompareType*/)
-{
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-}
-
-void CAarch64RecompilerOps::Compile_Branch(RecompilerBranchCompare /*CompareType*/, bool /*Link*/)
+void CAarch64RecompilerOps::PreCompileOpcode(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_PipelineStage != PIPELINE_STAGE_DELAY_SLOT_DONE)
+    {
+        m_CodeBlock.Log("  %X %s", (uint32_t)m_CompilePC, m_Instruction.NameAndParam().c_str());
+    }
 }
 
-void CAarch64RecompilerOps::Compile_BranchLikely(RecompilerBranchCompare /*CompareType*/, bool /*Link*/)
+void CAarch64RecompilerOps::PostCompileOpcode(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() + g_System->CountPerOp());
+    if (!g_System->bRegCaching())
+    {
+        m_RegWorkingSet.WriteBackRegisters();
+    }
+}
+
+bool CAarch64RecompilerOps::IsConstGPR(int32_t MipsReg) const
+{
+    return MipsReg == 0 || m_RegWorkingSet.IsConst(MipsReg);
+}
+
+int64_t CAarch64RecompilerOps::ConstCompareValue(int32_t MipsReg) const
+{
+    return (int64_t)m_RegWorkingSet.GetConstValue(MipsReg);
+}
+
+void CAarch64RecompilerOps::CompareGPR(int32_t MipsReg1, int32_t MipsReg2)
+{
+    // Every GPR is held sign extended in memory, so a 64-bit compare is also correct for 32-bit values
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, MipsReg1);
+    if (IsConstGPR(MipsReg2))
+    {
+        m_Assembler.CompConstToReg(asmjit::a64::x9, ConstCompareValue(MipsReg2));
+    }
+    else
+    {
+        m_RegWorkingSet.Map_TempReg(asmjit::a64::x10, MipsReg2);
+        m_Assembler.cmp(asmjit::a64::x9, asmjit::a64::x10);
+    }
+}
+
+void CAarch64RecompilerOps::BranchOnConst(bool Taken)
+{
+    m_Section->m_Jump.FallThrough = Taken;
+    m_Section->m_Cont.FallThrough = !Taken;
+}
+
+void CAarch64RecompilerOps::BranchOnCompare(BranchFunc JumpBranch, BranchFunc ContBranch)
+{
+    if (m_Section->m_Jump.FallThrough)
+    {
+        m_Section->m_Cont.LinkLocation = m_Assembler.newLabel();
+        (m_Assembler.*ContBranch)(m_Section->m_Cont.BranchLabel.c_str(), m_Section->m_Cont.LinkLocation);
+    }
+    else if (m_Section->m_Cont.FallThrough)
+    {
+        m_Section->m_Jump.LinkLocation = m_Assembler.newLabel();
+        (m_Assembler.*JumpBranch)(m_Section->m_Jump.BranchLabel.c_str(), m_Section->m_Jump.LinkLocation);
+    }
+    else
+    {
+        m_Section->m_Cont.LinkLocation = m_Assembler.newLabel();
+        (m_Assembler.*ContBranch)(m_Section->m_Cont.BranchLabel.c_str(), m_Section->m_Cont.LinkLocation);
+        m_Section->m_Jump.LinkLocation = m_Assembler.newLabel();
+        m_Assembler.BLabel(m_Section->m_Jump.BranchLabel.c_str(), m_Section->m_Jump.LinkLocation);
+    }
+}
+
+void CAarch64RecompilerOps::MoveGPRToVariable64(int32_t MipsReg, void * Variable, const char * VariableName)
+{
+    if (IsConstGPR(MipsReg))
+    {
+        m_Assembler.MoveConst64ToVariable(Variable, VariableName, m_RegWorkingSet.GetConstValue(MipsReg));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, MipsReg);
+    if (b32BitCore())
+    {
+        m_Assembler.sxtw(asmjit::a64::x9, asmjit::a64::w9);
+    }
+    m_Assembler.MoveRegToVariable(Variable, VariableName, asmjit::a64::x9);
+}
+
+// Trap functions
+void CAarch64RecompilerOps::Compile_TrapCompare(RecompilerTrapCompare CompareType)
+{
+    uintptr_t FunctAddress = 0;
+    const char * FunctName = nullptr;
+    switch (CompareType)
+    {
+    case RecompilerTrapCompare_TEQ:
+        FunctAddress = AddressOf(&R4300iOp::SPECIAL_TEQ);
+        FunctName = "R4300iOp::SPECIAL_TEQ";
+        break;
+    case RecompilerTrapCompare_TNE:
+        FunctAddress = AddressOf(&R4300iOp::SPECIAL_TNE);
+        FunctName = "R4300iOp::SPECIAL_TNE";
+        break;
+    case RecompilerTrapCompare_TGE:
+        FunctAddress = AddressOf(&R4300iOp::SPECIAL_TGE);
+        FunctName = "R4300iOp::SPECIAL_TGE";
+        break;
+    case RecompilerTrapCompare_TGEU:
+        FunctAddress = AddressOf(&R4300iOp::SPECIAL_TGEU);
+        FunctName = "R4300iOp::SPECIAL_TGEU";
+        break;
+    case RecompilerTrapCompare_TLT:
+        FunctAddress = AddressOf(&R4300iOp::SPECIAL_TLT);
+        FunctName = "R4300iOp::SPECIAL_TLT";
+        break;
+    case RecompilerTrapCompare_TLTU:
+        FunctAddress = AddressOf(&R4300iOp::SPECIAL_TLTU);
+        FunctName = "R4300iOp::SPECIAL_TLTU";
+        break;
+    case RecompilerTrapCompare_TEQI:
+        FunctAddress = AddressOf(&R4300iOp::REGIMM_TEQI);
+        FunctName = "R4300iOp::REGIMM_TEQI";
+        break;
+    case RecompilerTrapCompare_TNEI:
+        FunctAddress = AddressOf(&R4300iOp::REGIMM_TNEI);
+        FunctName = "R4300iOp::REGIMM_TNEI";
+        break;
+    case RecompilerTrapCompare_TGEI:
+        FunctAddress = AddressOf(&R4300iOp::REGIMM_TGEI);
+        FunctName = "R4300iOp::REGIMM_TGEI";
+        break;
+    case RecompilerTrapCompare_TGEIU:
+        FunctAddress = AddressOf(&R4300iOp::REGIMM_TGEIU);
+        FunctName = "R4300iOp::REGIMM_TGEIU";
+        break;
+    case RecompilerTrapCompare_TLTI:
+        FunctAddress = AddressOf(&R4300iOp::REGIMM_TLTI);
+        FunctName = "R4300iOp::REGIMM_TLTI";
+        break;
+    case RecompilerTrapCompare_TLTIU:
+        FunctAddress = AddressOf(&R4300iOp::REGIMM_TLTIU);
+        FunctName = "R4300iOp::REGIMM_TLTIU";
+        break;
+    default:
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+
+    if (FunctName != nullptr && FunctAddress != 0)
+    {
+        CompileInterpreterOp(FunctAddress, FunctName, m_Opcode.rs, m_Opcode.rt, 0, false);
+    }
+    else
+    {
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+}
+
+void CAarch64RecompilerOps::Compile_BranchCompare(RecompilerBranchCompare CompareType)
+{
+    switch (CompareType)
+    {
+    case RecompilerBranchCompare_BEQ: BEQ_Compare(); break;
+    case RecompilerBranchCompare_BNE: BNE_Compare(); break;
+    case RecompilerBranchCompare_BLTZ: BLTZ_Compare(); break;
+    case RecompilerBranchCompare_BLEZ: BLEZ_Compare(); break;
+    case RecompilerBranchCompare_BGTZ: BGTZ_Compare(); break;
+    case RecompilerBranchCompare_BGEZ: BGEZ_Compare(); break;
+    case RecompilerBranchCompare_COP1BCF: COP1_BCF_Compare(); break;
+    case RecompilerBranchCompare_COP1BCT: COP1_BCT_Compare(); break;
+    default:
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+}
+
+void CAarch64RecompilerOps::Compile_Branch(RecompilerBranchCompare CompareType, bool Link)
+{
+    if (m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT)
+    {
+        Compile_BranchCompare(CompareType);
+        if (m_Section->m_Jump.FallThrough || (!m_Section->m_Cont.FallThrough && m_Section->m_Jump.LinkLocation.isValid()))
+        {
+            LinkJump(m_Section->m_Jump);
+            m_Assembler.MoveConst64ToVariable(&g_System->m_JumpDelayLocation, "System::m_JumpDelayLocation", (int32_t)(m_CompilePC + ((int16_t)m_Opcode.offset << 2) + 8));
+            if (m_Section->m_Cont.LinkLocation.isValid())
+            {
+                // jump to link
+                g_Notify->BreakPoint(__FILE__, __LINE__);
+            }
+        }
+
+        if (m_Section->m_Cont.FallThrough)
+        {
+            LinkJump(m_Section->m_Cont);
+            m_Assembler.MoveConst64ToVariable(&g_System->m_JumpDelayLocation, "System::m_JumpDelayLocation", (int32_t)(m_CompilePC + 8));
+            if (m_Section->m_Jump.LinkLocation.isValid())
+            {
+                // jump to link
+                g_Notify->BreakPoint(__FILE__, __LINE__);
+            }
+        }
+
+        if (m_Section->m_Jump.LinkLocation.isValid() || m_Section->m_Cont.LinkLocation.isValid())
+        {
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+        if (Link)
+        {
+            m_Assembler.MoveVariableToReg(asmjit::a64::x9, &g_System->m_JumpToLocation, "System::m_JumpToLocation");
+            m_Assembler.add(asmjit::a64::w9, asmjit::a64::w9, 4);
+            m_Assembler.sxtw(asmjit::a64::x9, asmjit::a64::w9);
+            m_RegWorkingSet.StoreGPR(31, asmjit::a64::x9);
+        }
+        OverflowDelaySlot(false);
+    }
+    else if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+    {
+        if (CompareType == RecompilerBranchCompare_COP1BCF || CompareType == RecompilerBranchCompare_COP1BCT)
+        {
+            CompileCop1Test();
+            m_Assembler.MoveVariableToReg(asmjit::a64::w10, &m_Reg.m_FPCR[31], "_FPCR[31]");
+            m_Assembler.MoveConst64ToReg(Aarch64ScratchReg.w(), (uint32_t)(~0x0003F000));
+            m_Assembler.and_(asmjit::a64::w10, asmjit::a64::w10, Aarch64ScratchReg.w());
+            m_Assembler.MoveRegToVariable(&m_Reg.m_FPCR[31], "_FPCR[31]", asmjit::a64::w10);
+        }
+        if (m_CompilePC + ((int16_t)m_Opcode.offset << 2) + 4 == m_CompilePC + 8 && (m_CompilePC & 0xFFC) != 0xFFC)
+        {
+            m_PipelineStage = PIPELINE_STAGE_DO_DELAY_SLOT;
+            return;
+        }
+
+        if ((m_CompilePC & 0xFFC) != 0xFFC)
+        {
+            R4300iOpcode DelaySlot;
+            m_EffectDelaySlot = g_MMU->MemoryValue32((uint32_t)(m_CompilePC + 4), DelaySlot.Value) && R4300iInstruction(m_CompilePC, m_Opcode.Value).DelaySlotEffectsCompare(DelaySlot.Value);
+        }
+        else
+        {
+            m_EffectDelaySlot = true;
+        }
+        m_Section->m_Jump.JumpPC = (uint32_t)m_CompilePC;
+        m_Section->m_Jump.TargetPC = (uint32_t)(m_CompilePC + ((int16_t)m_Opcode.offset << 2) + 4);
+        if (m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT)
+        {
+            m_Section->m_Jump.TargetPC += 4;
+            m_EffectDelaySlot = true;
+        }
+        if (m_Section->m_JumpSection != nullptr)
+        {
+            m_Section->m_Jump.BranchLabel = stdstr_f("Section_%d", m_Section->m_JumpSection->m_SectionID);
+        }
+        else
+        {
+            m_Section->m_Jump.BranchLabel = stdstr_f("Exit_%X_jump_%X", m_Section->m_EnterPC, m_Section->m_Jump.TargetPC);
+        }
+        m_Section->m_Jump.LinkLocation = asmjit::Label();
+        m_Section->m_Jump.LinkLocation2 = asmjit::Label();
+        m_Section->m_Jump.DoneDelaySlot = false;
+        m_Section->m_Cont.JumpPC = (uint32_t)m_CompilePC;
+        m_Section->m_Cont.TargetPC = (uint32_t)(m_CompilePC + 8);
+        if (m_Section->m_ContinueSection != nullptr)
+        {
+            m_Section->m_Cont.BranchLabel = stdstr_f("Section_%d", m_Section->m_ContinueSection->m_SectionID);
+        }
+        else
+        {
+            m_Section->m_Cont.BranchLabel = stdstr_f("Exit_%X_continue_%X", m_Section->m_EnterPC, m_Section->m_Cont.TargetPC);
+        }
+        m_Section->m_Cont.LinkLocation = asmjit::Label();
+        m_Section->m_Cont.LinkLocation2 = asmjit::Label();
+        m_Section->m_Cont.DoneDelaySlot = false;
+        if (m_Section->m_Jump.TargetPC < m_Section->m_Cont.TargetPC)
+        {
+            m_Section->m_Cont.FallThrough = false;
+            m_Section->m_Jump.FallThrough = true;
+        }
+        else
+        {
+            m_Section->m_Cont.FallThrough = true;
+            m_Section->m_Jump.FallThrough = false;
+        }
+
+        if (Link)
+        {
+            R4300iInstruction Instruction(m_CompilePC, m_Opcode.Value);
+            uint32_t ReadReg1, ReadReg2;
+            Instruction.ReadsGPR(ReadReg1, ReadReg2);
+
+            if (ReadReg1 != 31 && ReadReg2 != 31)
+            {
+                m_RegWorkingSet.UnMap_GPR(31, false);
+                m_RegWorkingSet.SetMipsRegLo(31, (uint32_t)m_CompilePC + 8);
+                m_RegWorkingSet.SetMipsRegState(31, CRegInfo::STATE_CONST_32_SIGN);
+            }
+            else
+            {
+                m_Section->m_Cont.LinkAddress = (uint32_t)(m_CompilePC + 8);
+                m_Section->m_Jump.LinkAddress = (uint32_t)(m_CompilePC + 8);
+            }
+        }
+        if (m_EffectDelaySlot)
+        {
+            if ((m_CompilePC & 0xFFC) != 0xFFC)
+            {
+                m_Section->m_Cont.BranchLabel = m_Section->m_ContinueSection != nullptr ? "Continue" : stdstr_f("ExitBlock_%X_Continue", m_Section->m_EnterPC);
+                m_Section->m_Jump.BranchLabel = m_Section->m_JumpSection != nullptr ? "Jump" : stdstr_f("ExitBlock_%X_Jump", m_Section->m_EnterPC);
+            }
+            else
+            {
+                m_Section->m_Cont.BranchLabel = "Continue";
+                m_Section->m_Jump.BranchLabel = "Jump";
+            }
+            if (m_Section->m_Jump.TargetPC != m_Section->m_Cont.TargetPC)
+            {
+                Compile_BranchCompare(CompareType);
+            }
+            if (!m_Section->m_Jump.FallThrough && !m_Section->m_Cont.FallThrough)
+            {
+                if (m_Section->m_Jump.LinkLocation.isValid())
+                {
+                    LinkJump(m_Section->m_Jump);
+                    m_Section->m_Jump.FallThrough = true;
+                }
+                else if (m_Section->m_Cont.LinkLocation.isValid())
+                {
+                    LinkJump(m_Section->m_Cont);
+                    m_Section->m_Cont.FallThrough = true;
+                }
+            }
+            if ((m_CompilePC & 0xFFC) == 0xFFC)
+            {
+                asmjit::Label DelayLinkLocation;
+                if (m_Section->m_Jump.FallThrough)
+                {
+                    if (m_Section->m_Jump.LinkLocation.isValid() || m_Section->m_Jump.LinkLocation2.isValid())
+                    {
+                        g_Notify->BreakPoint(__FILE__, __LINE__);
+                    }
+                    m_Assembler.MoveConst64ToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", (int32_t)m_Section->m_Jump.TargetPC);
+                }
+                else if (m_Section->m_Cont.FallThrough)
+                {
+                    if (m_Section->m_Cont.LinkLocation.isValid() || m_Section->m_Cont.LinkLocation2.isValid())
+                    {
+                        g_Notify->BreakPoint(__FILE__, __LINE__);
+                    }
+                    m_Assembler.MoveConst64ToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", (int32_t)m_Section->m_Cont.TargetPC);
+                }
+
+                if (m_Section->m_Jump.LinkLocation.isValid() || m_Section->m_Jump.LinkLocation2.isValid())
+                {
+                    if (DelayLinkLocation.isValid())
+                    {
+                        g_Notify->BreakPoint(__FILE__, __LINE__);
+                    }
+                    DelayLinkLocation = m_Assembler.newLabel();
+                    m_Assembler.BLabel("DoDelaySlot", DelayLinkLocation);
+
+                    LinkJump(m_Section->m_Jump);
+                    m_Assembler.MoveConst64ToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", (int32_t)m_Section->m_Jump.TargetPC);
+                }
+                if (m_Section->m_Cont.LinkLocation.isValid() || m_Section->m_Cont.LinkLocation2.isValid())
+                {
+                    if (DelayLinkLocation.isValid())
+                    {
+                        g_Notify->BreakPoint(__FILE__, __LINE__);
+                    }
+                    DelayLinkLocation = m_Assembler.newLabel();
+                    m_Assembler.BLabel("DoDelaySlot", DelayLinkLocation);
+
+                    LinkJump(m_Section->m_Cont);
+                    m_Assembler.MoveConst64ToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", (int32_t)m_Section->m_Cont.TargetPC);
+                }
+                if (DelayLinkLocation.isValid())
+                {
+                    m_CodeBlock.Log("");
+                    m_Assembler.bind(DelayLinkLocation);
+                }
+                OverflowDelaySlot(false);
+                return;
+            }
+            m_RegBeforeDelay = m_RegWorkingSet;
+        }
+        if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+        {
+            m_PipelineStage = PIPELINE_STAGE_DO_DELAY_SLOT;
+        }
+        else
+        {
+            m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() + g_System->CountPerOp());
+            m_Section->m_Jump.RegSet = m_RegWorkingSet;
+            m_Section->m_Cont.RegSet = m_RegWorkingSet;
+            m_Section->GenerateSectionLinkage();
+            m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+        }
+    }
+    else if (m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT_DONE)
+    {
+        if (m_CompilePC + ((int16_t)m_Opcode.offset << 2) + 4 == m_CompilePC + 8)
+        {
+            m_PipelineStage = PIPELINE_STAGE_NORMAL;
+            m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() - g_System->CountPerOp());
+            SetCurrentPC((uint32_t)(GetCurrentPC() + 4));
+            return;
+        }
+        if (m_EffectDelaySlot)
+        {
+            CJumpInfo * FallInfo = m_Section->m_Jump.FallThrough ? &m_Section->m_Jump : &m_Section->m_Cont;
+            CJumpInfo * JumpInfo = m_Section->m_Jump.FallThrough ? &m_Section->m_Cont : &m_Section->m_Jump;
+
+            if (FallInfo->FallThrough && !FallInfo->DoneDelaySlot)
+            {
+                FallInfo->RegSet = m_RegWorkingSet;
+                if (FallInfo == &m_Section->m_Jump)
+                {
+                    if (m_Section->m_JumpSection != nullptr)
+                    {
+                        m_Section->m_Jump.BranchLabel = stdstr_f("Section_%d", m_Section->m_JumpSection->m_SectionID);
+                    }
+                    else
+                    {
+                        m_Section->m_Jump.BranchLabel = "ExitBlock";
+                    }
+                    if (FallInfo->TargetPC <= (uint32_t)m_CompilePC)
+                    {
+                        UpdateCounters(m_Section->m_Jump.RegSet, true, true, true);
+                        m_CodeBlock.Log("CompileSystemCheck 12");
+                        CompileSystemCheck(FallInfo->TargetPC, m_Section->m_Jump.RegSet);
+                        FallInfo->Reason = ExitReason_NormalNoSysCheck;
+                        FallInfo->JumpPC = (uint32_t)-1;
+                    }
+                }
+                else
+                {
+                    if (m_Section->m_ContinueSection != nullptr)
+                    {
+                        m_Section->m_Cont.BranchLabel = stdstr_f("Section_%d", m_Section->m_ContinueSection->m_SectionID);
+                    }
+                    else
+                    {
+                        m_Section->m_Cont.BranchLabel = stdstr_f("ExitBlock_%X_Continue", m_Section->m_EnterPC);
+                    }
+                }
+                FallInfo->DoneDelaySlot = true;
+                if (!JumpInfo->DoneDelaySlot)
+                {
+                    FallInfo->FallThrough = false;
+                    FallInfo->LinkLocation = m_Assembler.newLabel();
+                    m_Assembler.BLabel(FallInfo->BranchLabel.c_str(), FallInfo->LinkLocation);
+
+                    if (JumpInfo->LinkLocation.isValid())
+                    {
+                        LinkJump(*JumpInfo);
+                        JumpInfo->FallThrough = true;
+                        m_PipelineStage = PIPELINE_STAGE_DO_DELAY_SLOT;
+                        m_RegWorkingSet = m_RegBeforeDelay;
+                        return;
+                    }
+                }
+            }
+        }
+        else
+        {
+            if (m_Section->m_Jump.TargetPC != m_Section->m_Cont.TargetPC)
+            {
+                Compile_BranchCompare(CompareType);
+                        m_Section->m_Cont.RegSet = m_RegWorkingSet;
+                m_Section->m_Jump.RegSet = m_RegWorkingSet;
+                if (m_Section->m_Cont.LinkAddress != (uint32_t)-1)
+                {
+                    m_Section->m_Cont.RegSet.UnMap_GPR(31, false);
+                    m_Section->m_Cont.RegSet.SetMipsRegLo(31, m_Section->m_Cont.LinkAddress);
+                    m_Section->m_Cont.RegSet.SetMipsRegState(31, CRegInfo::STATE_CONST_32_SIGN);
+                    m_Section->m_Cont.LinkAddress = (uint32_t)-1;
+                }
+                if (m_Section->m_Jump.LinkAddress != (uint32_t)-1)
+                {
+                    m_Section->m_Jump.RegSet.UnMap_GPR(31, false);
+                    m_Section->m_Jump.RegSet.SetMipsRegLo(31, m_Section->m_Jump.LinkAddress);
+                    m_Section->m_Jump.RegSet.SetMipsRegState(31, CRegInfo::STATE_CONST_32_SIGN);
+                    m_Section->m_Jump.LinkAddress = (uint32_t)-1;
+                }
+            }
+            else
+            {
+                m_Section->m_Jump.FallThrough = false;
+                m_Section->m_Cont.FallThrough = true;
+                m_Section->m_Cont.RegSet = m_RegWorkingSet;
+                if (m_Section->m_ContinueSection == nullptr && m_Section->m_JumpSection != nullptr)
+                {
+                    m_Section->m_ContinueSection = m_Section->m_JumpSection;
+                    m_Section->m_JumpSection = nullptr;
+                }
+                if (m_Section->m_ContinueSection != nullptr)
+                {
+                    m_Section->m_Cont.BranchLabel = stdstr_f("Section_%d", m_Section->m_ContinueSection->m_SectionID);
+                }
+                else
+                {
+                    m_Section->m_Cont.BranchLabel = "ExitBlock";
+                }
+            }
+        }
+        m_Section->GenerateSectionLinkage();
+        m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+    }
+    else
+    {
+        if (HaveDebugger())
+        {
+            g_Notify->DisplayError(stdstr_f("WTF\n\nBranch\nNextInstruction = %X", m_PipelineStage).c_str());
+        }
+    }
+}
+
+void CAarch64RecompilerOps::Compile_BranchLikely(RecompilerBranchCompare CompareType, bool Link)
+{
+    if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+    {
+        if (CompareType == RecompilerBranchCompare_COP1BCF || CompareType == RecompilerBranchCompare_COP1BCT)
+        {
+            CompileCop1Test();
+            m_Assembler.MoveVariableToReg(asmjit::a64::w10, &m_Reg.m_FPCR[31], "_FPCR[31]");
+            m_Assembler.MoveConst64ToReg(Aarch64ScratchReg.w(), (uint32_t)(~0x0003F000));
+            m_Assembler.and_(asmjit::a64::w10, asmjit::a64::w10, Aarch64ScratchReg.w());
+            m_Assembler.MoveRegToVariable(&m_Reg.m_FPCR[31], "_FPCR[31]", asmjit::a64::w10);
+        }
+        if (!g_System->bLinkBlocks() || (m_CompilePC & 0xFFC) == 0xFFC)
+        {
+            m_Section->m_Jump.JumpPC = (uint32_t)m_CompilePC;
+            m_Section->m_Jump.TargetPC = (uint32_t)(m_CompilePC + ((int16_t)m_Opcode.offset << 2) + 4);
+            m_Section->m_Cont.JumpPC = (uint32_t)m_CompilePC;
+            m_Section->m_Cont.TargetPC = (uint32_t)(m_CompilePC + 8);
+        }
+        else
+        {
+            if (m_Section->m_Jump.JumpPC != (uint32_t)m_CompilePC)
+            {
+                g_Notify->BreakPoint(__FILE__, __LINE__);
+            }
+            if (m_Section->m_Cont.JumpPC != (uint32_t)m_CompilePC)
+            {
+                g_Notify->BreakPoint(__FILE__, __LINE__);
+            }
+            if (m_Section->m_Cont.TargetPC != (uint32_t)(m_CompilePC + 8))
+            {
+                g_Notify->BreakPoint(__FILE__, __LINE__);
+            }
+        }
+
+        if (m_Section->m_JumpSection != nullptr)
+        {
+            m_Section->m_Jump.BranchLabel = stdstr_f("Section_%d", ((CCodeSection *)m_Section->m_JumpSection)->m_SectionID);
+        }
+        else
+        {
+            m_Section->m_Jump.BranchLabel = "ExitBlock";
+        }
+
+        if (m_Section->m_ContinueSection != nullptr)
+        {
+            m_Section->m_Cont.BranchLabel = stdstr_f("Section_%d", ((CCodeSection *)m_Section->m_ContinueSection)->m_SectionID);
+        }
+        else
+        {
+            m_Section->m_Cont.BranchLabel = "ExitBlock";
+        }
+
+        m_Section->m_Jump.FallThrough = true;
+        m_Section->m_Jump.LinkLocation = asmjit::Label();
+        m_Section->m_Jump.LinkLocation2 = asmjit::Label();
+        m_Section->m_Cont.FallThrough = false;
+        m_Section->m_Cont.LinkLocation = asmjit::Label();
+        m_Section->m_Cont.LinkLocation2 = asmjit::Label();
+        if (Link)
+        {
+            R4300iInstruction Instruction(m_CompilePC, m_Opcode.Value);
+            uint32_t ReadReg1, ReadReg2;
+            Instruction.ReadsGPR(ReadReg1, ReadReg2);
+
+            if (ReadReg1 != 31 && ReadReg2 != 31)
+            {
+                m_RegWorkingSet.UnMap_GPR(31, false);
+                m_RegWorkingSet.SetMipsRegLo(31, (uint32_t)(m_CompilePC + 8));
+                m_RegWorkingSet.SetMipsRegState(31, CRegInfo::STATE_CONST_32_SIGN);
+            }
+            else
+            {
+                m_Section->m_Cont.LinkAddress = (uint32_t)(m_CompilePC + 8);
+                m_Section->m_Jump.LinkAddress = (uint32_t)(m_CompilePC + 8);
+            }
+        }
+
+        Compile_BranchCompare(CompareType);
+
+        m_Section->m_Cont.RegSet = m_RegWorkingSet;
+        m_Section->m_Cont.RegSet.SetBlockCycleCount(m_Section->m_Cont.RegSet.GetBlockCycleCount() + g_System->CountPerOp());
+        if (m_Section->m_Cont.LinkAddress != (uint32_t)-1)
+        {
+            m_Section->m_Cont.RegSet.UnMap_GPR(31, false);
+            m_Section->m_Cont.RegSet.SetMipsRegLo(31, m_Section->m_Cont.LinkAddress);
+            m_Section->m_Cont.RegSet.SetMipsRegState(31, CRegInfo::STATE_CONST_32_SIGN);
+            m_Section->m_Cont.LinkAddress = (uint32_t)-1;
+        }
+        if ((m_CompilePC & 0xFFC) == 0xFFC)
+        {
+            if (m_Section->m_Cont.FallThrough)
+            {
+                if (m_Section->m_Jump.LinkLocation.isValid())
+                {
+                    g_Notify->BreakPoint(__FILE__, __LINE__);
+                }
+            }
+
+            if (m_Section->m_Jump.LinkLocation.isValid() || m_Section->m_Jump.FallThrough)
+            {
+                LinkJump(m_Section->m_Jump);
+
+                m_Assembler.MoveConst64ToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", (int32_t)m_Section->m_Jump.TargetPC);
+                OverflowDelaySlot(false);
+                m_CodeBlock.Log("      ");
+                m_CodeBlock.Log("      %s:", m_Section->m_Cont.BranchLabel.c_str());
+            }
+            else if (!m_Section->m_Cont.FallThrough)
+            {
+                g_Notify->BreakPoint(__FILE__, __LINE__);
+            }
+
+            LinkJump(m_Section->m_Cont);
+            CompileExit(m_CompilePC, m_CompilePC + 8, m_Section->m_Cont.RegSet, ExitReason_Normal, true, nullptr);
+            return;
+        }
+        else
+        {
+            m_PipelineStage = PIPELINE_STAGE_DO_DELAY_SLOT;
+        }
+
+        if (g_System->bLinkBlocks())
+        {
+            m_Section->m_Jump.RegSet = m_RegWorkingSet;
+            m_Section->m_Jump.RegSet.SetBlockCycleCount(m_Section->m_Jump.RegSet.GetBlockCycleCount() + g_System->CountPerOp());
+            if (m_Section->m_Jump.LinkAddress != (uint32_t)-1)
+            {
+                m_Section->m_Jump.RegSet.UnMap_GPR(31, false);
+                m_Section->m_Jump.RegSet.SetMipsRegLo(31, m_Section->m_Jump.LinkAddress);
+                m_Section->m_Jump.RegSet.SetMipsRegState(31, CRegInfo::STATE_CONST_32_SIGN);
+                m_Section->m_Jump.LinkAddress = (uint32_t)-1;
+            }
+            m_Section->GenerateSectionLinkage();
+            m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+        }
+        else
+        {
+            if (m_Section->m_Cont.FallThrough)
+            {
+                if (m_Section->m_Jump.LinkLocation.isValid())
+                {
+                    g_Notify->BreakPoint(__FILE__, __LINE__);
+                }
+                m_Section->GenerateSectionLinkage();
+                m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+            }
+        }
+    }
+    else if (m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT_DONE)
+    {
+        m_Section->m_Jump.RegSet = m_RegWorkingSet;
+        m_Section->m_Jump.RegSet.SetBlockCycleCount(m_Section->m_Jump.RegSet.GetBlockCycleCount());
+        if (m_Section->m_Jump.LinkAddress != (uint32_t)-1)
+        {
+            m_Section->m_Jump.RegSet.UnMap_GPR(31, false);
+            m_Section->m_Jump.RegSet.SetMipsRegLo(31, m_Section->m_Jump.LinkAddress);
+            m_Section->m_Jump.RegSet.SetMipsRegState(31, CRegInfo::STATE_CONST_32_SIGN);
+            m_Section->m_Jump.LinkAddress = (uint32_t)-1;
+        }
+        m_Section->GenerateSectionLinkage();
+        m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+    }
+    else if (HaveDebugger())
+    {
+        g_Notify->DisplayError(stdstr_f("WTF\n%s\nNextInstruction = %X", __FUNCTION__, m_PipelineStage).c_str());
+    }
 }
 
 void CAarch64RecompilerOps::BNE_Compare()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        BranchOnConst(ConstCompareValue(m_Opcode.rs) != ConstCompareValue(m_Opcode.rt));
+        return;
+    }
+    CompareGPR(IsConstGPR(m_Opcode.rs) ? m_Opcode.rt : m_Opcode.rs, IsConstGPR(m_Opcode.rs) ? m_Opcode.rs : m_Opcode.rt);
+    BranchOnCompare(&CAarch64Ops::BneLabel, &CAarch64Ops::BeqLabel);
 }
 
 void CAarch64RecompilerOps::BEQ_Compare()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        BranchOnConst(ConstCompareValue(m_Opcode.rs) == ConstCompareValue(m_Opcode.rt));
+        return;
+    }
+    CompareGPR(IsConstGPR(m_Opcode.rs) ? m_Opcode.rt : m_Opcode.rs, IsConstGPR(m_Opcode.rs) ? m_Opcode.rs : m_Opcode.rt);
+    BranchOnCompare(&CAarch64Ops::BeqLabel, &CAarch64Ops::BneLabel);
 }
 
 void CAarch64RecompilerOps::BGTZ_Compare()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        BranchOnConst(ConstCompareValue(m_Opcode.rs) > 0);
+        return;
+    }
+    CompareGPR(m_Opcode.rs, 0);
+    BranchOnCompare(&CAarch64Ops::BgtLabel, &CAarch64Ops::BleLabel);
 }
 
 void CAarch64RecompilerOps::BLEZ_Compare()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        BranchOnConst(ConstCompareValue(m_Opcode.rs) <= 0);
+        return;
+    }
+    CompareGPR(m_Opcode.rs, 0);
+    BranchOnCompare(&CAarch64Ops::BleLabel, &CAarch64Ops::BgtLabel);
 }
 
 void CAarch64RecompilerOps::BLTZ_Compare()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        BranchOnConst(ConstCompareValue(m_Opcode.rs) < 0);
+        return;
+    }
+    CompareGPR(m_Opcode.rs, 0);
+    BranchOnCompare(&CAarch64Ops::BltLabel, &CAarch64Ops::BgeLabel);
 }
 
 void CAarch64RecompilerOps::BGEZ_Compare()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        BranchOnConst(ConstCompareValue(m_Opcode.rs) >= 0);
+        return;
+    }
+    CompareGPR(m_Opcode.rs, 0);
+    BranchOnCompare(&CAarch64Ops::BgeLabel, &CAarch64Ops::BltLabel);
 }
 
 void CAarch64RecompilerOps::COP1_BCF_Compare()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Assembler.TestVariable(&m_Reg.m_FPCR[31], "_FPCR[31]", FPCSR_C);
+    BranchOnCompare(&CAarch64Ops::BeqLabel, &CAarch64Ops::BneLabel);
 }
 
 void CAarch64RecompilerOps::COP1_BCT_Compare()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Assembler.TestVariable(&m_Reg.m_FPCR[31], "_FPCR[31]", FPCSR_C);
+    BranchOnCompare(&CAarch64Ops::BneLabel, &CAarch64Ops::BeqLabel);
 }
 
+//  Opcode functions
 void CAarch64RecompilerOps::J()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+    {
+        if ((m_CompilePC & 0xFFC) == 0xFFC)
+        {
+            m_Assembler.MoveConst64ToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", (int32_t)((m_CompilePC & 0xF0000000) + (m_Opcode.target << 2)));
+            OverflowDelaySlot(false);
+            return;
+        }
+        R4300iOpcode DelaySlot;
+        g_MMU->MemoryValue32((uint32_t)(m_CompilePC + 4), DelaySlot.Value);
+        if (R4300iInstruction(m_CompilePC + 4, DelaySlot.Value).HasDelaySlot())
+        {
+            m_Assembler.MoveConst64ToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", (int32_t)((m_CompilePC & 0xF0000000) + (m_Opcode.target << 2)));
+            m_PipelineStage = PIPELINE_STAGE_DO_DELAY_SLOT;
+            return;
+        }
+
+        m_Section->m_Jump.TargetPC = (m_CompilePC & 0xF0000000) + (m_Opcode.target << 2);
+        m_Section->m_Jump.JumpPC = (uint32_t)(m_CompilePC);
+        if (m_Section->m_JumpSection != nullptr)
+        {
+            m_Section->m_Jump.BranchLabel = stdstr_f("Section_%d", ((CCodeSection *)m_Section->m_JumpSection)->m_SectionID);
+        }
+        else
+        {
+            m_Section->m_Jump.BranchLabel = "ExitBlock";
+        }
+        m_Section->m_Jump.FallThrough = true;
+        m_Section->m_Jump.LinkLocation = asmjit::Label();
+        m_Section->m_Jump.LinkLocation2 = asmjit::Label();
+        m_PipelineStage = PIPELINE_STAGE_DO_DELAY_SLOT;
+    }
+    else if (m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT_DONE)
+    {
+        m_Section->m_Jump.RegSet = m_RegWorkingSet;
+        m_Section->GenerateSectionLinkage();
+        m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+    }
+    else if (HaveDebugger())
+    {
+        g_Notify->DisplayError(stdstr_f("WTF\n\nJ\nNextInstruction = %X", m_PipelineStage).c_str());
+    }
 }
 
 void CAarch64RecompilerOps::JAL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+    {
+        m_RegWorkingSet.SetConst(31, (int32_t)(m_CompilePC + 8));
+        if (m_CodeBlock.BlockLinkAllowed(m_CompilePC + 8))
+        {
+            CompilePushReturnAddress(m_CompilePC + 8);
+        }
+        if ((m_CompilePC & 0xFFC) == 0xFFC)
+        {
+            m_Assembler.MoveConst64ToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", (int32_t)((m_CompilePC & 0xF0000000) + (m_Opcode.target << 2)));
+            OverflowDelaySlot(false);
+            return;
+        }
+        m_Section->m_Jump.TargetPC = (m_CompilePC & 0xF0000000) + (m_Opcode.target << 2);
+        m_Section->m_Jump.JumpPC = (uint32_t)m_CompilePC;
+        if (m_Section->m_JumpSection != nullptr)
+        {
+            m_Section->m_Jump.BranchLabel = stdstr_f("Section_%d", ((CCodeSection *)m_Section->m_JumpSection)->m_SectionID);
+        }
+        else
+        {
+            m_Section->m_Jump.BranchLabel = "ExitBlock";
+        }
+        m_Section->m_Jump.FallThrough = true;
+        m_Section->m_Jump.LinkLocation = asmjit::Label();
+        m_Section->m_Jump.LinkLocation2 = asmjit::Label();
+        m_PipelineStage = PIPELINE_STAGE_DO_DELAY_SLOT;
+    }
+    else if (m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT_DONE)
+    {
+        if (m_Section->m_JumpSection)
+        {
+            m_Section->m_Jump.RegSet = m_RegWorkingSet;
+            m_Section->GenerateSectionLinkage();
+        }
+        else
+        {
+            m_RegWorkingSet.WriteBackRegisters();
+
+            uint32_t TargetPC = (m_CompilePC & 0xF0000000) + (m_Opcode.target << 2);
+            m_Assembler.MoveConst64ToVariable(&m_Reg.m_PROGRAM_COUNTER, "_PROGRAM_COUNTER", (int32_t)TargetPC);
+
+            bool bCheck = TargetPC <= m_CompilePC;
+            if (bCheck)
+            {
+                UpdateCounters(m_RegWorkingSet, bCheck, true);
+            }
+            CompileExit((uint32_t)-1, (uint32_t)-1, m_RegWorkingSet, bCheck ? ExitReason_Normal : ExitReason_NormalNoSysCheck, true, nullptr);
+        }
+        m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+    }
+    else
+    {
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
 }
 
 void CAarch64RecompilerOps::ADDI()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        int64_t Result = (int64_t)(int32_t)ConstCompareValue(m_Opcode.rs) + (int16_t)m_Opcode.immediate;
+        if (Result != (int32_t)Result)
+        {
+            CompileConstOverflow();
+            return;
+        }
+        m_RegWorkingSet.SetConst(m_Opcode.rt, (int32_t)Result);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w9, m_Opcode.rs);
+    m_Assembler.AddsConstToReg(asmjit::a64::w9, (int16_t)m_Opcode.immediate);
+    CompileOverflowExit();
+    m_Assembler.sxtw(asmjit::a64::x9, asmjit::a64::w9);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::ADDIU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rt == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rt, (int32_t)((uint32_t)ConstCompareValue(m_Opcode.rs) + (int16_t)m_Opcode.immediate));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w9, m_Opcode.rs);
+    m_Assembler.AddConstToReg(asmjit::a64::w9, asmjit::a64::w9, (int16_t)m_Opcode.immediate);
+    m_Assembler.sxtw(asmjit::a64::x9, asmjit::a64::w9);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x9);
 }
 
-void CAarch64RecompilerOps::SLTI()
+void CAarch64RecompilerOps::SLTIU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rt == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rt, (uint64_t)ConstCompareValue(m_Opcode.rs) < (uint64_t)(int64_t)(int16_t)m_Opcode.immediate ? 1 : 0);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_Assembler.CompConstToReg(asmjit::a64::x9, (int16_t)m_Opcode.immediate);
+    m_Assembler.cset(asmjit::a64::x9, (uint32_t)asmjit::a64::CondCode::kLO);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x9);
 }
 
-void CAarch64RecompilerOps::SLTIU()
+void CAarch64RecompilerOps::SLTI()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rt == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rt, ConstCompareValue(m_Opcode.rs) < (int64_t)(int16_t)m_Opcode.immediate ? 1 : 0);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_Assembler.CompConstToReg(asmjit::a64::x9, (int16_t)m_Opcode.immediate);
+    m_Assembler.cset(asmjit::a64::x9, (uint32_t)asmjit::a64::CondCode::kLT);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::ANDI()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rt == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rt, ConstCompareValue(m_Opcode.rs) & m_Opcode.immediate);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_Assembler.MoveConst64ToReg(Aarch64ScratchReg, m_Opcode.immediate);
+    m_Assembler.and_(asmjit::a64::x9, asmjit::a64::x9, Aarch64ScratchReg);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::ORI()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rt == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rt, ConstCompareValue(m_Opcode.rs) | m_Opcode.immediate);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    if (m_Opcode.immediate != 0)
+    {
+        m_Assembler.MoveConst64ToReg(Aarch64ScratchReg, m_Opcode.immediate);
+        m_Assembler.orr(asmjit::a64::x9, asmjit::a64::x9, Aarch64ScratchReg);
+    }
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::XORI()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rt == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rt, ConstCompareValue(m_Opcode.rs) ^ m_Opcode.immediate);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    if (m_Opcode.immediate != 0)
+    {
+        m_Assembler.MoveConst64ToReg(Aarch64ScratchReg, m_Opcode.immediate);
+        m_Assembler.eor(asmjit::a64::x9, asmjit::a64::x9, Aarch64ScratchReg);
+    }
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::LUI()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rt == 0)
+    {
+        return;
+    }
+    m_RegWorkingSet.SetConst(m_Opcode.rt, (int32_t)(m_Opcode.offset << 16));
 }
 
 void CAarch64RecompilerOps::DADDI()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        int64_t rs = ConstCompareValue(m_Opcode.rs);
+        int64_t imm = (int16_t)m_Opcode.immediate;
+        int64_t sum = (int64_t)((uint64_t)rs + (uint64_t)imm);
+        if ((~(rs ^ imm) & (rs ^ sum)) & 0x8000000000000000)
+        {
+            CompileConstOverflow();
+            return;
+        }
+        m_RegWorkingSet.SetConst(m_Opcode.rt, sum);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_Assembler.AddsConstToReg(asmjit::a64::x9, (int16_t)m_Opcode.immediate);
+    CompileOverflowExit();
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::DADDIU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rt == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rt, (int64_t)((uint64_t)ConstCompareValue(m_Opcode.rs) + (int64_t)(int16_t)m_Opcode.immediate));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_Assembler.AddConstToReg(asmjit::a64::x9, asmjit::a64::x9, (int16_t)m_Opcode.immediate);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x9);
+}
+
+void CAarch64RecompilerOps::CACHE()
+{
+    if (g_Settings->LoadDword(Game_SMM_Cache) == 0)
+    {
+        return;
+    }
+
+    switch (m_Opcode.rt)
+    {
+    case 0:
+    case 16:
+        if (IsConstGPR(m_Opcode.base))
+        {
+            m_Assembler.MoveConst64ToReg(asmjit::a64::w1, (uint32_t)ConstCompareValue(m_Opcode.base) + (int16_t)m_Opcode.offset);
+        }
+        else
+        {
+            m_RegWorkingSet.Map_TempReg(asmjit::a64::w1, m_Opcode.base);
+            m_Assembler.AddConstToReg(asmjit::a64::w1, asmjit::a64::w1, (int16_t)m_Opcode.offset);
+        }
+        m_Assembler.MoveConst64ToReg(asmjit::a64::w2, 0x20);
+        m_Assembler.MoveConst64ToReg(asmjit::a64::w3, CRecompiler::Remove_Cache);
+        m_Assembler.CallThis((uintptr_t)g_Recompiler, AddressOf(&CRecompiler::ClearRecompCode_Virt), "CRecompiler::ClearRecompCode_Virt");
+        break;
+    case 1:
+    case 3:
+    case 13:
+    case 5:
+    case 8:
+    case 9:
+    case 17:
+    case 21:
+    case 25:
+        break;
+    default:
+        if (HaveDebugger())
+        {
+            g_Notify->DisplayError(stdstr_f("cache: %d", m_Opcode.rt).c_str());
+        }
+    }
 }
 
 void CAarch64RecompilerOps::LDL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LDL_32) : AddressOf(&R4300iOp::LDL), "R4300iOp::LDL", m_Opcode.base, m_Opcode.rt, m_Opcode.rt, true);
 }
 
 void CAarch64RecompilerOps::LDR()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LDR_32) : AddressOf(&R4300iOp::LDR), "R4300iOp::LDR", m_Opcode.base, m_Opcode.rt, m_Opcode.rt, true);
 }
 
 void CAarch64RecompilerOps::RESERVED31()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() + g_System->CountPerOp());
+    CompileExit(m_CompilePC, m_CompilePC, m_RegWorkingSet, ExitReason_IllegalInstruction, true, nullptr);
+    m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
 }
 
 void CAarch64RecompilerOps::LB()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileLoad(8, true);
 }
 
 void CAarch64RecompilerOps::LH()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileLoad(16, true);
 }
 
 void CAarch64RecompilerOps::LWL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LWL_32) : AddressOf(&R4300iOp::LWL), "R4300iOp::LWL", m_Opcode.base, m_Opcode.rt, m_Opcode.rt, true);
 }
 
 void CAarch64RecompilerOps::LW()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileLoad(32, true);
 }
 
 void CAarch64RecompilerOps::LBU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileLoad(8, false);
 }
 
 void CAarch64RecompilerOps::LHU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileLoad(16, false);
 }
 
 void CAarch64RecompilerOps::LWR()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LWR_32) : AddressOf(&R4300iOp::LWR), "R4300iOp::LWR", m_Opcode.base, m_Opcode.rt, m_Opcode.rt, true);
 }
 
 void CAarch64RecompilerOps::LWU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileLoad(32, false);
 }
 
 void CAarch64RecompilerOps::SB()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileStore(8);
 }
 
 void CAarch64RecompilerOps::SH()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileStore(16);
 }
 
 void CAarch64RecompilerOps::SWL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SWL_32) : AddressOf(&R4300iOp::SWL), "R4300iOp::SWL", m_Opcode.base, m_Opcode.rt, 0, true);
 }
 
 void CAarch64RecompilerOps::SW()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileStore(32);
 }
 
 void CAarch64RecompilerOps::SWR()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SWR_32) : AddressOf(&R4300iOp::SWR), "R4300iOp::SWR", m_Opcode.base, m_Opcode.rt, 0, true);
 }
 
 void CAarch64RecompilerOps::SDL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SDL_32) : AddressOf(&R4300iOp::SDL), "R4300iOp::SDL", m_Opcode.base, m_Opcode.rt, 0, true);
 }
 
 void CAarch64RecompilerOps::SDR()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-}
-
-void CAarch64RecompilerOps::CACHE()
-{
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SDR_32) : AddressOf(&R4300iOp::SDR), "R4300iOp::SDR", m_Opcode.base, m_Opcode.rt, 0, true);
 }
 
 void CAarch64RecompilerOps::LL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LL_32) : AddressOf(&R4300iOp::LL), "R4300iOp::LL", m_Opcode.base, 0, m_Opcode.rt, true);
 }
 
 void CAarch64RecompilerOps::LWC1()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LWC1_32) : AddressOf(&R4300iOp::LWC1), "R4300iOp::LWC1", m_Opcode.base, 0, 0, true);
 }
 
 void CAarch64RecompilerOps::LDC1()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LDC1_32) : AddressOf(&R4300iOp::LDC1), "R4300iOp::LDC1", m_Opcode.base, 0, 0, true);
 }
 
 void CAarch64RecompilerOps::LD()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileLoad(64, false);
 }
 
 void CAarch64RecompilerOps::SC()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SC_32) : AddressOf(&R4300iOp::SC), "R4300iOp::SC", m_Opcode.base, m_Opcode.rt, m_Opcode.rt, true);
 }
 
 void CAarch64RecompilerOps::SWC1()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SWC1_32) : AddressOf(&R4300iOp::SWC1), "R4300iOp::SWC1", m_Opcode.base, 0, 0, true);
 }
 
 void CAarch64RecompilerOps::SDC1()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SDC1_32) : AddressOf(&R4300iOp::SDC1), "R4300iOp::SDC1", m_Opcode.base, 0, 0, true);
 }
 
 void CAarch64RecompilerOps::SD()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileStore(64);
 }
 
+// R4300i opcodes: Special
 void CAarch64RecompilerOps::SPECIAL_SLL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftConst(false, m_Opcode.sa, Shift_Left);
 }
 
 void CAarch64RecompilerOps::SPECIAL_SRL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftConst(false, m_Opcode.sa, Shift_RightLogical);
 }
 
 void CAarch64RecompilerOps::SPECIAL_SRA()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftConst(false, m_Opcode.sa, Shift_RightArithmetic);
 }
 
 void CAarch64RecompilerOps::SPECIAL_SLLV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftVariable(false, Shift_Left);
 }
 
 void CAarch64RecompilerOps::SPECIAL_SRLV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftVariable(false, Shift_RightLogical);
 }
 
 void CAarch64RecompilerOps::SPECIAL_SRAV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftVariable(false, Shift_RightArithmetic);
 }
 
 void CAarch64RecompilerOps::SPECIAL_JR()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+    {
+        if ((m_CompilePC & 0xFFC) == 0xFFC)
+        {
+            m_RegWorkingSet.WriteBackRegisters();
+            MoveGPRToVariable64(m_Opcode.rs, &g_System->m_JumpToLocation, "System::m_JumpToLocation");
+            OverflowDelaySlot(true);
+            return;
+        }
+
+        m_Section->m_Jump.FallThrough = false;
+        m_Section->m_Jump.LinkLocation = asmjit::Label();
+        m_Section->m_Jump.LinkLocation2 = asmjit::Label();
+        m_Section->m_Cont.FallThrough = false;
+        m_Section->m_Cont.LinkLocation = asmjit::Label();
+        m_Section->m_Cont.LinkLocation2 = asmjit::Label();
+
+        R4300iOpcode DelaySlot;
+        if (g_MMU->MemoryValue32((uint32_t)(m_CompilePC + 4), DelaySlot.Value) &&
+            R4300iInstruction(m_CompilePC, m_Opcode.Value).DelaySlotEffectsCompare(DelaySlot.Value))
+        {
+            MoveGPRToVariable64(m_Opcode.rs, &m_Reg.m_PROGRAM_COUNTER, "PROGRAM_COUNTER");
+        }
+        m_PipelineStage = PIPELINE_STAGE_DO_DELAY_SLOT;
+    }
+    else if (m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT_DONE)
+    {
+        R4300iOpcode DelaySlot;
+        if (g_MMU->MemoryValue32((uint32_t)(m_CompilePC + 4), DelaySlot.Value) && R4300iInstruction(m_CompilePC, m_Opcode.Value).DelaySlotEffectsCompare(DelaySlot.Value))
+        {
+            CompileExit(m_CompilePC, (uint32_t)-1, m_RegWorkingSet, ExitReason_CheckPCAlignment, true, nullptr);
+        }
+        else
+        {
+            MoveGPRToVariable64(m_Opcode.rs, &m_Reg.m_PROGRAM_COUNTER, "PROGRAM_COUNTER");
+            UpdateCounters(m_RegWorkingSet, true, true, false);
+            CompileExit((uint32_t)-1, (uint32_t)-1, m_RegWorkingSet, m_Opcode.rs == 31 && m_CodeBlock.BlockLinkAllowed() ? ExitReason_Return : ExitReason_CheckPCAlignment, true, nullptr);
+            if (m_Section->m_JumpSection)
+            {
+                m_Section->GenerateSectionLinkage();
+            }
+        }
+        m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+    }
+    else if (HaveDebugger())
+    {
+        g_Notify->DisplayError(stdstr_f("WTF\n\nBranch\nNextInstruction = %X", m_PipelineStage).c_str());
+    }
 }
 
 void CAarch64RecompilerOps::SPECIAL_JALR()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+    {
+        R4300iOpcode DelaySlot;
+        if ((g_MMU->MemoryValue32((uint32_t)(m_CompilePC + 4), DelaySlot.Value) &&
+             R4300iInstruction(m_CompilePC, m_Opcode.Value).DelaySlotEffectsCompare(DelaySlot.Value) && (m_CompilePC & 0xFFC) != 0xFFC) ||
+            m_Opcode.rd == m_Opcode.rs)
+        {
+            // The link register is about to be overwritten, so the target has to be saved first
+            MoveGPRToVariable64(m_Opcode.rs, &m_Reg.m_PROGRAM_COUNTER, "PROGRAM_COUNTER");
+        }
+        if ((m_CompilePC & 0xFFC) == 0xFFC)
+        {
+            m_RegWorkingSet.WriteBackRegisters();
+            MoveGPRToVariable64(m_Opcode.rs, &g_System->m_JumpToLocation, "System::m_JumpToLocation");
+            m_RegWorkingSet.SetConst(m_Opcode.rd, (int32_t)(m_CompilePC + 8));
+            m_RegWorkingSet.WriteBackRegisters();
+            OverflowDelaySlot(true);
+            return;
+        }
+        m_RegWorkingSet.SetConst(m_Opcode.rd, (int32_t)(m_CompilePC + 8));
+        if (m_Opcode.rd == 31 && m_CodeBlock.BlockLinkAllowed(m_CompilePC + 8))
+        {
+            CompilePushReturnAddress(m_CompilePC + 8);
+        }
+
+        m_Section->m_Jump.FallThrough = false;
+        m_Section->m_Jump.LinkLocation = asmjit::Label();
+        m_Section->m_Jump.LinkLocation2 = asmjit::Label();
+        m_Section->m_Cont.FallThrough = false;
+        m_Section->m_Cont.LinkLocation = asmjit::Label();
+        m_Section->m_Cont.LinkLocation2 = asmjit::Label();
+
+        m_PipelineStage = PIPELINE_STAGE_DO_DELAY_SLOT;
+    }
+    else if (m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT_DONE)
+    {
+        R4300iOpcode DelaySlot;
+        if ((g_MMU->MemoryValue32((uint32_t)(m_CompilePC + 4), DelaySlot.Value) &&
+             R4300iInstruction(m_CompilePC, m_Opcode.Value).DelaySlotEffectsCompare(DelaySlot.Value)) ||
+            m_Opcode.rd == m_Opcode.rs)
+        {
+            CompileExit(m_CompilePC, (uint32_t)-1, m_RegWorkingSet, ExitReason_CheckPCAlignment, true, nullptr);
+        }
+        else
+        {
+            UpdateCounters(m_RegWorkingSet, true, true);
+            MoveGPRToVariable64(m_Opcode.rs, &m_Reg.m_PROGRAM_COUNTER, "PROGRAM_COUNTER");
+            CompileExit((uint32_t)-1, (uint32_t)-1, m_RegWorkingSet, ExitReason_CheckPCAlignment, true, nullptr);
+            if (m_Section->m_JumpSection)
+            {
+                m_Section->GenerateSectionLinkage();
+            }
+        }
+        m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+    }
+    else if (HaveDebugger())
+    {
+        g_Notify->DisplayError(stdstr_f("WTF\n\nBranch\nNextInstruction = %X", m_PipelineStage).c_str());
+    }
 }
 
 void CAarch64RecompilerOps::SPECIAL_SYSCALL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() + g_System->CountPerOp());
+    CompileExit(m_CompilePC, m_CompilePC, m_RegWorkingSet, ExitReason_DoSysCall, true, nullptr);
+    if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+    {
+        m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+    }
 }
 
 void CAarch64RecompilerOps::SPECIAL_BREAK()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() + g_System->CountPerOp());
+    CompileExit(m_CompilePC, m_CompilePC, m_RegWorkingSet, ExitReason_Break, true, nullptr);
+    if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+    {
+        m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+    }
 }
 
 void CAarch64RecompilerOps::SPECIAL_SYNC()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
 }
 
 void CAarch64RecompilerOps::SPECIAL_MFLO()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    m_Assembler.MoveVariableToReg(asmjit::a64::x9, &m_Reg.m_LO.DW, "_RegLO");
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_MTLO()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    MoveGPRToVariable64(m_Opcode.rs, &m_Reg.m_LO.DW, "_RegLO");
 }
 
 void CAarch64RecompilerOps::SPECIAL_MFHI()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    m_Assembler.MoveVariableToReg(asmjit::a64::x9, &m_Reg.m_HI.DW, "_RegHI");
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_MTHI()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    MoveGPRToVariable64(m_Opcode.rs, &m_Reg.m_HI.DW, "_RegHI");
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSLLV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftVariable(true, Shift_Left);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSRLV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftVariable(true, Shift_RightLogical);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSRAV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftVariable(true, Shift_RightArithmetic);
 }
 
 void CAarch64RecompilerOps::SPECIAL_MULT()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        int64_t Result = (int64_t)(int32_t)ConstCompareValue(m_Opcode.rs) * (int64_t)(int32_t)ConstCompareValue(m_Opcode.rt);
+        m_Assembler.MoveConst64ToVariable(&m_Reg.m_LO.DW, "_RegLO", (int64_t)(int32_t)Result);
+        m_Assembler.MoveConst64ToVariable(&m_Reg.m_HI.DW, "_RegHI", (int64_t)(int32_t)(Result >> 32));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w10, m_Opcode.rt);
+    m_Assembler.smull(asmjit::a64::x9, asmjit::a64::w9, asmjit::a64::w10);
+    m_Assembler.sxtw(asmjit::a64::x10, asmjit::a64::w9);
+    m_Assembler.MoveRegToVariable(&m_Reg.m_LO.DW, "_RegLO", asmjit::a64::x10);
+    m_Assembler.asr(asmjit::a64::x9, asmjit::a64::x9, 32);
+    m_Assembler.MoveRegToVariable(&m_Reg.m_HI.DW, "_RegHI", asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_MULTU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        uint64_t Result = (uint64_t)(uint32_t)ConstCompareValue(m_Opcode.rs) * (uint64_t)(uint32_t)ConstCompareValue(m_Opcode.rt);
+        m_Assembler.MoveConst64ToVariable(&m_Reg.m_LO.DW, "_RegLO", (int64_t)(int32_t)Result);
+        m_Assembler.MoveConst64ToVariable(&m_Reg.m_HI.DW, "_RegHI", (int64_t)(int32_t)(Result >> 32));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w10, m_Opcode.rt);
+    m_Assembler.umull(asmjit::a64::x9, asmjit::a64::w9, asmjit::a64::w10);
+    m_Assembler.sxtw(asmjit::a64::x10, asmjit::a64::w9);
+    m_Assembler.MoveRegToVariable(&m_Reg.m_LO.DW, "_RegLO", asmjit::a64::x10);
+    m_Assembler.asr(asmjit::a64::x9, asmjit::a64::x9, 32);
+    m_Assembler.MoveRegToVariable(&m_Reg.m_HI.DW, "_RegHI", asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DIV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::SPECIAL_DIV), "R4300iOp::SPECIAL_DIV", m_Opcode.rs, m_Opcode.rt, 0, false);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DIVU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::SPECIAL_DIVU), "R4300iOp::SPECIAL_DIVU", m_Opcode.rs, m_Opcode.rt, 0, false);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DMULT()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::SPECIAL_DMULT), "R4300iOp::SPECIAL_DMULT", m_Opcode.rs, m_Opcode.rt, 0, false);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DMULTU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::SPECIAL_DMULTU), "R4300iOp::SPECIAL_DMULTU", m_Opcode.rs, m_Opcode.rt, 0, false);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DDIV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::SPECIAL_DDIV), "R4300iOp::SPECIAL_DDIV", m_Opcode.rs, m_Opcode.rt, 0, false);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DDIVU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::SPECIAL_DDIVU), "R4300iOp::SPECIAL_DDIVU", m_Opcode.rs, m_Opcode.rt, 0, false);
 }
 
 void CAarch64RecompilerOps::SPECIAL_ADD()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        int64_t Result = (int64_t)(int32_t)ConstCompareValue(m_Opcode.rs) + (int64_t)(int32_t)ConstCompareValue(m_Opcode.rt);
+        if (Result != (int32_t)Result)
+        {
+            CompileConstOverflow();
+            return;
+        }
+        m_RegWorkingSet.SetConst(m_Opcode.rd, (int32_t)Result);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w10, m_Opcode.rt);
+    m_Assembler.adds(asmjit::a64::w9, asmjit::a64::w9, asmjit::a64::w10);
+    CompileOverflowExit();
+    m_Assembler.sxtw(asmjit::a64::x9, asmjit::a64::w9);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_ADDU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, (int32_t)((uint32_t)ConstCompareValue(m_Opcode.rs) + (uint32_t)ConstCompareValue(m_Opcode.rt)));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w10, m_Opcode.rt);
+    m_Assembler.add(asmjit::a64::w9, asmjit::a64::w9, asmjit::a64::w10);
+    m_Assembler.sxtw(asmjit::a64::x9, asmjit::a64::w9);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_SUB()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        int64_t Result = (int64_t)(int32_t)ConstCompareValue(m_Opcode.rs) - (int64_t)(int32_t)ConstCompareValue(m_Opcode.rt);
+        if (Result != (int32_t)Result)
+        {
+            CompileConstOverflow();
+            return;
+        }
+        m_RegWorkingSet.SetConst(m_Opcode.rd, (int32_t)Result);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w10, m_Opcode.rt);
+    m_Assembler.subs(asmjit::a64::w9, asmjit::a64::w9, asmjit::a64::w10);
+    CompileOverflowExit();
+    m_Assembler.sxtw(asmjit::a64::x9, asmjit::a64::w9);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_SUBU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, (int32_t)((uint32_t)ConstCompareValue(m_Opcode.rs) - (uint32_t)ConstCompareValue(m_Opcode.rt)));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w10, m_Opcode.rt);
+    m_Assembler.sub(asmjit::a64::w9, asmjit::a64::w9, asmjit::a64::w10);
+    m_Assembler.sxtw(asmjit::a64::x9, asmjit::a64::w9);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_AND()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, ConstCompareValue(m_Opcode.rs) & ConstCompareValue(m_Opcode.rt));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x10, m_Opcode.rt);
+    m_Assembler.and_(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_OR()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, ConstCompareValue(m_Opcode.rs) | ConstCompareValue(m_Opcode.rt));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x10, m_Opcode.rt);
+    m_Assembler.orr(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_XOR()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (m_Opcode.rs == m_Opcode.rt)
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, 0);
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, ConstCompareValue(m_Opcode.rs) ^ ConstCompareValue(m_Opcode.rt));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x10, m_Opcode.rt);
+    m_Assembler.eor(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_NOR()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, ~(ConstCompareValue(m_Opcode.rs) | ConstCompareValue(m_Opcode.rt)));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x10, m_Opcode.rt);
+    m_Assembler.orr(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+    m_Assembler.mvn(asmjit::a64::x9, asmjit::a64::x9);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_SLT()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, ConstCompareValue(m_Opcode.rs) < ConstCompareValue(m_Opcode.rt) ? 1 : 0);
+        return;
+    }
+    CompareGPR(m_Opcode.rs, m_Opcode.rt);
+    m_Assembler.cset(asmjit::a64::x9, (uint32_t)asmjit::a64::CondCode::kLT);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_SLTU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, (uint64_t)ConstCompareValue(m_Opcode.rs) < (uint64_t)ConstCompareValue(m_Opcode.rt) ? 1 : 0);
+        return;
+    }
+    CompareGPR(m_Opcode.rs, m_Opcode.rt);
+    m_Assembler.cset(asmjit::a64::x9, (uint32_t)asmjit::a64::CondCode::kLO);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DADD()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        int64_t rs = ConstCompareValue(m_Opcode.rs);
+        int64_t rt = ConstCompareValue(m_Opcode.rt);
+        int64_t sum = (int64_t)((uint64_t)rs + (uint64_t)rt);
+        if ((~(rs ^ rt) & (rs ^ sum)) & 0x8000000000000000)
+        {
+            CompileConstOverflow();
+            return;
+        }
+        m_RegWorkingSet.SetConst(m_Opcode.rd, sum);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x10, m_Opcode.rt);
+    m_Assembler.adds(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+    CompileOverflowExit();
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DADDU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, (int64_t)((uint64_t)ConstCompareValue(m_Opcode.rs) + (uint64_t)ConstCompareValue(m_Opcode.rt)));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x10, m_Opcode.rt);
+    m_Assembler.add(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSUB()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        int64_t rs = ConstCompareValue(m_Opcode.rs);
+        int64_t rt = ConstCompareValue(m_Opcode.rt);
+        int64_t sub = (int64_t)((uint64_t)rs - (uint64_t)rt);
+        if (((rs ^ rt) & (rs ^ sub)) & 0x8000000000000000)
+        {
+            CompileConstOverflow();
+            return;
+        }
+        m_RegWorkingSet.SetConst(m_Opcode.rd, sub);
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x10, m_Opcode.rt);
+    m_Assembler.subs(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+    CompileOverflowExit();
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSUBU()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs) && IsConstGPR(m_Opcode.rt))
+    {
+        m_RegWorkingSet.SetConst(m_Opcode.rd, (int64_t)((uint64_t)ConstCompareValue(m_Opcode.rs) - (uint64_t)ConstCompareValue(m_Opcode.rt)));
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rs);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x10, m_Opcode.rt);
+    m_Assembler.sub(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSLL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftConst(true, m_Opcode.sa, Shift_Left);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSRL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftConst(true, m_Opcode.sa, Shift_RightLogical);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSRA()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftConst(true, m_Opcode.sa, Shift_RightArithmetic);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSLL32()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftConst(true, m_Opcode.sa + 32, Shift_Left);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSRL32()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftConst(true, m_Opcode.sa + 32, Shift_RightLogical);
 }
 
 void CAarch64RecompilerOps::SPECIAL_DSRA32()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    ShiftConst(true, m_Opcode.sa + 32, Shift_RightArithmetic);
 }
 
+// COP0 functions
 void CAarch64RecompilerOps::COP0_MF()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == CRegisters::COP0Reg_Count)
+    {
+        UpdateCounters(m_RegWorkingSet, false, true);
+    }
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w1, m_Opcode.rd);
+    m_Assembler.CallThis((uintptr_t)g_Reg, AddressOf(&CRegisters::Cop0_MF), "CRegisters::Cop0_MF");
+    m_Assembler.sxtw(asmjit::a64::x0, asmjit::a64::w0);
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x0);
 }
 
 void CAarch64RecompilerOps::COP0_DMF()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == CRegisters::COP0Reg_Count)
+    {
+        UpdateCounters(m_RegWorkingSet, false, true);
+    }
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w1, m_Opcode.rd);
+    m_Assembler.CallThis((uintptr_t)g_Reg, AddressOf(&CRegisters::Cop0_MF), "CRegisters::Cop0_MF");
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x0);
 }
 
 void CAarch64RecompilerOps::COP0_MT()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == CRegisters::COP0Reg_Wired || m_Opcode.rd == CRegisters::COP0Reg_Compare || m_Opcode.rd == CRegisters::COP0Reg_Count)
+    {
+        UpdateCounters(m_RegWorkingSet, false, true);
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::w2, m_Opcode.rt);
+    m_Assembler.sxtw(asmjit::a64::x2, asmjit::a64::w2);
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w1, m_Opcode.rd);
+    m_Assembler.CallThis((uintptr_t)g_Reg, AddressOf(&CRegisters::Cop0_MT), "CRegisters::Cop0_MT");
 }
 
 void CAarch64RecompilerOps::COP0_DMT()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_Opcode.rd == CRegisters::COP0Reg_Count)
+    {
+        UpdateCounters(m_RegWorkingSet, false, true);
+    }
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x2, m_Opcode.rt);
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w1, m_Opcode.rd);
+    m_Assembler.CallThis((uintptr_t)g_Reg, AddressOf(&CRegisters::Cop0_MT), "CRegisters::Cop0_MT");
+}
+
+// COP0 CO functions
+void CAarch64RecompilerOps::COP0_CO_TLBR(void)
+{
+    m_Assembler.CallThis((uintptr_t)&m_TLB, AddressOf(&CTLB::ReadEntry), "CTLB::ReadEntry");
 }
 
-void CAarch64RecompilerOps::COP0_CO_TLBR()
+void CAarch64RecompilerOps::COP0_CO_TLBWI(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Assembler.MoveVariableToReg(asmjit::a64::w1, &g_Reg->INDEX_REGISTER, "INDEX_REGISTER");
+    m_Assembler.and_(asmjit::a64::w1, asmjit::a64::w1, 0x1F);
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w2, false);
+    m_Assembler.CallThis((uintptr_t)&m_TLB, AddressOf(&CTLB::WriteEntry), "CTLB::WriteEntry");
 }
 
-void CAarch64RecompilerOps::COP0_CO_TLBWI()
+void CAarch64RecompilerOps::COP0_CO_TLBWR(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    UpdateCounters(m_RegWorkingSet, false, true);
+    m_Assembler.CallThis((uintptr_t)g_SystemTimer, AddressOf(&CSystemTimer::UpdateTimers), "CSystemTimer::UpdateTimers");
+    m_Assembler.MoveVariableToReg(asmjit::a64::w1, &g_Reg->RANDOM_REGISTER, "RANDOM_REGISTER");
+    m_Assembler.and_(asmjit::a64::w1, asmjit::a64::w1, 0x1F);
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w2, true);
+    m_Assembler.CallThis((uintptr_t)&m_TLB, AddressOf(&CTLB::WriteEntry), "CTLB::WriteEntry");
 }
 
-void CAarch64RecompilerOps::COP0_CO_TLBWR()
+void CAarch64RecompilerOps::COP0_CO_TLBP(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Assembler.CallThis((uintptr_t)&m_TLB, AddressOf(&CTLB::Probe), "CTLB::TLB_Probe");
 }
 
-void CAarch64RecompilerOps::COP0_CO_TLBP()
+void Aarch64_compiler_COP0_CO_ERET()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (g_Reg->STATUS_REGISTER.ErrorLevel != 0)
+    {
+        g_Reg->m_PROGRAM_COUNTER = g_Reg->ERROREPC_REGISTER;
+        g_Reg->STATUS_REGISTER.ErrorLevel = 0;
+    }
+    else
+    {
+        g_Reg->m_PROGRAM_COUNTER = g_Reg->EPC_REGISTER;
+        g_Reg->STATUS_REGISTER.ExceptionLevel = 0;
+    }
+    g_Reg->m_LLBit = 0;
+    g_Reg->CheckInterrupts();
 }
 
-void CAarch64RecompilerOps::COP0_CO_ERET()
+void CAarch64RecompilerOps::COP0_CO_ERET(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() + g_System->CountPerOp());
+    m_RegWorkingSet.WriteBackRegisters();
+    m_Assembler.CallFunc((uintptr_t)Aarch64_compiler_COP0_CO_ERET, "Aarch64_compiler_COP0_CO_ERET");
+
+    UpdateCounters(m_RegWorkingSet, true, true);
+    CompileExit(m_CompilePC, (uint32_t)-1, m_RegWorkingSet, ExitReason_Normal, true, nullptr);
+    m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
 }
 
+// COP1 functions
 void CAarch64RecompilerOps::COP1_MF()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_MF), "R4300iOp::COP1_MF", 0, 0, m_Opcode.rt, false);
 }
 
 void CAarch64RecompilerOps::COP1_DMF()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_DMF), "R4300iOp::COP1_DMF", 0, 0, m_Opcode.rt, false);
 }
 
 void CAarch64RecompilerOps::COP1_CF()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_CF), "R4300iOp::COP1_CF", 0, 0, m_Opcode.rt, false);
 }
 
 void CAarch64RecompilerOps::COP1_MT()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_MT), "R4300iOp::COP1_MT", m_Opcode.rt, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_DMT()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_DMT), "R4300iOp::COP1_DMT", m_Opcode.rt, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_CT()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_CT), "R4300iOp::COP1_CT", m_Opcode.rt, 0, 0, false);
 }
 
+// COP1: S functions
 void CAarch64RecompilerOps::COP1_S_ADD()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_ADD), "R4300iOp::COP1_S_ADD", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_SUB()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_SUB), "R4300iOp::COP1_S_SUB", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_MUL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_MUL), "R4300iOp::COP1_S_MUL", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_DIV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_DIV), "R4300iOp::COP1_S_DIV", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_ABS()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_ABS), "R4300iOp::COP1_S_ABS", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_NEG()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_NEG), "R4300iOp::COP1_S_NEG", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_SQRT()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_SQRT), "R4300iOp::COP1_S_SQRT", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_MOV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_MOV), "R4300iOp::COP1_S_MOV", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_ROUND_L()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_ROUND_L), "R4300iOp::COP1_S_ROUND_L", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_TRUNC_L()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_TRUNC_L), "R4300iOp::COP1_S_TRUNC_L", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_CEIL_L()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_CEIL_L), "R4300iOp::COP1_S_CEIL_L", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_FLOOR_L()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_FLOOR_L), "R4300iOp::COP1_S_FLOOR_L", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_ROUND_W()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_ROUND_W), "R4300iOp::COP1_S_ROUND_W", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_TRUNC_W()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_TRUNC_W), "R4300iOp::COP1_S_TRUNC_W", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_CEIL_W()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_CEIL_W), "R4300iOp::COP1_S_CEIL_W", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_FLOOR_W()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_FLOOR_W), "R4300iOp::COP1_S_FLOOR_W", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_CVT_D()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_CVT_D), "R4300iOp::COP1_S_CVT_D", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_CVT_W()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_CVT_W), "R4300iOp::COP1_S_CVT_W", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_CVT_L()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_CVT_L), "R4300iOp::COP1_S_CVT_L", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_S_CMP()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_S_CMP), "R4300iOp::COP1_S_CMP", 0, 0, 0, false);
 }
 
+// COP1: D functions
 void CAarch64RecompilerOps::COP1_D_ADD()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_ADD), "R4300iOp::COP1_D_ADD", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_SUB()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_SUB), "R4300iOp::COP1_D_SUB", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_MUL()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_MUL), "R4300iOp::COP1_D_MUL", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_DIV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_DIV), "R4300iOp::COP1_D_DIV", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_ABS()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_ABS), "R4300iOp::COP1_D_ABS", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_NEG()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_NEG), "R4300iOp::COP1_D_NEG", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_SQRT()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_SQRT), "R4300iOp::COP1_D_SQRT", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_MOV()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_MOV), "R4300iOp::COP1_D_MOV", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_ROUND_L()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_ROUND_L), "R4300iOp::COP1_D_ROUND_L", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_TRUNC_L()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_TRUNC_L), "R4300iOp::COP1_D_TRUNC_L", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_CEIL_L()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_CEIL_L), "R4300iOp::COP1_D_CEIL_L", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_FLOOR_L()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_FLOOR_L), "R4300iOp::COP1_D_FLOOR_L", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_ROUND_W()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_ROUND_W), "R4300iOp::COP1_D_ROUND_W", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_TRUNC_W()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_TRUNC_W), "R4300iOp::COP1_D_TRUNC_W", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_CEIL_W()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_CEIL_W), "R4300iOp::COP1_D_CEIL_W", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_FLOOR_W()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_FLOOR_W), "R4300iOp::COP1_D_FLOOR_W", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_CVT_S()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_CVT_S), "R4300iOp::COP1_D_CVT_S", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_CVT_W()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_CVT_W), "R4300iOp::COP1_D_CVT_W", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_CVT_L()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_CVT_L), "R4300iOp::COP1_D_CVT_L", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_D_CMP()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_D_CMP), "R4300iOp::COP1_D_CMP", 0, 0, 0, false);
 }
 
+// COP1: W functions
 void CAarch64RecompilerOps::COP1_W_CVT_S()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_W_CVT_S), "R4300iOp::COP1_W_CVT_S", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_W_CVT_D()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_W_CVT_D), "R4300iOp::COP1_W_CVT_D", 0, 0, 0, false);
 }
 
+// COP1: L functions
 void CAarch64RecompilerOps::COP1_L_CVT_S()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_L_CVT_S), "R4300iOp::COP1_L_CVT_S", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::COP1_L_CVT_D()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileInterpreterOp(AddressOf(&R4300iOp::COP1_L_CVT_D), "R4300iOp::COP1_L_CVT_D", 0, 0, 0, false);
 }
 
 void CAarch64RecompilerOps::UnknownOpcode()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_CodeBlock.Log("  %X Unhandled opcode: %s", m_CompilePC, R4300iInstruction(m_CompilePC, m_Opcode.Value).NameAndParam().c_str());
+
+    m_RegWorkingSet.WriteBackRegisters();
+    UpdateCounters(m_RegWorkingSet, false, true);
+    m_Assembler.MoveConst64ToVariable(&g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER", (int64_t)(int32_t)m_CompilePC);
+    m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() - g_System->CountPerOp());
+
+    m_Assembler.MoveConstToVariable(&g_System->m_OpCodes.m_Opcode.Value, "R4300iOp::m_Opcode.Value", m_Opcode.Value);
+    m_Assembler.CallThis((uintptr_t)&g_System->m_OpCodes, AddressOf(&R4300iOp::UnknownOpcode), "R4300iOp::UnknownOpcode");
+    ExitCodeBlock();
+    if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+    {
+        m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+    }
+}
+
+void CAarch64RecompilerOps::BaseOffsetAddress(const asmjit::a64::GpX & AddressReg)
+{
+    if (IsConstGPR(m_Opcode.base))
+    {
+        uint64_t Address = (uint64_t)ConstCompareValue(m_Opcode.base) + (int64_t)(int16_t)m_Opcode.offset;
+        m_Assembler.MoveConst64ToReg(AddressReg, b32BitCore() ? (uint64_t)(int64_t)(int32_t)Address : Address);
+        return;
+    }
+    if (b32BitCore())
+    {
+        m_RegWorkingSet.Map_TempReg(AddressReg.w(), m_Opcode.base);
+        m_Assembler.AddConstToReg(AddressReg.w(), AddressReg.w(), (int16_t)m_Opcode.offset);
+        m_Assembler.sxtw(AddressReg, AddressReg.w());
+        return;
+    }
+    m_RegWorkingSet.Map_TempReg(AddressReg, m_Opcode.base);
+    m_Assembler.AddConstToReg(AddressReg, AddressReg, (int16_t)m_Opcode.offset);
+}
+
+void CAarch64RecompilerOps::CompileLoad(uint8_t ValueSize, bool SignExtend)
+{
+    if (HaveReadBP())
+    {
+        // The memory functions of the interpreter check for read breakpoints
+        switch (m_Opcode.op)
+        {
+        case R4300i_LB: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LB_32) : AddressOf(&R4300iOp::LB), "R4300iOp::LB", m_Opcode.base, 0, m_Opcode.rt, true); break;
+        case R4300i_LBU: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LBU_32) : AddressOf(&R4300iOp::LBU), "R4300iOp::LBU", m_Opcode.base, 0, m_Opcode.rt, true); break;
+        case R4300i_LH: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LH_32) : AddressOf(&R4300iOp::LH), "R4300iOp::LH", m_Opcode.base, 0, m_Opcode.rt, true); break;
+        case R4300i_LHU: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LHU_32) : AddressOf(&R4300iOp::LHU), "R4300iOp::LHU", m_Opcode.base, 0, m_Opcode.rt, true); break;
+        case R4300i_LW: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LW_32) : AddressOf(&R4300iOp::LW), "R4300iOp::LW", m_Opcode.base, 0, m_Opcode.rt, true); break;
+        case R4300i_LWU: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LWU_32) : AddressOf(&R4300iOp::LWU), "R4300iOp::LWU", m_Opcode.base, 0, m_Opcode.rt, true); break;
+        case R4300i_LD: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::LD_32) : AddressOf(&R4300iOp::LD), "R4300iOp::LD", m_Opcode.base, 0, m_Opcode.rt, true); break;
+        default:
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+        return;
+    }
+
+    asmjit::Label SlowPath = m_Assembler.newLabel();
+    asmjit::Label Done = m_Assembler.newLabel();
+
+    BaseOffsetAddress(asmjit::a64::x9);
+    if (!b32BitCore())
+    {
+        m_Assembler.sxtw(asmjit::a64::x10, asmjit::a64::w9);
+        m_Assembler.cmp(asmjit::a64::x9, asmjit::a64::x10);
+        m_Assembler.BneLabel("SlowPath", SlowPath);
+    }
+    if (ValueSize > 8)
+    {
+        m_Assembler.tst(asmjit::a64::w9, (ValueSize / 8) - 1);
+        m_Assembler.BneLabel("SlowPath", SlowPath);
+    }
+    m_Assembler.lsr(asmjit::a64::w12, asmjit::a64::w9, 12);
+    m_Assembler.MoveConstPtrToReg(asmjit::a64::x10, g_MMU->m_MemoryReadMap, "MMU->m_MemoryReadMap");
+    m_Assembler.ldr(asmjit::a64::x10, asmjit::a64::ptr(asmjit::a64::x10, asmjit::a64::x12, asmjit::arm::lsl(3)));
+    m_Assembler.CompConstToReg(asmjit::a64::x10, -1);
+    m_Assembler.BeqLabel("SlowPath", SlowPath);
+
+    m_Assembler.mov(asmjit::a64::w12, asmjit::a64::w9);
+    if (ValueSize == 8)
+    {
+        m_Assembler.eor(asmjit::a64::x12, asmjit::a64::x12, 3);
+    }
+    else if (ValueSize == 16)
+    {
+        m_Assembler.eor(asmjit::a64::x12, asmjit::a64::x12, 2);
+    }
+    switch (ValueSize)
+    {
+    case 8: m_Assembler.ldrb(asmjit::a64::w11, asmjit::a64::ptr(asmjit::a64::x10, asmjit::a64::x12)); break;
+    case 16: m_Assembler.ldrh(asmjit::a64::w11, asmjit::a64::ptr(asmjit::a64::x10, asmjit::a64::x12)); break;
+    case 32: m_Assembler.ldr(asmjit::a64::w11, asmjit::a64::ptr(asmjit::a64::x10, asmjit::a64::x12)); break;
+    default:
+        // The two words of a double word are stored in host order, so swap them after the load
+        m_Assembler.ldr(asmjit::a64::x11, asmjit::a64::ptr(asmjit::a64::x10, asmjit::a64::x12));
+        m_Assembler.ror(asmjit::a64::x11, asmjit::a64::x11, 32);
+        break;
+    }
+    m_Assembler.BLabel("Done", Done);
+
+    m_CodeBlock.Log("");
+    m_Assembler.bind(SlowPath);
+    bool InDelaySlot = m_PipelineStage == PIPELINE_STAGE_JUMP || m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT;
+    m_Assembler.MoveConst64ToVariable(&g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER", (int64_t)(int32_t)m_CompilePC);
+    if (InDelaySlot)
+    {
+        m_Assembler.MoveConstToVariable(&g_System->m_PipelineStage, "g_System->m_PipelineStage", PIPELINE_STAGE_JUMP);
+    }
+    m_Assembler.mov(asmjit::a64::x1, asmjit::a64::x9);
+    switch (ValueSize)
+    {
+    case 8:
+        m_Assembler.MoveConstPtrToReg(asmjit::a64::x2, &m_TempValue32, "m_TempValue32");
+        m_Assembler.CallThis((uintptr_t)g_MMU, AddressOf(&CMipsMemoryVM::LB_Memory), "CMipsMemoryVM::LB_Memory");
+        break;
+    case 16:
+        m_Assembler.MoveConstPtrToReg(asmjit::a64::x2, &m_TempValue32, "m_TempValue32");
+        m_Assembler.CallThis((uintptr_t)g_MMU, AddressOf(&CMipsMemoryVM::LH_Memory), "CMipsMemoryVM::LH_Memory");
+        break;
+    case 32:
+        m_Assembler.MoveConstPtrToReg(asmjit::a64::x2, &m_TempValue32, "m_TempValue32");
+        m_Assembler.CallThis((uintptr_t)g_MMU, AddressOf(&CMipsMemoryVM::LW_Memory), "CMipsMemoryVM::LW_Memory");
+        break;
+    default:
+        m_Assembler.MoveConstPtrToReg(asmjit::a64::x2, &m_TempValue64, "m_TempValue64");
+        m_Assembler.CallThis((uintptr_t)g_MMU, AddressOf(&CMipsMemoryVM::LD_Memory), "CMipsMemoryVM::LD_Memory");
+        break;
+    }
+    m_Assembler.tst(asmjit::a64::w0, 0xFF);
+    CRegInfo ExitRegSet = m_RegWorkingSet;
+    ExitRegSet.SetBlockCycleCount(ExitRegSet.GetBlockCycleCount() + g_System->CountPerOp());
+    CompileExit((uint32_t)-1, (uint32_t)-1, ExitRegSet, ExitReason_Exception, false, &CAarch64Ops::BeqLabel);
+    switch (ValueSize)
+    {
+    case 8: m_Assembler.MoveVariableToReg(asmjit::a64::w11, &m_TempValue32, "m_TempValue32"); m_Assembler.and_(asmjit::a64::w11, asmjit::a64::w11, 0xFF); break;
+    case 16: m_Assembler.MoveVariableToReg(asmjit::a64::w11, &m_TempValue32, "m_TempValue32"); m_Assembler.and_(asmjit::a64::w11, asmjit::a64::w11, 0xFFFF); break;
+    case 32: m_Assembler.MoveVariableToReg(asmjit::a64::w11, &m_TempValue32, "m_TempValue32"); break;
+    default: m_Assembler.MoveVariableToReg(asmjit::a64::x11, &m_TempValue64, "m_TempValue64"); break;
+    }
+    if (InDelaySlot)
+    {
+        m_Assembler.MoveConstToVariable(&g_System->m_PipelineStage, "g_System->m_PipelineStage", PIPELINE_STAGE_NORMAL);
+    }
+
+    m_CodeBlock.Log("");
+    m_Assembler.bind(Done);
+    if (m_Opcode.rt == 0)
+    {
+        return;
+    }
+    switch (ValueSize)
+    {
+    case 8:
+        if (SignExtend)
+        {
+            m_Assembler.sxtb(asmjit::a64::x11, asmjit::a64::w11);
+        }
+        break;
+    case 16:
+        if (SignExtend)
+        {
+            m_Assembler.sxth(asmjit::a64::x11, asmjit::a64::w11);
+        }
+        break;
+    case 32:
+        if (SignExtend)
+        {
+            m_Assembler.sxtw(asmjit::a64::x11, asmjit::a64::w11);
+        }
+        break;
+    }
+    m_RegWorkingSet.StoreGPR(m_Opcode.rt, asmjit::a64::x11);
+}
+
+void CAarch64RecompilerOps::CompileStore(uint8_t ValueSize)
+{
+    if (HaveWriteBP())
+    {
+        // The memory functions of the interpreter check for write breakpoints
+        switch (m_Opcode.op)
+        {
+        case R4300i_SB: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SB_32) : AddressOf(&R4300iOp::SB), "R4300iOp::SB", m_Opcode.base, m_Opcode.rt, 0, true); break;
+        case R4300i_SH: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SH_32) : AddressOf(&R4300iOp::SH), "R4300iOp::SH", m_Opcode.base, m_Opcode.rt, 0, true); break;
+        case R4300i_SW: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SW_32) : AddressOf(&R4300iOp::SW), "R4300iOp::SW", m_Opcode.base, m_Opcode.rt, 0, true); break;
+        case R4300i_SD: CompileInterpreterOp(b32BitCore() ? AddressOf(&R4300iOp::SD_32) : AddressOf(&R4300iOp::SD), "R4300iOp::SD", m_Opcode.base, m_Opcode.rt, 0, true); break;
+        default:
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+        return;
+    }
+
+    asmjit::Label SlowPath = m_Assembler.newLabel();
+    asmjit::Label Done = m_Assembler.newLabel();
+
+    BaseOffsetAddress(asmjit::a64::x9);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x11, m_Opcode.rt);
+    if (!b32BitCore())
+    {
+        m_Assembler.sxtw(asmjit::a64::x10, asmjit::a64::w9);
+        m_Assembler.cmp(asmjit::a64::x9, asmjit::a64::x10);
+        m_Assembler.BneLabel("SlowPath", SlowPath);
+    }
+    if (ValueSize > 8)
+    {
+        m_Assembler.tst(asmjit::a64::w9, (ValueSize / 8) - 1);
+        m_Assembler.BneLabel("SlowPath", SlowPath);
+    }
+    m_Assembler.lsr(asmjit::a64::w12, asmjit::a64::w9, 12);
+    m_Assembler.MoveConstPtrToReg(asmjit::a64::x10, g_MMU->m_MemoryWriteMap, "MMU->m_MemoryWriteMap");
+    m_Assembler.ldr(asmjit::a64::x10, asmjit::a64::ptr(asmjit::a64::x10, asmjit::a64::x12, asmjit::arm::lsl(3)));
+    m_Assembler.CompConstToReg(asmjit::a64::x10, -1);
+    m_Assembler.BeqLabel("SlowPath", SlowPath);
+
+    m_Assembler.mov(asmjit::a64::w12, asmjit::a64::w9);
+    switch (ValueSize)
+    {
+    case 8:
+        m_Assembler.eor(asmjit::a64::x12, asmjit::a64::x12, 3);
+        m_Assembler.strb(asmjit::a64::w11, asmjit::a64::ptr(asmjit::a64::x10, asmjit::a64::x12));
+        break;
+    case 16:
+        m_Assembler.eor(asmjit::a64::x12, asmjit::a64::x12, 2);
+        m_Assembler.strh(asmjit::a64::w11, asmjit::a64::ptr(asmjit::a64::x10, asmjit::a64::x12));
+        break;
+    case 32:
+        m_Assembler.str(asmjit::a64::w11, asmjit::a64::ptr(asmjit::a64::x10, asmjit::a64::x12));
+        break;
+    default:
+        m_Assembler.ror(asmjit::a64::x13, asmjit::a64::x11, 32);
+        m_Assembler.str(asmjit::a64::x13, asmjit::a64::ptr(asmjit::a64::x10, asmjit::a64::x12));
+        break;
+    }
+    m_Assembler.BLabel("Done", Done);
+
+    m_CodeBlock.Log("");
+    m_Assembler.bind(SlowPath);
+    bool InDelaySlot = m_PipelineStage == PIPELINE_STAGE_JUMP || m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT;
+    m_Assembler.MoveConst64ToVariable(&g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER", (int64_t)(int32_t)m_CompilePC);
+    if (InDelaySlot)
+    {
+        m_Assembler.MoveConstToVariable(&g_System->m_PipelineStage, "g_System->m_PipelineStage", PIPELINE_STAGE_JUMP);
+    }
+    // A write to a timer or interrupt register needs an accurate count of the cycles executed
+    uint32_t Cycles = m_RegWorkingSet.GetBlockCycleCount();
+    if (Cycles != 0)
+    {
+        m_Assembler.SubConstFromVariable(Cycles, g_NextTimer, "g_NextTimer");
+    }
+    m_Assembler.mov(asmjit::a64::x1, asmjit::a64::x9);
+    switch (ValueSize)
+    {
+    case 8:
+        m_Assembler.mov(asmjit::a64::w2, asmjit::a64::w11);
+        m_Assembler.CallThis((uintptr_t)g_MMU, AddressOf(&CMipsMemoryVM::SB_Memory), "CMipsMemoryVM::SB_Memory");
+        break;
+    case 16:
+        m_Assembler.mov(asmjit::a64::w2, asmjit::a64::w11);
+        m_Assembler.CallThis((uintptr_t)g_MMU, AddressOf(&CMipsMemoryVM::SH_Memory), "CMipsMemoryVM::SH_Memory");
+        break;
+    case 32:
+        m_Assembler.mov(asmjit::a64::w2, asmjit::a64::w11);
+        m_Assembler.CallThis((uintptr_t)g_MMU, AddressOf(&CMipsMemoryVM::SW_Memory), "CMipsMemoryVM::SW_Memory");
+        break;
+    default:
+        m_Assembler.mov(asmjit::a64::x2, asmjit::a64::x11);
+        m_Assembler.CallThis((uintptr_t)g_MMU, AddressOf(&CMipsMemoryVM::SD_Memory), "CMipsMemoryVM::SD_Memory");
+        break;
+    }
+    if (Cycles != 0)
+    {
+        m_Assembler.AddConstToVariable(g_NextTimer, "g_NextTimer", Cycles);
+    }
+    m_Assembler.tst(asmjit::a64::w0, 0xFF);
+    CRegInfo ExitRegSet = m_RegWorkingSet;
+    ExitRegSet.SetBlockCycleCount(ExitRegSet.GetBlockCycleCount() + g_System->CountPerOp());
+    CompileExit((uint32_t)-1, (uint32_t)-1, ExitRegSet, ExitReason_Exception, false, &CAarch64Ops::BeqLabel);
+    if (InDelaySlot)
+    {
+        m_Assembler.MoveConstToVariable(&g_System->m_PipelineStage, "g_System->m_PipelineStage", PIPELINE_STAGE_NORMAL);
+    }
+
+    m_CodeBlock.Log("");
+    m_Assembler.bind(Done);
+}
+
+void CAarch64RecompilerOps::CompileInterpreterOp(uintptr_t FunctAddress, const char * FunctName, int32_t ReadReg1, int32_t ReadReg2, int32_t WriteReg, bool SyncTimer)
+{
+    m_RegWorkingSet.UnMap_GPR(ReadReg1, true);
+    m_RegWorkingSet.UnMap_GPR(ReadReg2, true);
+
+    CRegInfo ExitRegSet = m_RegWorkingSet;
+    ExitRegSet.SetBlockCycleCount(ExitRegSet.GetBlockCycleCount() + g_System->CountPerOp());
+    ExitRegSet.UnMap_GPR(WriteReg, false);
+    m_RegWorkingSet.UnMap_GPR(WriteReg, false);
+
+    bool InDelaySlot = m_PipelineStage == PIPELINE_STAGE_JUMP || m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT;
+    m_Assembler.MoveConst64ToVariable(&g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER", (int64_t)(int32_t)m_CompilePC);
+    if (InDelaySlot)
+    {
+        m_Assembler.MoveConstToVariable(&g_System->m_PipelineStage, "g_System->m_PipelineStage", PIPELINE_STAGE_JUMP);
+    }
+
+    // An exception sets the jump location to the exception vector, which is never 1. The value
+    // of the jump location is kept in a callee-saved register so it can be restored afterwards
+    m_Assembler.MoveVariableToReg(asmjit::a64::x20, &g_System->m_JumpToLocation, "System::m_JumpToLocation");
+    m_Assembler.MoveConst64ToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", 1);
+
+    uint32_t Cycles = m_RegWorkingSet.GetBlockCycleCount();
+    if (SyncTimer && Cycles != 0)
+    {
+        m_Assembler.SubConstFromVariable(Cycles, g_NextTimer, "g_NextTimer");
+    }
+    m_Assembler.MoveConstToVariable(&g_System->m_OpCodes.m_Opcode.Value, "R4300iOp::m_Opcode.Value", m_Opcode.Value);
+    m_Assembler.CallThis((uintptr_t)&g_System->m_OpCodes, FunctAddress, FunctName);
+    if (SyncTimer && Cycles != 0)
+    {
+        m_Assembler.AddConstToVariable(g_NextTimer, "g_NextTimer", Cycles);
+    }
+
+    m_Assembler.MoveVariableToReg(asmjit::a64::x9, &g_System->m_JumpToLocation, "System::m_JumpToLocation");
+    m_Assembler.CompConstToReg(asmjit::a64::x9, 1);
+    CompileExit((uint32_t)-1, (uint32_t)-1, ExitRegSet, ExitReason_Exception, false, &CAarch64Ops::BneLabel);
+    m_Assembler.MoveRegToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", asmjit::a64::x20);
+    if (InDelaySlot)
+    {
+        m_Assembler.MoveConstToVariable(&g_System->m_PipelineStage, "g_System->m_PipelineStage", PIPELINE_STAGE_NORMAL);
+    }
+}
+
+void CAarch64RecompilerOps::CompileOverflowExit(void)
+{
+    CRegInfo ExitRegSet = m_RegWorkingSet;
+    ExitRegSet.SetBlockCycleCount(ExitRegSet.GetBlockCycleCount() + g_System->CountPerOp());
+    CompileExit(m_CompilePC, m_CompilePC, ExitRegSet, ExitReason_ExceptionOverflow, false, &CAarch64Ops::BvsLabel);
+}
+
+void CAarch64RecompilerOps::CompileConstOverflow(void)
+{
+    m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() + g_System->CountPerOp());
+    CompileExit(m_CompilePC, m_CompilePC, m_RegWorkingSet, ExitReason_ExceptionOverflow, true, nullptr);
+    if (m_PipelineStage == PIPELINE_STAGE_NORMAL)
+    {
+        m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+    }
+}
+
+void CAarch64RecompilerOps::ShiftConst(bool Is64Bit, uint32_t Shift, ShiftType Type)
+{
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rt))
+    {
+        int64_t Value = ConstCompareValue(m_Opcode.rt);
+        if (Is64Bit)
+        {
+            switch (Type)
+            {
+            case Shift_Left: Value = (int64_t)((uint64_t)Value << Shift); break;
+            case Shift_RightLogical: Value = (int64_t)((uint64_t)Value >> Shift); break;
+            case Shift_RightArithmetic: Value = Value >> Shift; break;
+            }
+        }
+        else
+        {
+            switch (Type)
+            {
+            case Shift_Left: Value = (int32_t)((uint32_t)Value << Shift); break;
+            case Shift_RightLogical: Value = (int32_t)((uint32_t)Value >> Shift); break;
+            case Shift_RightArithmetic: Value = (int32_t)(Value >> Shift); break;
+            }
+        }
+        m_RegWorkingSet.SetConst(m_Opcode.rd, Value);
+        return;
+    }
+
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rt);
+    if (Shift != 0)
+    {
+        switch (Type)
+        {
+        case Shift_Left:
+            if (Is64Bit)
+            {
+                m_Assembler.lsl(asmjit::a64::x9, asmjit::a64::x9, Shift);
+            }
+            else
+            {
+                m_Assembler.lsl(asmjit::a64::w9, asmjit::a64::w9, Shift);
+            }
+            break;
+        case Shift_RightLogical:
+            if (Is64Bit)
+            {
+                m_Assembler.lsr(asmjit::a64::x9, asmjit::a64::x9, Shift);
+            }
+            else
+            {
+                m_Assembler.lsr(asmjit::a64::w9, asmjit::a64::w9, Shift);
+            }
+            break;
+        case Shift_RightArithmetic:
+            // The interpreter shifts the whole double word for SRA, the low word is then sign extended
+            m_Assembler.asr(asmjit::a64::x9, asmjit::a64::x9, Shift);
+            break;
+        }
+    }
+    if (!Is64Bit)
+    {
+        m_Assembler.sxtw(asmjit::a64::x9, asmjit::a64::w9);
+    }
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
+}
+
+void CAarch64RecompilerOps::ShiftVariable(bool Is64Bit, ShiftType Type)
+{
+    if (m_Opcode.rd == 0)
+    {
+        return;
+    }
+    if (IsConstGPR(m_Opcode.rs))
+    {
+        ShiftConst(Is64Bit, (uint32_t)ConstCompareValue(m_Opcode.rs) & (Is64Bit ? 0x3F : 0x1F), Type);
+        return;
+    }
+
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x9, m_Opcode.rt);
+    m_RegWorkingSet.Map_TempReg(asmjit::a64::x10, m_Opcode.rs);
+    switch (Type)
+    {
+    case Shift_Left:
+        if (Is64Bit)
+        {
+            m_Assembler.lsl(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+        }
+        else
+        {
+            m_Assembler.lsl(asmjit::a64::w9, asmjit::a64::w9, asmjit::a64::w10);
+        }
+        break;
+    case Shift_RightLogical:
+        if (Is64Bit)
+        {
+            m_Assembler.lsr(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+        }
+        else
+        {
+            m_Assembler.lsr(asmjit::a64::w9, asmjit::a64::w9, asmjit::a64::w10);
+        }
+        break;
+    case Shift_RightArithmetic:
+        if (!Is64Bit)
+        {
+            // A 64-bit shift only masks the amount with 63
+            m_Assembler.and_(asmjit::a64::w10, asmjit::a64::w10, 0x1F);
+        }
+        m_Assembler.asr(asmjit::a64::x9, asmjit::a64::x9, asmjit::a64::x10);
+        break;
+    }
+    if (!Is64Bit)
+    {
+        m_Assembler.sxtw(asmjit::a64::x9, asmjit::a64::w9);
+    }
+    m_RegWorkingSet.StoreGPR(m_Opcode.rd, asmjit::a64::x9);
 }
 
 void CAarch64RecompilerOps::EnterCodeBlock()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Assembler.EnterStackFrame();
+    m_Assembler.MoveConstPtrToReg(Aarch64GprBaseReg, m_Reg.m_GPR, "_GPR");
 }
 
-void CAarch64RecompilerOps::CompileExitCode()
+void CAarch64RecompilerOps::ExitCodeBlock()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (g_SyncSystem)
+    {
+        m_Assembler.CallThis((uintptr_t)g_BaseSystem, AddressOf(&CN64System::SyncSystem), "CN64System::SyncSystem");
+    }
+    m_Assembler.ExitStackFrame();
+    m_Assembler.ret(asmjit::a64::x30);
 }
 
-void CAarch64RecompilerOps::CompileInPermLoop(CRegInfo & /*RegSet*/, uint32_t /*ProgramCounter*/)
+void CAarch64RecompilerOps::CompileExitCode()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    for (EXIT_LIST::iterator ExitIter = m_ExitInfo.begin(); ExitIter != m_ExitInfo.end(); ExitIter++)
+    {
+        m_CodeBlock.Log("");
+        m_Assembler.bind(ExitIter->JumpLabel);
+        m_PipelineStage = ExitIter->PipelineStage;
+        CompileExit((uint32_t)-1, ExitIter->TargetPC, ExitIter->ExitRegSet, ExitIter->Reason, true, nullptr);
+    }
 }
 
-void CAarch64RecompilerOps::SyncRegState(const CRegInfo & /*SyncTo*/)
+void CAarch64RecompilerOps::CompileCop1Test()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-}
+    if (m_RegWorkingSet.GetFpuBeenUsed())
+    {
+        return;
+    }
 
-CRegInfo & CAarch64RecompilerOps::GetRegWorkingSet(void)
-{
-    return m_RegWorkingSet;
+    m_Assembler.TestVariable(&g_Reg->STATUS_REGISTER, "STATUS_REGISTER", STATUS_CU1);
+    CRegInfo ExitRegSet = m_RegWorkingSet;
+    ExitRegSet.SetBlockCycleCount(ExitRegSet.GetBlockCycleCount() + g_System->CountPerOp());
+    CompileExit(m_CompilePC, m_CompilePC, ExitRegSet, ExitReason_COP1Unuseable, false, &CAarch64Ops::BeqLabel);
+    m_RegWorkingSet.SetFpuBeenUsed(true);
 }
 
-void CAarch64RecompilerOps::SetRegWorkingSet(const CRegInfo & /*RegInfo*/)
+void CAarch64RecompilerOps::CompileInPermLoop(CRegInfo & RegSet, uint32_t ProgramCounter)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Assembler.MoveConst64ToVariable(&m_Reg.m_PROGRAM_COUNTER, "PROGRAM_COUNTER", (int64_t)(int32_t)ProgramCounter);
+    RegSet.WriteBackRegisters();
+    UpdateCounters(RegSet, false, true, false);
+    m_Assembler.CallThis((uintptr_t)&g_System->m_OpCodes, AddressOf(&R4300iOp::InPermLoop), "R4300iOp::InPermLoop");
+    m_Assembler.CallThis((uintptr_t)g_SystemTimer, AddressOf(&CSystemTimer::TimerDone), "CSystemTimer::TimerDone");
+    m_CodeBlock.Log("CompileSystemCheck 3");
+    CompileSystemCheck((uint32_t)-1, RegSet);
+    if (g_SyncSystem)
+    {
+        m_Assembler.CallThis((uintptr_t)g_BaseSystem, AddressOf(&CN64System::SyncSystem), "CN64System::SyncSystem");
+    }
 }
 
-bool CAarch64RecompilerOps::InheritParentInfo()
-{
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-    return false;
-}
-
-void CAarch64RecompilerOps::LinkJump(CJumpInfo & /*JumpInfo*/, uint32_t /*SectionID*/, uint32_t /*FromSectionID*/)
+void CAarch64RecompilerOps::SyncRegState(const CRegInfo & SyncTo)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    for (int32_t i = 1; i < 32; i++)
+    {
+        if (!m_RegWorkingSet.IsConst(i))
+        {
+            continue;
+        }
+        if (SyncTo.IsConst(i) && SyncTo.GetConstValue(i) == m_RegWorkingSet.GetConstValue(i))
+        {
+            continue;
+        }
+        m_RegWorkingSet.UnMap_GPR(i, true);
+    }
 }
 
-void CAarch64RecompilerOps::JumpToSection(CCodeSection * /*Section*/)
+CRegInfo & CAarch64RecompilerOps::GetRegWorkingSet(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    return m_RegWorkingSet;
 }
 
-void CAarch64RecompilerOps::JumpToUnknown(CJumpInfo * /*JumpInfo*/)
+void CAarch64RecompilerOps::SetRegWorkingSet(const CRegInfo & RegInfo)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_RegWorkingSet = RegInfo;
 }
 
-void CAarch64RecompilerOps::SetCurrentPC(uint32_t /*ProgramCounter*/)
+bool CAarch64RecompilerOps::InheritParentInfo()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Section->DisplaySectionInformation();
+
+    if (m_Section->m_ParentSection.empty())
+    {
+        SetRegWorkingSet(m_Section->m_RegEnter);
+        return true;
+    }
+
+    if (m_Section->m_ParentSection.size() == 1)
+    {
+        CCodeSection * Parent = *(m_Section->m_ParentSection.begin());
+        if (!Parent->m_EnterLabel.isValid())
+        {
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+        CJumpInfo * JumpInfo = m_Section == Parent->m_ContinueSection ? &Parent->m_Cont : &Parent->m_Jump;
+
+        m_Section->m_RegEnter = JumpInfo->RegSet;
+        LinkJump(*JumpInfo);
+        SetRegWorkingSet(m_Section->m_RegEnter);
+        return true;
+    }
+
+    // Multiple parents, compiled parents are at the start of the list
+    BLOCK_PARENT_LIST ParentList;
+    size_t NoOfCompiledParents = 0;
+    for (int32_t Pass = 0; Pass < 2; Pass++)
+    {
+        for (CCodeSection::SECTION_LIST::iterator iter = m_Section->m_ParentSection.begin(); iter != m_Section->m_ParentSection.end(); iter++)
+        {
+            CCodeSection * Parent = *iter;
+            if (Parent->m_EnterLabel.isValid() != (Pass == 0))
+            {
+                continue;
+            }
+            BLOCK_PARENT BlockParent;
+            BlockParent.Parent = Parent;
+            if (Parent->m_JumpSection != Parent->m_ContinueSection)
+            {
+                BlockParent.JumpInfo = m_Section == Parent->m_ContinueSection ? &Parent->m_Cont : &Parent->m_Jump;
+                ParentList.push_back(BlockParent);
+            }
+            else
+            {
+                BlockParent.JumpInfo = &Parent->m_Cont;
+                ParentList.push_back(BlockParent);
+                BlockParent.JumpInfo = &Parent->m_Jump;
+                ParentList.push_back(BlockParent);
+            }
+        }
+        if (Pass == 0)
+        {
+            NoOfCompiledParents = ParentList.size();
+        }
+    }
+    if (NoOfCompiledParents == 0)
+    {
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+        return false;
+    }
+
+    int FirstParent = -1;
+    for (size_t i = 0; i < NoOfCompiledParents; i++)
+    {
+        if (!ParentList[i].JumpInfo->FallThrough)
+        {
+            continue;
+        }
+        if (FirstParent != -1)
+        {
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+        FirstParent = (int)i;
+    }
+    if (FirstParent == -1)
+    {
+        FirstParent = 0;
+    }
+
+    // Link first parent to start
+    CJumpInfo * JumpInfo = ParentList[FirstParent].JumpInfo;
+
+    SetRegWorkingSet(JumpInfo->RegSet);
+    LinkJump(*JumpInfo);
+
+    if (JumpInfo->Reason == ExitReason_NormalNoSysCheck)
+    {
+        if (JumpInfo->RegSet.GetBlockCycleCount() != 0)
+        {
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+        if (JumpInfo->JumpPC != (uint32_t)-1)
+        {
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+    }
+    else
+    {
+        UpdateCounters(JumpInfo->RegSet, m_Section->m_EnterPC < JumpInfo->JumpPC, true);
+        if (JumpInfo->JumpPC == (uint32_t)-1)
+        {
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+        if (m_Section->m_EnterPC <= JumpInfo->JumpPC)
+        {
+            m_CodeBlock.Log("CompileSystemCheck 10");
+            CompileSystemCheck(m_Section->m_EnterPC, GetRegWorkingSet());
+        }
+    }
+    JumpInfo->FallThrough = false;
+
+    // Only constants that every parent agrees on are kept, an uncompiled parent is unknown so
+    // every register has to be in memory
+    for (size_t i = 0; i < ParentList.size(); i++)
+    {
+        if (i == (size_t)FirstParent)
+        {
+            continue;
+        }
+        if (i >= NoOfCompiledParents)
+        {
+            m_RegWorkingSet.WriteBackRegisters();
+            break;
+        }
+        CRegInfo * RegSet = &ParentList[i].JumpInfo->RegSet;
+        for (int32_t i2 = 1; i2 < 32; i2++)
+        {
+            if (m_RegWorkingSet.IsConst(i2) && (!RegSet->IsConst(i2) || RegSet->GetConstValue(i2) != m_RegWorkingSet.GetConstValue(i2)))
+            {
+                m_RegWorkingSet.UnMap_GPR(i2, true);
+            }
+        }
+    }
+    m_Section->m_RegEnter = m_RegWorkingSet;
+
+    // Sync registers for different blocks
+    stdstr_f Label("Section_%d", m_Section->m_SectionID);
+    int CurrentParent = FirstParent;
+    for (size_t i = 0; i < NoOfCompiledParents; i++)
+    {
+        if (i == (size_t)FirstParent)
+        {
+            continue;
+        }
+        JumpInfo = ParentList[i].JumpInfo;
+        CRegInfo * RegSet = &JumpInfo->RegSet;
+
+        bool NeedSync = RegSet->GetBlockCycleCount() != 0;
+        for (int32_t i2 = 1; !NeedSync && i2 < 32; i2++)
+        {
+            if (m_RegWorkingSet.GetMipsRegState(i2) != RegSet->GetMipsRegState(i2))
+            {
+                NeedSync = true;
+            }
+            else if (m_RegWorkingSet.IsConst(i2) && m_RegWorkingSet.GetConstValue(i2) != RegSet->GetConstValue(i2))
+            {
+                NeedSync = true;
+            }
+        }
+        if (!NeedSync)
+        {
+            continue;
+        }
+        JumpInfo = ParentList[CurrentParent].JumpInfo;
+        JumpInfo->LinkLocation = m_Assembler.newLabel();
+        m_Assembler.BLabel(Label.c_str(), JumpInfo->LinkLocation);
+        JumpInfo->LinkLocation2 = asmjit::Label();
+
+        CurrentParent = (int)i;
+        CCodeSection * Parent = ParentList[CurrentParent].Parent;
+        JumpInfo = ParentList[CurrentParent].JumpInfo;
+        m_CodeBlock.Log("   Section_%d (from %d):", m_Section->m_SectionID, Parent->m_SectionID);
+        if (JumpInfo->LinkLocation.isValid())
+        {
+            m_Assembler.bind(JumpInfo->LinkLocation);
+            JumpInfo->LinkLocation = asmjit::Label();
+            if (JumpInfo->LinkLocation2.isValid())
+            {
+                m_Assembler.bind(JumpInfo->LinkLocation2);
+                JumpInfo->LinkLocation2 = asmjit::Label();
+            }
+        }
+        m_RegWorkingSet = JumpInfo->RegSet;
+        if (m_Section->m_EnterPC < JumpInfo->JumpPC)
+        {
+            UpdateCounters(m_RegWorkingSet, true, true);
+            m_CodeBlock.Log("CompileSystemCheck 11");
+            CompileSystemCheck(m_Section->m_EnterPC, m_RegWorkingSet);
+        }
+        else
+        {
+            UpdateCounters(m_RegWorkingSet, false, true);
+        }
+        SyncRegState(m_Section->m_RegEnter);
+        m_Section->m_RegEnter = m_RegWorkingSet;
+    }
+
+    for (size_t i = 0; i < NoOfCompiledParents; i++)
+    {
+        LinkJump(*ParentList[i].JumpInfo);
+    }
+
+    m_CodeBlock.Log("   Section_%d:", m_Section->m_SectionID);
+    m_Section->m_RegEnter.SetBlockCycleCount(0);
+    return true;
+}
+
+void CAarch64RecompilerOps::LinkJump(CJumpInfo & JumpInfo)
+{
+    if (JumpInfo.LinkLocation.isValid())
+    {
+        m_CodeBlock.Log("");
+        m_Assembler.bind(JumpInfo.LinkLocation);
+        JumpInfo.LinkLocation = asmjit::Label();
+        if (JumpInfo.LinkLocation2.isValid())
+        {
+            m_Assembler.bind(JumpInfo.LinkLocation2);
+            JumpInfo.LinkLocation2 = asmjit::Label();
+        }
+    }
+}
+
+void CAarch64RecompilerOps::JumpToSection(CCodeSection * Section)
+{
+    m_Assembler.BLabel(stdstr_f("Section_%d", Section->m_SectionID).c_str(), Section->m_EnterLabel);
+}
+
+void CAarch64RecompilerOps::JumpToUnknown(CJumpInfo * JumpInfo)
+{
+    JumpInfo->LinkLocation = m_Assembler.newLabel();
+    m_Assembler.BLabel(JumpInfo->BranchLabel.c_str(), JumpInfo->LinkLocation);
+}
+
+void CAarch64RecompilerOps::SetCurrentPC(uint32_t ProgramCounter)
+{
+    uint32_t Value;
+    if (!g_MMU->MemoryValue32(ProgramCounter, Value))
+    {
+        g_Notify->FatalError(GS(MSG_FAIL_LOAD_WORD));
+    }
+    m_Instruction = R4300iInstruction((int32_t)ProgramCounter, Value);
 }
 
 uint32_t CAarch64RecompilerOps::GetCurrentPC(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-    return 0;
+    return m_CompilePC;
 }
 
-void CAarch64RecompilerOps::SetCurrentSection(CCodeSection * /*section*/)
+void CAarch64RecompilerOps::SetCurrentSection(CCodeSection * section)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Section = section;
 }
 
-void CAarch64RecompilerOps::SetNextStepType(PIPELINE_STAGE /*StepType*/)
+void CAarch64RecompilerOps::SetNextStepType(PIPELINE_STAGE StepType)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_PipelineStage = StepType;
 }
 
 PIPELINE_STAGE CAarch64RecompilerOps::GetNextStepType(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-    return PIPELINE_STAGE_NORMAL;
+    return m_PipelineStage;
 }
 
 const R4300iOpcode & CAarch64RecompilerOps::GetOpcode(void) const
@@ -882,39 +3058,395 @@ const R4300iOpcode & CAarch64RecompilerOps::GetOpcode(void) const
     return m_Opcode;
 }
 
-void CAarch64RecompilerOps::PreCompileOpcode(void)
+const R4300iInstruction & CAarch64RecompilerOps::GetInstruction(void) const
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    return m_Instruction;
 }
 
-void CAarch64RecompilerOps::PostCompileOpcode(void)
+void CAarch64RecompilerOps::UpdateSyncCPU(CRegInfo & /*RegSet*/, uint32_t Cycles)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-}
+    if (!g_SyncSystem)
+    {
+        return;
+    }
 
-void CAarch64RecompilerOps::CompileExit(uint32_t /*JumpPC*/, uint32_t /*TargetPC*/, CRegInfo & /*ExitRegSet*/, ExitReason /*reason*/)
-{
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_CodeBlock.Log("");
+    m_CodeBlock.Log("      // Updating sync CPU");
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w1, Cycles);
+    m_Assembler.CallThis((uintptr_t)g_System, AddressOf(&CN64System::UpdateSyncCPU), "CN64System::UpdateSyncCPU");
 }
 
-void CAarch64RecompilerOps::UpdateCounters(CRegInfo & /*RegSet*/, bool /*CheckTimer*/, bool /*ClearValues*/, bool /*UpdateTimer*/)
+void CAarch64RecompilerOps::UpdateCounters(CRegInfo & RegSet, bool CheckTimer, bool ClearValues, bool UpdateTimer)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (RegSet.GetBlockCycleCount() != 0)
+    {
+        UpdateSyncCPU(RegSet, RegSet.GetBlockCycleCount());
+        m_CodeBlock.Log("");
+        m_CodeBlock.Log("      // Update counter");
+        m_Assembler.SubConstFromVariable(RegSet.GetBlockCycleCount(), g_NextTimer, "g_NextTimer"); // Updates compare flag
+        if (ClearValues)
+        {
+            RegSet.SetBlockCycleCount(0);
+        }
+    }
+    else if (CheckTimer)
+    {
+        m_Assembler.CompConstToVariable(g_NextTimer, "g_NextTimer", 0);
+    }
+
+    if (CheckTimer)
+    {
+        asmjit::Label Jump = m_Assembler.newLabel();
+        m_Assembler.BplLabel("Continue_From_Timer_Test", Jump);
+        m_Assembler.CallThis((uintptr_t)g_SystemTimer, AddressOf(&CSystemTimer::TimerDone), "CSystemTimer::TimerDone");
+
+        m_CodeBlock.Log("");
+        m_Assembler.bind(Jump);
+    }
+
+    if ((UpdateTimer || CGameSettings::OverClockModifier() != 1) && g_SyncSystem)
+    {
+        m_Assembler.CallThis((uintptr_t)g_SystemTimer, AddressOf(&CSystemTimer::UpdateTimers), "CSystemTimer::UpdateTimers");
+    }
 }
 
-void CAarch64RecompilerOps::CompileSystemCheck(uint32_t /*TargetPC*/, const CRegInfo & /*RegSet*/)
+void CAarch64RecompilerOps::CompileSystemCheck(uint32_t TargetPC, const CRegInfo & RegSet)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Assembler.CompConstByteToVariable((void *)&m_SystemEvents.DoSomething(), "m_SystemEvents.DoSomething()", 0);
+    asmjit::Label Jump = m_Assembler.newLabel();
+    m_Assembler.BeqLabel("Continue_From_Interrupt_Test", Jump);
+    if (TargetPC != (uint32_t)-1)
+    {
+        m_Assembler.MoveConst64ToVariable(&g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER", (int64_t)(int32_t)TargetPC);
+    }
+
+    CRegInfo RegSetCopy(RegSet);
+    RegSetCopy.WriteBackRegisters();
+    m_Assembler.CallThis((uintptr_t)&m_SystemEvents, AddressOf(&CSystemEvents::ExecuteEvents), "CSystemEvents::ExecuteEvents");
+    ExitCodeBlock();
+    m_CodeBlock.Log("");
+    m_Assembler.bind(Jump);
 }
 
 void CAarch64RecompilerOps::CompileExecuteBP(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    bool bDelay = m_PipelineStage == PIPELINE_STAGE_JUMP || m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT;
+    if (bDelay)
+    {
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+    m_RegWorkingSet.WriteBackRegisters();
+
+    UpdateCounters(m_RegWorkingSet, true, true);
+    m_Assembler.MoveConst64ToVariable(&m_Reg.m_PROGRAM_COUNTER, "PROGRAM_COUNTER", (int64_t)(int32_t)m_CompilePC);
+    if (g_SyncSystem)
+    {
+        m_Assembler.CallThis((uintptr_t)g_BaseSystem, AddressOf(&CN64System::SyncSystem), "CN64System::SyncSystem");
+    }
+    m_Assembler.CallFunc((uintptr_t)Aarch64CompilerBreakPoint, "Aarch64CompilerBreakPoint");
+    ExitCodeBlock();
+    m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
 }
 
 void CAarch64RecompilerOps::CompileExecuteDelaySlotBP(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-}
-
-#endif
\ No newline at end of file
+    bool bDelay = m_PipelineStage == PIPELINE_STAGE_JUMP || m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT;
+    if (bDelay)
+    {
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+    m_RegWorkingSet.WriteBackRegisters();
+
+    UpdateCounters(m_RegWorkingSet, true, true);
+    m_Assembler.MoveConst64ToVariable(&m_Reg.m_PROGRAM_COUNTER, "PROGRAM_COUNTER", (int64_t)(int32_t)m_CompilePC);
+    if (g_SyncSystem)
+    {
+        m_Assembler.CallThis((uintptr_t)g_BaseSystem, AddressOf(&CN64System::SyncSystem), "CN64System::SyncSystem");
+    }
+    m_Assembler.CallFunc((uintptr_t)Aarch64BreakPointDelaySlot, "Aarch64BreakPointDelaySlot");
+    ExitCodeBlock();
+    m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+}
+
+void CAarch64RecompilerOps::OverflowDelaySlot(bool TestTimer)
+{
+    m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() + g_System->CountPerOp());
+    m_RegWorkingSet.WriteBackRegisters();
+    UpdateCounters(m_RegWorkingSet, false, true);
+    if (m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT)
+    {
+        m_Assembler.MoveVariableToReg(asmjit::a64::x9, &g_System->m_JumpToLocation, "System::m_JumpToLocation");
+        m_Assembler.MoveRegToVariable(&m_Reg.m_PROGRAM_COUNTER, "PROGRAM_COUNTER", asmjit::a64::x9);
+        m_Assembler.MoveVariableToReg(asmjit::a64::x9, &g_System->m_JumpDelayLocation, "System::JumpDelayLocation");
+        m_Assembler.MoveRegToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", asmjit::a64::x9);
+    }
+    else
+    {
+        m_Assembler.MoveConst64ToVariable(&m_Reg.m_PROGRAM_COUNTER, "PROGRAM_COUNTER", (int64_t)(int32_t)(m_CompilePC + 4));
+    }
+    m_Assembler.MoveConstToVariable(&g_System->m_PipelineStage, "System->m_PipelineStage", PIPELINE_STAGE_JUMP);
+    if (g_SyncSystem)
+    {
+        m_Assembler.CallThis((uintptr_t)g_BaseSystem, AddressOf(&CN64System::SyncSystem), "CN64System::SyncSystem");
+    }
+
+    if (TestTimer)
+    {
+        m_Assembler.MoveConstByteToVariable(&g_System->m_TestTimer, "R4300iOp::m_TestTimer", TestTimer);
+    }
+
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w1, g_System->CountPerOp());
+    m_Assembler.CallThis((uintptr_t)&g_System->m_OpCodes, AddressOf(&R4300iOp::ExecuteOps), "R4300iOp::ExecuteOps");
+    if (g_SyncSystem)
+    {
+        UpdateSyncCPU(m_RegWorkingSet, g_System->CountPerOp());
+    }
+
+    ExitCodeBlock();
+    m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
+}
+
+void CAarch64RecompilerOps::CompileBlockLink(uint32_t TargetPC)
+{
+    // Patched by CRecompiler::LinkFunction to branch to the body of the target block once it has been compiled
+    asmjit::Label ExitBlock = m_Assembler.newLabel();
+    asmjit::Label JumpLabel = m_Assembler.newLabel();
+    m_Assembler.CompConstByteToVariable(&m_System.m_EndEmulation, "m_EndEmulation", 0);
+    m_Assembler.BneLabel("ExitBlock", ExitBlock);
+    m_CodeBlock.Log("      Link to block %08X", TargetPC);
+    m_Assembler.bind(JumpLabel);
+    m_Assembler.embedUInt32(0x14000001);
+    m_Assembler.bind(ExitBlock);
+    m_CodeBlock.AddBlockLink(TargetPC, JumpLabel);
+}
+
+void CAarch64RecompilerOps::CompilePushReturnAddress(uint32_t ReturnPC)
+{
+    static_assert(sizeof(CRecompiler::RETURN_ADDRESS) == 16, "return stack index is scaled with a shift");
+
+    m_CodeBlock.Log("      Push return address %08X", ReturnPC);
+    m_Assembler.MoveVariableToReg(asmjit::a64::w10, &g_Recompiler->ReturnStackPos(), "ReturnStackPos");
+    m_Assembler.add(asmjit::a64::w10, asmjit::a64::w10, 1);
+    m_Assembler.and_(asmjit::a64::w10, asmjit::a64::w10, CRecompiler::ReturnStackSize - 1);
+    m_Assembler.MoveRegToVariable(&g_Recompiler->ReturnStackPos(), "ReturnStackPos", asmjit::a64::w10);
+    m_Assembler.MoveConstPtrToReg(asmjit::a64::x11, g_Recompiler->ReturnStack(), "ReturnStack");
+    m_Assembler.add(asmjit::a64::x11, asmjit::a64::x11, asmjit::a64::x10, asmjit::a64::lsl(4));
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w12, ReturnPC);
+    m_Assembler.str(asmjit::a64::w12, asmjit::a64::ptr(asmjit::a64::x11, offsetof(CRecompiler::RETURN_ADDRESS, ReturnPC)));
+    m_Assembler.MoveConstPtrToReg(asmjit::a64::x12, &g_Recompiler->JumpTable()[(ReturnPC & 0x1FFFFFFF) >> 2], "JumpTable entry");
+    m_Assembler.str(asmjit::a64::x12, asmjit::a64::ptr(asmjit::a64::x11, offsetof(CRecompiler::RETURN_ADDRESS, JumpTableEntry)));
+}
+
+void CAarch64RecompilerOps::CompileReturnPrediction()
+{
+    // Pop the return stack, if the top entry is the address being returned to and that address
+    // has been compiled then branch straight to it, otherwise leave through the lookup loop
+    asmjit::Label ExitBlock = m_Assembler.newLabel();
+
+    m_Assembler.MoveVariableToReg(asmjit::a64::w10, &g_Recompiler->ReturnStackPos(), "ReturnStackPos");
+    m_Assembler.sub(asmjit::a64::w12, asmjit::a64::w10, 1);
+    m_Assembler.and_(asmjit::a64::w12, asmjit::a64::w12, CRecompiler::ReturnStackSize - 1);
+    m_Assembler.MoveRegToVariable(&g_Recompiler->ReturnStackPos(), "ReturnStackPos", asmjit::a64::w12);
+    m_Assembler.MoveConstPtrToReg(asmjit::a64::x11, g_Recompiler->ReturnStack(), "ReturnStack");
+    m_Assembler.add(asmjit::a64::x11, asmjit::a64::x11, asmjit::a64::x10, asmjit::a64::lsl(4));
+    m_Assembler.MoveVariableToReg(asmjit::a64::x12, &g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER");
+    m_Assembler.ldrsw(asmjit::a64::x13, asmjit::a64::ptr(asmjit::a64::x11, offsetof(CRecompiler::RETURN_ADDRESS, ReturnPC)));
+    m_Assembler.cmp(asmjit::a64::x13, asmjit::a64::x12);
+    m_Assembler.BneLabel("ExitBlock", ExitBlock);
+    m_Assembler.ldr(asmjit::a64::x13, asmjit::a64::ptr(asmjit::a64::x11, offsetof(CRecompiler::RETURN_ADDRESS, JumpTableEntry)));
+    m_Assembler.ldr(asmjit::a64::x13, asmjit::a64::ptr(asmjit::a64::x13));
+    m_Assembler.cbz(asmjit::a64::x13, ExitBlock);
+    m_Assembler.ldr(asmjit::a64::w14, asmjit::a64::ptr(asmjit::a64::x13, CCompiledFunc::EnterPCOffset()));
+    m_Assembler.cmp(asmjit::a64::w14, asmjit::a64::w12);
+    m_Assembler.BneLabel("ExitBlock", ExitBlock);
+    m_Assembler.CompConstByteToVariable(&m_System.m_EndEmulation, "m_EndEmulation", 0);
+    m_Assembler.BneLabel("ExitBlock", ExitBlock);
+    m_Assembler.ldr(asmjit::a64::x13, asmjit::a64::ptr(asmjit::a64::x13, CCompiledFunc::LinkEntryOffset()));
+    m_Assembler.br(asmjit::a64::x13);
+    m_Assembler.bind(ExitBlock);
+}
+
+void CAarch64RecompilerOps::CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo & ExitRegSet, ExitReason Reason)
+{
+    CompileExit(JumpPC, TargetPC, ExitRegSet, Reason, true, nullptr);
+}
+
+void CAarch64RecompilerOps::CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo & ExitRegSet, ExitReason Reason, bool CompileNow, BranchFunc Branch)
+{
+    if (!CompileNow)
+    {
+        if (Branch == nullptr)
+        {
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+            return;
+        }
+        CExitInfo ExitInfo(m_CodeBlock);
+        stdstr_f ExitName("Exit_%08X_%d", JumpPC, m_ExitInfo.size());
+        (m_Assembler.*Branch)(ExitName.c_str(), ExitInfo.JumpLabel);
+        ExitInfo.ID = m_ExitInfo.size();
+        ExitInfo.Name = ExitName;
+        ExitInfo.TargetPC = TargetPC;
+        ExitInfo.ExitRegSet = ExitRegSet;
+        ExitInfo.Reason = Reason;
+        ExitInfo.PipelineStage = m_PipelineStage;
+        m_ExitInfo.push_back(ExitInfo);
+        return;
+    }
+
+    ExitRegSet.WriteBackRegisters();
+
+    if (TargetPC != (uint32_t)-1)
+    {
+        m_Assembler.MoveConst64ToVariable(&g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER", (int64_t)(int32_t)TargetPC);
+        UpdateCounters(ExitRegSet, TargetPC <= JumpPC && JumpPC != (uint32_t)-1, Reason == ExitReason_Normal);
+    }
+    else
+    {
+        UpdateCounters(ExitRegSet, false, Reason == ExitReason_Normal, Reason != ExitReason_Normal);
+    }
+
+    switch (Reason)
+    {
+    case ExitReason_Normal:
+    case ExitReason_CheckPCAlignment:
+    case ExitReason_Return:
+    case ExitReason_NormalNoSysCheck:
+        ExitRegSet.SetBlockCycleCount(0);
+        if (Reason != ExitReason_NormalNoSysCheck && (TargetPC == (uint32_t)-1 || TargetPC <= JumpPC))
+        {
+            CompileSystemCheck((uint32_t)-1, ExitRegSet);
+        }
+        if (Reason == ExitReason_CheckPCAlignment || Reason == ExitReason_Return)
+        {
+            m_Assembler.MoveVariableToReg(asmjit::a64::x1, &g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER");
+            m_Assembler.tst(asmjit::a64::w1, 3);
+            asmjit::Label ValidPCJump = m_Assembler.newLabel();
+            m_Assembler.BeqLabel("ValidPC", ValidPCJump);
+            CompileDoAddressError(true, true);
+            ExitCodeBlock();
+            m_Assembler.bind(ValidPCJump);
+        }
+        if (Reason == ExitReason_Return)
+        {
+            CompileReturnPrediction();
+        }
+        else if (Reason != ExitReason_CheckPCAlignment && TargetPC != (uint32_t)-1 && m_CodeBlock.BlockLinkAllowed(TargetPC))
+        {
+            CompileBlockLink(TargetPC);
+        }
+        ExitCodeBlock();
+        break;
+    case ExitReason_DoCPUAction:
+        m_Assembler.CallThis((uintptr_t)&g_System->m_SystemEvents, AddressOf(&CSystemEvents::ExecuteEvents), "CSystemEvents::ExecuteEvents");
+        ExitCodeBlock();
+        break;
+    case ExitReason_DoSysCall:
+        CompileTriggerException("EXC_SYSCALL", EXC_SYSCALL, 0);
+        ExitCodeBlock();
+        break;
+    case ExitReason_Break:
+        CompileTriggerException("EXC_BREAK", EXC_BREAK, 0);
+        ExitCodeBlock();
+        break;
+    case ExitReason_COP1Unuseable:
+        CompileTriggerException("EXC_CPU", EXC_CPU, 1);
+        ExitRegSet.SetBlockCycleCount(0);
+        UpdateCounters(ExitRegSet, true, false, false);
+        ExitCodeBlock();
+        break;
+    case ExitReason_ResetRecompCode:
+    case ExitReason_TLBWriteMiss:
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+        ExitCodeBlock();
+        break;
+    case ExitReason_TLBReadMiss:
+        MarkDelaySlotStage();
+        m_Assembler.MoveVariableToReg(asmjit::a64::w1, &m_System.m_TLBLoadAddress, "m_TLBLoadAddress");
+        m_Assembler.sxtw(asmjit::a64::x1, asmjit::a64::w1);
+        m_Assembler.MoveConst64ToReg(asmjit::a64::w2, EXC_RMISS);
+        m_Assembler.CallThis((uintptr_t)g_Reg, AddressOf(&CRegisters::TriggerAddressException), "CRegisters::TriggerAddressException");
+        CompileExceptionExit();
+        ExitCodeBlock();
+        break;
+    case ExitReason_ExceptionOverflow:
+        CompileTriggerException("EXC_OV", EXC_OV, 0);
+        ExitCodeBlock();
+        break;
+    case ExitReason_ExceptionFloatingPoint:
+        CompileTriggerException("EXC_FPE", EXC_FPE, 0);
+        ExitCodeBlock();
+        break;
+    case ExitReason_AddressErrorExceptionRead32:
+        MarkDelaySlotStage();
+        m_Assembler.MoveVariableToReg(asmjit::a64::w1, &m_TempValue32, "TempValue32");
+        m_Assembler.sxtw(asmjit::a64::x1, asmjit::a64::w1);
+        CompileDoAddressError(false, true);
+        ExitCodeBlock();
+        break;
+    case ExitReason_AddressErrorExceptionRead64:
+        MarkDelaySlotStage();
+        m_Assembler.MoveVariableToReg(asmjit::a64::x1, &m_TempValue64, "TempValue64");
+        CompileDoAddressError(false, true);
+        ExitCodeBlock();
+        break;
+    case ExitReason_AddressErrorExceptionWrite32:
+        MarkDelaySlotStage();
+        m_Assembler.MoveVariableToReg(asmjit::a64::w1, &m_TempValue32, "TempValue32");
+        m_Assembler.sxtw(asmjit::a64::x1, asmjit::a64::w1);
+        CompileDoAddressError(false, false);
+        ExitCodeBlock();
+        break;
+    case ExitReason_IllegalInstruction:
+        CompileTriggerException("EXC_II", EXC_II, 0);
+        ExitCodeBlock();
+        break;
+    case ExitReason_Exception:
+        CompileExceptionExit();
+        if (TargetPC == (uint32_t)-1)
+        {
+            ExitRegSet.SetBlockCycleCount(0);
+            UpdateCounters(ExitRegSet, false, false, false);
+        }
+        ExitCodeBlock();
+        break;
+    default:
+        WriteTrace(TraceRecompiler, TraceError, "How did you want to exit on reason (%d) ???", Reason);
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+}
+
+void CAarch64RecompilerOps::MarkDelaySlotStage(void)
+{
+    bool InDelaySlot = m_PipelineStage == PIPELINE_STAGE_JUMP || m_PipelineStage == PIPELINE_STAGE_DELAY_SLOT;
+    m_Assembler.MoveConstToVariable(&g_System->m_PipelineStage, "System->m_PipelineStage", InDelaySlot ? PIPELINE_STAGE_JUMP : PIPELINE_STAGE_NORMAL);
+}
+
+void CAarch64RecompilerOps::CompileTriggerException(const char * ExceptionName, uint32_t ExceptionCode, uint32_t Coprocessor)
+{
+    MarkDelaySlotStage();
+    m_CodeBlock.Log("      // %s", ExceptionName);
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w1, ExceptionCode);
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w2, Coprocessor);
+    m_Assembler.CallThis((uintptr_t)g_Reg, AddressOf(&CRegisters::TriggerException), "CRegisters::TriggerException");
+    CompileExceptionExit();
+}
+
+void CAarch64RecompilerOps::CompileDoAddressError(bool UsePC, bool FromRead)
+{
+    // x1 holds the bad address unless it is taken from the program counter
+    if (UsePC)
+    {
+        m_Assembler.MoveVariableToReg(asmjit::a64::x1, &g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER");
+    }
+    m_Assembler.MoveConst64ToReg(asmjit::a64::w2, FromRead);
+    m_Assembler.CallThis((uintptr_t)g_Reg, AddressOf(&CRegisters::DoAddressError), "CRegisters::DoAddressError");
+    CompileExceptionExit();
+}
+
+void CAarch64RecompilerOps::CompileExceptionExit(void)
+{
+    m_Assembler.MoveVariableToReg(asmjit::a64::x9, &g_System->m_JumpToLocation, "System->m_JumpToLocation");
+    m_Assembler.MoveRegToVariable(&g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER", asmjit::a64::x9);
+    m_Assembler.MoveConstToVariable(&g_System->m_PipelineStage, "g_System->m_PipelineStage", PIPELINE_STAGE_NORMAL);
+}
+#endif
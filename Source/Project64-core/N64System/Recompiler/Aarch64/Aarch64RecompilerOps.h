@@ -1,22 +1,36 @@
 #pragma once
 #if defined(__aarch64__)
 
-#include <Project64-core/N64System/Mips/R4300iOpcode.h>
+#include <Project64-core/N64System/Interpreter/InterpreterOps.h>
+#include <Project64-core/N64System/Mips/Register.h>
+#include <Project64-core/N64System/Recompiler/Aarch64/Aarch64RegInfo.h>
 #include <Project64-core/N64System/Recompiler/Aarch64/Aarch64ops.h>
 #include <Project64-core/N64System/Recompiler/ExitInfo.h>
+#include <Project64-core/N64System/Recompiler/JumpInfo.h>
 #include <Project64-core/N64System/Recompiler/RecompilerOps.h>
 #include <Project64-core/N64System/Recompiler/RegInfo.h>
+#include <Project64-core/N64System/Recompiler/asmjit.h>
+#include <Project64-core/Settings/GameSettings.h>
+#include <Project64-core/Settings/N64SystemSettings.h>
+#include <Project64-core/Settings/RecompilerSettings.h>
 
-class CMipsMemoryVM;
 class CCodeBlock;
 class CCodeSection;
-class CAarch64Ops;
-struct CJumpInfo;
 
-class CAarch64RecompilerOps
+// The integer unit, branches and the common loads and stores are compiled to native code.
+// Opcodes that are rarely on a hot path (cop0, cop1, divides, unaligned memory access) are
+// handed to the interpreter with the registers they use written back to memory first.
+class CAarch64RecompilerOps :
+    public CRecompilerOpsBase,
+    protected CN64SystemSettings,
+    protected CRecompilerSettings,
+    protected CLogSettings,
+    private CGameSettings
 {
+    friend CAarch64RegInfo;
+
 public:
-    CAarch64RecompilerOps(CMipsMemoryVM & MMU, CCodeBlock & CodeBlock);
+    CAarch64RecompilerOps(CN64System & m_System, CCodeBlock & CodeBlock);
     ~CAarch64RecompilerOps();
 
     // Trap functions
@@ -201,13 +215,15 @@ public:
     void UnknownOpcode();
 
     void EnterCodeBlock();
+    void ExitCodeBlock();
     void CompileExitCode();
+    void CompileCop1Test();
     void CompileInPermLoop(CRegInfo & RegSet, uint32_t ProgramCounter);
     void SyncRegState(const CRegInfo & SyncTo);
     CRegInfo & GetRegWorkingSet(void);
     void SetRegWorkingSet(const CRegInfo & RegInfo);
     bool InheritParentInfo();
-    void LinkJump(CJumpInfo & JumpInfo, uint32_t SectionID = -1, uint32_t FromSectionID = -1);
+    void LinkJump(CJumpInfo & JumpInfo);
     void JumpToSection(CCodeSection * Section);
     void JumpToUnknown(CJumpInfo * JumpInfo);
     void SetCurrentPC(uint32_t ProgramCounter);
@@ -216,14 +232,17 @@ public:
     void SetNextStepType(PIPELINE_STAGE StepType);
     PIPELINE_STAGE GetNextStepType(void);
     const R4300iOpcode & GetOpcode(void) const;
+    const R4300iInstruction & GetInstruction(void) const;
     void PreCompileOpcode(void);
     void PostCompileOpcode(void);
     void CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo & ExitRegSet, ExitReason Reason);
 
+    void UpdateSyncCPU(CRegInfo & RegSet, uint32_t Cycles);
     void UpdateCounters(CRegInfo & RegSet, bool CheckTimer, bool ClearValues = false, bool UpdateTimer = true);
     void CompileSystemCheck(uint32_t TargetPC, const CRegInfo & RegSet);
     void CompileExecuteBP(void);
     void CompileExecuteDelaySlotBP(void);
+    void OverflowDelaySlot(bool TestTimer);
 
     CAarch64Ops & Assembler()
     {
@@ -234,9 +253,50 @@ private:
     CAarch64RecompilerOps(const CAarch64RecompilerOps &);
     CAarch64RecompilerOps & operator=(const CAarch64RecompilerOps &);
 
-    CAarch64RegInfo m_RegWorkingSet;
+    typedef void (CAarch64Ops::*BranchFunc)(const char * LabelName, asmjit::Label & JumpLabel);
+
+    enum ShiftType
+    {
+        Shift_Left,
+        Shift_RightLogical,
+        Shift_RightArithmetic,
+    };
+
+    bool IsConstGPR(int32_t MipsReg) const;
+    int64_t ConstCompareValue(int32_t MipsReg) const;
+    void BranchOnCompare(BranchFunc JumpBranch, BranchFunc ContBranch);
+    void BranchOnConst(bool Taken);
+    void CompareGPR(int32_t MipsReg1, int32_t MipsReg2);
+    void MoveGPRToVariable64(int32_t MipsReg, void * Variable, const char * VariableName);
+    void BaseOffsetAddress(const asmjit::a64::GpX & AddressReg);
+    void CompileLoad(uint8_t ValueSize, bool SignExtend);
+    void CompileStore(uint8_t ValueSize);
+    void CompileInterpreterOp(uintptr_t FunctAddress, const char * FunctName, int32_t ReadReg1, int32_t ReadReg2, int32_t WriteReg, bool SyncTimer);
+    void CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo & ExitRegSet, ExitReason Reason, bool CompileNow, BranchFunc Branch);
+    void CompileBlockLink(uint32_t TargetPC);
+    void CompilePushReturnAddress(uint32_t ReturnPC);
+    void CompileReturnPrediction(void);
+    void CompileTriggerException(const char * ExceptionName, uint32_t ExceptionCode, uint32_t Coprocessor);
+    void CompileDoAddressError(bool UsePC, bool FromRead);
+    void CompileExceptionExit(void);
+    void CompileOverflowExit(void);
+    void CompileConstOverflow(void);
+    void MarkDelaySlotStage(void);
+    void ShiftConst(bool Is64Bit, uint32_t Shift, ShiftType Type);
+    void ShiftVariable(bool Is64Bit, ShiftType Type);
+
+    static void Aarch64CompilerBreakPoint();
+    static void Aarch64BreakPointDelaySlot();
+
+    EXIT_LIST m_ExitInfo;
     CAarch64Ops m_Assembler;
-    R4300iOpcode m_Opcode;
+    PIPELINE_STAGE m_PipelineStage;
+    const uint32_t & m_CompilePC;
+    CAarch64RegInfo m_RegWorkingSet;
+    CRegInfo m_RegBeforeDelay;
+    bool m_EffectDelaySlot;
+    static uint32_t m_TempValue32;
+    static uint64_t m_TempValue64;
 };
 
 typedef CAarch64RecompilerOps CRecompilerOps;
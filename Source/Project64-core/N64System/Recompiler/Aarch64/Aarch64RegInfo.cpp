@@ -2,14 +2,20 @@
 
 #if defined(__aarch64__)
 #include <Project64-core/N64System/Recompiler/Aarch64/Aarch64RegInfo.h>
+#include <Project64-core/N64System/Recompiler/CodeBlock.h>
+#include <Project64-core/N64System/Recompiler/RecompilerOps.h>
 
-CAarch64RegInfo::CAarch64RegInfo(CCodeBlock & /*CodeBlock*/, CAarch64Ops & /*Assembler*/)
+CAarch64RegInfo::CAarch64RegInfo(CCodeBlock & CodeBlock, CAarch64Ops & Assembler) :
+    m_CodeBlock(CodeBlock),
+    m_Assembler(Assembler)
 {
 }
 
-CAarch64RegInfo::CAarch64RegInfo(const CAarch64RegInfo &)
+CAarch64RegInfo::CAarch64RegInfo(const CAarch64RegInfo & rhs) :
+    m_CodeBlock(rhs.m_CodeBlock),
+    m_Assembler(rhs.m_CodeBlock.RecompilerOps()->Assembler())
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    *this = rhs;
 }
 
 CAarch64RegInfo::~CAarch64RegInfo()
@@ -19,25 +25,115 @@ CAarch64RegInfo::~CAarch64RegInfo()
 CAarch64RegInfo & CAarch64RegInfo::operator=(const CAarch64RegInfo & right)
 {
     CRegBase::operator=(right);
-    g_Notify->BreakPoint(__FILE__, __LINE__);
     return *this;
 }
 
-bool CAarch64RegInfo::operator==(const CAarch64RegInfo & /*right*/) const
+bool CAarch64RegInfo::operator==(const CAarch64RegInfo & right) const
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-    return false;
+    return CRegBase::operator==(right);
 }
 
-bool CAarch64RegInfo::operator!=(const CAarch64RegInfo & /*right*/) const
+bool CAarch64RegInfo::operator!=(const CAarch64RegInfo & right) const
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-    return false;
+    return !(right == *this);
+}
+
+CAarch64RegInfo::REG_STATE CAarch64RegInfo::ConstantsType(int64_t Value)
+{
+    if (((Value >> 32) == -1) && ((Value & 0x80000000) != 0))
+    {
+        return STATE_CONST_32_SIGN;
+    }
+    if (((Value >> 32) == 0) && ((Value & 0x80000000) == 0))
+    {
+        return STATE_CONST_32_SIGN;
+    }
+    return STATE_CONST_64;
+}
+
+uint64_t CAarch64RegInfo::GetConstValue(int32_t MipsReg) const
+{
+    if (MipsReg == 0)
+    {
+        return 0;
+    }
+    if (Is32Bit(MipsReg))
+    {
+        return IsSigned(MipsReg) ? (uint64_t)(int64_t)GetMipsRegLo_S(MipsReg) : (uint64_t)GetMipsRegLo(MipsReg);
+    }
+    return GetMipsReg(MipsReg);
+}
+
+asmjit::a64::Mem CAarch64RegInfo::GprPointer(int32_t MipsReg) const
+{
+    return asmjit::a64::ptr(Aarch64GprBaseReg, MipsReg * (int32_t)sizeof(MIPS_DWORD));
+}
+
+void CAarch64RegInfo::Map_TempReg(const asmjit::a64::Gp & Reg, int32_t MipsReg)
+{
+    if (MipsReg == 0)
+    {
+        m_Assembler.mov(Reg, Reg.isGpW() ? asmjit::a64::Gp(asmjit::a64::wzr) : asmjit::a64::Gp(asmjit::a64::xzr));
+    }
+    else if (IsConst(MipsReg))
+    {
+        m_Assembler.MoveConst64ToReg(Reg, GetConstValue(MipsReg));
+    }
+    else
+    {
+        m_Assembler.ldr(Reg, GprPointer(MipsReg));
+    }
+}
+
+void CAarch64RegInfo::SetConst(int32_t MipsReg, int64_t Value)
+{
+    if (MipsReg == 0)
+    {
+        return;
+    }
+    SetMipsRegState(MipsReg, ConstantsType(Value));
+    SetMipsReg_S(MipsReg, Value);
+}
+
+void CAarch64RegInfo::StoreGPR(int32_t MipsReg, const asmjit::a64::Gp & Reg)
+{
+    if (MipsReg == 0)
+    {
+        return;
+    }
+    m_Assembler.str(Reg.x(), GprPointer(MipsReg));
+    SetMipsRegState(MipsReg, STATE_UNKNOWN);
 }
 
 void CAarch64RegInfo::UnMap_GPR(uint32_t Reg, bool WriteBackValue)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (Reg == 0)
+    {
+        return;
+    }
+    if (IsConst(Reg) && WriteBackValue)
+    {
+        uint64_t Value = GetConstValue(Reg);
+        m_CodeBlock.Log("    regcache: unallocate %s from memory", CRegName::GPR[Reg]);
+        if (Value == 0)
+        {
+            m_Assembler.str(asmjit::a64::xzr, GprPointer(Reg));
+        }
+        else
+        {
+            m_Assembler.MoveConst64ToReg(Aarch64ScratchReg, Value);
+            m_Assembler.str(Aarch64ScratchReg, GprPointer(Reg));
+        }
+    }
+    SetMipsRegState(Reg, STATE_UNKNOWN);
+}
+
+void CAarch64RegInfo::WriteBackRegisters()
+{
+    for (uint32_t i = 1; i < 32; i++)
+    {
+        UnMap_GPR(i, true);
+    }
 }
 
 #endif
@@ -1,10 +1,13 @@
 #pragma once
 #if defined(__aarch64__)
+#include <Project64-core/N64System/Mips/Register.h>
+#include <Project64-core/N64System/Recompiler/Aarch64/Aarch64ops.h>
 #include <Project64-core/N64System/Recompiler/RegBase.h>
 
 class CCodeBlock;
-class CAarch64Ops;
 
+// The MIPS general purpose registers live in memory (addressed through Aarch64GprBaseReg),
+// only constant values are tracked between opcodes
 class CAarch64RegInfo :
     public CRegBase
 {
@@ -18,7 +21,21 @@ public:
     bool operator==(const CAarch64RegInfo & right) const;
     bool operator!=(const CAarch64RegInfo & right) const;
 
+    static REG_STATE ConstantsType(int64_t Value);
+
+    uint64_t GetConstValue(int32_t MipsReg) const;
+    asmjit::a64::Mem GprPointer(int32_t MipsReg) const;
+    void Map_TempReg(const asmjit::a64::Gp & Reg, int32_t MipsReg);
+    void SetConst(int32_t MipsReg, int64_t Value);
+    void StoreGPR(int32_t MipsReg, const asmjit::a64::Gp & Reg);
     void UnMap_GPR(uint32_t Reg, bool WriteBackValue);
+    void WriteBackRegisters();
+
+private:
+    CAarch64RegInfo();
+
+    CCodeBlock & m_CodeBlock;
+    CAarch64Ops & m_Assembler;
 };
 
 #endif
@@ -3,23 +3,412 @@
 
 #include <Project64-core/N64System/Recompiler/Aarch64/Aarch64ops.h>
 #include <Project64-core/N64System/Recompiler/CodeBlock.h>
+#include <Project64-core/N64System/SystemGlobals.h>
 
 CAarch64Ops::CAarch64Ops(CCodeBlock & CodeBlock) :
     asmjit::a64::Assembler(&CodeBlock.CodeHolder()),
     m_CodeBlock(CodeBlock)
 {
+    setLogger(CDebugSettings::bRecordRecompilerAsm() ? this : nullptr);
+    setErrorHandler(&CodeBlock);
+    addFlags(asmjit::FormatFlags::kHexOffsets);
+    addFlags(asmjit::FormatFlags::kHexImms);
+    addFlags(asmjit::FormatFlags::kExplainImms);
+}
+
+void CAarch64Ops::AddConstToReg(const asmjit::a64::Gp & DestReg, const asmjit::a64::Gp & SrcReg, int64_t Const)
+{
+    if (Const == 0)
+    {
+        if (DestReg != SrcReg)
+        {
+            mov(DestReg, SrcReg);
+        }
+    }
+    else if (Const > 0 && Const <= 0xFFF)
+    {
+        add(DestReg, SrcReg, (uint32_t)Const);
+    }
+    else if (Const < 0 && Const >= -0xFFF)
+    {
+        sub(DestReg, SrcReg, (uint32_t)-Const);
+    }
+    else
+    {
+        asmjit::a64::Gp Scratch = DestReg.isGpW() ? asmjit::a64::Gp(Aarch64ScratchReg.w()) : asmjit::a64::Gp(Aarch64ScratchReg.x());
+        MoveConst64ToReg(Scratch, (uint64_t)Const);
+        add(DestReg, SrcReg, Scratch);
+    }
+}
+
+void CAarch64Ops::AddsConstToReg(const asmjit::a64::Gp & Reg, int64_t Const)
+{
+    if (Const >= 0 && Const <= 0xFFF)
+    {
+        adds(Reg, Reg, (uint32_t)Const);
+    }
+    else if (Const < 0 && Const >= -0xFFF)
+    {
+        subs(Reg, Reg, (uint32_t)-Const);
+    }
+    else
+    {
+        asmjit::a64::Gp Scratch = Reg.isGpW() ? asmjit::a64::Gp(Aarch64ScratchReg.w()) : asmjit::a64::Gp(Aarch64ScratchReg.x());
+        MoveConst64ToReg(Scratch, (uint64_t)Const);
+        adds(Reg, Reg, Scratch);
+    }
+}
+
+void CAarch64Ops::AddConstToVariable(void * Variable, const char * VariableName, uint32_t Const)
+{
+    asmjit::a64::Mem Mem = VariablePtr(Variable, VariableName);
+    ldr(asmjit::a64::w9, Mem);
+    AddConstToReg(asmjit::a64::w9, asmjit::a64::w9, (int32_t)Const);
+    str(asmjit::a64::w9, Mem);
+}
+
+void CAarch64Ops::BreakPointNotification(const char * FileName, int32_t LineNumber)
+{
+    g_Notify->BreakPoint(FileName, LineNumber);
+}
+
+void CAarch64Ops::Aarch64BreakPoint(const char * FileName, int32_t LineNumber)
+{
+    MoveConstPtrToReg(asmjit::a64::x0, FileName, FileName);
+    MoveConst64ToReg(asmjit::a64::w1, (uint32_t)LineNumber);
+    CallFunc((uintptr_t)BreakPointNotification, "BreakPointNotification");
+}
+
+void CAarch64Ops::CallFunc(uintptr_t FunctPtr, const char * FunctName)
+{
+    MoveConstPtrToReg(Aarch64AddressReg, (const void *)FunctPtr, FunctName);
+    blr(Aarch64AddressReg);
+}
+
+void CAarch64Ops::CallThis(uintptr_t ThisPtr, uintptr_t FunctPtr, const char * FunctName)
+{
+    MoveConst64ToReg(asmjit::a64::x0, ThisPtr);
+    CallFunc(FunctPtr, FunctName);
+}
+
+void CAarch64Ops::CompConstByteToVariable(void * Variable, const char * VariableName, uint8_t Const)
+{
+    ldrb(asmjit::a64::w9, VariablePtr(Variable, VariableName));
+    cmp(asmjit::a64::w9, Const);
+}
+
+void CAarch64Ops::CompConstToReg(const asmjit::a64::Gp & Reg, int64_t Const)
+{
+    if (Const >= 0 && Const <= 0xFFF)
+    {
+        cmp(Reg, (uint32_t)Const);
+    }
+    else if (Const < 0 && Const >= -0xFFF)
+    {
+        cmn(Reg, (uint32_t)-Const);
+    }
+    else
+    {
+        asmjit::a64::Gp Scratch = Reg.isGpW() ? asmjit::a64::Gp(Aarch64ScratchReg.w()) : asmjit::a64::Gp(Aarch64ScratchReg.x());
+        MoveConst64ToReg(Scratch, (uint64_t)Const);
+        cmp(Reg, Scratch);
+    }
+}
+
+void CAarch64Ops::CompConstToVariable(void * Variable, const char * VariableName, uint32_t Const)
+{
+    ldr(asmjit::a64::w9, VariablePtr(Variable, VariableName));
+    CompConstToReg(asmjit::a64::w9, (int32_t)Const);
+}
+
+void CAarch64Ops::EnterStackFrame()
+{
+    stp(asmjit::a64::x29, asmjit::a64::x30, asmjit::a64::ptr_pre(asmjit::a64::sp, -32));
+    stp(asmjit::a64::x19, asmjit::a64::x20, asmjit::a64::ptr(asmjit::a64::sp, 16));
+    mov(asmjit::a64::x29, asmjit::a64::sp);
+}
+
+void CAarch64Ops::ExitStackFrame()
+{
+    ldp(asmjit::a64::x19, asmjit::a64::x20, asmjit::a64::ptr(asmjit::a64::sp, 16));
+    ldp(asmjit::a64::x29, asmjit::a64::x30, asmjit::a64::ptr_post(asmjit::a64::sp, 32));
+}
+
+void CAarch64Ops::BranchLabel(asmjit::a64::CondCode Cond, const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    b(Cond, JumpLabel);
+}
+
+void CAarch64Ops::BLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    b(JumpLabel);
+}
+
+void CAarch64Ops::BeqLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kEQ, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BgeLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kGE, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BgtLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kGT, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BhiLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kHI, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BhsLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kHS, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BleLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kLE, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BloLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kLO, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BlsLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kLS, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BltLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kLT, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BmiLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kMI, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BneLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kNE, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BplLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kPL, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::BvsLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    BranchLabel(asmjit::a64::CondCode::kVS, LabelName, JumpLabel);
+}
+
+void CAarch64Ops::MoveConst64ToReg(const asmjit::a64::Gp & Reg, uint64_t Const)
+{
+    uint32_t Chunks = Reg.isGpW() ? 2 : 4;
+    if (Reg.isGpW())
+    {
+        Const &= 0xFFFFFFFF;
+    }
+    bool First = true;
+    for (uint32_t i = 0; i < Chunks; i++)
+    {
+        uint32_t Chunk = (uint32_t)((Const >> (i * 16)) & 0xFFFF);
+        if (Chunk == 0)
+        {
+            continue;
+        }
+        if (First)
+        {
+            movz(Reg, Chunk, asmjit::arm::lsl(i * 16));
+            First = false;
+        }
+        else
+        {
+            movk(Reg, Chunk, asmjit::arm::lsl(i * 16));
+        }
+    }
+    if (First)
+    {
+        movz(Reg, 0);
+    }
+}
+
+void CAarch64Ops::MoveConst64ToVariable(void * Variable, const char * VariableName, uint64_t Const)
+{
+    asmjit::a64::Mem Mem = VariablePtr(Variable, VariableName);
+    if (Const == 0)
+    {
+        str(asmjit::a64::xzr, Mem);
+    }
+    else
+    {
+        MoveConst64ToReg(Aarch64ScratchReg, Const);
+        str(Aarch64ScratchReg, Mem);
+    }
+}
+
+void CAarch64Ops::MoveConstByteToVariable(void * Variable, const char * VariableName, uint8_t Const)
+{
+    asmjit::a64::Mem Mem = VariablePtr(Variable, VariableName);
+    if (Const == 0)
+    {
+        strb(asmjit::a64::wzr, Mem);
+    }
+    else
+    {
+        MoveConst64ToReg(Aarch64ScratchReg.w(), Const);
+        strb(Aarch64ScratchReg.w(), Mem);
+    }
+}
+
+void CAarch64Ops::MoveConstPtrToReg(const asmjit::a64::Gp & Reg, const void * Ptr, const char * PtrName)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        commentf("%s", PtrName);
+    }
+    MoveConst64ToReg(Reg.x(), (uint64_t)Ptr);
+}
+
+void CAarch64Ops::MoveConstToVariable(void * Variable, const char * VariableName, uint32_t Const)
+{
+    asmjit::a64::Mem Mem = VariablePtr(Variable, VariableName);
+    if (Const == 0)
+    {
+        str(asmjit::a64::wzr, Mem);
+    }
+    else
+    {
+        MoveConst64ToReg(Aarch64ScratchReg.w(), Const);
+        str(Aarch64ScratchReg.w(), Mem);
+    }
+}
+
+void CAarch64Ops::MoveRegToVariable(void * Variable, const char * VariableName, const asmjit::a64::Gp & Reg)
+{
+    str(Reg, VariablePtr(Variable, VariableName));
+}
+
+void CAarch64Ops::MoveVariableToReg(const asmjit::a64::Gp & Reg, void * Variable, const char * VariableName)
+{
+    ldr(Reg, VariablePtr(Variable, VariableName));
+}
+
+void CAarch64Ops::SubConstFromVariable(uint32_t Const, void * Variable, const char * VariableName)
+{
+    asmjit::a64::Mem Mem = VariablePtr(Variable, VariableName);
+    ldr(asmjit::a64::w9, Mem);
+    if (Const <= 0xFFF)
+    {
+        subs(asmjit::a64::w9, asmjit::a64::w9, Const);
+    }
+    else
+    {
+        MoveConst64ToReg(Aarch64ScratchReg.w(), Const);
+        subs(asmjit::a64::w9, asmjit::a64::w9, Aarch64ScratchReg.w());
+    }
+    str(asmjit::a64::w9, Mem);
+}
+
+void CAarch64Ops::TestVariable(void * Variable, const char * VariableName, uint32_t Const)
+{
+    ldr(asmjit::a64::w9, VariablePtr(Variable, VariableName));
+    MoveConst64ToReg(Aarch64ScratchReg.w(), Const);
+    tst(asmjit::a64::w9, Aarch64ScratchReg.w());
+}
+
+asmjit::a64::Mem CAarch64Ops::VariablePtr(void * Variable, const char * VariableName)
+{
+    MoveConstPtrToReg(Aarch64AddressReg, Variable, VariableName);
+    return asmjit::a64::ptr(Aarch64AddressReg);
+}
+
+uintptr_t CAarch64Ops::GetAddressOf(int value, ...)
+{
+    void * Address;
+
+    va_list ap;
+    va_start(ap, value);
+    Address = va_arg(ap, void *);
+    va_end(ap);
+
+    return (uintptr_t)Address;
 }
 
 asmjit::Error CAarch64Ops::_log(const char * data, size_t size) noexcept
 {
     stdstr AsmjitLog(std::string(data, size));
     AsmjitLog.Trim("\n");
-    for (SymbolMap::const_iterator itr = m_Symbols.begin(); itr != m_Symbols.end(); itr++)
+    std::string::size_type Pos = AsmjitLog.find("L");
+    if (m_LabelSymbols.size() > 0 && Pos != std::string::npos)
     {
-        AsmjitLog.Replace(itr->first, itr->second);
+        size_t len = AsmjitLog.length();
+        uint32_t Value = 0;
+        for (int i = 0; i < 8 && (Pos + 1 + i) < len; i++)
+        {
+            char c = AsmjitLog[Pos + 1 + i];
+            if (c >= '0' && c <= '9')
+            {
+                Value = (Value * 10) + (c - '0');
+            }
+            else
+            {
+                break;
+            }
+        }
+        LabelSymbolMap::iterator itr = m_LabelSymbols.find(Value);
+        if (itr != m_LabelSymbols.end())
+        {
+            std::string::size_type endPos = Pos + 1;
+            for (std::string::size_type LenSize = AsmjitLog.length(); (endPos < LenSize && isdigit((unsigned char)AsmjitLog[endPos])); endPos++)
+            {
+            }
+            std::string LabelStr = AsmjitLog.substr(Pos, endPos - Pos);
+            AsmjitLog.replace(Pos, LabelStr.length(), itr->second.Symbol);
+            itr->second.Count -= 1;
+            if (itr->second.Count == 0)
+            {
+                m_LabelSymbols.erase(itr);
+            }
+        }
     }
     m_CodeBlock.Log("      %s", AsmjitLog.c_str());
     return asmjit::kErrorOk;
 }
 
-#endif
\ No newline at end of file
+void CAarch64Ops::AddLabelSymbol(const asmjit::Label & Label, const char * Symbol)
+{
+    LabelSymbolMap::iterator itr = m_LabelSymbols.find(Label.id());
+    if (itr != m_LabelSymbols.end())
+    {
+        if (strcmp(itr->second.Symbol.c_str(), Symbol) == 0)
+        {
+            itr->second.Count += 2;
+        }
+        else
+        {
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+    }
+    else
+    {
+        m_LabelSymbols.emplace(std::make_pair(Label.id(), LabelSymbol{Symbol, 2}));
+    }
+}
+
+#endif
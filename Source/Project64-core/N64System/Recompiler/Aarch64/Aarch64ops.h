@@ -1,9 +1,22 @@
 #pragma once
 #if defined(__aarch64__)
 #include <Project64-core/N64System/Recompiler/asmjit.h>
+#include <map>
+#include <string>
+
+#if !defined(_MSC_VER) && !defined(_Printf_format_string_)
+#define _Printf_format_string_
+#endif
 
 class CCodeBlock;
 
+// x19 is callee-saved and holds the address of the MIPS general purpose registers for the
+// life of a code block. x16 and x17 are the intra-procedure-call registers, they are never
+// used to hold a value between helper calls so they are used to build addresses and constants
+static constexpr asmjit::a64::GpX Aarch64GprBaseReg = asmjit::a64::x19;
+static constexpr asmjit::a64::GpX Aarch64AddressReg = asmjit::a64::x16;
+static constexpr asmjit::a64::GpX Aarch64ScratchReg = asmjit::a64::x17;
+
 class CAarch64Ops :
     public asmjit::a64::Assembler,
     public asmjit::Logger
@@ -11,17 +24,68 @@ class CAarch64Ops :
 public:
     CAarch64Ops(CCodeBlock & CodeBlock);
 
+    void Aarch64BreakPoint(const char * FileName, int32_t LineNumber);
+    void AddConstToVariable(void * Variable, const char * VariableName, uint32_t Const);
+    void AddConstToReg(const asmjit::a64::Gp & DestReg, const asmjit::a64::Gp & SrcReg, int64_t Const);
+    void AddsConstToReg(const asmjit::a64::Gp & Reg, int64_t Const);
+    void CallFunc(uintptr_t FunctPtr, const char * FunctName);
+    void CallThis(uintptr_t ThisPtr, uintptr_t FunctPtr, const char * FunctName);
+    void CompConstByteToVariable(void * Variable, const char * VariableName, uint8_t Const);
+    void CompConstToReg(const asmjit::a64::Gp & Reg, int64_t Const);
+    void CompConstToVariable(void * Variable, const char * VariableName, uint32_t Const);
+    void EnterStackFrame();
+    void ExitStackFrame();
+    void BLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BeqLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BgeLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BgtLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BhiLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BhsLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BleLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BloLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BlsLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BltLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BmiLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BneLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BplLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void BvsLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void MoveConst64ToReg(const asmjit::a64::Gp & Reg, uint64_t Const);
+    void MoveConst64ToVariable(void * Variable, const char * VariableName, uint64_t Const);
+    void MoveConstByteToVariable(void * Variable, const char * VariableName, uint8_t Const);
+    void MoveConstPtrToReg(const asmjit::a64::Gp & Reg, const void * Ptr, const char * PtrName);
+    void MoveConstToVariable(void * Variable, const char * VariableName, uint32_t Const);
+    void MoveRegToVariable(void * Variable, const char * VariableName, const asmjit::a64::Gp & Reg);
+    void MoveVariableToReg(const asmjit::a64::Gp & Reg, void * Variable, const char * VariableName);
+    void SubConstFromVariable(uint32_t Const, void * Variable, const char * VariableName);
+    void TestVariable(void * Variable, const char * VariableName, uint32_t Const);
+
+    asmjit::a64::Mem VariablePtr(void * Variable, const char * VariableName);
+
+    static uintptr_t GetAddressOf(int32_t value, ...);
+
 private:
     CAarch64Ops(void);
     CAarch64Ops(const CAarch64Ops &);
     CAarch64Ops & operator=(const CAarch64Ops &);
 
     asmjit::Error _log(const char * data, size_t size) noexcept;
+    void AddLabelSymbol(const asmjit::Label & Label, const char * Symbol);
+    void BranchLabel(asmjit::a64::CondCode Cond, const char * LabelName, asmjit::Label & JumpLabel);
+
+    static void BreakPointNotification(const char * FileName, int32_t LineNumber);
 
-    typedef std::map<std::string, std::string> SymbolMap;
+    typedef struct
+    {
+        std::string Symbol;
+        uint32_t Count;
+    } LabelSymbol;
 
-    SymbolMap m_Symbols;
+    typedef std::map<uint32_t, LabelSymbol> LabelSymbolMap;
+
+    LabelSymbolMap m_LabelSymbols;
     CCodeBlock & m_CodeBlock;
 };
 
+#define AddressOf(Addr) CAarch64Ops::GetAddressOf(5, (Addr))
+
 #endif
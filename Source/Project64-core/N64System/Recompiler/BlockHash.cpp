@@ -0,0 +1,125 @@
+#include "stdafx.h"
+
+#include <Project64-core/N64System/Recompiler/BlockHash.h>
+#include <string.h>
+
+// 64-bit hash using the xxHash64 algorithm, four independent lanes are mixed for each 32 bytes
+// so it runs at close to memory speed, unlike MD5 which processes 64 bytes through 64 rounds
+static const uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t Prime3 = 0x165667B19E3779F9ULL;
+static const uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t Prime5 = 0x27D4EB2F165667C5ULL;
+
+static inline uint64_t RotateLeft(uint64_t Value, uint32_t Shift)
+{
+    return (Value << Shift) | (Value >> (64 - Shift));
+}
+
+static inline uint64_t Read64(const uint8_t * Data)
+{
+    uint64_t Value;
+    memcpy(&Value, Data, sizeof(Value));
+    return Value;
+}
+
+static inline uint32_t Read32(const uint8_t * Data)
+{
+    uint32_t Value;
+    memcpy(&Value, Data, sizeof(Value));
+    return Value;
+}
+
+static inline uint64_t Round(uint64_t Acc, uint64_t Input)
+{
+    Acc += Input * Prime2;
+    Acc = RotateLeft(Acc, 31);
+    return Acc * Prime1;
+}
+
+static inline uint64_t MergeRound(uint64_t Acc, uint64_t Value)
+{
+    Acc ^= Round(0, Value);
+    return Acc * Prime1 + Prime4;
+}
+
+CBlockHash::CBlockHash() :
+    m_Hash(0),
+    m_Length(0)
+{
+}
+
+CBlockHash::CBlockHash(const uint8_t * Data, uint32_t Length) :
+    m_Hash(Calculate(Data, Length)),
+    m_Length(Length)
+{
+}
+
+bool CBlockHash::operator==(const CBlockHash & rhs) const
+{
+    return m_Hash == rhs.m_Hash && m_Length == rhs.m_Length;
+}
+
+bool CBlockHash::operator!=(const CBlockHash & rhs) const
+{
+    return !(*this == rhs);
+}
+
+uint64_t CBlockHash::Calculate(const uint8_t * Data, uint32_t Length)
+{
+    const uint8_t * End = Data + Length;
+    uint64_t Hash;
+
+    if (Length >= 32)
+    {
+        const uint8_t * Limit = End - 32;
+        uint64_t v1 = Prime1 + Prime2;
+        uint64_t v2 = Prime2;
+        uint64_t v3 = 0;
+        uint64_t v4 = 0 - Prime1;
+
+        do
+        {
+            v1 = Round(v1, Read64(Data));
+            v2 = Round(v2, Read64(Data + 8));
+            v3 = Round(v3, Read64(Data + 16));
+            v4 = Round(v4, Read64(Data + 24));
+            Data += 32;
+        } while (Data <= Limit);
+
+        Hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+        Hash = MergeRound(Hash, v1);
+        Hash = MergeRound(Hash, v2);
+        Hash = MergeRound(Hash, v3);
+        Hash = MergeRound(Hash, v4);
+    }
+    else
+    {
+        Hash = Prime5;
+    }
+
+    Hash += Length;
+    for (; Data + 8 <= End; Data += 8)
+    {
+        Hash ^= Round(0, Read64(Data));
+        Hash = RotateLeft(Hash, 27) * Prime1 + Prime4;
+    }
+    if (Data + 4 <= End)
+    {
+        Hash ^= (uint64_t)Read32(Data) * Prime1;
+        Hash = RotateLeft(Hash, 23) * Prime2 + Prime3;
+        Data += 4;
+    }
+    for (; Data < End; Data++)
+    {
+        Hash ^= (*Data) * Prime5;
+        Hash = RotateLeft(Hash, 11) * Prime1;
+    }
+
+    Hash ^= Hash >> 33;
+    Hash *= Prime2;
+    Hash ^= Hash >> 29;
+    Hash *= Prime3;
+    Hash ^= Hash >> 32;
+    return Hash;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <stdint.h>
+
+// Fingerprint of the MIPS code a block was compiled from, used to decide if a compiled block can
+// be reused once the memory it came from has been written to. Only this class knows how the
+// fingerprint is calculated, so the hash can be changed without touching the recompiler.
+class CBlockHash
+{
+public:
+    CBlockHash();
+    CBlockHash(const uint8_t * Data, uint32_t Length);
+
+    bool operator==(const CBlockHash & rhs) const;
+    bool operator!=(const CBlockHash & rhs) const;
+
+    uint64_t Value() const
+    {
+        return m_Hash;
+    }
+
+private:
+    static uint64_t Calculate(const uint8_t * Data, uint32_t Length);
+
+    uint64_t m_Hash;
+    uint32_t m_Length;
+};
@@ -2,6 +2,7 @@
 
 #include <Project64-core/N64System/Mips/R4300iInstruction.h>
 #include <Project64-core/N64System/N64System.h>
+#include <Project64-core/N64System/Recompiler/Aarch64/Aarch64RecompilerOps.h>
 #include <Project64-core/N64System/Recompiler/Arm/ArmRecompilerOps.h>
 #include <Project64-core/N64System/Recompiler/CodeBlock.h>
 #include <Project64-core/N64System/Recompiler/Recompiler.h>
@@ -22,6 +23,7 @@ CCodeBlock::CCodeBlock(CN64System & System, uint32_t VAddrEnter) :
     m_VAddrFirst(VAddrEnter),
     m_VAddrLast(VAddrEnter),
     m_CompiledLocation(nullptr),
+    m_LinkEntry(nullptr),
     m_EnterSection(nullptr),
     m_RecompilerOps(nullptr),
     m_Test(1)
@@ -42,6 +44,8 @@ CCodeBlock::CCodeBlock(CN64System & System, uint32_t VAddrEnter) :
     m_RecompilerOps = new CX64RecompilerOps(System, *this);
 #elif defined(__arm__) || defined(_M_ARM)
     m_RecompilerOps = new CArmRecompilerOps(System, *this);
+#elif defined(__aarch64__)
+    m_RecompilerOps = new CAarch64RecompilerOps(System, *this);
 #else
     g_Notify->BreakPoint(__FILE__, __LINE__);
 #endif
@@ -99,6 +103,10 @@ CCodeBlock::~CCodeBlock()
     {
 #if defined(__i386__) || defined(_M_IX86)
         delete (CX86RecompilerOps *)m_RecompilerOps;
+#elif defined(__amd64__) || defined(_M_X64)
+        delete (CX64RecompilerOps *)m_RecompilerOps;
+#elif defined(__aarch64__)
+        delete (CAarch64RecompilerOps *)m_RecompilerOps;
 #else
         g_Notify->BreakPoint(__FILE__, __LINE__);
 #endif
@@ -867,6 +875,8 @@ bool CCodeBlock::AnalyzeInstruction(uint32_t PC, uint32_t & TargetPC, uint32_t &
 bool CCodeBlock::Compile()
 {
     m_RecompilerOps->EnterCodeBlock();
+    m_LinkEntryLabel = m_RecompilerOps->Assembler().newLabel();
+    m_RecompilerOps->Assembler().bind(m_LinkEntryLabel);
     if (g_System->bLinkBlocks())
     {
         while (m_EnterSection != nullptr && m_EnterSection->GenerateNativeCode(NextTest()))
@@ -888,7 +898,7 @@ bool CCodeBlock::Compile()
         g_Notify->BreakPoint(__FILE__, __LINE__);
         return false;
     }
-    MD5(BlockPtr, BlockSize).get_digest(m_Hash);
+    m_Hash = CBlockHash(BlockPtr, BlockSize);
     return true;
 }
 
@@ -920,10 +930,18 @@ uint32_t CCodeBlock::Finilize(CRecompMemory & RecompMem)
         m_CodeLog += CodeLog;
     }
     m_CodeHolder.copyFlattenedData(m_CompiledLocation, codeSize, asmjit::CopySectionFlags::kPadSectionBuffer);
-    m_Recompiler.RecompPos() += codeSize;
+    m_Recompiler.CodeAdded((uint32_t)codeSize);
+
+    m_LinkEntry = m_CompiledLocation + m_CodeHolder.labelOffsetFromBase(m_LinkEntryLabel);
+    for (size_t i = 0, n = m_BlockLinks.size(); i < n; i++)
+    {
+        m_BlockLinks[i].JumpLocation = m_CompiledLocation + m_CodeHolder.labelOffsetFromBase(m_BlockLinkLabels[i]);
+    }
 
 #if defined(ANDROID) && (defined(__arm__) || defined(_M_ARM))
     __clear_cache((uint8_t *)((uint32_t)m_CompiledLocation & ~1), m_CompiledLocation + codeSize);
+#elif defined(__aarch64__)
+    __builtin___clear_cache((char *)m_CompiledLocation, (char *)(m_CompiledLocation + codeSize));
 #endif
     return (uint32_t)codeSize;
 }
@@ -935,6 +953,38 @@ uint32_t CCodeBlock::NextTest()
     return next_test;
 }
 
+bool CCodeBlock::BlockLinkAllowed(void) const
+{
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64) || defined(__aarch64__)
+    // A linked exit skips the lookup loop, so only link when the loop would do nothing more than find the next block
+    if (!g_System->bLinkBlocks() || g_SyncSystem != nullptr || (g_System->LookUpMode() != FuncFind_PhysicalLookup && g_System->LookUpMode() != FuncFind_ChangeMemory) || g_System->bSMM_ValidFunc())
+    {
+        return false;
+    }
+
+    // kseg0 and kseg1 do not go through the TLB, so a link can not become stale from the TLB being changed
+    return (m_VAddrEnter & 0xC0000000) == 0x80000000;
+#else
+    return false;
+#endif
+}
+
+bool CCodeBlock::BlockLinkAllowed(uint32_t TargetPC) const
+{
+    if (!BlockLinkAllowed() || (TargetPC & 0xC0000000) != 0x80000000)
+    {
+        return false;
+    }
+    return (TargetPC & 0x1FFFFFFF) < m_MMU.RdramSize();
+}
+
+void CCodeBlock::AddBlockLink(uint32_t TargetPC, const asmjit::Label & JumpLabel)
+{
+    BLOCK_LINK Link = {TargetPC, nullptr};
+    m_BlockLinks.push_back(Link);
+    m_BlockLinkLabels.push_back(JumpLabel);
+}
+
 void CCodeBlock::Log(_Printf_format_string_ const char * Text, ...)
 {
     if (!CDebugSettings::bRecordRecompilerAsm())
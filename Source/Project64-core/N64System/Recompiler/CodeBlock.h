@@ -1,7 +1,8 @@
 #pragma once
-#include <Common/md5.h>
+#include <Project64-core/N64System/Recompiler/BlockHash.h>
 #include <Project64-core/N64System/Recompiler/CodeSection.h>
 #include <Project64-core/N64System/Recompiler/RecompilerOps.h>
+#include <vector>
 
 #if !defined(_MSC_VER) && !defined(_Printf_format_string_)
 #define _Printf_format_string_
@@ -15,6 +16,14 @@ class CCodeBlock :
     public asmjit::ErrorHandler
 {
 public:
+    typedef struct
+    {
+        uint32_t TargetPC;
+        uint8_t * JumpLocation;
+    } BLOCK_LINK;
+
+    typedef std::vector<BLOCK_LINK> BLOCK_LINKS;
+
     CCodeBlock(CN64System & System, uint32_t VAddrEnter);
     ~CCodeBlock();
 
@@ -41,6 +50,14 @@ public:
     {
         return m_CompiledLocation;
     }
+    uint8_t * LinkEntry() const
+    {
+        return m_LinkEntry;
+    }
+    const BLOCK_LINKS & BlockLinks() const
+    {
+        return m_BlockLinks;
+    }
     int32_t NoOfSections() const
     {
         return (int32_t)m_Sections.size() - 1;
@@ -49,7 +66,7 @@ public:
     {
         return *m_EnterSection;
     }
-    const MD5Digest & Hash() const
+    const CBlockHash & Hash() const
     {
         return m_Hash;
     }
@@ -95,6 +112,10 @@ public:
 
     uint32_t NextTest();
 
+    bool BlockLinkAllowed(void) const;
+    bool BlockLinkAllowed(uint32_t TargetPC) const;
+    void AddBlockLink(uint32_t TargetPC, const asmjit::Label & JumpLabel);
+
     void Log(_Printf_format_string_ const char * Text, ...);
 
 private:
@@ -117,6 +138,10 @@ private:
     uint32_t m_VAddrFirst;
     uint32_t m_VAddrLast;
     uint8_t * m_CompiledLocation;
+    uint8_t * m_LinkEntry;
+    asmjit::Label m_LinkEntryLabel;
+    BLOCK_LINKS m_BlockLinks;
+    std::vector<asmjit::Label> m_BlockLinkLabels;
 
     typedef std::map<uint32_t, CCodeSection *> SectionMap;
     typedef std::list<CCodeSection *> SectionList;
@@ -128,7 +153,7 @@ private:
     SectionList m_Sections;
     CCodeSection * m_EnterSection;
     int32_t m_Test;
-    MD5Digest m_Hash;
+    CBlockHash m_Hash;
     uint64_t m_MemContents[2];
     uint64_t * m_MemLocation[2];
     CRecompilerOps * m_RecompilerOps;
@@ -11,6 +11,7 @@ enum ExitReason
     ExitReason_Normal,
     ExitReason_NormalNoSysCheck,
     ExitReason_CheckPCAlignment,
+    ExitReason_Return,
     ExitReason_DoCPUAction,
     ExitReason_COP1Unuseable,
     ExitReason_DoSysCall,
@@ -7,6 +7,8 @@ CCompiledFunc::CCompiledFunc(const CCodeBlock & CodeBlock) :
     m_MaxPC(CodeBlock.VAddrLast()),
     m_Hash(CodeBlock.Hash()),
     m_Function((Func)CodeBlock.CompiledLocation()),
+    m_LinkEntry(CodeBlock.LinkEntry()),
+    m_BlockLinks(CodeBlock.BlockLinks()),
     m_Next(nullptr)
 {
     m_MemContents[0] = CodeBlock.MemContents(0);
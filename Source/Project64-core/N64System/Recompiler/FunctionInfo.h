@@ -1,5 +1,6 @@
 #pragma once
 #include <Project64-core/N64System/Recompiler/CodeBlock.h>
+#include <stddef.h>
 
 class CCompiledFunc
 {
@@ -24,7 +25,23 @@ public:
     {
         return m_Function;
     }
-    const MD5Digest & Hash() const
+    uint8_t * LinkEntry() const
+    {
+        return m_LinkEntry;
+    }
+    const CCodeBlock::BLOCK_LINKS & BlockLinks() const
+    {
+        return m_BlockLinks;
+    }
+    static uint32_t EnterPCOffset()
+    {
+        return (uint32_t)offsetof(CCompiledFunc, m_EnterPC);
+    }
+    static uint32_t LinkEntryOffset()
+    {
+        return (uint32_t)offsetof(CCompiledFunc, m_LinkEntry);
+    }
+    const CBlockHash & Hash() const
     {
         return m_Hash;
     }
@@ -56,8 +73,10 @@ private:
     uint32_t m_MinPC;
     uint32_t m_MaxPC;
 
-    MD5Digest m_Hash;
+    CBlockHash m_Hash;
     Func m_Function;
+    uint8_t * m_LinkEntry;
+    CCodeBlock::BLOCK_LINKS m_BlockLinks;
 
     CCompiledFunc * m_Next;
     uint64_t m_MemContents[2], *m_MemLocation[2];
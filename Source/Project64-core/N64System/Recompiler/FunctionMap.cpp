@@ -8,6 +8,9 @@ CFunctionMap::CFunctionMap() :
     m_JumpTable(nullptr),
     m_FunctionTable(nullptr)
 {
+    memset(m_CodePages, 0, sizeof(m_CodePages));
+    memset(m_PageBlocks, 0, sizeof(m_PageBlocks));
+    memset(m_PageFirstBlock, 0, sizeof(m_PageFirstBlock));
 }
 
 CFunctionMap::~CFunctionMap()
@@ -29,7 +32,7 @@ bool CFunctionMap::AllocateMemory()
         }
         memset(m_FunctionTable, 0, 0x100000 * sizeof(PCCompiledFunc_TABLE));
     }
-    if (LookUpMode() == FuncFind_PhysicalLookup && m_JumpTable == nullptr)
+    if ((LookUpMode() == FuncFind_PhysicalLookup || LookUpMode() == FuncFind_ChangeMemory) && m_JumpTable == nullptr)
     {
         m_JumpTable = new PCCompiledFunc[RdramSize() >> 2];
         if (m_JumpTable == nullptr)
@@ -63,13 +66,100 @@ void CFunctionMap::CleanBuffers()
         delete[] m_JumpTable;
         m_JumpTable = nullptr;
     }
+    memset(m_CodePages, 0, sizeof(m_CodePages));
+    memset(m_PageBlocks, 0, sizeof(m_PageBlocks));
+    memset(m_PageFirstBlock, 0, sizeof(m_PageFirstBlock));
+}
+
+void CFunctionMap::SetPageHasCode(uint32_t PAddr)
+{
+    uint32_t Page = PAddr >> 12;
+    if (Page < MaxCodePages)
+    {
+        m_CodePages[Page >> 5] |= 1u << (Page & 0x1F);
+    }
+}
+
+void CFunctionMap::ClearPageHasCode(uint32_t PAddr)
+{
+    uint32_t Page = PAddr >> 12;
+    if (Page < MaxCodePages)
+    {
+        m_CodePages[Page >> 5] &= ~(1u << (Page & 0x1F));
+    }
+}
+
+bool CFunctionMap::PageHasCode(uint32_t PAddr) const
+{
+    uint32_t Page = PAddr >> 12;
+    if (Page >= MaxCodePages)
+    {
+        return true;
+    }
+    return (m_CodePages[Page >> 5] & (1u << (Page & 0x1F))) != 0;
+}
+
+bool CFunctionMap::RangeHasCode(uint32_t PAddr, uint32_t Length) const
+{
+    if (Length == 0)
+    {
+        return false;
+    }
+    for (uint32_t Page = PAddr >> 12, LastPage = (PAddr + Length - 1) >> 12; Page <= LastPage; Page++)
+    {
+        if (PageHasCode(Page << 12))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CFunctionMap::AddPageBlock(uint32_t StartPAddr, uint32_t EndPAddr)
+{
+    for (uint32_t Page = StartPAddr >> 12, LastPage = EndPAddr >> 12; Page <= LastPage && Page < MaxCodePages; Page++)
+    {
+        if (m_PageBlocks[Page] == 0 || StartPAddr < m_PageFirstBlock[Page])
+        {
+            m_PageFirstBlock[Page] = StartPAddr;
+        }
+        m_PageBlocks[Page] += 1;
+    }
+}
+
+uint32_t CFunctionMap::RemovePageBlock(uint32_t PAddr)
+{
+    uint32_t Page = PAddr >> 12;
+    if (Page >= MaxCodePages || m_PageBlocks[Page] == 0)
+    {
+        return 0;
+    }
+    return --m_PageBlocks[Page];
+}
+
+uint32_t CFunctionMap::FirstBlockPAddr(uint32_t PAddr, uint32_t Length) const
+{
+    uint32_t FirstPAddr = (uint32_t)-1;
+    if (Length == 0)
+    {
+        return FirstPAddr;
+    }
+    for (uint32_t Page = PAddr >> 12, LastPage = (PAddr + Length - 1) >> 12; Page <= LastPage && Page < MaxCodePages; Page++)
+    {
+        // The first block is only lowered while the page has blocks, so it can be lower than needed but never higher
+        if (m_PageBlocks[Page] != 0 && m_PageFirstBlock[Page] < FirstPAddr)
+        {
+            FirstPAddr = m_PageFirstBlock[Page];
+        }
+    }
+    return FirstPAddr;
 }
 
 void CFunctionMap::Reset(bool bAllocate)
 {
     WriteTrace(TraceRecompiler, TraceDebug, "Start (bAllocate: %s)", bAllocate ? "true" : "false");
     CleanBuffers();
-    if (bAllocate && (g_System->LookUpMode() == FuncFind_VirtualLookup || g_System->LookUpMode() == FuncFind_PhysicalLookup))
+    if (bAllocate && (g_System->LookUpMode() == FuncFind_VirtualLookup || g_System->LookUpMode() == FuncFind_PhysicalLookup || g_System->LookUpMode() == FuncFind_ChangeMemory))
     {
         AllocateMemory();
     }
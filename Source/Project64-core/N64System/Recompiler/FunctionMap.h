@@ -25,9 +25,30 @@ public:
         return m_JumpTable;
     }
 
+    // One bit per 4KB page of RDRAM, set when a block is entered from that page. Clearing
+    // compiled code is skipped for pages where nothing has ever been compiled
+    void SetPageHasCode(uint32_t PAddr);
+    void ClearPageHasCode(uint32_t PAddr);
+    bool PageHasCode(uint32_t PAddr) const;
+    bool RangeHasCode(uint32_t PAddr, uint32_t Length) const;
+
+    // Number of jump table entries whose block has code in each page, and the lowest address any
+    // of those blocks starts at. A write to a page has to remove every block that covers it
+    void AddPageBlock(uint32_t StartPAddr, uint32_t EndPAddr);
+    uint32_t RemovePageBlock(uint32_t PAddr);
+    uint32_t FirstBlockPAddr(uint32_t PAddr, uint32_t Length) const;
+
 private:
+    enum
+    {
+        MaxCodePages = 0x800000 >> 12,
+    };
+
     void CleanBuffers();
 
     PCCompiledFunc * m_JumpTable;
     PCCompiledFunc_TABLE * m_FunctionTable;
+    uint32_t m_CodePages[MaxCodePages / 32];
+    uint32_t m_PageBlocks[MaxCodePages];
+    uint32_t m_PageFirstBlock[MaxCodePages];
 };
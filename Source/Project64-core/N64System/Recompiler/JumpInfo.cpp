@@ -2,7 +2,7 @@
 
 #include "JumpInfo.h"
 #include "SectionInfo.h"
-#include <Project64-core\N64System\Recompiler\CodeBlock.h>
+#include <Project64-core/N64System/Recompiler/CodeBlock.h>
 
 CJumpInfo::CJumpInfo(CCodeBlock & CodeBlock) :
     RegSet(CodeBlock, CodeBlock.RecompilerOps()->Assembler())
@@ -11,11 +11,14 @@ CRecompiler::CRecompiler(CN64System & System, bool & EndEmulation) :
     m_TLB(System.m_TLB),
     m_EndEmulation(EndEmulation),
     m_MemoryStack(0),
+    m_ReturnStackPos(0),
     PROGRAM_COUNTER(System.m_Reg.m_PROGRAM_COUNTER),
     m_LogFile(nullptr)
 {
     CFunctionMap::AllocateMemory();
     ResetMemoryStackPos();
+    ResetReturnStack();
+    ResetRemoveStats();
 }
 
 CRecompiler::~CRecompiler()
@@ -126,7 +129,64 @@ void CRecompiler::RecompilerMain_VirtualTable()
 
 void CRecompiler::RecompilerMain_VirtualTable_validate()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    bool & Done = m_EndEmulation;
+    uint64_t & PC = PROGRAM_COUNTER;
+
+    while (!Done)
+    {
+        if (!m_MMU.ValidVaddr((uint32_t)PC))
+        {
+            m_Reg.TriggerAddressException(PC, EXC_RMISS);
+            PC = m_System.m_JumpToLocation;
+            m_System.m_PipelineStage = PIPELINE_STAGE_NORMAL;
+            if (!m_MMU.ValidVaddr((uint32_t)PC))
+            {
+                g_Notify->DisplayError(stdstr_f("Failed to translate PC to a PAddr: %X\n\nEmulation stopped", (uint32_t)PC).c_str());
+                return;
+            }
+            continue;
+        }
+
+        PCCompiledFunc_TABLE & table = FunctionTable()[(uint32_t)PC >> 0xC];
+        uint32_t TableEntry = ((uint32_t)PC & 0xFFF) >> 2;
+        if (table)
+        {
+            CCompiledFunc * info = table[TableEntry];
+            if (info != nullptr)
+            {
+                if (*(info->MemLocation(0)) == info->MemContents(0) &&
+                    *(info->MemLocation(1)) == info->MemContents(1))
+                {
+                    (info->Function())();
+                    continue;
+                }
+                uint32_t VAddr = (uint32_t)PC & ~0xFFF;
+                ClearRecompCode_Virt(VAddr - 0x1000, 0x1000, Remove_ValidateFunc);
+                ClearRecompCode_Virt(VAddr, 0x1000, Remove_ValidateFunc);
+                ClearRecompCode_Virt(VAddr + 0x1000, 0x1000, Remove_ValidateFunc);
+                continue;
+            }
+        }
+        CCompiledFunc * info = CompileCode();
+        if (info == nullptr || m_EndEmulation)
+        {
+            break;
+        }
+
+        if (table == nullptr)
+        {
+            table = new PCCompiledFunc[(0x1000 >> 2)];
+            if (table == nullptr)
+            {
+                WriteTrace(TraceRecompiler, TraceError, "Failed to allocate PCCompiledFunc");
+                g_Notify->FatalError(MSG_MEM_ALLOC_ERROR);
+            }
+            memset(table, 0, sizeof(PCCompiledFunc) * (0x1000 >> 2));
+        }
+
+        table[TableEntry] = info;
+        (info->Function())();
+    }
 }
 
 void CRecompiler::RecompilerMain_Lookup()
@@ -159,6 +219,8 @@ void CRecompiler::RecompilerMain_Lookup()
                     break;
                 }
                 JumpTable()[PhysicalAddr >> 2] = info;
+                AddLiveBlock(PhysicalAddr, info);
+                LinkFunction(PhysicalAddr, info);
             }
             (info->Function())();
         }
@@ -166,7 +228,7 @@ void CRecompiler::RecompilerMain_Lookup()
         {
             uint32_t opsExecuted = 0;
 
-            while (m_MMU.VAddrToPAddr((uint32_t)PROGRAM_COUNTER, PhysicalAddr) && PhysicalAddr >= m_System.RdramSize())
+            while (!m_EndEmulation && m_MMU.VAddrToPAddr((uint32_t)PROGRAM_COUNTER, PhysicalAddr) && PhysicalAddr >= m_System.RdramSize())
             {
                 m_System.m_OpCodes.ExecuteOps(m_System.CountPerOp());
                 opsExecuted += m_System.CountPerOp();
@@ -214,6 +276,7 @@ void CRecompiler::RecompilerMain_Lookup_validate()
                     break;
                 }
                 JumpTable()[PhysicalAddr >> 2] = info;
+                AddLiveBlock(PhysicalAddr, info);
             }
             else
             {
@@ -275,7 +338,7 @@ void CRecompiler::RecompilerMain_Lookup_validate()
         {
             uint32_t opsExecuted = 0;
 
-            while (m_MMU.VAddrToPAddr((uint32_t)PC, PhysicalAddr) && PhysicalAddr >= m_System.RdramSize())
+            while (!Done && m_MMU.VAddrToPAddr((uint32_t)PC, PhysicalAddr) && PhysicalAddr >= m_System.RdramSize())
             {
                 m_System.m_OpCodes.ExecuteOps(m_System.CountPerOp());
                 opsExecuted += m_System.CountPerOp();
@@ -303,8 +366,12 @@ void CRecompiler::Reset()
 void CRecompiler::ResetRecompCode(bool bAllocate)
 {
     WriteTrace(TraceRecompiler, TraceDebug, "Start");
+    DumpRemoveStats();
+    ResetRemoveStats();
     CRecompMemory::Reset();
     CFunctionMap::Reset(bAllocate);
+    m_BlockLinks.clear();
+    ResetReturnStack();
 
     for (CCompiledFuncList::iterator iter = m_Functions.begin(); iter != m_Functions.end(); iter++)
     {
@@ -323,7 +390,10 @@ void CRecompiler::ResetRecompCode(bool bAllocate)
 
 void CRecompiler::RecompilerMain_ChangeMemory()
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    // Every page a block is compiled from has its memory write map entry cleared, so a store to it
+    // takes the slow path and removes the block. The jump table can then be trusted without
+    // checking the code of each block before it is run.
+    RecompilerMain_Lookup();
 }
 
 CCompiledFunc * CRecompiler::CompileCode()
@@ -349,11 +419,10 @@ CCompiledFunc * CRecompiler::CompileCode()
             uint32_t PAddr;
             if (m_MMU.VAddrToPAddr(Func->MinPC(), PAddr))
             {
-                MD5Digest Hash;
-                MD5(m_MMU.Rdram() + PAddr, (Func->MaxPC() - Func->MinPC()) + 4).get_digest(Hash);
-                if (memcmp(Hash.digest, Func->Hash().digest, sizeof(Hash.digest)) == 0)
+                if (CBlockHash(m_MMU.Rdram() + PAddr, (Func->MaxPC() - Func->MinPC()) + 4) == Func->Hash())
                 {
                     WriteTrace(TraceRecompiler, TraceInfo, "Using existing compiled code (Program Counter: %016llX pAddr: %X)", PROGRAM_COUNTER, pAddr);
+                    MarkCodePages(pAddr, Func);
                     return Func;
                 }
             }
@@ -367,12 +436,10 @@ CCompiledFunc * CRecompiler::CompileCode()
     {
         return nullptr;
     }
-    uint32_t CodeLen = CodeBlock.Finilize(*this);
-    if (CodeLen == 0)
+    if (CodeBlock.Finilize(*this) == 0)
     {
         return nullptr;
     }
-    RecompPos() += CodeLen;
     LogCodeBlock(CodeBlock);
 
     if (bShowRecompMemSize())
@@ -380,12 +447,8 @@ CCompiledFunc * CRecompiler::CompileCode()
         ShowMemUsed();
     }
 
-    if (bSMM_StoreInstruc())
-    {
-        m_MMU.ClearMemoryWriteMap(CodeBlock.VAddrEnter() & ~0xFFF, 0xFFF);
-    }
-
     CCompiledFunc * Func = new CCompiledFunc(CodeBlock);
+    MarkCodePages(pAddr, Func);
     std::pair<CCompiledFuncList::iterator, bool> ret = m_Functions.insert(CCompiledFuncList::value_type(Func->EnterPC(), Func));
     if (ret.second == false)
     {
@@ -393,9 +456,6 @@ CCompiledFunc * CRecompiler::CompileCode()
         ret.first->second->SetNext(Func);
     }
 
-#if defined(__aarch64__) || defined(__amd64__) || defined(_M_X64)
-    g_Notify->BreakPoint(__FILE__, __LINE__);
-#endif
     if (g_ModuleLogLevel[TraceRecompiler] >= TraceDebug)
     {
         m_RecompEndTime.SetToNow();
@@ -407,85 +467,394 @@ CCompiledFunc * CRecompiler::CompileCode()
     return Func;
 }
 
+void CRecompiler::MarkCodePages(uint32_t PAddr, const CCompiledFunc * Func)
+{
+    SetPageHasCode(PAddr);
+    if (m_System.LookUpMode() == FuncFind_ChangeMemory)
+    {
+        uint32_t StartPAddr;
+        if (m_MMU.VAddrToPAddr(Func->MinPC(), StartPAddr))
+        {
+            for (uint32_t Page = StartPAddr & ~0xFFF, EndPAddr = StartPAddr + (Func->MaxPC() - Func->MinPC()); Page <= EndPAddr; Page += 0x1000)
+            {
+                SetPageHasCode(Page);
+            }
+        }
+        m_MMU.ClearMemoryWriteMap(Func->MinPC() & ~0xFFF, Func->MaxPC() - (Func->MinPC() & ~0xFFF));
+    }
+    else if (bSMM_StoreInstruc())
+    {
+        m_MMU.ClearMemoryWriteMap(Func->EnterPC() & ~0xFFF, 0xFFF);
+    }
+}
+
 void CRecompiler::ClearRecompCode_Phys(uint32_t Address, int length, REMOVE_REASON Reason)
 {
+    m_RemoveStats[Reason].Requests += 1;
+    if (m_System.LookUpMode() == FuncFind_ChangeMemory && Address < m_System.RdramSize() && length > 0)
+    {
+        // Stores are caught a page at a time, so every block with code in the pages written to is
+        // removed, including blocks that start in an earlier page and run on in to them
+        uint32_t PageStart = Address & ~0xFFF;
+        uint32_t PageEnd = (Address + length + 0xFFF) & ~0xFFF;
+        uint32_t FirstPAddr = FirstBlockPAddr(PageStart, PageEnd - PageStart);
+        if (FirstPAddr == (uint32_t)-1)
+        {
+            m_RemoveStats[Reason].Skipped += 1;
+            m_MMU.RestoreMemoryWriteMap(PageStart, PageEnd - PageStart);
+            return;
+        }
+        uint32_t ScanStart = FirstPAddr < PageStart ? FirstPAddr & ~3 : PageStart;
+        m_RemoveStats[Reason].FunctionsRemoved += ClearJumpTable(ScanStart, PageEnd - ScanStart, PageStart);
+        return;
+    }
+    if (Address < m_System.RdramSize() && !RangeHasCode(Address, (length + 3) & ~3))
+    {
+        m_RemoveStats[Reason].Skipped += 1;
+        return;
+    }
+
     if (m_System.LookUpMode() == FuncFind_VirtualLookup)
     {
-        ClearRecompCode_Virt(Address + 0x80000000, length, Reason);
-        ClearRecompCode_Virt(Address + 0xA0000000, length, Reason);
+        uint32_t Removed = ClearVirtualTable(Address + 0x80000000, length);
+        Removed += ClearVirtualTable(Address + 0xA0000000, length);
 
         uint32_t VAddr, Index = 0;
         while (m_TLB.PAddrToVAddr(Address, VAddr, Index))
         {
             WriteTrace(TraceRecompiler, TraceInfo, "ClearRecompCode Vaddr %X  len: %d", VAddr, length);
-            ClearRecompCode_Virt(VAddr, length, Reason);
+            Removed += ClearVirtualTable(VAddr, length);
         }
+        m_RemoveStats[Reason].FunctionsRemoved += Removed;
     }
     else if (m_System.LookUpMode() == FuncFind_PhysicalLookup)
     {
-        if (Address < m_System.RdramSize())
+        m_RemoveStats[Reason].FunctionsRemoved += ClearJumpTable(Address, length, Address);
+    }
+}
+
+void CRecompiler::ClearRecompCode_Virt(uint32_t Address, int length, REMOVE_REASON Reason)
+{
+    switch (m_System.LookUpMode())
+    {
+    case FuncFind_VirtualLookup:
+        m_RemoveStats[Reason].Requests += 1;
+        m_RemoveStats[Reason].FunctionsRemoved += ClearVirtualTable(Address, length);
+        break;
+    case FuncFind_PhysicalLookup:
+    case FuncFind_ChangeMemory:
+    {
+        uint32_t pAddr = 0;
+        if (m_MMU.VAddrToPAddr(Address, pAddr))
+        {
+            ClearRecompCode_Phys(pAddr, length, Reason);
+        }
+    }
+    break;
+    default:
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+}
+
+uint32_t CRecompiler::ClearVirtualTable(uint32_t Address, int length)
+{
+    uint32_t AddressIndex = Address >> 0xC;
+    uint32_t WriteStart = (Address & 0xFFC);
+    length = ((length + 3) & ~0x3);
+
+    int DataInBlock = 0x1000 - WriteStart;
+    int DataToWrite = length < DataInBlock ? length : DataInBlock;
+    int DataLeft = length - DataToWrite;
+    uint32_t Removed = 0;
+
+    PCCompiledFunc_TABLE & table = FunctionTable()[AddressIndex];
+    if (table)
+    {
+        WriteTrace(TraceRecompiler, TraceError, "Delete table (%X): Index = %d", table, AddressIndex);
+        for (uint32_t i = 0; i < (0x1000 >> 2); i++)
         {
-            int ClearLen = ((length + 3) & ~3);
-            if (Address + ClearLen > m_System.RdramSize())
+            if (table[i] != nullptr)
             {
-                g_Notify->BreakPoint(__FILE__, __LINE__);
-                ClearLen = m_System.RdramSize() - Address;
+                Removed += 1;
             }
-            WriteTrace(TraceRecompiler, TraceInfo, "Resetting jump table, Addr: %X  len: %d", Address, ClearLen);
-            memset((uint8_t *)JumpTable() + Address, 0, ClearLen);
         }
-        else
+        delete table;
+        table = nullptr;
+    }
+
+    if (DataLeft > 0)
+    {
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+    return Removed;
+}
+
+uint32_t CRecompiler::ClearJumpTable(uint32_t Address, int length, uint32_t WriteStart)
+{
+    if (Address >= m_System.RdramSize())
+    {
+        WriteTrace(TraceRecompiler, TraceInfo, "Ignoring reset of jump table, Addr: %X  len: %d", Address, ((length + 3) & ~3));
+        return 0;
+    }
+    int ClearLen = ((length + 3) & ~3);
+    if (Address + ClearLen > m_System.RdramSize())
+    {
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+        ClearLen = m_System.RdramSize() - Address;
+    }
+    WriteTrace(TraceRecompiler, TraceInfo, "Resetting jump table, Addr: %X  len: %d", Address, ClearLen);
+    PCCompiledFunc * Table = JumpTable();
+    uint32_t Removed = 0;
+    for (uint32_t PAddr = Address, EndAddr = Address + ClearLen; PAddr < EndAddr; PAddr += 4)
+    {
+        if ((PAddr & 0xFFF) == 0 && !PageHasCode(PAddr))
         {
-            WriteTrace(TraceRecompiler, TraceInfo, "Ignoring reset of jump table, Addr: %X  len: %d", Address, ((length + 3) & ~3));
+            PAddr += 0x1000 - 4;
+            continue;
+        }
+        CCompiledFunc * Func = Table[PAddr >> 2];
+        if (Func == nullptr || (PAddr < WriteStart && BlockEndPAddr(PAddr, Func) < WriteStart))
+        {
+            continue;
         }
+        UnlinkFunction(PAddr, Func);
+        RemoveLiveBlock(PAddr, Func);
+        Table[PAddr >> 2] = nullptr;
+        Removed += 1;
+    }
+
+    // Pages that have been cleared completely have no entries left in the jump table
+    for (uint32_t PAddr = (WriteStart + 0xFFF) & ~0xFFF; PAddr + 0x1000 <= Address + ClearLen; PAddr += 0x1000)
+    {
+        ClearPageHasCode(PAddr);
     }
+    return Removed;
 }
 
-void CRecompiler::ClearRecompCode_Virt(uint32_t Address, int length, REMOVE_REASON Reason)
+void CRecompiler::AddLiveBlock(uint32_t PAddr, const CCompiledFunc * Func)
 {
-    uint32_t AddressIndex, WriteStart;
-    int DataInBlock, DataToWrite, DataLeft;
+    uint32_t Before = Func->EnterPC() - Func->MinPC();
+    AddPageBlock(Before < PAddr ? PAddr - Before : 0, BlockEndPAddr(PAddr, Func));
+}
 
-    switch (m_System.LookUpMode())
+void CRecompiler::RemoveLiveBlock(uint32_t PAddr, const CCompiledFunc * Func)
+{
+    uint32_t Before = Func->EnterPC() - Func->MinPC();
+    uint32_t StartPAddr = Before < PAddr ? PAddr - Before : 0;
+    for (uint32_t Page = StartPAddr & ~0xFFF, EndPAddr = BlockEndPAddr(PAddr, Func); Page <= EndPAddr; Page += 0x1000)
     {
-    case FuncFind_VirtualLookup:
-        AddressIndex = Address >> 0xC;
-        WriteStart = (Address & 0xFFC);
-        length = ((length + 3) & ~0x3);
+        // Stores to a page only take the fast path again once no block is left with code in it
+        if (RemovePageBlock(Page) == 0 && m_System.LookUpMode() == FuncFind_ChangeMemory)
+        {
+            m_MMU.RestoreMemoryWriteMap(Page, 0x1000);
+        }
+    }
+}
 
-        DataInBlock = 0x1000 - WriteStart;
-        DataToWrite = length < DataInBlock ? length : DataInBlock;
-        DataLeft = length - DataToWrite;
+uint32_t CRecompiler::BlockEndPAddr(uint32_t PAddr, const CCompiledFunc * Func)
+{
+    return PAddr + (Func->MaxPC() - Func->EnterPC()) + 3;
+}
 
+void CRecompiler::EvictRecompCode(uint8_t * Start, uint32_t Length)
+{
+    WriteTrace(TraceRecompiler, TraceInfo, "Start (Start: %p Length: %X)", Start, Length);
+    uint8_t * End = Start + Length;
+    uint32_t Evicted = 0;
+
+    // Remove every reference to the functions before they are deleted, a function can be in
+    // the tables more than once when the same code is reached through different addresses
+    PCCompiledFunc * Table = JumpTable();
+    if (Table != nullptr)
+    {
+        for (uint32_t i = 0, n = m_System.RdramSize() >> 2; i < n; i++)
         {
-            PCCompiledFunc_TABLE & table = FunctionTable()[AddressIndex];
-            if (table)
+            if ((i & 0x3FF) == 0 && !PageHasCode(i << 2))
             {
-                WriteTrace(TraceRecompiler, TraceError, "Delete table (%X): Index = %d", table, AddressIndex);
-                delete table;
-                table = nullptr;
+                i += 0x3FF;
+                continue;
             }
+            if (Table[i] != nullptr && (uint8_t *)Table[i]->Function() >= Start && (uint8_t *)Table[i]->Function() < End)
+            {
+                UnlinkFunction(i << 2, Table[i]);
+                RemoveLiveBlock(i << 2, Table[i]);
+                Table[i] = nullptr;
+            }
+        }
+    }
+    PCCompiledFunc_TABLE * FuncTable = FunctionTable();
+    if (FuncTable != nullptr)
+    {
+        for (uint32_t i = 0; i < 0x100000; i++)
+        {
+            if (FuncTable[i] == nullptr)
+            {
+                continue;
+            }
+            for (uint32_t x = 0; x < (0x1000 >> 2); x++)
+            {
+                CCompiledFunc * Func = FuncTable[i][x];
+                if (Func != nullptr && (uint8_t *)Func->Function() >= Start && (uint8_t *)Func->Function() < End)
+                {
+                    FuncTable[i][x] = nullptr;
+                }
+            }
+        }
+    }
 
-            if (DataLeft > 0)
+    for (CCompiledFuncList::iterator itr = m_Functions.begin(); itr != m_Functions.end();)
+    {
+        CCompiledFunc * Head = nullptr, *Tail = nullptr;
+        for (CCompiledFunc * Func = itr->second, *Next; Func != nullptr; Func = Next)
+        {
+            Next = Func->Next();
+            if ((uint8_t *)Func->Function() >= Start && (uint8_t *)Func->Function() < End)
+            {
+                m_BlockProfile.erase(Func->Function());
+                delete Func;
+                Evicted += 1;
+                continue;
+            }
+            Func->SetNext(nullptr);
+            if (Tail == nullptr)
+            {
+                Head = Func;
+            }
+            else
             {
-                g_Notify->BreakPoint(__FILE__, __LINE__);
+                Tail->SetNext(Func);
             }
+            Tail = Func;
         }
-        break;
-    case FuncFind_PhysicalLookup:
+        if (Head == nullptr)
+        {
+            itr = m_Functions.erase(itr);
+        }
+        else
+        {
+            itr->second = Head;
+            itr++;
+        }
+    }
+    WriteTrace(TraceRecompiler, TraceInfo, "Done (Evicted: %d Remaining: %d)", Evicted, (uint32_t)m_Functions.size());
+}
+
+void CRecompiler::ResetRemoveStats()
+{
+    memset(m_RemoveStats, 0, sizeof(m_RemoveStats));
+}
+
+void CRecompiler::DumpRemoveStats()
+{
+    for (int i = 0; i < Remove_ReasonCount; i++)
     {
-        uint32_t pAddr = 0;
-        if (m_MMU.VAddrToPAddr(Address, pAddr))
+        const REMOVE_STATS & Stats = m_RemoveStats[i];
+        if (Stats.Requests == 0)
         {
-            ClearRecompCode_Phys(pAddr, length, Reason);
+            continue;
         }
+        WriteTrace(TraceRecompiler, TraceInfo, "%s: Requests: %d Skipped: %d FunctionsRemoved: %d", RemoveReasonName((REMOVE_REASON)i), Stats.Requests, Stats.Skipped, Stats.FunctionsRemoved);
     }
-    break;
-    default:
-        g_Notify->BreakPoint(__FILE__, __LINE__);
+}
+
+const char * CRecompiler::RemoveReasonName(REMOVE_REASON Reason)
+{
+    switch (Reason)
+    {
+    case Remove_InitialCode: return "Remove_InitialCode";
+    case Remove_Cache: return "Remove_Cache";
+    case Remove_ProtectedMem: return "Remove_ProtectedMem";
+    case Remove_ValidateFunc: return "Remove_ValidateFunc";
+    case Remove_TLB: return "Remove_TLB";
+    case Remove_DMA: return "Remove_DMA";
+    case Remove_StoreInstruc: return "Remove_StoreInstruc";
+    case Remove_Cheats: return "Remove_Cheats";
+    case Remove_MemViewer: return "Remove_MemViewer";
+    case Remove_Rewind: return "Remove_Rewind";
+    case Remove_ReasonCount: break;
+    }
+    return "Unknown";
+}
+
+void CRecompiler::ResetReturnStack()
+{
+    // The jump table may have been reallocated, so no entry can be left pointing in to it. A return
+    // address of -1 is never matched as the PC alignment is checked before the return stack
+    for (uint32_t i = 0; i < ReturnStackSize; i++)
+    {
+        m_ReturnStack[i].ReturnPC = (uint32_t)-1;
+        m_ReturnStack[i].JumpTableEntry = nullptr;
+    }
+    m_ReturnStackPos = 0;
+}
+
+void CRecompiler::LinkFunction(uint32_t PAddr, CCompiledFunc * Func)
+{
+    const CCodeBlock::BLOCK_LINKS & Links = Func->BlockLinks();
+    for (size_t i = 0, n = Links.size(); i < n; i++)
+    {
+        uint32_t TargetPAddr = Links[i].TargetPC & 0x1FFFFFFF;
+        m_BlockLinks.insert(BLOCK_LINK_MAP::value_type(TargetPAddr, Links[i]));
+
+        CCompiledFunc * Target = JumpTable()[TargetPAddr >> 2];
+        if (Target != nullptr && Target->EnterPC() == Links[i].TargetPC)
+        {
+            PatchBlockLink(Links[i].JumpLocation, Target);
+        }
+    }
+
+    // Exits from other blocks that have been waiting for this block to be compiled
+    std::pair<BLOCK_LINK_MAP::iterator, BLOCK_LINK_MAP::iterator> Waiting = m_BlockLinks.equal_range(PAddr);
+    for (BLOCK_LINK_MAP::iterator itr = Waiting.first; itr != Waiting.second; itr++)
+    {
+        if (itr->second.TargetPC == Func->EnterPC())
+        {
+            PatchBlockLink(itr->second.JumpLocation, Func);
+        }
+    }
+}
+
+void CRecompiler::UnlinkFunction(uint32_t PAddr, CCompiledFunc * Func)
+{
+    std::pair<BLOCK_LINK_MAP::iterator, BLOCK_LINK_MAP::iterator> Incoming = m_BlockLinks.equal_range(PAddr);
+    for (BLOCK_LINK_MAP::iterator itr = Incoming.first; itr != Incoming.second; itr++)
+    {
+        PatchBlockLink(itr->second.JumpLocation, nullptr);
+    }
+
+    // The block may be reused later from m_Functions, so its exits go back to the lookup loop until it is linked again
+    const CCodeBlock::BLOCK_LINKS & Links = Func->BlockLinks();
+    for (size_t i = 0, n = Links.size(); i < n; i++)
+    {
+        std::pair<BLOCK_LINK_MAP::iterator, BLOCK_LINK_MAP::iterator> Outgoing = m_BlockLinks.equal_range(Links[i].TargetPC & 0x1FFFFFFF);
+        for (BLOCK_LINK_MAP::iterator itr = Outgoing.first; itr != Outgoing.second; itr++)
+        {
+            if (itr->second.JumpLocation == Links[i].JumpLocation)
+            {
+                m_BlockLinks.erase(itr);
+                break;
+            }
+        }
+        PatchBlockLink(Links[i].JumpLocation, nullptr);
     }
 }
 
+void CRecompiler::PatchBlockLink(uint8_t * JumpLocation, const CCompiledFunc * Target)
+{
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
+    // jmp rel32, with a displacement of 0 it falls through to the block exit
+    int32_t Displacement = Target != nullptr ? (int32_t)(Target->LinkEntry() - (JumpLocation + 5)) : 0;
+    *((int32_t *)(JumpLocation + 1)) = Displacement;
+#elif defined(__aarch64__)
+    // b imm26, branching to the next instruction falls through to the block exit
+    int64_t Displacement = Target != nullptr ? Target->LinkEntry() - JumpLocation : 4;
+    *((uint32_t *)JumpLocation) = 0x14000000 | (uint32_t)((Displacement >> 2) & 0x03FFFFFF);
+    __builtin___clear_cache((char *)JumpLocation, (char *)(JumpLocation + 4));
+#else
+    g_Notify->BreakPoint(__FILE__, __LINE__);
+#endif
+}
+
 void CRecompiler::ResetLog()
 {
     StopLog();
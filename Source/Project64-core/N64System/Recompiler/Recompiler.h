@@ -28,10 +28,34 @@ public:
         Remove_StoreInstruc,
         Remove_Cheats,
         Remove_MemViewer,
+        Remove_Rewind,
+        Remove_ReasonCount,
     };
 
+    // How often code was cleared for each reason, Skipped counts requests that were dropped
+    // because no compiled block has code in the pages written to
+    typedef struct
+    {
+        uint32_t Requests;
+        uint32_t Skipped;
+        uint32_t FunctionsRemoved;
+    } REMOVE_STATS;
+
     typedef void (*DelayFunc)();
 
+    // Return addresses pushed by JAL/JALR in recompiled code, a JR ra that matches the top entry
+    // jumps straight to the function compiled at the return address instead of the lookup loop
+    typedef struct
+    {
+        uint32_t ReturnPC;
+        PCCompiledFunc * JumpTableEntry;
+    } RETURN_ADDRESS;
+
+    enum
+    {
+        ReturnStackSize = 32,
+    };
+
 public:
     CRecompiler(CN64System & System, bool & EndEmulation);
     ~CRecompiler();
@@ -43,6 +67,14 @@ public:
     // Self-modifying code methods
     void ClearRecompCode_Virt(uint32_t VirtualAddress, int32_t length, REMOVE_REASON Reason);
     void ClearRecompCode_Phys(uint32_t PhysicalAddress, int32_t length, REMOVE_REASON Reason);
+    void EvictRecompCode(uint8_t * Start, uint32_t Length);
+    const REMOVE_STATS & RemoveStats(REMOVE_REASON Reason) const
+    {
+        return m_RemoveStats[Reason];
+    }
+    void ResetRemoveStats();
+    void DumpRemoveStats();
+    static const char * RemoveReasonName(REMOVE_REASON Reason);
 
     void ResetLog();
     void ResetMemoryStackPos();
@@ -53,6 +85,14 @@ public:
     {
         return m_MemoryStack;
     }
+    RETURN_ADDRESS * ReturnStack()
+    {
+        return m_ReturnStack;
+    }
+    uint32_t & ReturnStackPos()
+    {
+        return m_ReturnStackPos;
+    }
 
 private:
     CRecompiler();
@@ -68,6 +108,7 @@ private:
     } FUNCTION_PROFILE_DATA;
 
     typedef std::map<CCompiledFunc::Func, FUNCTION_PROFILE_DATA> FUNCTION_PROFILE;
+    typedef std::multimap<uint32_t, CCodeBlock::BLOCK_LINK> BLOCK_LINK_MAP;
 
     void RecompilerMain_VirtualTable();
     void RecompilerMain_VirtualTable_validate();
@@ -75,18 +116,33 @@ private:
     void RecompilerMain_Lookup();
     void RecompilerMain_Lookup_validate();
 
+    void ResetReturnStack();
+    void MarkCodePages(uint32_t PAddr, const CCompiledFunc * Func);
+    uint32_t ClearVirtualTable(uint32_t Address, int length);
+    uint32_t ClearJumpTable(uint32_t Address, int length, uint32_t WriteStart);
+    void AddLiveBlock(uint32_t PAddr, const CCompiledFunc * Func);
+    void RemoveLiveBlock(uint32_t PAddr, const CCompiledFunc * Func);
+    static uint32_t BlockEndPAddr(uint32_t PAddr, const CCompiledFunc * Func);
+    void LinkFunction(uint32_t PAddr, CCompiledFunc * Func);
+    void UnlinkFunction(uint32_t PAddr, CCompiledFunc * Func);
+    static void PatchBlockLink(uint8_t * JumpLocation, const CCompiledFunc * Target);
+
     void StartLog();
     void StopLog();
     void LogCodeBlock(const CCodeBlock & CodeBlock);
 
     CCompiledFuncList m_Functions;
+    BLOCK_LINK_MAP m_BlockLinks;
     CN64System & m_System;
     CMipsMemoryVM & m_MMU;
     CRegisters & m_Reg;
     CTLB & m_TLB;
     bool & m_EndEmulation;
     uint8_t * m_MemoryStack;
+    RETURN_ADDRESS m_ReturnStack[ReturnStackSize];
+    uint32_t m_ReturnStackPos;
     FUNCTION_PROFILE m_BlockProfile;
+    REMOVE_STATS m_RemoveStats[Remove_ReasonCount];
     uint64_t & PROGRAM_COUNTER;
     CLog * m_LogFile;
     HighResTimeStamp m_RecompStartTime;
@@ -7,7 +7,9 @@
 
 CRecompMemory::CRecompMemory() :
     m_RecompCode(nullptr),
-    m_RecompSize(0)
+    m_RecompSize(0),
+    m_RecompFreeEnd(nullptr),
+    m_CompiledBytes(0)
 {
     m_RecompPos = nullptr;
 }
@@ -44,6 +46,7 @@ bool CRecompMemory::AllocateMemory()
     }
     m_RecompSize = InitialCompileBufferSize;
     m_RecompPos = m_RecompCode;
+    m_RecompFreeEnd = m_RecompCode + m_RecompSize;
     memset(m_RecompCode, 0, InitialCompileBufferSize);
     WriteTrace(TraceRecompiler, TraceDebug, "Done");
     return true;
@@ -51,42 +54,68 @@ bool CRecompMemory::AllocateMemory()
 
 bool CRecompMemory::CheckRecompMem(uint32_t BlockSize)
 {
-    uint32_t Size = (uint32_t)((uint8_t *)m_RecompPos - (uint8_t *)m_RecompCode);
     if (BlockSize < 0x50000)
     {
         BlockSize = 0x50000;
     }
-    if ((Size + BlockSize) < m_RecompSize)
+    if ((uint32_t)(m_RecompFreeEnd - m_RecompPos) > BlockSize)
     {
         return true;
     }
-    if (m_RecompSize == MaxCompileBufferSize)
+    if (m_RecompSize < MaxCompileBufferSize)
     {
-        g_Recompiler->ResetRecompCode(true);
-        Size = (uint32_t)((uint8_t *)m_RecompPos - (uint8_t *)m_RecompCode);
-        if ((Size + BlockSize) < m_RecompSize)
+        if (BlockSize > IncreaseCompileBufferSize)
         {
-            return true;
+            g_Notify->BreakPoint(__FILE__, __LINE__);
         }
-        return false;
+        void * MemAddr = CommitMemory(m_RecompCode + m_RecompSize, IncreaseCompileBufferSize, MEM_EXECUTE_READWRITE);
+        if (MemAddr == nullptr)
+        {
+            WriteTrace(TraceRecompiler, TraceError, "Failed to increase buffer");
+            g_Notify->FatalError(MSG_MEM_ALLOC_ERROR);
+        }
+        m_RecompSize += IncreaseCompileBufferSize;
+        m_RecompFreeEnd = m_RecompCode + m_RecompSize;
+        return true;
     }
-    if (BlockSize > IncreaseCompileBufferSize)
+    if (BlockSize >= m_RecompSize)
     {
-        g_Notify->BreakPoint(__FILE__, __LINE__);
+        return false;
     }
-    void * MemAddr = CommitMemory(m_RecompCode + m_RecompSize, IncreaseCompileBufferSize, MEM_EXECUTE_READWRITE);
-    if (MemAddr == nullptr)
+
+    // The buffer is used as a ring, the oldest code in front of the compile position is evicted a
+    // section at a time so the space stays contiguous and only code that has not been compiled
+    // recently needs to be compiled again
+    while ((uint32_t)(m_RecompFreeEnd - m_RecompPos) <= BlockSize)
     {
-        WriteTrace(TraceRecompiler, TraceError, "Failed to increase buffer");
-        g_Notify->FatalError(MSG_MEM_ALLOC_ERROR);
+        uint8_t * BufferEnd = m_RecompCode + m_RecompSize;
+        if (m_RecompFreeEnd == BufferEnd)
+        {
+            WriteTrace(TraceRecompiler, TraceInfo, "Compile buffer wrapped");
+            m_RecompPos = m_RecompCode;
+            m_RecompFreeEnd = m_RecompCode;
+        }
+        uint32_t EvictSize = (uint32_t)(BufferEnd - m_RecompFreeEnd);
+        if (EvictSize > EvictCompileBufferSize)
+        {
+            EvictSize = EvictCompileBufferSize;
+        }
+        g_Recompiler->EvictRecompCode(m_RecompFreeEnd, EvictSize);
+        m_RecompFreeEnd += EvictSize;
     }
-    m_RecompSize += IncreaseCompileBufferSize;
     return true;
 }
 
+void CRecompMemory::CodeAdded(uint32_t Size)
+{
+    m_RecompPos += Size;
+    m_CompiledBytes += Size;
+}
+
 void CRecompMemory::Reset()
 {
     m_RecompPos = m_RecompCode;
+    m_RecompFreeEnd = m_RecompCode + m_RecompSize;
 }
 
 void CRecompMemory::ShowMemUsed()
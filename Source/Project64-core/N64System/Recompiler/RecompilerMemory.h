@@ -16,6 +16,12 @@ public:
     {
         return m_RecompPos;
     }
+    uint64_t CompiledBytes() const
+    {
+        return m_CompiledBytes;
+    }
+
+    void CodeAdded(uint32_t Size);
 
     bool CheckRecompMem(uint32_t BlockSize);
 
@@ -26,6 +32,8 @@ private:
     uint8_t * m_RecompCode;
     uint32_t m_RecompSize;
     uint8_t * m_RecompPos;
+    uint8_t * m_RecompFreeEnd;
+    uint64_t m_CompiledBytes;
 
     enum
     {
@@ -39,4 +47,8 @@ private:
     {
         IncreaseCompileBufferSize = 0x00100000
     };
+    enum
+    {
+        EvictCompileBufferSize = 0x00400000
+    };
 };
@@ -1,19 +1,32 @@
 #pragma once
 #if defined(__amd64__) || defined(_M_X64)
 
+#include <Project64-core/N64System/Interpreter/InterpreterOps.h>
+#include <Project64-core/N64System/Mips/Register.h>
 #include <Project64-core/N64System/Recompiler/ExitInfo.h>
+#include <Project64-core/N64System/Recompiler/JumpInfo.h>
 #include <Project64-core/N64System/Recompiler/RecompilerOps.h>
 #include <Project64-core/N64System/Recompiler/RegInfo.h>
+#include <Project64-core/N64System/Recompiler/asmjit.h>
 #include <Project64-core/N64System/Recompiler/x64-86/x64ops.h>
+#include <Project64-core/Settings/GameSettings.h>
+#include <Project64-core/Settings/N64SystemSettings.h>
+#include <Project64-core/Settings/RecompilerSettings.h>
 
-class CX64Ops;
-struct CJumpInfo;
+class CCodeBlock;
+class CCodeSection;
 
 class CX64RecompilerOps :
-    public CRecompilerOpsBase
+    public CRecompilerOpsBase,
+    protected CN64SystemSettings,
+    protected CRecompilerSettings,
+    protected CLogSettings,
+    private CGameSettings
 {
+    friend CX64RegInfo;
+
 public:
-    CX64RecompilerOps(CN64System & System, CCodeBlock & CodeBlock);
+    CX64RecompilerOps(CN64System & m_System, CCodeBlock & CodeBlock);
     ~CX64RecompilerOps();
 
     // Trap functions
@@ -197,14 +210,30 @@ public:
     // Other functions
     void UnknownOpcode();
 
+    void RecordLLAddress(const asmjit::x86::Gp & AddressReg);
+    void RecordLLAddress(uint64_t Address);
+    void ClearCachedInstructionInfo();
+    void FoundMemoryBreakpoint();
+    void PreReadInstruction();
+    void PreWriteInstruction();
+    void TestWriteBreakpoint(const asmjit::x86::Gp & AddressReg, uintptr_t FunctAddress, const char * FunctName);
+    void TestReadBreakpoint(const asmjit::x86::Gp & AddressReg, uintptr_t FunctAddress, const char * FunctName);
+    void TestBreakpoint(const asmjit::x86::Gp & AddressReg, uintptr_t FunctAddress, const char * FunctName);
     void EnterCodeBlock();
+    void ExitCodeBlock();
     void CompileExitCode();
+    void CompileCheckFPUInput(asmjit::x86::Gp RegPointer, FpuOpSize OpSize, bool Conv = false);
+    void CompileCheckFPUResult32(int32_t DestReg);
+    void CompileCheckFPUResult64(asmjit::x86::Gp RegPointer);
+    void CompileCop1Test();
+    void CompileInitFpuOperation(CRegBase::FPU_ROUND RoundMethod);
     void CompileInPermLoop(CRegInfo & RegSet, uint32_t ProgramCounter);
     void SyncRegState(const CRegInfo & SyncTo);
-    CX64RegInfo & GetRegWorkingSet(void);
-    void SetRegWorkingSet(const CX64RegInfo & RegInfo);
+    bool SetupRegisterForLoop(CCodeBlock & BlockInfo, const CRegInfo & RegSet);
+    CRegInfo & GetRegWorkingSet(void);
+    void SetRegWorkingSet(const CRegInfo & RegInfo);
     bool InheritParentInfo();
-    void LinkJump(CJumpInfo & JumpInfo, uint32_t SectionID = -1, uint32_t FromSectionID = -1);
+    void LinkJump(CJumpInfo & JumpInfo);
     void JumpToSection(CCodeSection * Section);
     void JumpToUnknown(CJumpInfo * JumpInfo);
     void SetCurrentPC(uint32_t ProgramCounter);
@@ -213,14 +242,22 @@ public:
     void SetNextStepType(PIPELINE_STAGE StepType);
     PIPELINE_STAGE GetNextStepType(void);
     const R4300iOpcode & GetOpcode(void) const;
+    const R4300iInstruction & GetInstruction(void) const;
     void PreCompileOpcode(void);
     void PostCompileOpcode(void);
-    void CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo & ExitRegSet, ExitReason reason);
+    void CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo & ExitRegSet, ExitReason Reason);
 
+    void CompileReadTLBMiss(uint32_t VirtualAddress, const asmjit::x86::Gp & LookUpReg);
+    void CompileReadTLBMiss(const asmjit::x86::Gp & AddressReg, const asmjit::x86::Gp & LookUpReg);
+    void CompileWriteTLBMiss(const asmjit::x86::Gp & AddressReg, const asmjit::x86::Gp & LookUpReg);
+    void TLBMapToHostOffset(const asmjit::x86::Gp & LookUpReg, const asmjit::x86::Gp & AddressReg);
+    void UpdateSyncCPU(CRegInfo & RegSet, uint32_t Cycles);
     void UpdateCounters(CRegInfo & RegSet, bool CheckTimer, bool ClearValues = false, bool UpdateTimer = true);
     void CompileSystemCheck(uint32_t TargetPC, const CRegInfo & RegSet);
     void CompileExecuteBP(void);
     void CompileExecuteDelaySlotBP(void);
+    static void ChangeDefaultRoundingModel();
+    void OverflowDelaySlot(bool TestTimer);
 
     CX64Ops & Assembler()
     {
@@ -231,8 +268,56 @@ private:
     CX64RecompilerOps(const CX64RecompilerOps &);
     CX64RecompilerOps & operator=(const CX64RecompilerOps &);
 
-    CX64RegInfo m_RegWorkingSet;
+    asmjit::x86::Gp BaseOffsetAddress(bool UseBaseRegister);
+    void CompileLoadMemoryValue(asmjit::x86::Gp & AddressReg, const asmjit::x86::Gp & ValueReg, const asmjit::x86::Gp & ValueRegHi, uint8_t ValueSize, bool SignExtend);
+    void CompileStoreMemoryValue(asmjit::x86::Gp AddressReg, const asmjit::x86::Gp & ValueReg, const asmjit::x86::Gp & ValueRegHi, uint64_t Value, uint8_t ValueSize);
+    void COP1_D_Opcode(void (CX64Ops::*Instruction)(void));
+    void COP1_D_Opcode(void (CX64Ops::*Instruction)(const asmjit::x86::Mem &));
+    void COP1_S_Opcode(void (CX64Ops::*Instruction)(void));
+    void COP1_S_Opcode(void (CX64Ops::*Instruction)(const asmjit::x86::Mem &));
+
+    void SB_Const(uint32_t Value, uint32_t Addr);
+    void SB_Register(const asmjit::x86::Gp & Reg, uint32_t Addr);
+    void SH_Const(uint32_t Value, uint32_t Addr);
+    void SH_Register(const asmjit::x86::Gp & Reg, uint32_t Addr);
+    void SW_Const(uint32_t Value, uint32_t Addr);
+    void SW_Register(const asmjit::x86::Gp & Reg, uint32_t Addr);
+    void LB_KnownAddress(const asmjit::x86::Gp & Reg, uint32_t VAddr, bool SignExtend);
+    void LH_KnownAddress(const asmjit::x86::Gp & Reg, uint32_t VAddr, bool SignExtend);
+    void LW_KnownAddress(const asmjit::x86::Gp & Reg, uint32_t VAddr);
+    void LW(bool ResultSigned, bool bRecordLLBit);
+    void SW(bool bCheckLLbit);
+    void CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo & ExitRegSet, ExitReason Reason, bool CompileNow, void (CX64Ops::*x86Jmp)(const char * LabelName, asmjit::Label & JumpLabel));
+    void CompileBlockLink(uint32_t TargetPC);
+    void CompilePushReturnAddress(uint32_t ReturnPC);
+    void CompileReturnPrediction(void);
+    void ResetMemoryStack();
+    void COP1_S_CVT(CRegBase::FPU_ROUND RoundMethod, CRegInfo::FPU_STATE OldFormat, CRegInfo::FPU_STATE NewFormat);
+
+    static void x86CompilerBreakPoint();
+    static void x86BreakPointDelaySlot();
+    static void x86MemoryBreakPoint();
+    static void x86TestReadBreakPoint8();
+    static void x86TestReadBreakPoint16();
+    static void x86TestReadBreakPoint32();
+    static void x86TestReadBreakPoint64();
+    static void x86TestWriteBreakPoint8();
+    static void x86TestWriteBreakPoint16();
+    static void x86TestWriteBreakPoint32();
+    static void x86TestWriteBreakPoint64();
+
+    EXIT_LIST m_ExitInfo;
     CX64Ops m_Assembler;
+    PIPELINE_STAGE m_PipelineStage;
+    const uint32_t & m_CompilePC;
+    CX64RegInfo m_RegWorkingSet;
+    CRegInfo m_RegBeforeDelay;
+    bool m_EffectDelaySlot;
+    static uint32_t m_RoundingModeValue;
+    static bool m_TempMemoryUsed;
+    static uint32_t m_TempValue32;
+    static uint64_t m_TempValue64;
+    static uint32_t m_BranchCompare;
 };
 
 typedef CX64RecompilerOps CRecompilerOps;
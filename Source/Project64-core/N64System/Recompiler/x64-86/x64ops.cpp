@@ -1,24 +1,1013 @@
 #include "stdafx.h"
-#if defined(__amd64__) || defined(_M_X64)
 
+#if defined(__amd64__) || defined(_M_X64)
+#include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
 #include <Project64-core/N64System/Recompiler/CodeBlock.h>
 #include <Project64-core/N64System/Recompiler/x64-86/x64ops.h>
+#include <Project64-core/N64System/SystemGlobals.h>
 
 CX64Ops::CX64Ops(CCodeBlock & CodeBlock) :
-    m_CodeBlock(CodeBlock)
+    asmjit::x86::Assembler(&CodeBlock.CodeHolder()),
+    m_CodeBlock(CodeBlock),
+    m_PushedArgs(0)
+{
+    setLogger(CDebugSettings::bRecordRecompilerAsm() ? this : nullptr);
+    setErrorHandler(&CodeBlock);
+    addFlags(asmjit::FormatFlags::kHexOffsets);
+    addFlags(asmjit::FormatFlags::kHexImms);
+    addFlags(asmjit::FormatFlags::kExplainImms);
+}
+
+void CX64Ops::AdcVariableToX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    adc(Reg, VariablePtr(Variable, VariableName, 4));
+}
+
+void CX64Ops::AddConstToVariable(void * Variable, const char * VariableName, uint32_t Const)
+{
+    add(VariablePtr(Variable, VariableName, 4), Const);
+}
+
+void CX64Ops::AddConstToX86Reg(const asmjit::x86::Gp & Reg, uint32_t Const)
+{
+    if (Const != 0)
+    {
+        if (Const == 1)
+        {
+            inc(Reg);
+        }
+        else if (Const == 0xFFFFFFFF)
+        {
+            dec(Reg);
+        }
+        else
+        {
+            add(Reg, Const);
+        }
+    }
+}
+
+void CX64Ops::AddVariableToX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    add(Reg, VariablePtr(Variable, VariableName, 4));
+}
+
+void CX64Ops::AndConstToVariable(void * Variable, const char * VariableName, uint32_t Const)
+{
+    and_(VariablePtr(Variable, VariableName, 4), Const);
+}
+
+void CX64Ops::AndVariableDispToX86Reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName, const asmjit::x86::Gp & AddrReg, Multipler Multiply)
+{
+    MoveConstPtrToX86reg(x64ScratchReg, Variable, VariableName);
+    and_(Reg, asmjit::x86::dword_ptr(x64ScratchReg, AddrReg.r64(), Multiply >> 1));
+}
+
+void CX64Ops::AndVariableToX86Reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    and_(Reg, VariablePtr(Variable, VariableName, 4));
+}
+
+void CX64Ops::BreakPointNotification(const char * FileName, int32_t LineNumber)
+{
+    g_Notify->BreakPoint(FileName, LineNumber);
+}
+
+void CX64Ops::X86HardBreakPoint()
+{
+    int3();
+}
+
+void CX64Ops::X86BreakPoint(const char * FileName, int32_t LineNumber)
+{
+    PushVolatileRegs();
+    MoveConstPtrToX86reg(x64ArgReg1, FileName, FileName);
+    MoveConstToX86reg(x64ArgReg2.r32(), (uint32_t)LineNumber);
+    CallFunc((uintptr_t)BreakPointNotification, "BreakPointNotification");
+    PopVolatileRegs();
+}
+
+void CX64Ops::CallFunc(uintptr_t FunctPtr, const char * FunctName)
+{
+    PopArguments(0);
+    MoveConstPtrToX86reg(x64ScratchReg, (const void *)FunctPtr, FunctName);
+    call(x64ScratchReg);
+}
+
+void CX64Ops::CallThis(uintptr_t ThisPtr, uintptr_t FunctPtr, const char * FunctName)
+{
+    PopArguments(1);
+    MoveConst64ToX86reg(x64ArgReg1, ThisPtr);
+    CallFunc(FunctPtr, FunctName);
+}
+
+void CX64Ops::CompConstByteToVariable(void * Variable, const char * VariableName, uint8_t Const)
+{
+    cmp(VariablePtr(Variable, VariableName, 1), Const);
+}
+
+void CX64Ops::CompConstToVariable(void * Variable, const char * VariableName, uint32_t Const)
+{
+    cmp(VariablePtr(Variable, VariableName, 4), Const);
+}
+
+void CX64Ops::CompConstToX86reg(const asmjit::x86::Gp & Reg, uint32_t Const)
 {
+    if (Const == 0)
+    {
+        or_(Reg, Reg);
+    }
+    else
+    {
+        cmp(Reg, Const);
+    }
+}
+
+void CX64Ops::CompX86regToVariable(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    cmp(Reg, VariablePtr(Variable, VariableName, 4));
+}
+
+void CX64Ops::Fabs(void)
+{
+    fabs();
+}
+
+void CX64Ops::Fadd(const asmjit::x86::Mem & Mem)
+{
+    fadd(Mem);
+}
+
+void CX64Ops::Fchs(void)
+{
+    fchs();
+}
+
+void CX64Ops::Fdiv(const asmjit::x86::Mem & Mem)
+{
+    fdiv(Mem);
+}
+
+void CX64Ops::Fmul(const asmjit::x86::Mem & Mem)
+{
+    fmul(Mem);
+}
+
+void CX64Ops::Fsqrt(void)
+{
+    fsqrt();
+}
+
+void CX64Ops::Fsub(const asmjit::x86::Mem & Mem)
+{
+    fsub(Mem);
+}
+
+void CX64Ops::JaeLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jae(JumpLabel);
+}
+
+void CX64Ops::JaLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    ja(JumpLabel);
+}
+
+void CX64Ops::JbLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jb(JumpLabel);
+}
+
+void CX64Ops::JbeLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jbe(JumpLabel);
+}
+
+void CX64Ops::JecxzLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jecxz(JumpLabel);
+}
+
+void CX64Ops::JeLabel8(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    short_().je(JumpLabel);
+}
+
+void CX64Ops::JeLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    je(JumpLabel);
+}
+
+void CX64Ops::JgeLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jge(JumpLabel);
+}
+
+void CX64Ops::JgLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jg(JumpLabel);
+}
+
+void CX64Ops::JleLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jle(JumpLabel);
+}
+
+void CX64Ops::JlLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jl(JumpLabel);
+}
+
+void CX64Ops::JmpLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jmp(JumpLabel);
+}
+
+void CX64Ops::JneLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jne(JumpLabel);
+}
+
+void CX64Ops::JnpLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jnp(JumpLabel);
+}
+
+void CX64Ops::JnsLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jns(JumpLabel);
+}
+
+void CX64Ops::JnzLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jnz(JumpLabel);
+}
+
+void CX64Ops::JsLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    js(JumpLabel);
+}
+
+void CX64Ops::JoLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jo(JumpLabel);
+}
+
+void CX64Ops::JzLabel(const char * LabelName, asmjit::Label & JumpLabel)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddLabelSymbol(JumpLabel, LabelName);
+    }
+    jz(JumpLabel);
+}
+
+void CX64Ops::MoveConstByteToVariable(void * Variable, const char * VariableName, uint8_t Const)
+{
+    mov(VariablePtr(Variable, VariableName, 1), Const);
+}
+
+void CX64Ops::MoveConstHalfToVariable(void * Variable, const char * VariableName, uint16_t Const)
+{
+    mov(VariablePtr(Variable, VariableName, 2), Const);
+}
+
+void CX64Ops::MoveConstToVariable(void * Variable, const char * VariableName, uint32_t Const)
+{
+    mov(VariablePtr(Variable, VariableName, 4), Const);
+}
+
+void CX64Ops::MoveConst64ToVariable(void * Variable, const char * VariableName, uint64_t Const)
+{
+    asmjit::x86::Mem Mem = VariablePtr(Variable, VariableName, 4);
+    mov(Mem, (uint32_t)Const);
+    mov(Mem.cloneAdjusted(4), (uint32_t)(Const >> 32));
+}
+
+void CX64Ops::MoveConstToX86reg(const asmjit::x86::Gp & Reg, uint32_t Const)
+{
+    if (Const == 0)
+    {
+        xor_(Reg, Reg);
+    }
+    else
+    {
+        mov(Reg, Const);
+    }
+}
+
+void CX64Ops::MoveConst64ToX86reg(const asmjit::x86::Gp & Reg, uint64_t Const)
+{
+    if (Const == 0)
+    {
+        xor_(Reg.r32(), Reg.r32());
+    }
+    else if (Const <= 0xFFFFFFFF)
+    {
+        mov(Reg.r32(), (uint32_t)Const);
+    }
+    else
+    {
+        mov(Reg.r64(), Const);
+    }
+}
+
+void CX64Ops::MoveConstPtrToX86reg(const asmjit::x86::Gp & Reg, const void * Ptr, const char * PtrName)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddNumberSymbol((uint64_t)Ptr, PtrName);
+    }
+    mov(Reg.r64(), (uint64_t)Ptr);
+}
+
+void CX64Ops::MoveSxVariableToX86regByte(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    movsx(Reg, VariablePtr(Variable, VariableName, 1));
+}
+
+void CX64Ops::MoveSxVariableToX86regHalf(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    movsx(Reg, VariablePtr(Variable, VariableName, 2));
+}
+
+void CX64Ops::MoveVariableToX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    mov(Reg, VariablePtr(Variable, VariableName, 4));
+}
+
+void CX64Ops::MoveVariableDispToX86Reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName, const asmjit::x86::Gp & AddrReg, Multipler Multiplier)
+{
+    MoveConstPtrToX86reg(x64ScratchReg, Variable, VariableName);
+    mov(Reg, asmjit::x86::ptr(x64ScratchReg, AddrReg.r64(), Multiplier == Multip_x8 ? 3 : Multiplier >> 1, 0, Reg.size()));
+}
+
+void CX64Ops::MoveVariable64ToX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    mov(Reg.r64(), VariablePtr(Variable, VariableName, 8));
+}
+
+void CX64Ops::MoveX86regByteToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg)
+{
+    mov(VariablePtr(Variable, VariableName, 1), Reg.r8());
+}
+
+void CX64Ops::MoveX86regHalfToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg)
+{
+    mov(VariablePtr(Variable, VariableName, 2), Reg.r16());
+}
+
+void CX64Ops::MoveX86regToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg)
+{
+    mov(VariablePtr(Variable, VariableName, 4), Reg);
+}
+
+void CX64Ops::MoveX86reg64ToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg)
+{
+    mov(VariablePtr(Variable, VariableName, 8), Reg.r64());
+}
+
+void CX64Ops::MoveZxVariableToX86regByte(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    movzx(Reg, VariablePtr(Variable, VariableName, 1));
+}
+
+void CX64Ops::MoveZxVariableToX86regHalf(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    movzx(Reg, VariablePtr(Variable, VariableName, 2));
+}
+
+void CX64Ops::OrConstToVariable(void * Variable, const char * VariableName, uint32_t Const)
+{
+    or_(VariablePtr(Variable, VariableName, 4), Const);
+}
+
+void CX64Ops::OrVariableToX86Reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    or_(Reg, VariablePtr(Variable, VariableName, 4));
+}
+
+void CX64Ops::OrX86RegToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg)
+{
+    or_(VariablePtr(Variable, VariableName, 4), Reg);
+}
+
+void CX64Ops::PushImm32(uint32_t Value)
+{
+    push(Value);
+    m_PushedArgs += 1;
+}
+
+void CX64Ops::PushImm32(const char * String, uint32_t Value)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddNumberSymbol(Value, String);
+    }
+    push(Value);
+    m_PushedArgs += 1;
+}
+
+void CX64Ops::PushImm64(const char * String, uint64_t Value)
+{
+    if (CDebugSettings::bRecordRecompilerAsm())
+    {
+        AddNumberSymbol(Value, String);
+    }
+    mov(x64ScratchReg, Value);
+    push(x64ScratchReg);
+    m_PushedArgs += 1;
+}
+
+void CX64Ops::PushImmPtr(const char * String, const void * Value)
+{
+    MoveConstPtrToX86reg(x64ScratchReg, Value, String);
+    push(x64ScratchReg);
+    m_PushedArgs += 1;
+}
+
+void CX64Ops::PushX86reg(const asmjit::x86::Gp & Reg)
+{
+    if (Reg.isGpq())
+    {
+        push(Reg);
+    }
+    else
+    {
+        mov(x64ScratchReg.r32(), Reg.r32());
+        push(x64ScratchReg);
+    }
+    m_PushedArgs += 1;
+}
+
+void CX64Ops::PushX86regPair(const asmjit::x86::Gp & HiReg, const asmjit::x86::Gp & LoReg)
+{
+    mov(x64ScratchReg.r32(), HiReg.r32());
+    shl(x64ScratchReg, 32);
+    push(x64ScratchReg);
+    mov(x64ScratchReg.r32(), LoReg.r32());
+    or_(asmjit::x86::qword_ptr(asmjit::x86::rsp), x64ScratchReg);
+    m_PushedArgs += 1;
+}
+
+void CX64Ops::PopArguments(uint32_t FirstArg)
+{
+#ifdef _WIN32
+    static const asmjit::x86::Gp ArgRegs[] = {x64ArgReg1, x64ArgReg2, x64ArgReg3, x64ArgReg4};
+#else
+    static const asmjit::x86::Gp ArgRegs[] = {x64ArgReg1, x64ArgReg2, x64ArgReg3, x64ArgReg4, asmjit::x86::r8, asmjit::x86::r9};
+#endif
+    if (FirstArg + m_PushedArgs > sizeof(ArgRegs) / sizeof(ArgRegs[0]))
+    {
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+    for (uint32_t i = 0; i < m_PushedArgs; i++)
+    {
+        pop(ArgRegs[FirstArg + i]);
+    }
+    m_PushedArgs = 0;
+}
+
+void CX64Ops::PushVolatileRegs()
+{
+    push(asmjit::x86::rax);
+    push(asmjit::x86::rcx);
+    push(asmjit::x86::rdx);
+    push(asmjit::x86::rsi);
+    push(asmjit::x86::rdi);
+    push(asmjit::x86::r8);
+    push(asmjit::x86::r9);
+    push(asmjit::x86::r10);
+    push(asmjit::x86::r11);
+    sub(asmjit::x86::rsp, 0x28);
+}
+
+void CX64Ops::PopVolatileRegs()
+{
+    add(asmjit::x86::rsp, 0x28);
+    pop(asmjit::x86::r11);
+    pop(asmjit::x86::r10);
+    pop(asmjit::x86::r9);
+    pop(asmjit::x86::r8);
+    pop(asmjit::x86::rdi);
+    pop(asmjit::x86::rsi);
+    pop(asmjit::x86::rdx);
+    pop(asmjit::x86::rcx);
+    pop(asmjit::x86::rax);
+}
+
+void CX64Ops::SetaVariable(void * Variable, const char * VariableName)
+{
+    seta(VariablePtr(Variable, VariableName, 1));
+}
+
+void CX64Ops::SetbVariable(void * Variable, const char * VariableName)
+{
+    setb(VariablePtr(Variable, VariableName, 1));
+}
+
+void CX64Ops::SetgVariable(void * Variable, const char * VariableName)
+{
+    setg(VariablePtr(Variable, VariableName, 1));
+}
+
+void CX64Ops::SetlVariable(void * Variable, const char * VariableName)
+{
+    setl(VariablePtr(Variable, VariableName, 1));
+}
+
+void CX64Ops::SbbVariableFromX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    sbb(Reg, VariablePtr(Variable, VariableName, 4));
+}
+
+void CX64Ops::SubConstFromVariable(uint32_t Const, void * Variable, const char * VariableName)
+{
+    sub(VariablePtr(Variable, VariableName, 4), Const);
+}
+
+void CX64Ops::SubVariableFromX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    sub(Reg, VariablePtr(Variable, VariableName, 4));
+}
+
+void CX64Ops::TestVariable(void * Variable, const char * VariableName, uint32_t Const)
+{
+    test(VariablePtr(Variable, VariableName, 4), Const);
+}
+
+void CX64Ops::XorVariableToX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName)
+{
+    xor_(Reg, VariablePtr(Variable, VariableName, 4));
+}
+
+void CX64Ops::fpuCompp(int32_t & StackPos)
+{
+    StackPos = (StackPos + 2) & 7;
+    fcompp();
+}
+
+void CX64Ops::fpuIncStack(int32_t & StackPos)
+{
+    StackPos = (StackPos + 1) & 7;
+    fincstp();
+}
+
+void CX64Ops::fpuLoadControl(void * Variable, const char * VariableName)
+{
+    fldcw(VariablePtr(Variable, VariableName, 2));
+}
+
+void CX64Ops::fpuLoadDwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & x86reg)
+{
+    fld(asmjit::x86::dword_ptr(x86reg.r64()));
+    StackPos = (StackPos - 1) & 7;
+}
+
+void CX64Ops::fpuLoadDwordFromStackReg(int32_t & StackPos, const asmjit::x86::St & StackReg)
+{
+    fld(StackReg);
+    StackPos = (StackPos - 1) & 7;
+}
+
+void CX64Ops::fpuLoadDwordFromPtr(int32_t & StackPos, uint64_t Ptr)
+{
+    MoveConst64ToX86reg(x64ScratchReg, Ptr);
+    fld(asmjit::x86::dword_ptr(x64ScratchReg));
+    StackPos = (StackPos - 1) & 7;
+}
+
+void CX64Ops::fpuLoadIntegerDwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & x86reg)
+{
+    fild(asmjit::x86::dword_ptr(x86reg.r64()));
+    StackPos = (StackPos - 1) & 7;
+}
+
+void CX64Ops::fpuLoadIntegerQwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & x86reg)
+{
+    fild(asmjit::x86::qword_ptr(x86reg.r64()));
+    StackPos = (StackPos - 1) & 7;
+}
+
+void CX64Ops::fpuLoadQwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg)
+{
+    StackPos = (StackPos - 1) & 7;
+    fld(asmjit::x86::qword_ptr(Reg.r64()));
+}
+
+void CX64Ops::fpuLoadReg(int32_t & StackPos, const asmjit::x86::St & Reg)
+{
+    StackPos = (StackPos - 1) & 7;
+    fld(Reg);
+}
+
+void CX64Ops::fpuStoreControl(void * Variable, const char * VariableName)
+{
+    fnstcw(VariablePtr(Variable, VariableName, 2));
+}
+
+void CX64Ops::fpuStoreDwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & x86reg, bool pop)
+{
+    if (pop)
+    {
+        fstp(asmjit::x86::dword_ptr(x86reg.r64()));
+        StackPos = (StackPos + 1) & 7;
+    }
+    else
+    {
+        fst(asmjit::x86::dword_ptr(x86reg.r64()));
+    }
+}
+
+void CX64Ops::fpuStoreIntegerDwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & x86reg, bool pop)
+{
+    if (pop)
+    {
+        fistp(asmjit::x86::dword_ptr(x86reg.r64()));
+        StackPos = (StackPos + 1) & 7;
+    }
+    else
+    {
+        fist(asmjit::x86::dword_ptr(x86reg.r64()));
+    }
+}
+
+void CX64Ops::fpuStoreIntegerQwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg, bool pop)
+{
+    if (pop)
+    {
+        StackPos = (StackPos + 1) & 7;
+        fistp(asmjit::x86::qword_ptr(Reg.r64()));
+    }
+    else
+    {
+        fist(asmjit::x86::qword_ptr(Reg.r64()));
+    }
+}
+
+void CX64Ops::fpuStoreQwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg, bool pop)
+{
+    if (pop)
+    {
+        fstp(asmjit::x86::qword_ptr(Reg.r64()));
+        StackPos = (StackPos + 1) & 7;
+    }
+    else
+    {
+        fst(asmjit::x86::qword_ptr(Reg.r64()));
+    }
+}
+
+const char * CX64Ops::x86_Name(const asmjit::x86::Gp & Reg)
+{
+    if (Reg == asmjit::x86::eax)
+    {
+        return "eax";
+    }
+    if (Reg == asmjit::x86::rax)
+    {
+        return "rax";
+    }
+    if (Reg == asmjit::x86::ebx)
+    {
+        return "ebx";
+    }
+    if (Reg == asmjit::x86::rbx)
+    {
+        return "rbx";
+    }
+    if (Reg == asmjit::x86::ecx)
+    {
+        return "ecx";
+    }
+    if (Reg == asmjit::x86::rcx)
+    {
+        return "rcx";
+    }
+    if (Reg == asmjit::x86::edx)
+    {
+        return "edx";
+    }
+    if (Reg == asmjit::x86::rdx)
+    {
+        return "rdx";
+    }
+    if (Reg == asmjit::x86::esi)
+    {
+        return "esi";
+    }
+    if (Reg == asmjit::x86::rsi)
+    {
+        return "rsi";
+    }
+    if (Reg == asmjit::x86::edi)
+    {
+        return "edi";
+    }
+    if (Reg == asmjit::x86::rdi)
+    {
+        return "rdi";
+    }
+    if (Reg == asmjit::x86::ebp)
+    {
+        return "ebp";
+    }
+    if (Reg == asmjit::x86::rbp)
+    {
+        return "rbp";
+    }
+    if (Reg == asmjit::x86::esp)
+    {
+        return "esp";
+    }
+    if (Reg == asmjit::x86::rsp)
+    {
+        return "rsp";
+    }
+    if (Reg == asmjit::x86::r8d)
+    {
+        return "r8d";
+    }
+    if (Reg == asmjit::x86::r8)
+    {
+        return "r8";
+    }
+    if (Reg == asmjit::x86::r9d)
+    {
+        return "r9d";
+    }
+    if (Reg == asmjit::x86::r9)
+    {
+        return "r9";
+    }
+    if (Reg == asmjit::x86::r10d)
+    {
+        return "r10d";
+    }
+    if (Reg == asmjit::x86::r10)
+    {
+        return "r10";
+    }
+    if (Reg == asmjit::x86::r11d)
+    {
+        return "r11d";
+    }
+    if (Reg == asmjit::x86::r11)
+    {
+        return "r11";
+    }
+    if (Reg == asmjit::x86::r12d)
+    {
+        return "r12d";
+    }
+    if (Reg == asmjit::x86::r12)
+    {
+        return "r12";
+    }
+    if (Reg == asmjit::x86::r13d)
+    {
+        return "r13d";
+    }
+    if (Reg == asmjit::x86::r13)
+    {
+        return "r13";
+    }
+    if (Reg == asmjit::x86::r14d)
+    {
+        return "r14d";
+    }
+    if (Reg == asmjit::x86::r14)
+    {
+        return "r14";
+    }
+    if (Reg == asmjit::x86::r15d)
+    {
+        return "r15d";
+    }
+    if (Reg == asmjit::x86::r15)
+    {
+        return "r15";
+    }
+    g_Notify->BreakPoint(__FILE__, __LINE__);
+    return "???";
+}
+
+bool CX64Ops::Is8BitReg(const asmjit::x86::Gp & Reg)
+{
+    return Reg.isValid() && Reg.isGp();
+}
+
+uintptr_t CX64Ops::GetAddressOf(int value, ...)
+{
+    void * Address;
+
+    va_list ap;
+    va_start(ap, value);
+    Address = va_arg(ap, void *);
+    va_end(ap);
+
+    return (uintptr_t)Address;
+}
+
+asmjit::x86::Mem CX64Ops::VariablePtr(void * Variable, const char * VariableName, uint32_t Size)
+{
+    MoveConstPtrToX86reg(x64ScratchReg, Variable, VariableName);
+    return asmjit::x86::ptr(x64ScratchReg, 0, Size);
+}
+
+void CX64Ops::EnterStackFrame()
+{
+    sub(asmjit::x86::rsp, StackFrameSize);
+}
+
+void CX64Ops::ExitStackFrame()
+{
+    add(asmjit::x86::rsp, StackFrameSize);
 }
 
 asmjit::Error CX64Ops::_log(const char * data, size_t size) noexcept
 {
     stdstr AsmjitLog(std::string(data, size));
     AsmjitLog.Trim("\n");
-    for (SymbolMap::const_iterator itr = m_Symbols.begin(); itr != m_Symbols.end(); itr++)
+    std::string::size_type Pos = AsmjitLog.find("0x");
+    if (m_NumberSymbols.size() > 0 && Pos != std::string::npos)
     {
-        AsmjitLog.Replace(itr->first, itr->second);
+        uint64_t Value = 0;
+        for (int i = 0; i < 16; i++)
+        {
+            char c = AsmjitLog[Pos + 2 + i];
+            if (c >= '0' && c <= '9')
+            {
+                Value = (Value << 4) | (c - '0');
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                Value = (Value << 4) | (c - 'a' + 10);
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                Value = (Value << 4) | (c - 'A' + 10);
+            }
+            else
+            {
+                break;
+            }
+        }
+        NumberSymbolMap::iterator itr = m_NumberSymbols.find(Value);
+        if (itr != m_NumberSymbols.end())
+        {
+            std::string::size_type endPos = Pos + 2;
+            for (std::string::size_type LenSize = AsmjitLog.length(); (endPos < LenSize && isxdigit((unsigned char)AsmjitLog[endPos])); endPos++)
+            {
+            }
+            std::string hexStr = AsmjitLog.substr(Pos, endPos - Pos);
+            AsmjitLog.replace(Pos, hexStr.length(), itr->second.Symbol);
+            itr->second.Count -= 1;
+            if (itr->second.Count == 0)
+            {
+                m_NumberSymbols.erase(itr);
+            }
+        }
+    }
+    Pos = AsmjitLog.find("L");
+    if (m_LabelSymbols.size() > 0 && Pos != std::string::npos)
+    {
+        size_t len = AsmjitLog.length();
+        uint32_t Value = 0;
+        for (int i = 0; i < 8 && (Pos + 1 + i) < len; i++)
+        {
+            char c = AsmjitLog[Pos + 1 + i];
+            if (c >= '0' && c <= '9')
+            {
+                Value = (Value * 10) + (c - '0');
+            }
+            else
+            {
+                break;
+            }
+        }
+        NumberSymbolMap::iterator itr = m_LabelSymbols.find(Value);
+        if (itr != m_LabelSymbols.end())
+        {
+            std::string::size_type endPos = Pos + 1;
+            for (std::string::size_type LenSize = AsmjitLog.length(); (endPos < LenSize && isdigit((unsigned char)AsmjitLog[endPos])); endPos++)
+            {
+            }
+            std::string LabelStr = AsmjitLog.substr(Pos, endPos - Pos);
+            AsmjitLog.replace(Pos, LabelStr.length(), itr->second.Symbol);
+            itr->second.Count -= 1;
+            if (itr->second.Count == 0)
+            {
+                m_LabelSymbols.erase(itr);
+            }
+        }
     }
     m_CodeBlock.Log("      %s", AsmjitLog.c_str());
     return asmjit::kErrorOk;
 }
 
-#endif
\ No newline at end of file
+void CX64Ops::AddLabelSymbol(const asmjit::Label & Label, const char * Symbol)
+{
+    NumberSymbolMap::iterator itr = m_LabelSymbols.find(Label.id());
+    if (itr != m_LabelSymbols.end())
+    {
+        if (strcmp(itr->second.Symbol.c_str(), Symbol) == 0)
+        {
+            itr->second.Count += 2;
+        }
+        else
+        {
+            g_Notify->BreakPoint(__FILE__, __LINE__);
+        }
+    }
+    else
+    {
+        m_LabelSymbols.emplace(std::make_pair(Label.id(), NumberSymbol{Symbol, 2}));
+    }
+}
+
+void CX64Ops::AddNumberSymbol(uint64_t Value, const char * Symbol)
+{
+    NumberSymbolMap::iterator itr = m_NumberSymbols.find(Value);
+    if (itr != m_NumberSymbols.end())
+    {
+        itr->second.Count += 1;
+    }
+    else
+    {
+        m_NumberSymbols.emplace(std::make_pair(Value, NumberSymbol{Symbol, 1}));
+    }
+}
+#endif
@@ -4,26 +4,187 @@
 #include <map>
 #include <string>
 
+#if !defined(_MSC_VER) && !defined(_Printf_format_string_)
+#define _Printf_format_string_
+#endif
+
 class CCodeBlock;
 
+static constexpr asmjit::x86::Gp x86Reg_Unknown = asmjit::x86::Gp();
+
+// r11 is volatile in both the Microsoft and System V calling conventions and is never
+// handed out by the register cache, so it is used to hold 64-bit addresses and call targets
+static constexpr asmjit::x86::Gp x64ScratchReg = asmjit::x86::r11;
+
+#ifdef _WIN32
+static constexpr asmjit::x86::Gp x64ArgReg1 = asmjit::x86::rcx;
+static constexpr asmjit::x86::Gp x64ArgReg2 = asmjit::x86::rdx;
+static constexpr asmjit::x86::Gp x64ArgReg3 = asmjit::x86::r8;
+static constexpr asmjit::x86::Gp x64ArgReg4 = asmjit::x86::r9;
+#else
+static constexpr asmjit::x86::Gp x64ArgReg1 = asmjit::x86::rdi;
+static constexpr asmjit::x86::Gp x64ArgReg2 = asmjit::x86::rsi;
+static constexpr asmjit::x86::Gp x64ArgReg3 = asmjit::x86::rdx;
+static constexpr asmjit::x86::Gp x64ArgReg4 = asmjit::x86::rcx;
+#endif
+
 class CX64Ops :
     public asmjit::x86::Assembler,
     public asmjit::Logger
 {
 public:
+    enum Multipler
+    {
+        Multip_x1 = 1,
+        Multip_x2 = 2,
+        Multip_x4 = 4,
+        Multip_x8 = 8
+    };
+
+    // Function arguments are pushed in the same order as the x86 cdecl code, last argument
+    // first. CallFunc/CallThis pop them in to the argument registers, so a value already held
+    // in an argument register can be passed without being overwritten first.
+
+    // Stack space reserved by a code block on entry, keeps rsp 16 byte aligned
+    // and provides the 32 byte register home area needed by the Microsoft ABI
+    enum
+    {
+        StackFrameSize = 0x28,
+    };
+
+    static const char * x86_Name(const asmjit::x86::Gp & Reg);
+
     CX64Ops(CCodeBlock & CodeBlock);
 
+    void AdcVariableToX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void AddConstToVariable(void * Variable, const char * VariableName, uint32_t Const);
+    void AddConstToX86Reg(const asmjit::x86::Gp & Reg, uint32_t Const);
+    void AddVariableToX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void AndConstToVariable(void * Variable, const char * VariableName, uint32_t Const);
+    void AndVariableToX86Reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void AndVariableDispToX86Reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName, const asmjit::x86::Gp & AddrReg, Multipler Multiply);
+    void X86HardBreakPoint();
+    void X86BreakPoint(const char * FileName, int32_t LineNumber);
+    void CallFunc(uintptr_t FunctPtr, const char * FunctName);
+    void CallThis(uintptr_t ThisPtr, uintptr_t FunctPtr, const char * FunctName);
+    void CompConstByteToVariable(void * Variable, const char * VariableName, uint8_t Const);
+    void CompConstToVariable(void * Variable, const char * VariableName, uint32_t Const);
+    void CompConstToX86reg(const asmjit::x86::Gp & Reg, uint32_t Const);
+    void CompX86regToVariable(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void EnterStackFrame();
+    void ExitStackFrame();
+    void Fabs(void);
+    void Fadd(const asmjit::x86::Mem & Mem);
+    void Fchs(void);
+    void Fdiv(const asmjit::x86::Mem & Mem);
+    void Fmul(const asmjit::x86::Mem & Mem);
+    void Fsqrt(void);
+    void Fsub(const asmjit::x86::Mem & Mem);
+    void JaeLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JaLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JbLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JbeLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JecxzLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JeLabel8(const char * LabelName, asmjit::Label & JumpLabel);
+    void JeLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JgeLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JgLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JleLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JlLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JmpLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JneLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JnpLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JnsLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JnzLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JoLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JsLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void JzLabel(const char * LabelName, asmjit::Label & JumpLabel);
+    void MoveConstByteToVariable(void * Variable, const char * VariableName, uint8_t Const);
+    void MoveConstHalfToVariable(void * Variable, const char * VariableName, uint16_t Const);
+    void MoveConstToVariable(void * Variable, const char * VariableName, uint32_t Const);
+    void MoveConst64ToVariable(void * Variable, const char * VariableName, uint64_t Const);
+    void MoveConstToX86reg(const asmjit::x86::Gp & Reg, uint32_t Const);
+    void MoveConst64ToX86reg(const asmjit::x86::Gp & Reg, uint64_t Const);
+    void MoveConstPtrToX86reg(const asmjit::x86::Gp & Reg, const void * Ptr, const char * PtrName);
+    void MoveSxVariableToX86regByte(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void MoveSxVariableToX86regHalf(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void MoveVariableDispToX86Reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName, const asmjit::x86::Gp & AddrReg, Multipler Multiplier);
+    void MoveVariableToX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void MoveVariable64ToX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void MoveX86regByteToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg);
+    void MoveX86regHalfToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg);
+    void MoveX86regToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg);
+    void MoveX86reg64ToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg);
+    void MoveZxVariableToX86regByte(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void MoveZxVariableToX86regHalf(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void OrConstToVariable(void * Variable, const char * VariableName, uint32_t Const);
+    void OrVariableToX86Reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void OrX86RegToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg);
+    void PushImm32(uint32_t Value);
+    void PushImm32(const char * String, uint32_t Value);
+    void PushImm64(const char * String, uint64_t Value);
+    void PushImmPtr(const char * String, const void * Value);
+    void PushX86reg(const asmjit::x86::Gp & Reg);
+    void PushX86regPair(const asmjit::x86::Gp & HiReg, const asmjit::x86::Gp & LoReg);
+    void PushVolatileRegs();
+    void PopVolatileRegs();
+    void SetaVariable(void * Variable, const char * VariableName);
+    void SetbVariable(void * Variable, const char * VariableName);
+    void SetgVariable(void * Variable, const char * VariableName);
+    void SetlVariable(void * Variable, const char * VariableName);
+    void SbbVariableFromX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void SubConstFromVariable(uint32_t Const, void * Variable, const char * VariableName);
+    void SubVariableFromX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+    void TestVariable(void * Variable, const char * VariableName, uint32_t Const);
+    void XorVariableToX86reg(const asmjit::x86::Gp & Reg, void * Variable, const char * VariableName);
+
+    void fpuCompp(int32_t & StackPos);
+    void fpuIncStack(int32_t & StackPos);
+    void fpuLoadControl(void * Variable, const char * VariableName);
+    void fpuLoadDwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg);
+    void fpuLoadDwordFromStackReg(int32_t & StackPos, const asmjit::x86::St & Reg);
+    void fpuLoadDwordFromPtr(int32_t & StackPos, uint64_t Ptr);
+    void fpuLoadIntegerDwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg);
+    void fpuLoadIntegerQwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg);
+    void fpuLoadQwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg);
+    void fpuLoadReg(int32_t & StackPos, const asmjit::x86::St & Reg);
+    void fpuStoreControl(void * Variable, const char * VariableName);
+    void fpuStoreDwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg, bool pop);
+    void fpuStoreIntegerDwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg, bool pop);
+    void fpuStoreIntegerQwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg, bool pop);
+    void fpuStoreQwordFromX86Reg(int32_t & StackPos, const asmjit::x86::Gp & Reg, bool pop);
+
+    asmjit::x86::Mem VariablePtr(void * Variable, const char * VariableName, uint32_t Size);
+
+    static bool Is8BitReg(const asmjit::x86::Gp & Reg);
+    static uintptr_t GetAddressOf(int32_t value, ...);
+
 private:
     CX64Ops(void);
     CX64Ops(const CX64Ops &);
     CX64Ops & operator=(const CX64Ops &);
 
     asmjit::Error _log(const char * data, size_t size) noexcept;
+    void AddLabelSymbol(const asmjit::Label & Label, const char * Symbol);
+    void AddNumberSymbol(uint64_t Value, const char * Symbol);
+
+    static void BreakPointNotification(const char * FileName, int32_t LineNumber);
+    void PopArguments(uint32_t FirstArg);
 
-    typedef std::map<std::string, std::string> SymbolMap;
+    typedef struct
+    {
+        std::string Symbol;
+        uint32_t Count;
+    } NumberSymbol;
 
-    SymbolMap m_Symbols;
+    typedef std::map<uint64_t, NumberSymbol> NumberSymbolMap;
+
+    NumberSymbolMap m_LabelSymbols;
+    NumberSymbolMap m_NumberSymbols;
     CCodeBlock & m_CodeBlock;
+    uint32_t m_PushedArgs;
 };
 
+#define AddressOf(Addr) CX64Ops::GetAddressOf(5, (Addr))
+
 #endif
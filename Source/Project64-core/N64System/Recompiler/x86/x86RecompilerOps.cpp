@@ -2286,6 +2286,10 @@ void CX86RecompilerOps::JAL()
         m_Assembler.MoveVariableToX86reg(m_RegWorkingSet.GetMipsRegMapLo(31), &m_Reg.m_PROGRAM_COUNTER, "_PROGRAM_COUNTER");
         m_Assembler.and_(m_RegWorkingSet.GetMipsRegMapLo(31), 0xF0000000);
         m_Assembler.AddConstToX86Reg(m_RegWorkingSet.GetMipsRegMapLo(31), (m_CompilePC + 8) & ~0xF0000000);
+        if (m_CodeBlock.BlockLinkAllowed(m_CompilePC + 8))
+        {
+            CompilePushReturnAddress(m_CompilePC + 8);
+        }
         if ((m_CompilePC & 0xFFC) == 0xFFC)
         {
             m_Assembler.MoveConst64ToVariable(&g_System->m_JumpToLocation, "System::m_JumpToLocation", (int32_t)((m_CompilePC & 0xF0000000) + (m_Opcode.target << 2)));
@@ -4597,7 +4601,7 @@ void CX86RecompilerOps::SPECIAL_JR()
                 m_Assembler.MoveX86regToVariable(((uint8_t *)&m_Reg.m_PROGRAM_COUNTER) + 4, "PROGRAM_COUNTER + 4", m_RegWorkingSet.Map_TempReg(x86Reg_Unknown, m_Opcode.rs, true, false));
             }
             UpdateCounters(m_RegWorkingSet, true, true, false);
-            CompileExit((uint32_t)-1, (uint32_t)-1, m_RegWorkingSet, ExitReason_CheckPCAlignment, true, nullptr);
+            CompileExit((uint32_t)-1, (uint32_t)-1, m_RegWorkingSet, m_Opcode.rs == 31 && m_CodeBlock.BlockLinkAllowed() ? ExitReason_Return : ExitReason_CheckPCAlignment, true, nullptr);
             if (m_Section->m_JumpSection)
             {
                 m_Section->GenerateSectionLinkage();
@@ -4644,6 +4648,10 @@ void CX86RecompilerOps::SPECIAL_JALR()
         m_RegWorkingSet.UnMap_GPR(m_Opcode.rd, false);
         m_RegWorkingSet.SetMipsRegLo(m_Opcode.rd, (uint32_t)(m_CompilePC + 8));
         m_RegWorkingSet.SetMipsRegState(m_Opcode.rd, CRegInfo::STATE_CONST_32_SIGN);
+        if (m_Opcode.rd == 31 && m_CodeBlock.BlockLinkAllowed(m_CompilePC + 8))
+        {
+            CompilePushReturnAddress(m_CompilePC + 8);
+        }
         if ((m_CompilePC & 0xFFC) == 0xFFC)
         {
             if (m_RegWorkingSet.IsMapped(m_Opcode.rs))
@@ -9628,6 +9636,62 @@ void CX86RecompilerOps::OverflowDelaySlot(bool TestTimer)
     m_PipelineStage = PIPELINE_STAGE_END_BLOCK;
 }
 
+void CX86RecompilerOps::CompileBlockLink(uint32_t TargetPC)
+{
+    // Patched by CRecompiler::LinkFunction to jump to the body of the target block once it has been compiled
+    asmjit::Label ExitBlock = m_Assembler.newLabel();
+    asmjit::Label JumpLabel = m_Assembler.newLabel();
+    m_Assembler.CompConstByteToVariable(&m_System.m_EndEmulation, "m_EndEmulation", 0);
+    m_Assembler.JneLabel("ExitBlock", ExitBlock);
+    m_CodeBlock.Log("      Link to block %08X", TargetPC);
+    m_Assembler.bind(JumpLabel);
+    m_Assembler.embedUInt8(0xE9);
+    m_Assembler.embedUInt32(0);
+    m_Assembler.bind(ExitBlock);
+    m_CodeBlock.AddBlockLink(TargetPC, JumpLabel);
+}
+
+void CX86RecompilerOps::CompilePushReturnAddress(uint32_t ReturnPC)
+{
+    static_assert(sizeof(CRecompiler::RETURN_ADDRESS) == 8, "return stack index is scaled by 8");
+
+    asmjit::x86::Gp IndexReg = m_RegWorkingSet.Map_TempReg(x86Reg_Unknown, -1, false, false);
+    m_CodeBlock.Log("      Push return address %08X", ReturnPC);
+    m_Assembler.MoveVariableToX86reg(IndexReg, &g_Recompiler->ReturnStackPos(), "ReturnStackPos");
+    m_Assembler.add(IndexReg, 1);
+    m_Assembler.and_(IndexReg, CRecompiler::ReturnStackSize - 1);
+    m_Assembler.MoveX86regToVariable(&g_Recompiler->ReturnStackPos(), "ReturnStackPos", IndexReg);
+    m_Assembler.mov(asmjit::x86::dword_ptr((uint32_t)g_Recompiler->ReturnStack() + offsetof(CRecompiler::RETURN_ADDRESS, ReturnPC), IndexReg, 3), ReturnPC);
+    m_Assembler.mov(asmjit::x86::dword_ptr((uint32_t)g_Recompiler->ReturnStack() + offsetof(CRecompiler::RETURN_ADDRESS, JumpTableEntry), IndexReg, 3), (uint32_t)&g_Recompiler->JumpTable()[(ReturnPC & 0x1FFFFFFF) >> 2]);
+}
+
+void CX86RecompilerOps::CompileReturnPrediction()
+{
+    // Pop the return stack, if the top entry is the address being returned to and that address
+    // has been compiled then jump straight to it, otherwise leave through the lookup loop
+    asmjit::Label ExitBlock = m_Assembler.newLabel();
+
+    m_Assembler.MoveVariableToX86reg(asmjit::x86::eax, &g_Recompiler->ReturnStackPos(), "ReturnStackPos");
+    m_Assembler.lea(asmjit::x86::edx, asmjit::x86::ptr(asmjit::x86::eax, -1));
+    m_Assembler.and_(asmjit::x86::edx, CRecompiler::ReturnStackSize - 1);
+    m_Assembler.MoveX86regToVariable(&g_Recompiler->ReturnStackPos(), "ReturnStackPos", asmjit::x86::edx);
+    m_Assembler.CompConstToVariable((void *)(((uint64_t)&g_Reg->m_PROGRAM_COUNTER) + 4), "PROGRAM_COUNTER + 4", 0xFFFFFFFF);
+    m_Assembler.JneLabel("ExitBlock", ExitBlock);
+    m_Assembler.MoveVariableToX86reg(asmjit::x86::edx, &g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER");
+    m_Assembler.cmp(asmjit::x86::dword_ptr((uint32_t)g_Recompiler->ReturnStack() + offsetof(CRecompiler::RETURN_ADDRESS, ReturnPC), asmjit::x86::eax, 3), asmjit::x86::edx);
+    m_Assembler.JneLabel("ExitBlock", ExitBlock);
+    m_Assembler.mov(asmjit::x86::eax, asmjit::x86::dword_ptr((uint32_t)g_Recompiler->ReturnStack() + offsetof(CRecompiler::RETURN_ADDRESS, JumpTableEntry), asmjit::x86::eax, 3));
+    m_Assembler.mov(asmjit::x86::eax, asmjit::x86::dword_ptr(asmjit::x86::eax));
+    m_Assembler.test(asmjit::x86::eax, asmjit::x86::eax);
+    m_Assembler.JeLabel("ExitBlock", ExitBlock);
+    m_Assembler.cmp(asmjit::x86::dword_ptr(asmjit::x86::eax, CCompiledFunc::EnterPCOffset()), asmjit::x86::edx);
+    m_Assembler.JneLabel("ExitBlock", ExitBlock);
+    m_Assembler.CompConstByteToVariable(&m_System.m_EndEmulation, "m_EndEmulation", 0);
+    m_Assembler.JneLabel("ExitBlock", ExitBlock);
+    m_Assembler.jmp(asmjit::x86::dword_ptr(asmjit::x86::eax, CCompiledFunc::LinkEntryOffset()));
+    m_Assembler.bind(ExitBlock);
+}
+
 void CX86RecompilerOps::CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo & ExitRegSet, ExitReason reason)
 {
     CompileExit(JumpPC, TargetPC, ExitRegSet, reason, true, nullptr);
@@ -9673,13 +9737,14 @@ void CX86RecompilerOps::CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo
     {
     case ExitReason_Normal:
     case ExitReason_CheckPCAlignment:
+    case ExitReason_Return:
     case ExitReason_NormalNoSysCheck:
         ExitRegSet.SetBlockCycleCount(0);
-        if ((reason == ExitReason_Normal || reason == ExitReason_CheckPCAlignment) && (TargetPC == (uint32_t)-1 || TargetPC <= JumpPC))
+        if (reason != ExitReason_NormalNoSysCheck && (TargetPC == (uint32_t)-1 || TargetPC <= JumpPC))
         {
             CompileSystemCheck((uint32_t)-1, ExitRegSet);
         }
-        if (reason == ExitReason_CheckPCAlignment)
+        if (reason == ExitReason_CheckPCAlignment || reason == ExitReason_Return)
         {
             m_Assembler.MoveVariableToX86reg(asmjit::x86::eax, &g_Reg->m_PROGRAM_COUNTER, "PROGRAM_COUNTER");
             m_Assembler.test(asmjit::x86::eax, 3);
@@ -9696,6 +9761,14 @@ void CX86RecompilerOps::CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo
             ExitCodeBlock();
             m_Assembler.bind(ValidPCJump);
         }
+        if (reason == ExitReason_Return)
+        {
+            CompileReturnPrediction();
+        }
+        else if (reason != ExitReason_CheckPCAlignment && TargetPC != (uint32_t)-1 && m_CodeBlock.BlockLinkAllowed(TargetPC))
+        {
+            CompileBlockLink(TargetPC);
+        }
         ExitCodeBlock();
         break;
     case ExitReason_DoCPUAction:
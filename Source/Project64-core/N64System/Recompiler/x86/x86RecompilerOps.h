@@ -287,6 +287,9 @@ private:
     void LW(bool ResultSigned, bool bRecordLLBit);
     void SW(bool bCheckLLbit);
     void CompileExit(uint32_t JumpPC, uint32_t TargetPC, CRegInfo & ExitRegSet, ExitReason Reason, bool CompileNow, void (CX86Ops::*x86Jmp)(const char * LabelName, asmjit::Label & JumpLabel));
+    void CompileBlockLink(uint32_t TargetPC);
+    void CompilePushReturnAddress(uint32_t ReturnPC);
+    void CompileReturnPrediction(void);
     void ResetMemoryStack();
     void COP1_S_CVT(CRegBase::FPU_ROUND RoundMethod, CRegInfo::FPU_STATE OldFormat, CRegInfo::FPU_STATE NewFormat);
 
@@ -0,0 +1,164 @@
+#include "stdafx.h"
+
+#include "SaveStateFile.h"
+#include <thread>
+#include <zlib/zlib.h>
+
+CSaveStateChunks::CSaveStateChunks(uint8_t * Data, uint32_t Length) :
+    m_Data(Data),
+    m_Length(Length),
+    m_Chunks((Length + ChunkSize - 1) / ChunkSize),
+    m_Table(nullptr),
+    m_Buffer(nullptr),
+    m_BufferStride(0),
+    m_Source(nullptr),
+    m_SourceLength(0),
+    m_SourceTable(nullptr)
+{
+    m_Table = new SAVE_STATE_CHUNK[m_Chunks];
+    for (uint32_t i = 0; i < m_Chunks; i++)
+    {
+        m_Table[i].Offset = i * ChunkSize;
+        m_Table[i].Length = ChunkLength(i);
+    }
+}
+
+CSaveStateChunks::~CSaveStateChunks()
+{
+    delete[] m_Table;
+    delete[] m_Buffer;
+}
+
+bool CSaveStateChunks::Compress()
+{
+    if (m_Buffer == nullptr)
+    {
+        m_BufferStride = (uint32_t)compressBound(ChunkSize);
+        m_Buffer = new uint8_t[(size_t)m_BufferStride * m_Chunks];
+    }
+    if (!RunWorkers(true))
+    {
+        return false;
+    }
+    uint32_t Offset = 0;
+    for (uint32_t i = 0; i < m_Chunks; i++)
+    {
+        m_Table[i].Offset = Offset;
+        Offset += m_Table[i].Length;
+    }
+    return true;
+}
+
+bool CSaveStateChunks::Decompress(const uint8_t * Source, uint32_t SourceLength, const SAVE_STATE_CHUNK * Table)
+{
+    m_Source = Source;
+    m_SourceLength = SourceLength;
+    m_SourceTable = Table;
+    bool Result = RunWorkers(false);
+    m_Source = nullptr;
+    m_SourceLength = 0;
+    m_SourceTable = nullptr;
+    return Result;
+}
+
+const uint8_t * CSaveStateChunks::ChunkData(uint32_t Chunk) const
+{
+    return m_Buffer != nullptr ? &m_Buffer[(size_t)Chunk * m_BufferStride] : &m_Data[Chunk * ChunkSize];
+}
+
+bool CSaveStateChunks::RunWorkers(bool Compress)
+{
+    uint32_t Workers = m_Chunks < MaxWorkers ? m_Chunks : MaxWorkers;
+    WORKER Worker[MaxWorkers];
+    std::thread Threads[MaxWorkers];
+
+    for (uint32_t i = 0; i < Workers; i++)
+    {
+        Worker[i].Chunks = this;
+        Worker[i].First = i;
+        Worker[i].Step = Workers;
+        Worker[i].Compress = Compress;
+        Worker[i].Result = true;
+    }
+
+    // The calling thread takes the first share of the chunks itself
+    for (uint32_t i = 1; i < Workers; i++)
+    {
+        Threads[i] = std::thread(stWorkerThread, &Worker[i]);
+    }
+    if (Workers > 0)
+    {
+        stWorkerThread(&Worker[0]);
+    }
+
+    bool Result = true;
+    for (uint32_t i = 0; i < Workers; i++)
+    {
+        if (Threads[i].joinable())
+        {
+            Threads[i].join();
+        }
+        Result = Result && Worker[i].Result;
+    }
+    return Result;
+}
+
+bool CSaveStateChunks::CompressChunk(uint32_t Chunk)
+{
+    const uint8_t * Source = &m_Data[Chunk * ChunkSize];
+    uint8_t * Dest = &m_Buffer[(size_t)Chunk * m_BufferStride];
+    uLongf DestLen = m_BufferStride;
+    uint32_t Length = ChunkLength(Chunk);
+
+    if (compress2(Dest, &DestLen, Source, Length, Z_BEST_SPEED) != Z_OK)
+    {
+        return false;
+    }
+    if (DestLen >= Length)
+    {
+        // Nothing gained, keep the chunk as it is
+        memcpy(Dest, Source, Length);
+        DestLen = Length;
+    }
+    m_Table[Chunk].Length = (uint32_t)DestLen;
+    return true;
+}
+
+bool CSaveStateChunks::DecompressChunk(uint32_t Chunk)
+{
+    const SAVE_STATE_CHUNK & Entry = m_SourceTable[Chunk];
+    uint8_t * Dest = &m_Data[Chunk * ChunkSize];
+    uint32_t Length = ChunkLength(Chunk);
+
+    if (Entry.Offset > m_SourceLength || Entry.Length > m_SourceLength - Entry.Offset)
+    {
+        return false;
+    }
+    if (Entry.Length == Length)
+    {
+        memcpy(Dest, &m_Source[Entry.Offset], Length);
+        return true;
+    }
+    uLongf DestLen = Length;
+    return uncompress(Dest, &DestLen, &m_Source[Entry.Offset], Entry.Length) == Z_OK && DestLen == Length;
+}
+
+uint32_t CSaveStateChunks::ChunkLength(uint32_t Chunk) const
+{
+    uint32_t Start = Chunk * ChunkSize;
+    return m_Length - Start < (uint32_t)ChunkSize ? m_Length - Start : (uint32_t)ChunkSize;
+}
+
+uint32_t CSaveStateChunks::stWorkerThread(WORKER * Worker)
+{
+    CSaveStateChunks * _this = Worker->Chunks;
+    for (uint32_t Chunk = Worker->First; Chunk < _this->m_Chunks; Chunk += Worker->Step)
+    {
+        if (!(Worker->Compress ? _this->CompressChunk(Chunk) : _this->DecompressChunk(Chunk)))
+        {
+            Worker->Result = false;
+            break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <stdint.h>
+
+// Layout of a fast save state (SaveID_3). Everything is found through the offsets in
+// the header, RDRAM is either stored raw at a page aligned offset or split in to
+// chunks that were compressed on their own so they can be handled in parallel.
+struct SAVE_STATE_HEADER
+{
+    uint32_t SaveID;
+    uint32_t HeaderSize;
+    uint32_t RdramSize;
+    uint32_t RdramChunkSize;
+    uint32_t RdramChunks;
+    uint32_t RdramCompressed;
+    uint32_t MachineOffset;
+    uint32_t MachineSize;
+    uint32_t TimerOffset;
+    uint32_t TimerSize;
+    uint32_t ChunkTableOffset;
+    uint32_t RdramOffset;
+    uint8_t RomHeader[0x40];
+};
+
+// Offset is relative to SAVE_STATE_HEADER::RdramOffset, a chunk that is as long as
+// the data it holds was stored without compression
+struct SAVE_STATE_CHUNK
+{
+    uint32_t Offset;
+    uint32_t Length;
+};
+
+class CSaveStateChunks
+{
+public:
+    enum
+    {
+        ChunkSize = 0x40000,
+        MaxWorkers = 4,
+    };
+
+    CSaveStateChunks(uint8_t * Data, uint32_t Length);
+    ~CSaveStateChunks();
+
+    bool Compress();
+    bool Decompress(const uint8_t * Source, uint32_t SourceLength, const SAVE_STATE_CHUNK * Table);
+
+    uint32_t Chunks() const
+    {
+        return m_Chunks;
+    }
+    const SAVE_STATE_CHUNK * Table() const
+    {
+        return m_Table;
+    }
+    const uint8_t * ChunkData(uint32_t Chunk) const;
+
+private:
+    CSaveStateChunks();
+    CSaveStateChunks(const CSaveStateChunks &);
+    CSaveStateChunks & operator=(const CSaveStateChunks &);
+
+    struct WORKER
+    {
+        CSaveStateChunks * Chunks;
+        uint32_t First;
+        uint32_t Step;
+        bool Compress;
+        bool Result;
+    };
+
+    bool RunWorkers(bool Compress);
+    bool CompressChunk(uint32_t Chunk);
+    bool DecompressChunk(uint32_t Chunk);
+    uint32_t ChunkLength(uint32_t Chunk) const;
+
+    static uint32_t stWorkerThread(WORKER * Worker);
+
+    uint8_t * m_Data;
+    uint32_t m_Length;
+    uint32_t m_Chunks;
+    SAVE_STATE_CHUNK * m_Table;
+    uint8_t * m_Buffer;
+    uint32_t m_BufferStride;
+    const uint8_t * m_Source;
+    uint32_t m_SourceLength;
+    const SAVE_STATE_CHUNK * m_SourceTable;
+};
@@ -1,8 +1,8 @@
 #include "stdafx.h"
 
-#include <Project64-core\N64System\N64System.h>
-#include <Project64-core\N64System\SaveType\Eeprom.h>
-#include <Project64-core\N64System\SystemGlobals.h>
+#include <Project64-core/N64System/N64System.h>
+#include <Project64-core/N64System/SaveType/Eeprom.h>
+#include <Project64-core/N64System/SystemGlobals.h>
 #include <time.h>
 
 CEeprom::CEeprom(bool ReadOnly) :
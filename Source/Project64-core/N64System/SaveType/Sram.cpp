@@ -1,7 +1,7 @@
 #include "stdafx.h"
 
-#include <Common\path.h>
-#include <Project64-core\N64System\SaveType\Sram.h>
+#include <Common/path.h>
+#include <Project64-core/N64System/SaveType/Sram.h>
 
 CSram::CSram(bool ReadOnly) :
     m_ReadOnly(ReadOnly)
@@ -0,0 +1,285 @@
+#include "stdafx.h"
+
+#include "SnapshotRing.h"
+#include <Project64-core/N64System/N64System.h>
+#include <Project64-core/N64System/Recompiler/BlockHash.h>
+
+CSnapshotRing::CSnapshotRing(CN64System & System, uint32_t Slots, uint32_t DeltaPages) :
+    m_System(System),
+    m_Snapshots(nullptr),
+    m_Slots(Slots != 0 ? Slots : 1),
+    m_First(0),
+    m_Count(0),
+    m_Rdram(nullptr),
+    m_PageHash(nullptr),
+    m_RdramPages(System.m_MMU_VM.RdramSize() >> PageShift),
+    m_ChangedPage(nullptr),
+    m_ChangedHash(nullptr),
+    m_DeltaData(nullptr),
+    m_DeltaPage(nullptr),
+    m_DeltaHash(nullptr),
+    m_DeltaPages(DeltaPages != 0 ? DeltaPages : 1),
+    m_DeltaTail(0),
+    m_DeltaUsed(0)
+{
+    WriteTrace(TraceN64System, TraceDebug, "Slots: %d DeltaPages: %d RdramPages: %d", m_Slots, m_DeltaPages, m_RdramPages);
+    m_Snapshots = new SNAPSHOT[m_Slots];
+    m_Rdram = new uint8_t[m_RdramPages << PageShift];
+    m_PageHash = new uint64_t[m_RdramPages];
+    m_ChangedPage = new uint32_t[m_RdramPages];
+    m_ChangedHash = new uint64_t[m_RdramPages];
+    m_DeltaData = new uint8_t[(size_t)m_DeltaPages << PageShift];
+    m_DeltaPage = new uint32_t[m_DeltaPages];
+    m_DeltaHash = new uint64_t[m_DeltaPages];
+}
+
+CSnapshotRing::~CSnapshotRing()
+{
+    delete[] m_Snapshots;
+    delete[] m_Rdram;
+    delete[] m_PageHash;
+    delete[] m_ChangedPage;
+    delete[] m_ChangedHash;
+    delete[] m_DeltaData;
+    delete[] m_DeltaPage;
+    delete[] m_DeltaHash;
+}
+
+void CSnapshotRing::Clear()
+{
+    m_First = 0;
+    m_Count = 0;
+    m_DeltaTail = 0;
+    m_DeltaUsed = 0;
+}
+
+bool CSnapshotRing::Capture()
+{
+    if (m_System.m_Reg.STATUS_REGISTER.ExceptionLevel != 0)
+    {
+        return false;
+    }
+    const uint8_t * Rdram = m_System.m_MMU_VM.Rdram();
+    uint32_t Changed = 0;
+    if (m_Count == 0)
+    {
+        memcpy(m_Rdram, Rdram, m_RdramPages << PageShift);
+        for (uint32_t Page = 0; Page < m_RdramPages; Page++)
+        {
+            m_PageHash[Page] = CBlockHash(&m_Rdram[Page << PageShift], PageSize).Value();
+        }
+    }
+    else
+    {
+        for (uint32_t Page = 0; Page < m_RdramPages; Page++)
+        {
+            uint64_t Hash = CBlockHash(&Rdram[Page << PageShift], PageSize).Value();
+            if (Hash != m_PageHash[Page])
+            {
+                m_ChangedPage[Changed] = Page;
+                m_ChangedHash[Changed] = Hash;
+                Changed += 1;
+            }
+        }
+    }
+
+    if (m_Count == m_Slots)
+    {
+        DropOldest();
+    }
+    if (Changed > m_DeltaPages)
+    {
+        // The changes can not be undone with the space available, start the history again from here
+        Clear();
+    }
+    while (m_Count > 0 && m_DeltaUsed + Changed > m_DeltaPages)
+    {
+        DropOldest();
+    }
+
+    SNAPSHOT & Snapshot = m_Snapshots[(m_First + m_Count) % m_Slots];
+    Snapshot.DeltaStart = (m_DeltaTail + m_DeltaUsed) % m_DeltaPages;
+    Snapshot.DeltaCount = 0;
+    for (uint32_t i = 0; i < Changed; i++)
+    {
+        uint32_t Page = m_ChangedPage[i];
+        if (m_Count > 0)
+        {
+            uint32_t Index = (Snapshot.DeltaStart + Snapshot.DeltaCount) % m_DeltaPages;
+            memcpy(&m_DeltaData[(size_t)Index << PageShift], &m_Rdram[Page << PageShift], PageSize);
+            m_DeltaPage[Index] = Page;
+            m_DeltaHash[Index] = m_PageHash[Page];
+            Snapshot.DeltaCount += 1;
+        }
+        memcpy(&m_Rdram[Page << PageShift], &Rdram[Page << PageShift], PageSize);
+        m_PageHash[Page] = m_ChangedHash[i];
+    }
+    m_DeltaUsed += Snapshot.DeltaCount;
+    SaveFixedState(Snapshot);
+    m_Count += 1;
+    return true;
+}
+
+bool CSnapshotRing::Restore(uint32_t StepsBack)
+{
+    if (m_Count == 0)
+    {
+        return false;
+    }
+    for (; StepsBack > 0 && m_Count > 1; StepsBack--)
+    {
+        DropNewest();
+    }
+
+    // Only pages that differ from the snapshot are written, so only their code has to be thrown away
+    uint8_t * Rdram = m_System.m_MMU_VM.Rdram();
+    for (uint32_t Page = 0; Page < m_RdramPages; Page++)
+    {
+        uint32_t Offset = Page << PageShift;
+        if (memcmp(&Rdram[Offset], &m_Rdram[Offset], PageSize) == 0)
+        {
+            continue;
+        }
+        if (m_System.m_Recomp != nullptr)
+        {
+            m_System.m_Recomp->ClearRecompCode_Phys(Offset, PageSize, CRecompiler::Remove_Rewind);
+        }
+        m_System.m_OpCodes.ClearDecodedCode_Phys(Offset, PageSize);
+        memcpy(&Rdram[Offset], &m_Rdram[Offset], PageSize);
+    }
+    LoadFixedState(m_Snapshots[(m_First + m_Count - 1) % m_Slots]);
+    return true;
+}
+
+void CSnapshotRing::DropOldest()
+{
+    m_First = (m_First + 1) % m_Slots;
+    m_Count -= 1;
+    if (m_Count == 0)
+    {
+        m_DeltaTail = 0;
+        m_DeltaUsed = 0;
+        return;
+    }
+
+    // The oldest snapshot has nothing older to go back to, so its pages can be reused
+    SNAPSHOT & Oldest = m_Snapshots[m_First];
+    m_DeltaTail = (m_DeltaTail + Oldest.DeltaCount) % m_DeltaPages;
+    m_DeltaUsed -= Oldest.DeltaCount;
+    Oldest.DeltaCount = 0;
+}
+
+void CSnapshotRing::DropNewest()
+{
+    SNAPSHOT & Newest = m_Snapshots[(m_First + m_Count - 1) % m_Slots];
+    for (uint32_t i = 0; i < Newest.DeltaCount; i++)
+    {
+        uint32_t Index = (Newest.DeltaStart + i) % m_DeltaPages;
+        uint32_t Page = m_DeltaPage[Index];
+        memcpy(&m_Rdram[Page << PageShift], &m_DeltaData[(size_t)Index << PageShift], PageSize);
+        m_PageHash[Page] = m_DeltaHash[Index];
+    }
+    m_DeltaUsed -= Newest.DeltaCount;
+    Newest.DeltaCount = 0;
+    m_Count -= 1;
+}
+
+void CSnapshotRing::SaveFixedState(SNAPSHOT & Snapshot)
+{
+    CRegisters & Reg = m_System.m_Reg;
+    CSystemTimer & SystemTimer = m_System.m_SystemTimer;
+
+    Snapshot.PROGRAM_COUNTER = Reg.m_PROGRAM_COUNTER;
+    memcpy(Snapshot.GPR, Reg.m_GPR, sizeof(Snapshot.GPR));
+    memcpy(Snapshot.CP0, Reg.m_CP0, sizeof(Snapshot.CP0));
+    Snapshot.CP0Latch = Reg.m_CP0Latch;
+    Snapshot.CP2Latch = Reg.m_CP2Latch;
+    Snapshot.HI = Reg.m_HI;
+    Snapshot.LO = Reg.m_LO;
+    Snapshot.LLBit = Reg.m_LLBit;
+    memcpy(Snapshot.FPCR, Reg.m_FPCR, sizeof(Snapshot.FPCR));
+    memcpy(Snapshot.FPR, Reg.m_FPR, sizeof(Snapshot.FPR));
+    memcpy(Snapshot.RDRAM_Registers, Reg.m_RDRAM_Registers, sizeof(Snapshot.RDRAM_Registers));
+    memcpy(Snapshot.SigProcessor_Interface, Reg.m_SigProcessor_Interface, sizeof(Snapshot.SigProcessor_Interface));
+    memcpy(Snapshot.Display_ControlReg, Reg.m_Display_ControlReg, sizeof(Snapshot.Display_ControlReg));
+    memcpy(Snapshot.Mips_Interface, Reg.m_Mips_Interface, sizeof(Snapshot.Mips_Interface));
+    memcpy(Snapshot.Video_Interface, Reg.m_Video_Interface, sizeof(Snapshot.Video_Interface));
+    memcpy(Snapshot.Audio_Interface, Reg.m_Audio_Interface, sizeof(Snapshot.Audio_Interface));
+    memcpy(Snapshot.Peripheral_Interface, Reg.m_Peripheral_Interface, sizeof(Snapshot.Peripheral_Interface));
+    memcpy(Snapshot.RDRAM_Interface, Reg.m_RDRAM_Interface, sizeof(Snapshot.RDRAM_Interface));
+    memcpy(Snapshot.SerialInterface, Reg.m_SerialInterface, sizeof(Snapshot.SerialInterface));
+    memcpy(Snapshot.DiskInterface, Reg.m_DiskInterface, sizeof(Snapshot.DiskInterface));
+    Snapshot.AudioIntrReg = Reg.m_AudioIntrReg;
+    Snapshot.GfxIntrReg = Reg.m_GfxIntrReg;
+    Snapshot.RspIntrReg = Reg.m_RspIntrReg;
+
+    memcpy(Snapshot.TlbEntries, &m_System.m_TLB.TlbEntry(0), sizeof(Snapshot.TlbEntries));
+    memcpy(Snapshot.Timers, SystemTimer.m_TimerDetatils, sizeof(Snapshot.Timers));
+    Snapshot.TimerLastUpdate = SystemTimer.m_LastUpdate;
+    Snapshot.NextTimer = SystemTimer.m_NextTimer;
+    Snapshot.CurrentTimer = SystemTimer.m_Current;
+    memcpy(Snapshot.PifRam, m_System.m_MMU_VM.PifRam().PifRam(), sizeof(Snapshot.PifRam));
+    memcpy(Snapshot.Dmem, m_System.m_MMU_VM.Dmem(), sizeof(Snapshot.Dmem));
+    memcpy(Snapshot.Imem, m_System.m_MMU_VM.Imem(), sizeof(Snapshot.Imem));
+}
+
+void CSnapshotRing::LoadFixedState(const SNAPSHOT & Snapshot)
+{
+    CRegisters & Reg = m_System.m_Reg;
+    CSystemTimer & SystemTimer = m_System.m_SystemTimer;
+    uint32_t OldViStatus = Reg.VI_STATUS_REG;
+    uint32_t OldViWidth = Reg.VI_WIDTH_REG;
+    uint32_t OldDacrate = Reg.AI_DACRATE_REG;
+
+    Reg.m_PROGRAM_COUNTER = Snapshot.PROGRAM_COUNTER;
+    memcpy(Reg.m_GPR, Snapshot.GPR, sizeof(Snapshot.GPR));
+    memcpy(Reg.m_CP0, Snapshot.CP0, sizeof(Snapshot.CP0));
+    Reg.m_CP0Latch = Snapshot.CP0Latch;
+    Reg.m_CP2Latch = Snapshot.CP2Latch;
+    Reg.m_HI = Snapshot.HI;
+    Reg.m_LO = Snapshot.LO;
+    Reg.m_LLBit = Snapshot.LLBit;
+    memcpy(Reg.m_FPCR, Snapshot.FPCR, sizeof(Snapshot.FPCR));
+    memcpy(Reg.m_FPR, Snapshot.FPR, sizeof(Snapshot.FPR));
+    memcpy(Reg.m_RDRAM_Registers, Snapshot.RDRAM_Registers, sizeof(Snapshot.RDRAM_Registers));
+    memcpy(Reg.m_SigProcessor_Interface, Snapshot.SigProcessor_Interface, sizeof(Snapshot.SigProcessor_Interface));
+    memcpy(Reg.m_Display_ControlReg, Snapshot.Display_ControlReg, sizeof(Snapshot.Display_ControlReg));
+    memcpy(Reg.m_Mips_Interface, Snapshot.Mips_Interface, sizeof(Snapshot.Mips_Interface));
+    memcpy(Reg.m_Video_Interface, Snapshot.Video_Interface, sizeof(Snapshot.Video_Interface));
+    memcpy(Reg.m_Audio_Interface, Snapshot.Audio_Interface, sizeof(Snapshot.Audio_Interface));
+    memcpy(Reg.m_Peripheral_Interface, Snapshot.Peripheral_Interface, sizeof(Snapshot.Peripheral_Interface));
+    memcpy(Reg.m_RDRAM_Interface, Snapshot.RDRAM_Interface, sizeof(Snapshot.RDRAM_Interface));
+    memcpy(Reg.m_SerialInterface, Snapshot.SerialInterface, sizeof(Snapshot.SerialInterface));
+    memcpy(Reg.m_DiskInterface, Snapshot.DiskInterface, sizeof(Snapshot.DiskInterface));
+    Reg.m_AudioIntrReg = Snapshot.AudioIntrReg;
+    Reg.m_GfxIntrReg = Snapshot.GfxIntrReg;
+    Reg.m_RspIntrReg = Snapshot.RspIntrReg;
+    Reg.FixFpuLocations();
+
+    m_System.m_TLB.LoadEntries(Snapshot.TlbEntries);
+    memcpy(SystemTimer.m_TimerDetatils, Snapshot.Timers, sizeof(Snapshot.Timers));
+    SystemTimer.m_LastUpdate = Snapshot.TimerLastUpdate;
+    SystemTimer.m_NextTimer = Snapshot.NextTimer;
+    SystemTimer.m_Current = Snapshot.CurrentTimer;
+    memcpy(m_System.m_MMU_VM.PifRam().PifRam(), Snapshot.PifRam, sizeof(Snapshot.PifRam));
+    memcpy(m_System.m_MMU_VM.Dmem(), Snapshot.Dmem, sizeof(Snapshot.Dmem));
+    memcpy(m_System.m_MMU_VM.Imem(), Snapshot.Imem, sizeof(Snapshot.Imem));
+    m_System.m_PipelineStage = PIPELINE_STAGE_NORMAL;
+
+    if (OldViStatus != Reg.VI_STATUS_REG)
+    {
+        m_System.m_Plugins->Gfx()->ViStatusChanged();
+    }
+    if (OldViWidth != Reg.VI_WIDTH_REG)
+    {
+        m_System.m_Plugins->Gfx()->ViWidthChanged();
+    }
+    if (OldDacrate != Reg.AI_DACRATE_REG)
+    {
+        m_System.m_Plugins->Audio()->DacrateChanged(m_System.SystemType());
+    }
+    if (bFastSP() && m_System.m_Recomp != nullptr)
+    {
+        m_System.m_Recomp->ResetMemoryStackPos();
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <Project64-core/N64System/Mips/SystemTiming.h>
+#include <Project64-core/N64System/Mips/TLB.h>
+#include <Project64-core/Settings/GameSettings.h>
+#include <stdint.h>
+
+class CN64System;
+
+// Keeps the last few machine states in memory so emulation can be rewound without
+// going through a save state file. Everything except RDRAM is held in a preallocated
+// slot, RDRAM is kept as one copy of the newest snapshot plus the pages each snapshot
+// changed, so capturing a frame only costs hashing RDRAM and copying the dirty pages.
+class CSnapshotRing :
+    private CGameSettings
+{
+public:
+    CSnapshotRing(CN64System & System, uint32_t Slots, uint32_t DeltaPages);
+    ~CSnapshotRing();
+
+    bool Capture();
+    bool Restore(uint32_t StepsBack);
+    void Clear();
+
+    uint32_t Count() const
+    {
+        return m_Count;
+    }
+
+private:
+    CSnapshotRing();
+    CSnapshotRing(const CSnapshotRing &);
+    CSnapshotRing & operator=(const CSnapshotRing &);
+
+    enum
+    {
+        PageShift = 12,
+        PageSize = 1 << PageShift,
+    };
+
+    struct SNAPSHOT
+    {
+        uint64_t PROGRAM_COUNTER;
+        MIPS_DWORD GPR[32];
+        uint64_t CP0[32];
+        uint64_t CP0Latch;
+        uint64_t CP2Latch;
+        MIPS_DWORD HI;
+        MIPS_DWORD LO;
+        uint32_t LLBit;
+        uint32_t FPCR[32];
+        MIPS_DWORD FPR[32];
+        uint32_t RDRAM_Registers[10];
+        uint32_t SigProcessor_Interface[10];
+        uint32_t Display_ControlReg[10];
+        uint32_t Mips_Interface[4];
+        uint32_t Video_Interface[14];
+        uint32_t Audio_Interface[6];
+        uint32_t Peripheral_Interface[13];
+        uint32_t RDRAM_Interface[8];
+        uint32_t SerialInterface[4];
+        uint32_t DiskInterface[22];
+        uint32_t AudioIntrReg;
+        uint32_t GfxIntrReg;
+        uint32_t RspIntrReg;
+        TLB_ENTRY TlbEntries[32];
+        CSystemTimer::TIMER_DETAILS Timers[CSystemTimer::MaxTimer];
+        int32_t TimerLastUpdate;
+        int32_t NextTimer;
+        CSystemTimer::TimerType CurrentTimer;
+        uint8_t PifRam[0x40];
+        uint8_t Dmem[0x1000];
+        uint8_t Imem[0x1000];
+
+        // Pages in the delta area needed to turn the RDRAM of this snapshot back in to the previous one
+        uint32_t DeltaStart;
+        uint32_t DeltaCount;
+    };
+
+    void DropOldest();
+    void DropNewest();
+    void SaveFixedState(SNAPSHOT & Snapshot);
+    void LoadFixedState(const SNAPSHOT & Snapshot);
+
+    CN64System & m_System;
+    SNAPSHOT * m_Snapshots;
+    uint32_t m_Slots;
+    uint32_t m_First;
+    uint32_t m_Count;
+
+    // RDRAM as it was at the newest snapshot
+    uint8_t * m_Rdram;
+    uint64_t * m_PageHash;
+    uint32_t m_RdramPages;
+    uint32_t * m_ChangedPage;
+    uint64_t * m_ChangedHash;
+
+    // Ring of old RDRAM pages, owned by the snapshots in the order they were taken
+    uint8_t * m_DeltaData;
+    uint32_t * m_DeltaPage;
+    uint64_t * m_DeltaHash;
+    uint32_t m_DeltaPages;
+    uint32_t m_DeltaTail;
+    uint32_t m_DeltaUsed;
+};
@@ -0,0 +1,256 @@
+#include "stdafx.h"
+
+#include "SyncTrace.h"
+#include <Project64-core/N64System/N64Rom.h>
+#include <Project64-core/N64System/N64System.h>
+#include <Project64-core/N64System/Recompiler/BlockHash.h>
+#include <Project64-core/N64System/SystemGlobals.h>
+
+CSyncTrace::CSyncTrace(CN64System & System, const char * FileName, TRACE_MODE Mode) :
+    m_System(System),
+    m_Mode(Mode),
+    m_BufferPos(0),
+    m_BufferUsed(0),
+    m_PendingCycles(0),
+    m_Records(0),
+    m_Diverged(false),
+    m_Completed(false)
+{
+    memset(&m_Header, 0, sizeof(m_Header));
+    memset(m_LastPC, 0, sizeof(m_LastPC));
+
+    if (m_Mode == Trace_Record)
+    {
+        if (!m_File.Open(FileName, CFileBase::modeWrite | CFileBase::modeCreate))
+        {
+            WriteTrace(TraceN64System, TraceError, "Failed to create %s", FileName);
+            return;
+        }
+        m_Header.Magic = TraceMagic;
+        m_Header.Version = TraceVersion;
+        m_Header.RandomSeed = m_System.m_Random.get_state();
+        if (g_Rom != nullptr)
+        {
+            memcpy(m_Header.RomHeader, g_Rom->GetRomAddress(), sizeof(m_Header.RomHeader));
+        }
+        m_File.Write(&m_Header, sizeof(m_Header));
+    }
+    else
+    {
+        if (!m_File.Open(FileName, CFileBase::modeRead))
+        {
+            WriteTrace(TraceN64System, TraceError, "Failed to open %s", FileName);
+            return;
+        }
+        if (m_File.Read(&m_Header, sizeof(m_Header)) != sizeof(m_Header) || m_Header.Magic != TraceMagic || m_Header.Version != TraceVersion)
+        {
+            WriteTrace(TraceN64System, TraceError, "%s is not a version %d sync trace", FileName, TraceVersion);
+            m_File.Close();
+        }
+    }
+}
+
+CSyncTrace::~CSyncTrace()
+{
+    if (m_Mode == Trace_Record && m_File.IsOpen())
+    {
+        Flush();
+        WriteTrace(TraceN64System, TraceInfo, "Recorded %llu sync points", (unsigned long long)m_Records);
+    }
+    m_File.Close();
+}
+
+void CSyncTrace::AddCycles(uint32_t Cycles)
+{
+    m_PendingCycles += Cycles;
+}
+
+void CSyncTrace::RecordSync(bool PCOnly)
+{
+    if (!m_File.IsOpen())
+    {
+        return;
+    }
+    if (m_Records == 0)
+    {
+        // Game settings are only final once the system has been reset, so the header is finished with the first record
+        m_Header.Flags = m_System.b32BitCore() ? Flag_32BitCore : 0;
+        m_Header.CountPerOp = m_System.CountPerOp();
+        m_File.Seek(0, CFileBase::begin);
+        m_File.Write(&m_Header, sizeof(m_Header));
+        m_File.SeekToEnd();
+    }
+
+    TRACE_RECORD & Record = m_Buffer[m_BufferUsed++];
+    BuildRecord(Record, PCOnly ? Record_SyncPC : Record_Sync);
+    Record.Cycles = m_PendingCycles;
+    m_PendingCycles = 0;
+    m_Records += 1;
+    if (m_BufferUsed == BufferRecords)
+    {
+        Flush();
+    }
+}
+
+bool CSyncTrace::Replay()
+{
+    if (!m_File.IsOpen())
+    {
+        return false;
+    }
+    uint32_t Flags = m_System.b32BitCore() ? Flag_32BitCore : 0;
+    if (m_Header.Flags != Flags || m_Header.CountPerOp != m_System.CountPerOp())
+    {
+        g_Notify->DisplayError(stdstr_f("Sync trace was recorded with different game settings (32bit: %d/%d, count per op: %d/%d)", (m_Header.Flags & Flag_32BitCore) != 0, (Flags & Flag_32BitCore) != 0, m_Header.CountPerOp, m_System.CountPerOp()).c_str());
+        return false;
+    }
+    if (g_Rom != nullptr && memcmp(m_Header.RomHeader, g_Rom->GetRomAddress(), sizeof(m_Header.RomHeader)) != 0)
+    {
+        g_Notify->DisplayError("Sync trace was recorded with a different ROM");
+        return false;
+    }
+
+    TRACE_RECORD Expected, Actual;
+    while (!m_System.m_EndEmulation && ReadRecord(Expected))
+    {
+        if (Expected.Cycles != 0)
+        {
+            m_System.m_OpCodes.ExecuteOps(Expected.Cycles);
+        }
+        if (m_System.m_EndEmulation)
+        {
+            break;
+        }
+        // The recording side brings the timers up to date before each record (see CN64System::SyncSystem)
+        m_System.m_SystemTimer.UpdateTimers();
+        BuildRecord(Actual, (RECORD_TYPE)Expected.Type);
+        if (Actual.PC != Expected.PC || Actual.CpuHash != Expected.CpuHash || Actual.SystemHash != Expected.SystemHash)
+        {
+            m_Diverged = true;
+            ReportDivergence(Expected, Actual);
+            return false;
+        }
+        for (int i = LastRecords - 1; i > 0; i--)
+        {
+            m_LastPC[i] = m_LastPC[i - 1];
+        }
+        m_LastPC[0] = Actual.PC;
+        m_Records += 1;
+    }
+    m_Completed = !m_System.m_EndEmulation;
+    m_System.m_EndEmulation = true;
+    return m_Completed;
+}
+
+void CSyncTrace::Flush()
+{
+    if (m_BufferUsed != 0)
+    {
+        m_File.Write(m_Buffer, m_BufferUsed * sizeof(m_Buffer[0]));
+        m_BufferUsed = 0;
+    }
+}
+
+bool CSyncTrace::ReadRecord(TRACE_RECORD & Record)
+{
+    if (m_BufferPos == m_BufferUsed)
+    {
+        m_BufferPos = 0;
+        m_BufferUsed = m_File.Read(m_Buffer, sizeof(m_Buffer)) / sizeof(m_Buffer[0]);
+        if (m_BufferUsed == 0)
+        {
+            return false;
+        }
+    }
+    Record = m_Buffer[m_BufferPos++];
+    return true;
+}
+
+void CSyncTrace::BuildRecord(TRACE_RECORD & Record, RECORD_TYPE Type) const
+{
+    // Covers the same state CN64System::SyncSystem/SyncSystemPC compare against the sync core
+    const CRegisters & Reg = m_System.m_Reg;
+    const CSystemTimer & SystemTimer = m_System.m_SystemTimer;
+
+    struct
+    {
+        uint64_t GPR[32];
+        uint64_t FPR[32];
+        uint64_t HI, LO;
+        uint32_t FPCR0, FPCR31;
+    } Cpu;
+
+    struct
+    {
+        uint64_t CP0[32];
+        uint32_t Random;
+        uint32_t Tlb[32][5];
+        int64_t CyclesToTimer[CSystemTimer::MaxTimer];
+        uint32_t TimerActive[CSystemTimer::MaxTimer];
+        int32_t LastUpdate;
+        int32_t NextTimer;
+        uint32_t CurrentTimer;
+        uint32_t InFixTimer;
+    } System;
+
+    memset(&Cpu, 0, sizeof(Cpu));
+    memset(&System, 0, sizeof(System));
+    bool b32BitCore = m_System.b32BitCore();
+
+    if (Type == Record_Sync)
+    {
+        for (uint32_t i = 0; i < 32; i++)
+        {
+            Cpu.GPR[i] = b32BitCore ? Reg.m_GPR[i].UW[0] : Reg.m_GPR[i].UDW;
+            Cpu.FPR[i] = Reg.m_FPR[i].UDW;
+            System.CP0[i] = Reg.m_CP0[i];
+        }
+        Cpu.HI = Reg.m_HI.UDW;
+        Cpu.LO = Reg.m_LO.UDW;
+        Cpu.FPCR0 = Reg.m_FPCR[0];
+        Cpu.FPCR31 = Reg.m_FPCR[31];
+        System.Random = const_cast<CRandom &>(m_System.m_Random).get_state();
+    }
+    CTLB & Tlb = const_cast<CTLB &>(m_System.m_TLB);
+    for (int32_t i = 0; i < 32; i++)
+    {
+        const TLB_ENTRY & Entry = Tlb.TlbEntry(i);
+        if (Entry.EntryDefined)
+        {
+            System.Tlb[i][0] = 1;
+            System.Tlb[i][1] = Entry.PageMask.Value;
+            System.Tlb[i][2] = Entry.EntryHi.Value;
+            System.Tlb[i][3] = Entry.EntryLo0.Value;
+            System.Tlb[i][4] = Entry.EntryLo1.Value;
+        }
+    }
+    for (uint32_t i = 0; i < CSystemTimer::MaxTimer; i++)
+    {
+        System.CyclesToTimer[i] = SystemTimer.m_TimerDetatils[i].CyclesToTimer;
+        System.TimerActive[i] = SystemTimer.m_TimerDetatils[i].Active ? 1 : 0;
+    }
+    System.LastUpdate = SystemTimer.m_LastUpdate;
+    System.NextTimer = SystemTimer.m_NextTimer;
+    System.CurrentTimer = SystemTimer.m_Current;
+    System.InFixTimer = SystemTimer.m_inFixTimer ? 1 : 0;
+
+    Record.PC = Reg.m_PROGRAM_COUNTER;
+    Record.Cycles = 0;
+    Record.Type = Type;
+    Record.CpuHash = Type == Record_Sync ? CBlockHash((const uint8_t *)&Cpu, sizeof(Cpu)).Value() : 0;
+    Record.SystemHash = CBlockHash((const uint8_t *)&System, sizeof(System)).Value();
+}
+
+void CSyncTrace::ReportDivergence(const TRACE_RECORD & Expected, const TRACE_RECORD & Actual) const
+{
+    stdstr_f Message("Sync trace diverged at record %llu (PC: %016llX expected: %016llX)%s%s",
+                     (unsigned long long)m_Records, (unsigned long long)Actual.PC, (unsigned long long)Expected.PC,
+                     Actual.CpuHash != Expected.CpuHash ? " CPU registers differ" : "",
+                     Actual.SystemHash != Expected.SystemHash ? " CP0/TLB/timers differ" : "");
+    WriteTrace(TraceN64System, TraceError, "%s", Message.c_str());
+    for (int i = 0; i < LastRecords && (uint64_t)i < m_Records; i++)
+    {
+        WriteTrace(TraceN64System, TraceError, "Last matched record -%d: PC %016llX", i + 1, (unsigned long long)m_LastPC[i]);
+    }
+    g_Notify->DisplayError(Message.c_str());
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <Common/File.h>
+#include <stdint.h>
+
+class CN64System;
+
+// Sync core testing without the second core: a recording run stores a hash of the
+// machine state each time the recompiler syncs, a replay run steps the interpreter
+// through the same cycles and stops at the first record that does not match.
+class CSyncTrace
+{
+public:
+    enum TRACE_MODE
+    {
+        Trace_Record,
+        Trace_Replay,
+    };
+
+    CSyncTrace(CN64System & System, const char * FileName, TRACE_MODE Mode);
+    ~CSyncTrace();
+
+    bool IsOpen() const
+    {
+        return m_File.IsOpen();
+    }
+    TRACE_MODE Mode() const
+    {
+        return m_Mode;
+    }
+    uint32_t RandomSeed() const
+    {
+        return m_Header.RandomSeed;
+    }
+    uint64_t Records() const
+    {
+        return m_Records;
+    }
+    bool Diverged() const
+    {
+        return m_Diverged;
+    }
+    bool Completed() const
+    {
+        return m_Completed;
+    }
+
+    void AddCycles(uint32_t Cycles);
+    void RecordSync(bool PCOnly);
+    bool Replay();
+
+private:
+    CSyncTrace();
+    CSyncTrace(const CSyncTrace &);
+    CSyncTrace & operator=(const CSyncTrace &);
+
+    enum
+    {
+        TraceMagic = 0x54534A50, // "PJST"
+        TraceVersion = 1,
+        Flag_32BitCore = 0x1,
+        BufferRecords = 0x800,
+        LastRecords = 10,
+    };
+
+    enum RECORD_TYPE
+    {
+        Record_Sync,
+        Record_SyncPC,
+    };
+
+    struct TRACE_HEADER
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t RandomSeed;
+        uint32_t Flags;
+        uint32_t CountPerOp;
+        uint32_t Reserved;
+        uint8_t RomHeader[0x40];
+    };
+
+    struct TRACE_RECORD
+    {
+        uint64_t PC;
+        uint32_t Cycles;
+        uint32_t Type;
+        uint64_t CpuHash;
+        uint64_t SystemHash;
+    };
+
+    void Flush();
+    bool ReadRecord(TRACE_RECORD & Record);
+    void BuildRecord(TRACE_RECORD & Record, RECORD_TYPE Type) const;
+    void ReportDivergence(const TRACE_RECORD & Expected, const TRACE_RECORD & Actual) const;
+
+    CN64System & m_System;
+    TRACE_MODE m_Mode;
+    CFile m_File;
+    TRACE_HEADER m_Header;
+    TRACE_RECORD m_Buffer[BufferRecords];
+    uint32_t m_BufferPos;
+    uint32_t m_BufferUsed;
+    uint32_t m_PendingCycles;
+    uint64_t m_Records;
+    uint64_t m_LastPC[LastRecords];
+    bool m_Diverged;
+    bool m_Completed;
+};
@@ -109,6 +109,7 @@ void CSettings::AddHowToHandleSetting(const char * BaseDirectory)
     AddHandler(Setting_CN64TimeCritical, new CSettingTypeApplication("Settings", "CN64TimeCritical", false));
     AddHandler(Setting_AutoStart, new CSettingTypeApplication("Settings", "Auto Start", (uint32_t) true));
     AddHandler(Setting_AutoZipInstantSave, new CSettingTypeApplication("Settings", "Auto Zip Saves", (uint32_t) true));
+    AddHandler(Setting_FastSaveStates, new CSettingTypeApplication("Settings", "Fast Save States", false));
     AddHandler(Setting_EraseGameDefaults, new CSettingTypeApplication("Settings", "Erase on default", (uint32_t) true));
     AddHandler(Setting_CheckEmuRunning, new CSettingTypeApplication("Settings", "Check Running", (uint32_t) true));
 #ifndef _M_X64
@@ -129,6 +130,11 @@ void CSettings::AddHowToHandleSetting(const char * BaseDirectory)
     AddHandler(Setting_DiskSaveType, new CSettingTypeApplication("Settings", "Disk Save Type", (uint32_t)1));
     AddHandler(Setting_UpdateControllerOnRefresh, new CSettingTypeTempBool(false));
     AddHandler(Setting_AllocatedRdramSize, new CSettingTypeTempNumber(0, "AllocatedRdramSize"));
+    AddHandler(Setting_RewindInterval, new CSettingTypeApplication("Settings", "Rewind Interval", (uint32_t)0));
+    AddHandler(Setting_RewindSnapshots, new CSettingTypeApplication("Settings", "Rewind Snapshots", (uint32_t)600));
+    AddHandler(Setting_RewindBufferSize, new CSettingTypeApplication("Settings", "Rewind Buffer Size", (uint32_t)64));
+    AddHandler(Setting_SyncTraceFile, new CSettingTypeTempString(""));
+    AddHandler(Setting_SyncTraceReplay, new CSettingTypeTempBool(false));
 
     AddHandler(Default_RDRamSizeUnknown, new CSettingTypeApplication("Defaults", "Unknown RDRAM Size", 0x800000u));
     AddHandler(Default_RDRamSizeKnown, new CSettingTypeApplication("Defaults", "Known RDRAM Size", 0x400000u));
@@ -342,6 +348,7 @@ void CSettings::AddHowToHandleSetting(const char * BaseDirectory)
     AddHandler(Debugger_RcpIntrBreakpoints, new CSettingTypeApplication("Debugger", "RCP Interrupt Breakpoints", (uint32_t)0));
     AddHandler(Debugger_DebugLanguage, new CSettingTypeApplication("Debugger", "Debug Language", false));
     AddHandler(Debugger_AppLogFlush, new CSettingTypeApplication("Logging", "Log Auto Flush", (uint32_t) false));
+    AddHandler(Debugger_AppLogAsync, new CSettingTypeApplication("Logging", "Log Async", false));
     AddHandler(Debugger_RecordRecompilerAsm, new CSettingTypeApplication("Debugger", "Record Recompiler Asm", false));
     AddHandler(Debugger_AutorunScripts, new CSettingTypeApplication("Debugger", "Autorun Scripts", ""));
     AddHandler(Debugger_TrackCPUStepStarted, new CSettingTypeTempBool(false));
@@ -88,6 +88,13 @@ void CGameSettings::RefreshGameSettings()
     m_FPURegCaching = g_Settings->LoadBool(Game_FPURegCache);
     m_bLinkBlocks = g_Settings->LoadBool(Game_BlockLinking);
     m_LookUpMode = g_Settings->LoadDword(Game_FuncLookupMode);
+    if (m_LookUpMode == FuncFind_ChangeMemory)
+    {
+        // Change memory does not validate blocks before running them, so every write to memory
+        // holding code has to clear the blocks compiled from it
+        m_bSMM_StoreInstruc = true;
+        m_bSMM_PIDMA = true;
+    }
     m_SystemType = (SYSTEM_TYPE)g_Settings->LoadDword(Game_SystemType);
     m_CpuType = (CPU_TYPE)g_Settings->LoadDword(Game_CpuType);
     m_OverClockModifier = g_Settings->LoadDword(Game_OverClockModifier);
@@ -47,6 +47,10 @@ bool CSettingTypeRDBCpuType::Load(uint32_t Index, uint32_t & Value) const
     {
         Value = CPU_SyncCores;
     }
+    else if (_stricmp(String, "CachedInterpreter") == 0)
+    {
+        Value = CPU_CachedInterpreter;
+    }
     else if (_stricmp(String, "Default") == 0)
     {
         LoadDefault(Index, Value);
@@ -106,6 +110,7 @@ void CSettingTypeRDBCpuType::Save(uint32_t /*Index*/, uint32_t Value)
     case CPU_Interpreter: strValue = "Interpreter"; break;
     case CPU_Recompiler: strValue = "Recompiler"; break;
     case CPU_SyncCores: strValue = "SyncCores"; break;
+    case CPU_CachedInterpreter: strValue = "CachedInterpreter"; break;
     default:
         g_Notify->BreakPoint(__FILE__, __LINE__);
     }
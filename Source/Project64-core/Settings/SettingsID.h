@@ -52,6 +52,7 @@ enum SettingID
     Setting_FixedRdramAddress,
 
     Setting_AutoZipInstantSave,
+    Setting_FastSaveStates,
     Setting_RememberCheats,
     Setting_UniqueSaveDir,
     Setting_LanguageDir,
@@ -63,6 +64,11 @@ enum SettingID
     Setting_DiskSaveType,
     Setting_UpdateControllerOnRefresh,
     Setting_AllocatedRdramSize,
+    Setting_RewindInterval,
+    Setting_RewindSnapshots,
+    Setting_RewindBufferSize,
+    Setting_SyncTraceFile,
+    Setting_SyncTraceReplay,
 
     // Default settings
     Default_RDRamSizeUnknown,
@@ -252,6 +258,7 @@ enum SettingID
     Debugger_DisableGameFixes,
     Debugger_AppLogLevel,
     Debugger_AppLogFlush,
+    Debugger_AppLogAsync,
     Debugger_ShowDListAListCount,
     Debugger_ShowRecompMemSize,
     Debugger_DebugLanguage,
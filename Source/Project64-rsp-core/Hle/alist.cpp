@@ -11,6 +11,10 @@
 #include "audio.h"
 #include "hle.h"
 #include "mem.h"
+#include <Project64-rsp-core/Settings/RspSettings.h>
+#include <Project64-rsp-core/cpu/RspLog.h>
+#include <Project64-rsp-core/cpu/RspSimd.h>
+#include <Settings/Settings.h>
 #include <memory.h>
 #include <stdint.h>
 
@@ -60,6 +64,31 @@ static void alist_envmix_mix(size_t n, int16_t ** dst, const int16_t * gains, in
     }
 }
 
+#if defined(RSP_SIMD)
+static inline RspVec sample_mix_simd(RspVec dst, RspVec src, RspVec gain)
+{
+    return VecNarrowSat(Vec32Add(VecWiden(dst), Vec32Sra(VecMulWide(src, gain), 15)));
+}
+
+// Eight samples at a time give the same result as the scalar loop unless dst starts
+// inside the first block of src, as the scalar loop would then read back its own output
+static inline bool simd_block_safe(const int16_t * dst, const int16_t * src)
+{
+    return dst <= src || dst >= src + 8;
+}
+
+static void alist_envmix_mix_simd(size_t n, int16_t ** dst, const int16_t gains[4][8], const int16_t * src)
+{
+    const RspVec in = VecLoad(src);
+    size_t i;
+
+    for (i = 0; i < n; ++i)
+    {
+        VecStore(dst[i], sample_mix_simd(VecLoad(dst[i]), in, VecLoad(gains[i])));
+    }
+}
+#endif
+
 static int16_t ramp_step(struct ramp_t * ramp)
 {
     bool target_reached;
@@ -77,6 +106,90 @@ static int16_t ramp_step(struct ramp_t * ramp)
     return (int16_t)(ramp->value >> 16);
 }
 
+#if defined(RSP_SIMD)
+// With the Check SIMD setting on, a command with a SIMD path is run twice from the same state: first
+// with the scalar code, then with the SIMD code. The alist buffer, the RDRAM range and the caller
+// state the command updates must come out the same both times.
+static struct
+{
+    bool active;
+    uint32_t address;
+    size_t dram_size;
+    void * state;
+    size_t state_size;
+    uint8_t alist_buffer[2][0x1000];
+    uint8_t dram[2][0x50];
+    uint8_t state_copy[2][0x10];
+} simd_check;
+
+static bool simd_check_begin(CHle * hle, uint32_t address, size_t dram_size, void * state, size_t state_size)
+{
+    if (!CheckSimd || simd_check.active || RspSimdLevel() == RspSimd_None)
+    {
+        return false;
+    }
+    simd_check.active = true;
+    simd_check.address = address;
+    simd_check.dram_size = dram_size;
+    simd_check.state = state;
+    simd_check.state_size = state_size;
+    memcpy(simd_check.alist_buffer[0], hle->alist_buffer(), sizeof(simd_check.alist_buffer[0]));
+    if (dram_size != 0)
+    {
+        memcpy(simd_check.dram[0], hle->dram() + address, dram_size);
+    }
+    if (state_size != 0)
+    {
+        memcpy(simd_check.state_copy[0], state, state_size);
+    }
+    RspSimdForceScalar(true);
+    return true;
+}
+
+static void simd_check_next(CHle * hle)
+{
+    RspSimdForceScalar(false);
+    memcpy(simd_check.alist_buffer[1], hle->alist_buffer(), sizeof(simd_check.alist_buffer[1]));
+    memcpy(hle->alist_buffer(), simd_check.alist_buffer[0], sizeof(simd_check.alist_buffer[0]));
+    if (simd_check.dram_size != 0)
+    {
+        memcpy(simd_check.dram[1], hle->dram() + simd_check.address, simd_check.dram_size);
+        memcpy(hle->dram() + simd_check.address, simd_check.dram[0], simd_check.dram_size);
+    }
+    if (simd_check.state_size != 0)
+    {
+        memcpy(simd_check.state_copy[1], simd_check.state, simd_check.state_size);
+        memcpy(simd_check.state, simd_check.state_copy[0], simd_check.state_size);
+    }
+}
+
+static void simd_check_end(CHle * hle, const char * name)
+{
+    bool alist_buffer_ok = memcmp(simd_check.alist_buffer[1], hle->alist_buffer(), sizeof(simd_check.alist_buffer[1])) == 0;
+    bool dram_ok = simd_check.dram_size == 0 || memcmp(simd_check.dram[1], hle->dram() + simd_check.address, simd_check.dram_size) == 0;
+    bool state_ok = simd_check.state_size == 0 || memcmp(simd_check.state_copy[1], simd_check.state, simd_check.state_size) == 0;
+
+    simd_check.active = false;
+    if (!alist_buffer_ok || !dram_ok || !state_ok)
+    {
+        CPU_Message("SIMD check failed: %s%s%s%s", name, alist_buffer_ok ? "" : " alist buffer", dram_ok ? "" : " RDRAM", state_ok ? "" : " state");
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+}
+
+#define ALIST_CHECK_SIMD(hle, address, dram_size, state, state_size, call) \
+    if (simd_check_begin(hle, address, dram_size, state, state_size))      \
+    {                                                                      \
+        call;                                                              \
+        simd_check_next(hle);                                              \
+        call;                                                              \
+        simd_check_end(hle, __FUNCTION__);                                 \
+        return;                                                            \
+    }
+#else
+#define ALIST_CHECK_SIMD(hle, address, dram_size, state, state_size, call)
+#endif
+
 // Global functions
 
 void alist_process(CHle * hle, const acmd_callback_t abi[], unsigned int abi_size)
@@ -260,6 +373,14 @@ void alist_envmix_exp(CHle * hle, bool init, bool aux, uint16_t dmem_dl, uint16_
     uint32_t ptr = 0;
     int x, y;
     short save_buffer[40];
+#if defined(RSP_SIMD)
+    int16_t block_gains[4][8];
+#endif
+
+    ALIST_CHECK_SIMD(hle, address, sizeof(save_buffer), nullptr, 0, alist_envmix_exp(hle, init, aux, dmem_dl, dmem_dr, dmem_wl, dmem_wr, dmemi, count, dry, wet, vol, target, rate, address));
+#if defined(RSP_SIMD)
+    const bool use_simd = RspSimdLevel() != RspSimd_None;
+#endif
 
     memcpy((uint8_t *)save_buffer, (hle->dram() + address), sizeof(save_buffer));
     if (init)
@@ -322,9 +443,28 @@ void alist_envmix_exp(CHle * hle, bool init, bool aux, uint16_t dmem_dl, uint16_
             gains[2] = clamp_s16((l_vol * wet + 0x4000) >> 15);
             gains[3] = clamp_s16((r_vol * wet + 0x4000) >> 15);
 
+#if defined(RSP_SIMD)
+            if (use_simd)
+            {
+                size_t i;
+                for (i = 0; i < 4; ++i)
+                {
+                    block_gains[i][x ^ S] = gains[i];
+                }
+                ++ptr;
+                continue;
+            }
+#endif
             alist_envmix_mix(n, buffers, gains, in[ptr ^ S]);
             ++ptr;
         }
+#if defined(RSP_SIMD)
+        if (use_simd)
+        {
+            int16_t * blocks[4] = {dl + ptr - 8, dr + ptr - 8, wl + ptr - 8, wr + ptr - 8};
+            alist_envmix_mix_simd(n, blocks, block_gains, in + ptr - 8);
+        }
+#endif
     }
 
     *(int16_t *)(save_buffer + 0) = wet;                      // 0-1
@@ -483,8 +623,20 @@ void alist_mix(CHle * hle, uint16_t dmemo, uint16_t dmemi, uint16_t count, int16
     int16_t * dst = (int16_t *)(hle->alist_buffer() + dmemo);
     const int16_t * src = (int16_t *)(hle->alist_buffer() + dmemi);
 
+    ALIST_CHECK_SIMD(hle, 0, 0, nullptr, 0, alist_mix(hle, dmemo, dmemi, count, gain));
     count >>= 1;
 
+#if defined(RSP_SIMD)
+    if (RspSimdLevel() != RspSimd_None && simd_block_safe(dst, src))
+    {
+        const RspVec vgain = VecSet(gain);
+        for (; count >= 8; count -= 8, dst += 8, src += 8)
+        {
+            VecStore(dst, sample_mix_simd(VecLoad(dst), VecLoad(src), vgain));
+        }
+    }
+#endif
+
     while (count != 0)
     {
         sample_mix(dst, *src, gain);
@@ -503,6 +655,8 @@ void alist_envmix_nead(CHle * hle, bool swap_wet_LR, uint16_t dmem_dl, uint16_t
     int16_t * wl = (int16_t *)(hle->alist_buffer() + dmem_wl);
     int16_t * wr = (int16_t *)(hle->alist_buffer() + dmem_wr);
 
+    ALIST_CHECK_SIMD(hle, 0, 0, env_values, 3 * sizeof(env_values[0]), alist_envmix_nead(hle, swap_wet_LR, dmem_dl, dmem_dr, dmem_wl, dmem_wr, dmemi, count, env_values, env_steps, xors));
+
     // Make sure count is a multiple of 8
     count = align(count, 8);
 
@@ -511,6 +665,40 @@ void alist_envmix_nead(CHle * hle, bool swap_wet_LR, uint16_t dmem_dl, uint16_t
         swap(&wl, &wr);
     }
 
+#if defined(RSP_SIMD)
+    if (RspSimdLevel() != RspSimd_None)
+    {
+        const RspVec xor0 = VecSet(xors[0]), xor1 = VecSet(xors[1]), xor2 = VecSet(xors[2]), xor3 = VecSet(xors[3]);
+
+        while (count != 0)
+        {
+            // (in * env) >> 16 with in signed and env unsigned, samples keep the same lanes in every buffer
+            RspVec samples = VecLoad(in);
+            RspVec l = VecXor(VecMulHiSU(samples, VecSet(env_values[0])), xor0);
+            RspVec r = VecXor(VecMulHiSU(samples, VecSet(env_values[1])), xor1);
+            RspVec l2 = VecXor(VecMulHiSU(l, VecSet(env_values[2])), xor2);
+            RspVec r2 = VecXor(VecMulHiSU(r, VecSet(env_values[2])), xor3);
+
+            VecStore(dl, VecAddSat(VecLoad(dl), l));
+            VecStore(dr, VecAddSat(VecLoad(dr), r));
+            VecStore(wl, VecAddSat(VecLoad(wl), l2));
+            VecStore(wr, VecAddSat(VecLoad(wr), r2));
+
+            env_values[0] += env_steps[0];
+            env_values[1] += env_steps[1];
+            env_values[2] += env_steps[2];
+
+            dl += 8;
+            dr += 8;
+            wl += 8;
+            wr += 8;
+            in += 8;
+            count -= 8;
+        }
+        return;
+    }
+#endif
+
     while (count != 0)
     {
         size_t i;
@@ -545,8 +733,19 @@ void alist_add(CHle * hle, uint16_t dmemo, uint16_t dmemi, uint16_t count)
     int16_t * dst = (int16_t *)(hle->alist_buffer() + dmemo);
     const int16_t * src = (int16_t *)(hle->alist_buffer() + dmemi);
 
+    ALIST_CHECK_SIMD(hle, 0, 0, nullptr, 0, alist_add(hle, dmemo, dmemi, count));
     count >>= 1;
 
+#if defined(RSP_SIMD)
+    if (RspSimdLevel() != RspSimd_None && simd_block_safe(dst, src))
+    {
+        for (; count >= 8; count -= 8, dst += 8, src += 8)
+        {
+            VecStore(dst, VecAddSat(VecLoad(dst), VecLoad(src)));
+        }
+    }
+#endif
+
     while (count != 0)
     {
         *dst = clamp_s16(*dst + *src);
@@ -709,6 +908,7 @@ void alist_adpcm(CHle * hle, bool init, bool loop, bool two_bit_per_sample, uint
                                               : adpcm_predict_frame_4bits;
 
     assert((count & 0x1f) == 0);
+    ALIST_CHECK_SIMD(hle, last_frame_address & 0xffffff, sizeof(last_frame), nullptr, 0, alist_adpcm(hle, init, loop, two_bit_per_sample, dmemo, dmemi, count, codebook, loop_address, last_frame_address));
 
     if (init)
     {
@@ -757,12 +957,46 @@ void alist_filter(CHle * hle, uint16_t dmem, uint16_t count, uint32_t address, c
     int16_t * in1 = (int16_t *)(hle->dram() + address);
     int16_t * in2 = (int16_t *)(hle->alist_buffer() + dmem);
 
+    ALIST_CHECK_SIMD(hle, address, 16, nullptr, 0, alist_filter(hle, dmem, count, address, lut_address));
     for (x = 0; x < 8; ++x)
     {
         int32_t v = (lutt5[x] + lutt6[x]) >> 1;
         lutt5[x] = lutt6[x] = v;
     }
 
+#if defined(RSP_SIMD)
+    if (RspSimdLevel() != RspSimd_None)
+    {
+        // With the pairs of in1:in2 swapped into sample order s[], output sample n is the sum of
+        // s[n + 1 + k] * coef[k], coef being lutt6 in the order the scalar code below uses it
+        const RspVec coef[8] = {VecSet(lutt6[6]), VecSet(lutt6[7]), VecSet(lutt6[4]), VecSet(lutt6[5]), VecSet(lutt6[2]), VecSet(lutt6[3]), VecSet(lutt6[0]), VecSet(lutt6[1])};
+        RspVec s0 = VecSwapPairs(VecLoad(in1));
+
+        for (x = 0; x < count; x += 16)
+        {
+            RspVec s1 = VecSwapPairs(VecLoad(in2));
+
+            RspVec32 v = Vec32Set(0x4000);
+            v = Vec32Add(v, VecMulWide(VecConcat<1>(s0, s1), coef[0]));
+            v = Vec32Add(v, VecMulWide(VecConcat<2>(s0, s1), coef[1]));
+            v = Vec32Add(v, VecMulWide(VecConcat<3>(s0, s1), coef[2]));
+            v = Vec32Add(v, VecMulWide(VecConcat<4>(s0, s1), coef[3]));
+            v = Vec32Add(v, VecMulWide(VecConcat<5>(s0, s1), coef[4]));
+            v = Vec32Add(v, VecMulWide(VecConcat<6>(s0, s1), coef[5]));
+            v = Vec32Add(v, VecMulWide(VecConcat<7>(s0, s1), coef[6]));
+            v = Vec32Add(v, VecMulWide(s1, coef[7]));
+            VecStore(outp, VecSwapPairs(VecNarrow(Vec32Sra(v, 15))));
+
+            s0 = s1;
+            in2 += 8;
+            outp += 8;
+        }
+        memcpy(hle->dram() + address, in2 - 8, 16);
+        memcpy(hle->alist_buffer() + dmem, outbuff, count);
+        return;
+    }
+#endif
+
     for (x = 0; x < count; x += 16)
     {
         int32_t v[8];
@@ -867,6 +1101,11 @@ void alist_polef(CHle * hle, bool init, uint16_t dmemo, uint16_t dmemi, uint16_t
     int16_t l1, l2;
     int16_t h2_before[8];
 
+    ALIST_CHECK_SIMD(hle, address & 0xffffff, 8, h2, 8 * sizeof(h2[0]), alist_polef(hle, init, dmemo, dmemi, count, gain, table, address));
+#if defined(RSP_SIMD)
+    const bool use_simd = RspSimdLevel() != RspSimd_None;
+#endif
+
     count = align(count, 16);
 
     if (init)
@@ -895,11 +1134,44 @@ void alist_polef(CHle * hle, bool init, uint16_t dmemo, uint16_t dmemi, uint16_t
             frame[i] = *alist_s16(hle, dmemi);
         }
 
-        for (i = 0; i < 8; ++i)
+#if defined(RSP_SIMD)
+        if (use_simd)
+        {
+            // Same sum as below with rdot unrolled, gain is unsigned so its top bit is added separately
+            const RspVec in = VecLoad(frame);
+            const RspVec zero = VecZero();
+            int16_t out[8];
+
+            RspVec32 accu = VecMulWide(in, VecSet((int16_t)gain));
+            if ((gain & 0x8000) != 0)
+            {
+                accu = Vec32Add(accu, Vec32Shl(VecWiden(in), 16));
+            }
+            accu = Vec32Add(accu, VecMulWide(VecLoad(h1), VecSet(l1)));
+            accu = Vec32Add(accu, VecMulWide(VecLoad(h2_before), VecSet(l2)));
+            accu = Vec32Add(accu, VecMulWide(VecConcat<7>(zero, in), VecSet(h2[0])));
+            accu = Vec32Add(accu, VecMulWide(VecConcat<6>(zero, in), VecSet(h2[1])));
+            accu = Vec32Add(accu, VecMulWide(VecConcat<5>(zero, in), VecSet(h2[2])));
+            accu = Vec32Add(accu, VecMulWide(VecConcat<4>(zero, in), VecSet(h2[3])));
+            accu = Vec32Add(accu, VecMulWide(VecConcat<3>(zero, in), VecSet(h2[4])));
+            accu = Vec32Add(accu, VecMulWide(VecConcat<2>(zero, in), VecSet(h2[5])));
+            accu = Vec32Add(accu, VecMulWide(VecConcat<1>(zero, in), VecSet(h2[6])));
+            VecStore(out, VecNarrowSat(Vec32Sra(accu, 14)));
+
+            for (i = 0; i < 8; ++i)
+            {
+                dst[i ^ S] = out[i];
+            }
+        }
+        else
+#endif
         {
-            int32_t accu = frame[i] * gain;
-            accu += h1[i] * l1 + h2_before[i] * l2 + rdot(i, h2, frame);
-            dst[i ^ S] = clamp_s16(accu >> 14);
+            for (i = 0; i < 8; ++i)
+            {
+                int32_t accu = frame[i] * gain;
+                accu += h1[i] * l1 + h2_before[i] * l2 + rdot(i, h2, frame);
+                dst[i ^ S] = clamp_s16(accu >> 14);
+            }
         }
 
         l1 = dst[6 ^ S];
@@ -5,6 +5,7 @@
 // GNU/GPLv2 licensed: https://gnu.org/licenses/gpl-2.0.html
 
 #pragma once
+#include <stddef.h>
 #include <stdint.h>
 
 class CHle;
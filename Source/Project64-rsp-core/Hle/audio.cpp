@@ -5,6 +5,7 @@
 // GNU/GPLv2 licensed: https://gnu.org/licenses/gpl-2.0.html
 
 #include "audio.h"
+#include <Project64-rsp-core/cpu/RspSimd.h>
 #include <assert.h>
 #include <stdint.h>
 
@@ -92,6 +93,28 @@ int32_t rdot(size_t n, const int16_t * x, const int16_t * y)
     return accu;
 }
 
+#if defined(RSP_SIMD)
+// The residuals only depend on the source frame, so all eight are computed together:
+// dst[i] = (src[i] << 11) + book1[i] * l1 + book2[i] * l2 + sum(book2[k] * src[i - 1 - k])
+static void adpcm_compute_residuals_simd(int16_t * dst, const int16_t * src, const int16_t * book1, const int16_t * book2, int16_t l1, int16_t l2)
+{
+    const RspVec Src = VecLoad(src);
+    const RspVec Zero = VecZero();
+
+    RspVec32 accu = VecMulWide(Src, VecSet(1 << 11));
+    accu = Vec32Add(accu, VecMulWide(VecLoad(book1), VecSet(l1)));
+    accu = Vec32Add(accu, VecMulWide(VecLoad(book2), VecSet(l2)));
+    accu = Vec32Add(accu, VecMulWide(VecConcat<7>(Zero, Src), VecSet(book2[0])));
+    accu = Vec32Add(accu, VecMulWide(VecConcat<6>(Zero, Src), VecSet(book2[1])));
+    accu = Vec32Add(accu, VecMulWide(VecConcat<5>(Zero, Src), VecSet(book2[2])));
+    accu = Vec32Add(accu, VecMulWide(VecConcat<4>(Zero, Src), VecSet(book2[3])));
+    accu = Vec32Add(accu, VecMulWide(VecConcat<3>(Zero, Src), VecSet(book2[4])));
+    accu = Vec32Add(accu, VecMulWide(VecConcat<2>(Zero, Src), VecSet(book2[5])));
+    accu = Vec32Add(accu, VecMulWide(VecConcat<1>(Zero, Src), VecSet(book2[6])));
+    VecStore(dst, VecNarrowSat(Vec32Sra(accu, 11)));
+}
+#endif
+
 void adpcm_compute_residuals(int16_t * dst, const int16_t * src,
                              const int16_t * cb_entry, const int16_t * last_samples, size_t count)
 {
@@ -105,6 +128,14 @@ void adpcm_compute_residuals(int16_t * dst, const int16_t * src,
 
     assert(count <= 8);
 
+#if defined(RSP_SIMD)
+    if (count == 8 && RspSimdLevel() != RspSimd_None)
+    {
+        adpcm_compute_residuals_simd(dst, src, book1, book2, l1, l2);
+        return;
+    }
+#endif
+
     for (i = 0; i < count; ++i)
     {
         int32_t accu = (int32_t)src[i] << 11;
@@ -16,8 +16,6 @@
 #include "ucodes.h"
 #include <memory.h>
 
-#define min(a, b) (((a) < (b)) ? (a) : (b))
-
 // Helper functions prototypes
 
 static unsigned int sum_bytes(const uint8_t * bytes, uint32_t size);
@@ -213,50 +211,6 @@ bool CHle::try_fast_audio_dispatching(void)
     return false;
 }
 
-void CHle::normal_task_dispatching(void)
-{
-    const unsigned int sum =
-        sum_bytes((const uint8_t *)dram_u32(this, *dmem_u32(this, TASK_UCODE)), min(*dmem_u32(this, TASK_UCODE_SIZE), 0xf80) >> 1);
-
-    switch (sum)
-    {
-        // StoreVe12: found in Zelda Ocarina of Time [misleading task->type == 4]
-    case 0x278:
-        // Nothing to emulate
-        return;
-
-        // GFX: Twintris [misleading task->type == 0]
-    case 0x212ee:
-        if (m_ForwardGFX)
-        {
-            m_ProcessDList();
-            return;
-        }
-        break;
-
-        // JPEG: found in Pokmon Stadium J
-    case 0x2c85a:
-        jpeg_decode_PS0(this);
-        return;
-
-        // JPEG: found in Zelda Ocarina of Time, Pokmon Stadium 1, Pokmon Stadium 2
-    case 0x2caa6:
-        jpeg_decode_PS(this);
-        return;
-
-        // JPEG: found in Ogre Battle, Bottom of the 9th
-    case 0x130de:
-    case 0x278b0:
-        jpeg_decode_OB(this);
-        return;
-    }
-
-    WarnMessage("Unknown OSTask: sum: %x PC:%x", sum, *m_sp_pc);
-#ifdef ENABLE_TASK_DUMP
-    dump_unknown_task(this, sum);
-#endif
-}
-
 void CHle::non_task_dispatching(void)
 {
     const unsigned int sum = sum_bytes(m_imem, 44);
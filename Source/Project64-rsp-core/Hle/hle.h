@@ -82,7 +82,6 @@ private:
     CHle & operator=(const CHle &);
 
     bool is_task(void);
-    void normal_task_dispatching(void);
     void non_task_dispatching(void);
 
     uint8_t *& m_dram;
@@ -11,6 +11,7 @@
 
 #include "arithmetics.h"
 #include "mem.h"
+#include <Project64-rsp-core/cpu/RspSimd.h>
 
 #define SUBBLOCK_SIZE 64
 
@@ -282,6 +283,15 @@ static uint16_t GetRGBA(int16_t y, int16_t u, int16_t v)
     return (r << 4) | (g >> 1) | (b >> 6) | 1;
 }
 
+#if defined(RSP_SIMD)
+// Same as clamp_u8, including -0x8000 giving 1
+static inline RspVec clamp_u8_simd(RspVec x)
+{
+    const RspVec clamped = VecMin(VecMax(x, VecZero()), VecSet(0xff));
+    return VecSelect(VecCmpEq(x, VecSet(-0x8000)), VecSet(1), clamped);
+}
+#endif
+
 static void EmitYUVTileLine(CHle * hle, const int16_t * y, const int16_t * u, uint32_t address)
 {
     uint32_t uyvy[8];
@@ -289,6 +299,19 @@ static void EmitYUVTileLine(CHle * hle, const int16_t * y, const int16_t * u, ui
     const int16_t * const v = u + SUBBLOCK_SIZE;
     const int16_t * const y2 = y + SUBBLOCK_SIZE;
 
+#if defined(RSP_SIMD)
+    if (RspSimdLevel() != RspSimd_None)
+    {
+        // Each pair of 16-bit lanes is one word: y2 | v << 8 in the low half, y1 | u << 8 in the high half
+        const RspVec uv_lo = VecShl(clamp_u8_simd(VecLoad(v)), 8);
+        const RspVec uv_hi = VecShl(clamp_u8_simd(VecLoad(u)), 8);
+        VecStore(&uyvy[0], VecOr(VecSwapPairs(clamp_u8_simd(VecLoad(y))), VecZipLo(uv_lo, uv_hi)));
+        VecStore(&uyvy[4], VecOr(VecSwapPairs(clamp_u8_simd(VecLoad(y2))), VecZipHi(uv_lo, uv_hi)));
+        dram_store_u32(hle, uyvy, address, 8);
+        return;
+    }
+#endif
+
     uyvy[0] = GetUYVY(y[0], y[1], u[0], v[0]);
     uyvy[1] = GetUYVY(y[2], y[3], u[1], v[1]);
     uyvy[2] = GetUYVY(y[4], y[5], u[2], v[2]);
@@ -301,6 +324,52 @@ static void EmitYUVTileLine(CHle * hle, const int16_t * y, const int16_t * u, ui
     dram_store_u32(hle, uyvy, address, 8);
 }
 
+#if defined(RSP_SIMD_SSE2)
+// trunc(base + kx * x + ky * y) worked out in double precision like GetRGBA, cut to 16 bits
+static inline __m128i rgba_channel_half(__m128i base, __m128i x, double kx, __m128i y, double ky)
+{
+    __m128i result[2];
+
+    for (int i = 0; i < 2; i++)
+    {
+        __m128d sum = _mm_add_pd(_mm_cvtepi32_pd(base), _mm_mul_pd(_mm_set1_pd(kx), _mm_cvtepi32_pd(x)));
+        if (ky != 0.0)
+        {
+            sum = _mm_add_pd(sum, _mm_mul_pd(_mm_set1_pd(ky), _mm_cvtepi32_pd(y)));
+        }
+        result[i] = _mm_cvttpd_epi32(sum);
+        base = _mm_srli_si128(base, 8);
+        x = _mm_srli_si128(x, 8);
+        y = _mm_srli_si128(y, 8);
+    }
+    return _mm_unpacklo_epi64(result[0], result[1]);
+}
+
+static inline RspVec rgba_channel_simd(RspVec32 base, RspVec32 x, double kx, RspVec32 y, double ky)
+{
+    RspVec32 lanes = {rgba_channel_half(base.Lo, x.Lo, kx, y.Lo, ky), rgba_channel_half(base.Hi, x.Hi, kx, y.Hi, ky)};
+    return VecNarrow(lanes);
+}
+
+static inline RspVec clamp_RGBA_component_simd(RspVec x)
+{
+    return VecAnd(VecMin(VecMax(x, VecZero()), VecSet(0xff0)), VecSet(0xf80));
+}
+
+static inline RspVec GetRGBA_simd(RspVec y, RspVec u, RspVec v)
+{
+    const RspVec32 base = Vec32Add(VecWiden(y), Vec32Set(2048));
+    const RspVec32 u32 = VecWiden(u);
+    const RspVec32 v32 = VecWiden(v);
+
+    const RspVec r = clamp_RGBA_component_simd(rgba_channel_simd(base, v32, 1.4025, v32, 0.0));
+    const RspVec g = clamp_RGBA_component_simd(rgba_channel_simd(base, u32, -0.3443, v32, -0.7144));
+    const RspVec b = clamp_RGBA_component_simd(rgba_channel_simd(base, u32, 1.7729, u32, 0.0));
+
+    return VecOr(VecOr(VecShl(r, 4), VecSra(g, 1)), VecOr(VecSra(b, 6), VecSet(1)));
+}
+#endif
+
 static void EmitRGBATileLine(CHle * hle, const int16_t * y, const int16_t * u, uint32_t address)
 {
     uint16_t rgba[16];
@@ -308,6 +377,18 @@ static void EmitRGBATileLine(CHle * hle, const int16_t * y, const int16_t * u, u
     const int16_t * const v = u + SUBBLOCK_SIZE;
     const int16_t * const y2 = y + SUBBLOCK_SIZE;
 
+#if defined(RSP_SIMD_SSE2)
+    if (RspSimdLevel() != RspSimd_None)
+    {
+        // Each u, v pair is shared by two neighbouring pixels
+        const RspVec uu = VecLoad(u), vv = VecLoad(v);
+        VecStore(&rgba[0], GetRGBA_simd(VecLoad(y), VecZipLo(uu, uu), VecZipLo(vv, vv)));
+        VecStore(&rgba[8], GetRGBA_simd(VecLoad(y2), VecZipHi(uu, uu), VecZipHi(vv, vv)));
+        dram_store_u16(hle, rgba, address, 16);
+        return;
+    }
+#endif
+
     rgba[0] = GetRGBA(y[0], u[0], v[0]);
     rgba[1] = GetRGBA(y[1], u[0], v[0]);
     rgba[2] = GetRGBA(y[2], u[1], v[1]);
@@ -447,6 +528,20 @@ static void decode_macroblock_std(const subblock_transform_t transform_luma,
 
 static void TransposeSubBlock(int16_t * dst, const int16_t * src)
 {
+#if defined(RSP_SIMD)
+    if (RspSimdLevel() != RspSimd_None)
+    {
+        RspVec rows[8];
+        unsigned int i;
+
+        for (i = 0; i < 8; ++i)
+            rows[i] = VecLoad(&src[i * 8]);
+        VecTranspose(rows);
+        for (i = 0; i < 8; ++i)
+            VecStore(&dst[i * 8], rows[i]);
+        return;
+    }
+#endif
     ReorderSubBlock(dst, src, TRANSPOSE_TABLE);
 }
 
@@ -470,6 +565,16 @@ static void MultSubBlocks(int16_t * dst, const int16_t * src1, const int16_t * s
 {
     unsigned int i;
 
+#if defined(RSP_SIMD)
+    if (RspSimdLevel() != RspSimd_None)
+    {
+        for (i = 0; i < SUBBLOCK_SIZE; i += 8)
+        {
+            VecStore(&dst[i], VecShl(VecNarrowSat(VecMulWide(VecLoad(&src1[i]), VecLoad(&src2[i]))), shift));
+        }
+        return;
+    }
+#endif
     for (i = 0; i < SUBBLOCK_SIZE; ++i)
     {
         int32_t v = src1[i] * src2[i];
@@ -544,12 +649,100 @@ static void InverseDCT1D(const float * const x, float * dst, unsigned int stride
     *dst = f[0] + f[2] - e[0];
 }
 
+#if defined(RSP_SIMD_SSE2)
+// InverseDCT1D on four lanes at once, with the operations in the same order so every lane rounds
+// exactly like the scalar version
+static void InverseDCT1D_simd(const __m128 * x, __m128 * dst)
+{
+    __m128 e[4];
+    __m128 f[4];
+    __m128 x26, x1357, x15, x37, x17, x35;
+
+    x15 = _mm_mul_ps(_mm_set1_ps(IDCT_K[2]), _mm_add_ps(x[1], x[5]));
+    x37 = _mm_mul_ps(_mm_set1_ps(IDCT_K[3]), _mm_add_ps(x[3], x[7]));
+    x17 = _mm_mul_ps(_mm_set1_ps(IDCT_K[8]), _mm_add_ps(x[1], x[7]));
+    x35 = _mm_mul_ps(_mm_set1_ps(IDCT_K[9]), _mm_add_ps(x[3], x[5]));
+    x1357 = _mm_mul_ps(_mm_set1_ps(IDCT_C3), _mm_add_ps(_mm_add_ps(_mm_add_ps(x[1], x[3]), x[5]), x[7]));
+    x26 = _mm_mul_ps(_mm_set1_ps(IDCT_C6), _mm_add_ps(x[2], x[6]));
+
+    f[0] = _mm_add_ps(x[0], x[4]);
+    f[1] = _mm_sub_ps(x[0], x[4]);
+    f[2] = _mm_add_ps(x26, _mm_mul_ps(_mm_set1_ps(IDCT_K[0]), x[2]));
+    f[3] = _mm_add_ps(x26, _mm_mul_ps(_mm_set1_ps(IDCT_K[1]), x[6]));
+
+    e[0] = _mm_add_ps(_mm_add_ps(_mm_add_ps(x1357, x15), _mm_mul_ps(_mm_set1_ps(IDCT_K[4]), x[1])), x17);
+    e[1] = _mm_add_ps(_mm_add_ps(_mm_add_ps(x1357, x37), _mm_mul_ps(_mm_set1_ps(IDCT_K[6]), x[3])), x35);
+    e[2] = _mm_add_ps(_mm_add_ps(_mm_add_ps(x1357, x15), _mm_mul_ps(_mm_set1_ps(IDCT_K[5]), x[5])), x35);
+    e[3] = _mm_add_ps(_mm_add_ps(_mm_add_ps(x1357, x37), _mm_mul_ps(_mm_set1_ps(IDCT_K[7]), x[7])), x17);
+
+    dst[0] = _mm_add_ps(_mm_add_ps(f[0], f[2]), e[0]);
+    dst[1] = _mm_add_ps(_mm_add_ps(f[1], f[3]), e[1]);
+    dst[2] = _mm_add_ps(_mm_sub_ps(f[1], f[3]), e[2]);
+    dst[3] = _mm_add_ps(_mm_sub_ps(f[0], f[2]), e[3]);
+    dst[4] = _mm_sub_ps(_mm_sub_ps(f[0], f[2]), e[3]);
+    dst[5] = _mm_sub_ps(_mm_sub_ps(f[1], f[3]), e[2]);
+    dst[6] = _mm_sub_ps(_mm_add_ps(f[1], f[3]), e[1]);
+    dst[7] = _mm_sub_ps(_mm_add_ps(f[0], f[2]), e[0]);
+}
+
+// Lane i of lo[n] / hi[n] holds element n of row i / row i + 4
+static void InverseDCTSubBlock_simd(int16_t * dst, const int16_t * src)
+{
+    RspVec rows[8];
+    __m128 lo[8], hi[8], out_lo[8], out_hi[8];
+    unsigned int i;
+
+    // IDCT 1D on rows, the transposition puts one row in each lane
+    for (i = 0; i < 8; ++i)
+        rows[i] = VecLoad(&src[i * 8]);
+    VecTranspose(rows);
+    for (i = 0; i < 8; ++i)
+    {
+        const RspVec32 x = VecWiden(rows[i]);
+        lo[i] = _mm_cvtepi32_ps(x.Lo);
+        hi[i] = _mm_cvtepi32_ps(x.Hi);
+    }
+    InverseDCT1D_simd(lo, out_lo);
+    InverseDCT1D_simd(hi, out_hi);
+
+    // IDCT 1D on columns (thanks to previous transposition), transposed back as four 4x4 blocks
+    for (i = 0; i < 4; ++i)
+    {
+        lo[i] = out_lo[i];
+        hi[i] = out_lo[i + 4];
+        lo[i + 4] = out_hi[i];
+        hi[i + 4] = out_hi[i + 4];
+    }
+    _MM_TRANSPOSE4_PS(lo[0], lo[1], lo[2], lo[3]);
+    _MM_TRANSPOSE4_PS(hi[0], hi[1], hi[2], hi[3]);
+    _MM_TRANSPOSE4_PS(lo[4], lo[5], lo[6], lo[7]);
+    _MM_TRANSPOSE4_PS(hi[4], hi[5], hi[6], hi[7]);
+    InverseDCT1D_simd(lo, out_lo);
+    InverseDCT1D_simd(hi, out_hi);
+
+    // C4 = 1 normalization implies a division by 8
+    for (i = 0; i < 8; ++i)
+    {
+        RspVec32 x = {_mm_cvttps_epi32(out_lo[i]), _mm_cvttps_epi32(out_hi[i])};
+        VecStore(&dst[i * 8], VecSra(VecNarrow(x), 3));
+    }
+}
+#endif
+
 static void InverseDCTSubBlock(int16_t * dst, const int16_t * src)
 {
     float x[8];
     float block[SUBBLOCK_SIZE];
     unsigned int i, j;
 
+#if defined(RSP_SIMD_SSE2)
+    if (RspSimdLevel() != RspSimd_None)
+    {
+        InverseDCTSubBlock_simd(dst, src);
+        return;
+    }
+#endif
+
     // IDCT 1D on rows (+transposition)
     for (i = 0; i < 8; ++i)
     {
@@ -576,6 +769,18 @@ static void RescaleYSubBlock(int16_t * dst, const int16_t * src)
 {
     unsigned int i;
 
+#if defined(RSP_SIMD)
+    if (RspSimdLevel() != RspSimd_None)
+    {
+        for (i = 0; i < SUBBLOCK_SIZE; i += 8)
+        {
+            const RspVec x = VecAdd(VecMin(VecMax(VecLoad(&src[i]), VecSet(-0x800)), VecSet(0x7f0)), VecSet(0x800));
+            VecStore(&dst[i], VecAdd(VecMulHiU(x, VecSet(0xdb0)), VecSet(0x10)));
+        }
+        return;
+    }
+#endif
+
     for (i = 0; i < SUBBLOCK_SIZE; ++i)
     {
         dst[i] = (((uint32_t)(clamp_s12(src[i]) + 0x800) * 0xdb0) >> 16) + 0x10;
@@ -585,6 +790,18 @@ static void RescaleUVSubBlock(int16_t * dst, const int16_t * src)
 {
     unsigned int i;
 
+#if defined(RSP_SIMD)
+    if (RspSimdLevel() != RspSimd_None)
+    {
+        for (i = 0; i < SUBBLOCK_SIZE; i += 8)
+        {
+            const RspVec x = VecMin(VecMax(VecLoad(&src[i]), VecSet(-0x800)), VecSet(0x7f0));
+            VecStore(&dst[i], VecAdd(VecMulHi(x, VecSet(0xe00)), VecSet(0x80)));
+        }
+        return;
+    }
+#endif
+
     for (i = 0; i < SUBBLOCK_SIZE; ++i)
     {
         dst[i] = (((int)clamp_s12(src[i]) * 0xe00) >> 16) + 0x80;
@@ -7,6 +7,7 @@
 #pragma once
 #include "hle.h"
 #include <assert.h>
+#include <stddef.h>
 
 #define S 1
 #define S16 2
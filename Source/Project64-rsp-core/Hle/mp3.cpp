@@ -11,6 +11,7 @@
 
 #include "arithmetics.h"
 #include "mem.h"
+#include <Project64-rsp-core/cpu/RspSimd.h>
 
 static void InnerLoop(CHle * hle, uint32_t outPtr, uint32_t inPtr, uint32_t t6, uint32_t t5, uint32_t t4);
 
@@ -187,6 +188,25 @@ static void MP3AB0(int32_t * v)
     }
 }
 
+#if defined(RSP_SIMD)
+// Sum of eight rounded products (sample * window + round) >> 15, the same as eight steps of the dewindowing loops
+static inline int32_t DeWindowSum(const uint8_t * samples, RspVec window, RspVec32 round)
+{
+    return Vec32Sum(Vec32Sra(Vec32Add(VecMulWide(VecLoad(samples), window), round), 15));
+}
+
+// As DeWindowSum, but with the odd products subtracted. -((p + 0x4000) >> 15) is (-p + 0x3FFF) >> 15,
+// and DeWindowLUT has no 0x8000 entry, so the window can simply be negated in those lanes.
+static inline int32_t DeWindowSumAlternate(const uint8_t * samples, const uint16_t * window)
+{
+    static const int16_t negate[8] = {0, -1, 0, -1, 0, -1, 0, -1};
+    static const int16_t round[8] = {0x4000, 0x3FFF, 0x4000, 0x3FFF, 0x4000, 0x3FFF, 0x4000, 0x3FFF};
+
+    const RspVec w = VecLoad(window);
+    return DeWindowSum(samples, VecSelect(VecLoad(negate), VecSub(VecZero(), w), w), VecWiden(VecLoad(round)));
+}
+#endif
+
 void mp3_task(CHle * hle, unsigned int index, uint32_t address)
 {
     uint32_t inPtr, outPtr;
@@ -559,6 +579,11 @@ static void InnerLoop(CHle * hle, uint32_t outPtr, uint32_t inPtr, uint32_t t6,
 
     addptr = t6 & 0xFFE0;
 
+#if defined(RSP_SIMD)
+    const bool use_simd = RspSimdLevel() != RspSimd_None;
+    const RspVec32 round = Vec32Set(0x4000);
+#endif
+
     offset = 0x10 - (t4 >> 1);
     for (x = 0; x < 8; x++)
     {
@@ -566,6 +591,18 @@ static void InnerLoop(CHle * hle, uint32_t outPtr, uint32_t inPtr, uint32_t t6,
         int32_t v18;
         v2 = v4 = v6 = v8 = 0;
 
+#if defined(RSP_SIMD)
+        if (use_simd)
+        {
+            v2 = DeWindowSum(hle->mp3_buffer() + addptr + 0x00, VecLoad(&DeWindowLUT[offset + 0x00]), round);
+            v4 = DeWindowSum(hle->mp3_buffer() + addptr + 0x10, VecLoad(&DeWindowLUT[offset + 0x08]), round);
+            v6 = DeWindowSum(hle->mp3_buffer() + addptr + 0x20, VecLoad(&DeWindowLUT[offset + 0x20]), round);
+            v8 = DeWindowSum(hle->mp3_buffer() + addptr + 0x30, VecLoad(&DeWindowLUT[offset + 0x28]), round);
+            addptr += 0x10;
+            offset += 8;
+        }
+        else
+#endif
         for (i = 7; i >= 0; i--)
         {
             v2 += ((int)*(int16_t *)(hle->mp3_buffer() + (addptr) + 0x00) * (short)DeWindowLUT[offset + 0x00] + 0x4000) >> 0xF;
@@ -623,6 +660,17 @@ static void InnerLoop(CHle * hle, uint32_t outPtr, uint32_t inPtr, uint32_t t6,
 
         offset = (0x22F - (t4 >> 1) + x * 0x40);
 
+#if defined(RSP_SIMD)
+        if (use_simd)
+        {
+            v2 = DeWindowSumAlternate(hle->mp3_buffer() + addptr + 0x20, &DeWindowLUT[offset + 0x00]);
+            v4 = DeWindowSumAlternate(hle->mp3_buffer() + addptr + 0x30, &DeWindowLUT[offset + 0x08]);
+            v6 = DeWindowSumAlternate(hle->mp3_buffer() + addptr + 0x00, &DeWindowLUT[offset + 0x20]);
+            v8 = DeWindowSumAlternate(hle->mp3_buffer() + addptr + 0x10, &DeWindowLUT[offset + 0x28]);
+            addptr += 0x10;
+        }
+        else
+#endif
         for (i = 0; i < 4; i++)
         {
             v2 += ((int)*(int16_t *)(hle->mp3_buffer() + (addptr) + 0x20) * (short)DeWindowLUT[offset + 0x00] + 0x4000) >> 0xF;
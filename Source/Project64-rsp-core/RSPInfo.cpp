@@ -1,5 +1,6 @@
 #include "RSPInfo.h"
 #include <Project64-rsp-core/Recompiler/RspProfiling.h>
+#include <Project64-rsp-core/Recompiler/RspRecompilerCPU-x64.h>
 #include <Project64-rsp-core/Recompiler/RspRecompilerCPU-x86.h>
 #include <Project64-rsp-core/Settings/RspSettings.h>
 #include <Project64-rsp-core/Settings/RspSettingsID.h>
@@ -18,7 +19,7 @@
 RSP_INFO RSPInfo;
 uint32_t RdramSize = 0;
 
-#if defined(__i386__) || defined(_M_IX86)
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
 void ClearAllx86Code(void);
 #endif
 
@@ -132,11 +133,8 @@ void InitilizeRSP(RSP_INFO & Rsp_Info)
 void RspRomOpened(void)
 {
     CRSPSettings::SetRomOpen(true);
-#if defined(__i386__) || defined(_M_IX86)
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
     ClearAllx86Code();
-#endif
-
-#if defined(__i386__) || defined(_M_IX86)
     JumpTableSize = GetSetting(Set_JumpTableSize);
 #endif
     Mfc0Count = GetSetting(Set_Mfc0Count);
@@ -157,7 +155,7 @@ void RspRomClosed(void)
         GenerateTimerResults();
     }
     RSPSystem.RomClosed();
-#if defined(__i386__) || defined(_M_IX86)
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
     ClearAllx86Code();
 #endif
     RDPLog.StopLog();
@@ -116,19 +116,11 @@ void RspAssembler::CallFunc(void * FunctPtr, const char * FunctName)
     call(asmjit::x86::r11);
 }
 
-#ifdef _MSC_VER
 void RspAssembler::CallThis(void * ThisPtr, void * FunctPtr, const char * FunctName)
 {
-    mov(asmjit::x86::rcx, ThisPtr);
+    mov(RspArgReg1, ThisPtr);
     CallFunc(FunctPtr, FunctName);
 }
-#else
-void CX86Ops::CallThis(uint64_t ThisPtr, uint64_t FunctPtr, const char * FunctName)
-{
-    mov(asmjit::x86::rdi, ThisPtr);
-    CallFunc(FunctPtr, FunctName);
-}
-#endif
 
 void RspAssembler::CompConstToVariable(void * Variable, const char * VariableName, uint32_t Const)
 {
@@ -136,7 +128,16 @@ void RspAssembler::CompConstToVariable(void * Variable, const char * VariableNam
     {
         AddNumberSymbol((uint64_t)Variable, VariableName);
     }
-    cmp(asmjit::x86::dword_ptr((uint64_t)Variable), Const);
+    uint64_t addr = (uint64_t)Variable;
+    if (addr <= 0x7FFFFFFF)
+    {
+        cmp(asmjit::x86::dword_ptr(addr), Const);
+    }
+    else
+    {
+        mov(asmjit::x86::r11, addr);
+        cmp(asmjit::x86::dword_ptr(asmjit::x86::r11), Const);
+    }
 }
 
 void RspAssembler::CompX86regToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg)
@@ -145,7 +146,16 @@ void RspAssembler::CompX86regToVariable(void * Variable, const char * VariableNa
     {
         AddNumberSymbol((uint64_t)Variable, VariableName);
     }
-    cmp(Reg, asmjit::x86::dword_ptr((uint64_t)Variable));
+    uint64_t addr = (uint64_t)Variable;
+    if (addr <= 0x7FFFFFFF)
+    {
+        cmp(Reg, asmjit::x86::dword_ptr(addr));
+    }
+    else
+    {
+        mov(asmjit::x86::r11, addr);
+        cmp(Reg, asmjit::x86::dword_ptr(asmjit::x86::r11));
+    }
 }
 
 void RspAssembler::JeLabel(const char * LabelName, asmjit::Label & JumpLabel)
@@ -217,7 +227,16 @@ void RspAssembler::MoveVariableToX86reg(const asmjit::x86::Gp & Reg, void * Vari
     {
         AddNumberSymbol((uint64_t)Variable, VariableName);
     }
-    mov(Reg, asmjit::x86::dword_ptr((uint64_t)Variable));
+    uint64_t addr = (uint64_t)Variable;
+    if (addr <= 0x7FFFFFFF)
+    {
+        mov(Reg, asmjit::x86::dword_ptr(addr));
+    }
+    else
+    {
+        mov(asmjit::x86::r11, addr);
+        mov(Reg, asmjit::x86::dword_ptr(asmjit::x86::r11));
+    }
 }
 
 void RspAssembler::MoveX86regToVariable(void * Variable, const char * VariableName, const asmjit::x86::Gp & Reg)
@@ -226,7 +245,16 @@ void RspAssembler::MoveX86regToVariable(void * Variable, const char * VariableNa
     {
         AddNumberSymbol((uint64_t)Variable, VariableName);
     }
-    mov(asmjit::x86::dword_ptr((uint64_t)(Variable)), Reg);
+    uint64_t addr = (uint64_t)Variable;
+    if (addr <= 0x7FFFFFFF)
+    {
+        mov(asmjit::x86::dword_ptr(addr), Reg);
+    }
+    else
+    {
+        mov(asmjit::x86::r11, addr);
+        mov(asmjit::x86::dword_ptr(asmjit::x86::r11), Reg);
+    }
 }
 
 void RspAssembler::SetgVariable(void * Variable, const char * VariableName)
@@ -235,7 +263,16 @@ void RspAssembler::SetgVariable(void * Variable, const char * VariableName)
     {
         AddNumberSymbol((uint64_t)Variable, VariableName);
     }
-    setg(asmjit::x86::byte_ptr((uint64_t)Variable));
+    uint64_t addr = (uint64_t)Variable;
+    if (addr <= 0x7FFFFFFF)
+    {
+        setg(asmjit::x86::byte_ptr(addr));
+    }
+    else
+    {
+        mov(asmjit::x86::r11, addr);
+        setg(asmjit::x86::byte_ptr(asmjit::x86::r11));
+    }
 }
 
 void RspAssembler::SetzVariable(void * Variable, const char * VariableName)
@@ -244,7 +281,16 @@ void RspAssembler::SetzVariable(void * Variable, const char * VariableName)
     {
         AddNumberSymbol((uint64_t)Variable, VariableName);
     }
-    setz(asmjit::x86::byte_ptr((uint64_t)Variable));
+    uint64_t addr = (uint64_t)Variable;
+    if (addr <= 0x7FFFFFFF)
+    {
+        setz(asmjit::x86::byte_ptr(addr));
+    }
+    else
+    {
+        mov(asmjit::x86::r11, addr);
+        setz(asmjit::x86::byte_ptr(asmjit::x86::r11));
+    }
 }
 
 void RspAssembler::AddLabelSymbol(const asmjit::Label & Label, const char * Symbol)
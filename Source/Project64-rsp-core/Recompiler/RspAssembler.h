@@ -4,6 +4,16 @@
 #include <Project64-rsp-core/Recompiler/asmjit.h>
 #include <map>
 
+#ifdef _WIN32
+static constexpr asmjit::x86::Gp RspArgReg1 = asmjit::x86::rcx;
+static constexpr asmjit::x86::Gp RspArgReg2 = asmjit::x86::rdx;
+static constexpr asmjit::x86::Gp RspArgReg3 = asmjit::x86::r8;
+#else
+static constexpr asmjit::x86::Gp RspArgReg1 = asmjit::x86::rdi;
+static constexpr asmjit::x86::Gp RspArgReg2 = asmjit::x86::rsi;
+static constexpr asmjit::x86::Gp RspArgReg3 = asmjit::x86::rdx;
+#endif
+
 class RspAssembler :
     public asmjit::x86::Assembler,
     public asmjit::ErrorHandler,
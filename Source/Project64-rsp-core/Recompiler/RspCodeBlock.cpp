@@ -1,6 +1,7 @@
 #include "RspCodeBlock.h"
 #include <Common/StdString.h>
 #include <Project64-rsp-core/cpu/RspSystem.h>
+#include <algorithm>
 
 RspCodeBlock::RspCodeBlock(CRSPSystem & System, uint32_t StartAddress, RspCodeType type, uint32_t EndBlockAddress, RspCodeBlocks & Functions) :
     m_Functions(Functions),
@@ -11,7 +12,14 @@ RspCodeBlock::RspCodeBlock(CRSPSystem & System, uint32_t StartAddress, RspCodeTy
     m_CompiledLoction(nullptr),
     m_Valid(true)
 {
-    Analyze();
+    if (m_CodeType == RspCodeType_BLOCK)
+    {
+        AnalyzeBlock();
+    }
+    else
+    {
+        Analyze();
+    }
 }
 
 const RspCodeBlock::Addresses & RspCodeBlock::GetBranchTargets() const
@@ -161,3 +169,56 @@ void RspCodeBlock::Analyze(void)
         }
     }
 }
+
+// A block runs straight from the start address to the first branch and its delay slot. It also ends
+// after a COP0 write or BREAK, as they can stop the RSP, so the dispatcher gets to check for it.
+void RspCodeBlock::AnalyzeBlock(void)
+{
+    uint8_t * IMEM = m_System.m_IMEM;
+
+    for (uint32_t Address = m_StartAddress; Address < 0x1000; Address += 4)
+    {
+        RSPInstruction Instruction(Address, *(uint32_t *)(IMEM + Address));
+        if (Instruction.IsBranch())
+        {
+            // A delay slot that wraps around IMEM or is a branch itself is left to the interpreter
+            uint32_t DelaySlotAddress = Address + 4;
+            if (DelaySlotAddress == 0x1000)
+            {
+                break;
+            }
+            RSPInstruction DelaySlot(DelaySlotAddress, *(uint32_t *)(IMEM + DelaySlotAddress));
+            if (DelaySlot.IsBranch())
+            {
+                break;
+            }
+            m_Instructions.push_back(Instruction);
+            m_Instructions.push_back(DelaySlot);
+
+            uint32_t Target = (uint32_t)-1;
+            if (Instruction.IsConditionalBranch())
+            {
+                Target = Instruction.ConditionalBranchTarget() & 0xFFC;
+            }
+            else if (Instruction.IsJump())
+            {
+                Target = Instruction.JumpTarget() & 0xFFC;
+            }
+            else if (Instruction.IsStaticCall())
+            {
+                Target = Instruction.StaticCallTarget() & 0xFFC;
+            }
+            if (Target == m_StartAddress)
+            {
+                m_BranchTargets.insert(Target);
+            }
+            break;
+        }
+        m_Instructions.push_back(Instruction);
+        if (Instruction.Flag() == RSPInstructionFlag::MT || Instruction.Flag() == RSPInstructionFlag::Break)
+        {
+            break;
+        }
+    }
+    m_Valid = !m_Instructions.empty();
+}
@@ -12,6 +12,7 @@ enum RspCodeType
 {
     RspCodeType_TASK,
     RspCodeType_SUBROUTINE,
+    RspCodeType_BLOCK,
 };
 
 class RspCodeBlock;
@@ -44,6 +45,7 @@ private:
     RspCodeBlock & operator=(const RspCodeBlock &);
 
     void Analyze();
+    void AnalyzeBlock();
 
     RspCodeBlocks & m_Functions;
     const uint32_t m_EndBlockAddress;
@@ -0,0 +1,159 @@
+#include "RspCodeCache.h"
+#include <Project64-rsp-core/cpu/RspLog.h>
+#include <algorithm>
+#include <string.h>
+
+CRspCodeCache RspCodeCache;
+
+static const uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+
+static inline uint64_t Mix(uint64_t Acc, uint64_t Input)
+{
+    Acc += Input * Prime2;
+    Acc = (Acc << 31) | (Acc >> 33);
+    return Acc * Prime1;
+}
+
+CRspCodeCache::CRspCodeCache() :
+    m_Generation(0),
+    m_NextId(0),
+    m_IMEMWritten(true)
+{
+    memset(&m_Stats, 0, sizeof(m_Stats));
+    memset(m_ActiveIMEM, 0, sizeof(m_ActiveIMEM));
+}
+
+void ** CRspCodeCache::Lookup(const uint8_t * IMEM, uint32_t Length)
+{
+    if (Length > IMEMSize)
+    {
+        Length = IMEMSize;
+    }
+    if (!m_Maps.empty() && m_Maps.front().Key.Length == Length &&
+        (!m_IMEMWritten || memcmp(m_ActiveIMEM, IMEM, Length) == 0))
+    {
+        m_IMEMWritten = false;
+        m_Stats.Hits += 1;
+        CodeMap & Map = m_Maps.front();
+        Map.LastUsed = m_Generation;
+        return Map.JumpTable.data();
+    }
+
+    MapKey Key = {Length, HashIMEM(IMEM, Length)};
+    m_Stats.Hashes += 1;
+    memcpy(m_ActiveIMEM, IMEM, Length);
+    m_IMEMWritten = false;
+    if (m_Maps.empty() || !(m_Maps.front().Key == Key))
+    {
+        MapIndex::iterator itr = m_Index.find(Key);
+        if (itr != m_Index.end())
+        {
+            m_Maps.splice(m_Maps.begin(), m_Maps, itr->second);
+            m_Stats.Hits += 1;
+        }
+        else
+        {
+            CodeMap Map;
+            Map.Key = Key;
+            Map.Id = m_NextId++;
+            Map.JumpTable.resize(JumpTableEntries, nullptr);
+            m_Maps.push_front(std::move(Map));
+            m_Index[Key] = m_Maps.begin();
+            m_Stats.Misses += 1;
+        }
+    }
+    else
+    {
+        m_Stats.Hits += 1;
+    }
+
+    CodeMap & Map = m_Maps.front();
+    Map.LastUsed = m_Generation;
+    return Map.JumpTable.data();
+}
+
+// IMEM has been loaded by a DMA, or may have been written by the CPU while the RSP was halted
+void CRspCodeCache::IMEMWritten(void)
+{
+    m_IMEMWritten = true;
+}
+
+uint32_t CRspCodeCache::ActiveMapId(void) const
+{
+    return m_Maps.empty() ? 0 : m_Maps.front().Id;
+}
+
+// The code buffer is about to be reused, so every jump table is emptied. Maps are kept in most
+// recently used order, so the ones that have not been used since the last flush are at the back.
+void CRspCodeCache::Flush(void)
+{
+    while (m_Maps.size() > 1 && m_Maps.back().LastUsed != m_Generation)
+    {
+        m_Index.erase(m_Maps.back().Key);
+        m_Maps.pop_back();
+        m_Stats.Evictions += 1;
+    }
+    for (CodeMaps::iterator itr = m_Maps.begin(); itr != m_Maps.end(); itr++)
+    {
+        std::fill(itr->JumpTable.begin(), itr->JumpTable.end(), nullptr);
+    }
+    m_Generation += 1;
+    m_Stats.Flushes += 1;
+}
+
+// Drops every map but the active one, which is emptied so JumpTable still points at valid memory
+void CRspCodeCache::Reset(void)
+{
+    LogStats();
+    while (m_Maps.size() > 1)
+    {
+        m_Index.erase(m_Maps.back().Key);
+        m_Maps.pop_back();
+    }
+    if (!m_Maps.empty())
+    {
+        std::fill(m_Maps.front().JumpTable.begin(), m_Maps.front().JumpTable.end(), nullptr);
+    }
+    m_IMEMWritten = true;
+    memset(&m_Stats, 0, sizeof(m_Stats));
+}
+
+void CRspCodeCache::LogStats(void) const
+{
+    if (m_Stats.Hits == 0 && m_Stats.Misses == 0)
+    {
+        return;
+    }
+    CPU_Message("Code cache: %u maps, %llu hits, %llu misses, %llu hashes, %llu evictions, %llu flushes", MapCount(),
+                (unsigned long long)m_Stats.Hits, (unsigned long long)m_Stats.Misses, (unsigned long long)m_Stats.Hashes,
+                (unsigned long long)m_Stats.Evictions, (unsigned long long)m_Stats.Flushes);
+}
+
+// Four independent lanes so the multiplies overlap; IMEM is only ever loaded in multiples of 8 bytes
+uint64_t CRspCodeCache::HashIMEM(const uint8_t * IMEM, uint32_t Length)
+{
+    uint64_t v1 = Prime1 + Prime2, v2 = Prime2, v3 = 0, v4 = 0 - Prime1;
+    uint64_t Words[4];
+
+    uint32_t Pos = 0;
+    for (; Pos + 32 <= Length; Pos += 32)
+    {
+        memcpy(Words, IMEM + Pos, sizeof(Words));
+        v1 = Mix(v1, Words[0]);
+        v2 = Mix(v2, Words[1]);
+        v3 = Mix(v3, Words[2]);
+        v4 = Mix(v4, Words[3]);
+    }
+    for (; Pos + 8 <= Length; Pos += 8)
+    {
+        memcpy(Words, IMEM + Pos, sizeof(Words[0]));
+        v1 = Mix(v1, Words[0]);
+    }
+
+    uint64_t Hash = Mix(Mix(Mix(v1, v2), v3), v4) ^ Length;
+    Hash ^= Hash >> 33;
+    Hash *= Prime2;
+    Hash ^= Hash >> 29;
+    return Hash;
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <list>
+#include <stddef.h>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+// Jump tables for every microcode the recompiler has seen. A microcode is identified by the length
+// of IMEM that was loaded and a 64-bit hash of that IMEM, so the same code gets the same map however
+// it got there. IMEM is only hashed again after it may have been written and no longer matches a
+// copy of what the active map was identified from.
+// There is no limit on the number of maps; when the code buffer has to be flushed, maps that were
+// not used since the previous flush are evicted and the rest keep their identity.
+class CRspCodeCache
+{
+public:
+    enum
+    {
+        JumpTableEntries = 0x400, // One entry per instruction in IMEM
+        IMEMSize = 0x1000,
+    };
+
+    struct CacheStats
+    {
+        uint64_t Hits;
+        uint64_t Misses;
+        uint64_t Evictions;
+        uint64_t Flushes;
+        uint64_t Hashes;
+    };
+
+    CRspCodeCache();
+
+    void ** Lookup(const uint8_t * IMEM, uint32_t Length);
+    void IMEMWritten(void);
+    uint32_t ActiveMapId(void) const;
+    void Flush(void);
+    void Reset(void);
+    void LogStats(void) const;
+
+    const CacheStats & Stats(void) const
+    {
+        return m_Stats;
+    }
+    uint32_t MapCount(void) const
+    {
+        return (uint32_t)m_Maps.size();
+    }
+
+    static uint64_t HashIMEM(const uint8_t * IMEM, uint32_t Length);
+
+private:
+    CRspCodeCache(const CRspCodeCache &);
+    CRspCodeCache & operator=(const CRspCodeCache &);
+
+    struct MapKey
+    {
+        uint32_t Length;
+        uint64_t Hash;
+
+        bool operator==(const MapKey & rhs) const
+        {
+            return Hash == rhs.Hash && Length == rhs.Length;
+        }
+    };
+
+    struct MapKeyHash
+    {
+        size_t operator()(const MapKey & Key) const
+        {
+            return (size_t)Key.Hash;
+        }
+    };
+
+    struct CodeMap
+    {
+        MapKey Key;
+        uint32_t Id;
+        uint32_t LastUsed;
+        std::vector<void *> JumpTable;
+    };
+
+    typedef std::list<CodeMap> CodeMaps;
+    typedef std::unordered_map<MapKey, CodeMaps::iterator, MapKeyHash> MapIndex;
+
+    CodeMaps m_Maps; // Most recently used first
+    MapIndex m_Index;
+    CacheStats m_Stats;
+    uint32_t m_Generation;
+    uint32_t m_NextId;
+    bool m_IMEMWritten;
+    uint8_t m_ActiveIMEM[IMEMSize]; // IMEM the front map was identified from
+};
+
+extern CRspCodeCache RspCodeCache;
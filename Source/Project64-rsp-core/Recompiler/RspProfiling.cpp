@@ -6,74 +6,94 @@
 #include <Common/Log.h>
 #include <Common/StdString.h>
 #include <Common/path.h>
+#include <Project64-rsp-core/Recompiler/RspCodeCache.h>
 #include <Project64-rsp-core/Settings/RspSettings.h>
+#include <Project64-rsp-core/cpu/RspSystem.h>
 #include <Settings/Settings.h>
+#include <algorithm>
 #include <chrono>
-#include <intrin.h>
 #include <map>
-#include <thread>
 #include <vector>
-#ifdef WIN32
-#include <Windows.h>
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
 #endif
 
+// The time stamp counter is read on every block entry and exit, so it has to be cheap. It is
+// converted to wall time using the rate it ran at since the counters were last reset.
+static inline uint64_t ReadTimeStamp(void)
+{
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    _mm_lfence();
+    uint64_t Value = __rdtsc();
+    _mm_lfence();
+    return Value;
+#elif defined(__aarch64__)
+    uint64_t Value;
+    asm volatile("isb; mrs %0, cntvct_el0"
+                 : "=r"(Value));
+    return Value;
+#else
+    return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+static inline int64_t ReadWallTime(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 class CRspProfiling
 {
-    typedef std::map<uint32_t, int64_t> PROFILE_ENRTIES;
-    typedef PROFILE_ENRTIES::iterator PROFILE_ENRTY;
-    typedef PROFILE_ENRTIES::value_type PROFILE_VALUE;
+    struct PROFILE_TOTALS
+    {
+        uint64_t Calls;
+        uint64_t Cycles;
+        int64_t WallTime; // Nanoseconds, only measured for whole tasks
+    };
+
+    typedef std::pair<uint64_t, uint32_t> BLOCK_KEY;         // Microcode, address
+    typedef std::pair<uint64_t, uint32_t> MICROCODE_KEY;     // Microcode, task type
+    typedef std::pair<uint32_t, RSP_PROFILE_EXEC> TASK_KEY; // Task type, how it was run
+    typedef std::map<BLOCK_KEY, PROFILE_TOTALS> BLOCK_ENTRIES;
+    typedef std::map<MICROCODE_KEY, PROFILE_TOTALS> MICROCODE_ENTRIES;
+    typedef std::map<TASK_KEY, PROFILE_TOTALS> TASK_ENTRIES;
+
     typedef struct
     {
         SPECIAL_TIMERS Timer;
-        char * Name;
+        const char * Name;
     } TIMER_NAME;
 
-    uint32_t m_CurrentTimerAddr, CurrentDisplayCount;
-#if defined(_M_IX86) && defined(_MSC_VER)
-    uint32_t m_StartTimeHi, m_StartTimeLo; // The current timer start time
-#else
+    uint32_t m_CurrentTimerAddr;
+    uint64_t m_CurrentMicrocode;
     uint64_t m_StartTime;
-#endif
-    PROFILE_ENRTIES m_Entries;
-    double m_CpuFrequencyGHz;
+    uint64_t m_CalibrationCycles;
+    int64_t m_CalibrationTime;
+    uint64_t m_IdleCyclesSkipped;
+    uint32_t m_IdleLoopExits;
+    BLOCK_ENTRIES m_Blocks;
+    MICROCODE_ENTRIES m_Microcodes;
+    TASK_ENTRIES m_Tasks;
 
 public:
-    CRspProfiling()
+    CRspProfiling() :
+        m_CurrentTimerAddr(Timer_None),
+        m_CurrentMicrocode(0),
+        m_StartTime(0)
     {
-        m_CurrentTimerAddr = Timer_None;
-#ifdef WIN32
-        LARGE_INTEGER frequency;
-        QueryPerformanceFrequency(&frequency);
-        m_CpuFrequencyGHz = MeasureCpuFrequencyGHz();
-#else
-        g_Notify->BreakPoint(__FILE__, __LINE__);
-        m_CpuFrequencyGHz = 0;
-#endif
+        ResetCounters();
     }
 
     uint32_t StartTimer(uint32_t Address)
     {
         uint32_t OldTimerAddr = StopTimer();
         m_CurrentTimerAddr = Address;
-
-#if defined(_M_IX86) && defined(_MSC_VER)
-        uint32_t HiValue, LoValue;
-        _asm {
-			pushad
-			rdtsc
-			mov HiValue, edx
-			mov LoValue, eax
-			popad
-        }
-        m_StartTimeHi = HiValue;
-        m_StartTimeLo = LoValue;
-#else
-        _mm_lfence();
-        m_StartTime = __rdtsc();
-        _mm_lfence();
-#endif
+        m_StartTime = ReadTimeStamp();
         return OldTimerAddr;
     }
+
     uint32_t StopTimer(void)
     {
         if (m_CurrentTimerAddr == Timer_None)
@@ -81,128 +101,207 @@ public:
             return m_CurrentTimerAddr;
         }
 
-#if defined(_M_IX86) && defined(_MSC_VER)
-        uint32_t HiValue, LoValue;
-        _asm {
-			pushad
-			rdtsc
-			mov HiValue, edx
-			mov LoValue, eax
-			popad
-        }
-
-        int64_t StopTime = ((uint64_t)HiValue << 32) + (uint64_t)LoValue;
-        int64_t StartTime = ((uint64_t)m_StartTimeHi << 32) + (uint64_t)m_StartTimeLo;
-        int64_t TimeTaken = StopTime - StartTime;
-#else
-        _mm_lfence();
-        uint64_t currentTime = __rdtsc();
-        _mm_lfence();
-        int64_t TimeTaken = currentTime - m_StartTime;
-#endif
-        PROFILE_ENRTY Entry = m_Entries.find(m_CurrentTimerAddr);
-        if (Entry != m_Entries.end())
-        {
-            Entry->second += TimeTaken;
-        }
-        else
-        {
-            m_Entries.insert(PROFILE_ENRTIES::value_type(m_CurrentTimerAddr, TimeTaken));
-        }
+        uint64_t TimeTaken = ReadTimeStamp() - m_StartTime;
+        int32_t Address = (int32_t)m_CurrentTimerAddr;
+        PROFILE_TOTALS & Entry = m_Blocks[BLOCK_KEY(Address < 0 ? 0 : m_CurrentMicrocode, m_CurrentTimerAddr)];
+        Entry.Calls += 1;
+        Entry.Cycles += TimeTaken;
 
         uint32_t OldTimerAddr = m_CurrentTimerAddr;
         m_CurrentTimerAddr = Timer_None;
         return OldTimerAddr;
     }
 
-    void ResetCounters(void)
+    void SetMicrocode(uint64_t Microcode)
     {
-        m_Entries.clear();
+        m_CurrentMicrocode = Microcode;
     }
 
-    double ConvertCyclesToMilliseconds(uint64_t cycles, double cpuFreqGHz)
+    void AddTask(uint32_t TaskType, uint64_t Microcode, RSP_PROFILE_EXEC Exec, uint64_t Cycles, int64_t WallTime)
     {
-        return (cycles / (cpuFreqGHz * 1e9)) * 1000.0;
+        PROFILE_TOTALS & Task = m_Tasks[TASK_KEY(TaskType, Exec)];
+        Task.Calls += 1;
+        Task.Cycles += Cycles;
+        Task.WallTime += WallTime;
+
+        PROFILE_TOTALS & Ucode = m_Microcodes[MICROCODE_KEY(Microcode, TaskType)];
+        Ucode.Calls += 1;
+        Ucode.Cycles += Cycles;
+        Ucode.WallTime += WallTime;
     }
 
-    double MeasureCpuFrequencyGHz()
+    void ResetCounters(void)
     {
-        DWORD_PTR oldMask = SetThreadAffinityMask(GetCurrentThread(), 1);
-        auto start_time = std::chrono::high_resolution_clock::now();
-        uint64_t start_cycles = __rdtsc();
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
-        uint64_t end_cycles = __rdtsc();
-        auto end_time = std::chrono::high_resolution_clock::now();
-        SetThreadAffinityMask(GetCurrentThread(), oldMask);
-        double elapsed_seconds = std::chrono::duration<double>(end_time - start_time).count();
-        uint64_t elapsed_cycles = end_cycles - start_cycles;
-        return static_cast<double>(elapsed_cycles) / (elapsed_seconds * 1e9);
+        m_Blocks.clear();
+        m_Microcodes.clear();
+        m_Tasks.clear();
+        m_CalibrationCycles = ReadTimeStamp();
+        m_CalibrationTime = ReadWallTime();
+        m_IdleCyclesSkipped = RSPSystem.IdleCyclesSkipped();
+        m_IdleLoopExits = RSPSystem.IdleLoopExits();
     }
+
     void GenerateLog(void)
     {
-        stdstr LogFileName;
+        char LogDir[260];
+        GetSystemSettingSz(Set_DirectoryLog, LogDir, sizeof(LogDir));
+
+        double CyclesPerMs = 0;
+        int64_t Elapsed = ReadWallTime() - m_CalibrationTime;
+        if (Elapsed > 0)
         {
-            char LogDir[260];
-            CPath LogFilePath(GetSystemSettingSz(Set_DirectoryLog, LogDir, sizeof(LogDir)), "RSP_Profiling.txt");
+            CyclesPerMs = (double)(ReadTimeStamp() - m_CalibrationCycles) / ((double)Elapsed / 1000000.0);
+        }
 
-            CLog Log;
-            Log.Open(LogFilePath);
-            LogFileName = Log.FileName();
+        GenerateTextLog(CPath(LogDir, "RSP_Profiling.txt"), CyclesPerMs);
+        GenerateCsvLog(CPath(LogDir, "RSP_Profiling.csv"), CyclesPerMs);
+        GenerateJsonLog(CPath(LogDir, "RSP_Profiling.json"), CyclesPerMs);
+        ResetCounters();
+    }
 
-            // Get the total time
-            int64_t TotalTime = 0;
-            for (PROFILE_ENRTY itemTime = m_Entries.begin(); itemTime != m_Entries.end(); itemTime++)
-            {
-                TotalTime += itemTime->second;
-            }
+private:
+    template <typename ENTRIES>
+    static std::vector<typename ENTRIES::const_iterator> SortedByCycles(const ENTRIES & Entries, uint64_t & TotalCycles)
+    {
+        std::vector<typename ENTRIES::const_iterator> ItemList;
+        TotalCycles = 0;
+        for (typename ENTRIES::const_iterator itr = Entries.begin(); itr != Entries.end(); itr++)
+        {
+            TotalCycles += itr->second.Cycles;
+            ItemList.push_back(itr);
+        }
+        std::sort(ItemList.begin(), ItemList.end(), [](const typename ENTRIES::const_iterator & a, const typename ENTRIES::const_iterator & b)
+                  { return a->second.Cycles > b->second.Cycles; });
+        return ItemList;
+    }
 
-            // Create a sortable list of items
-            std::vector<PROFILE_VALUE *> ItemList;
-            for (PROFILE_ENRTY Entry = m_Entries.begin(); Entry != m_Entries.end(); Entry++)
-            {
-                ItemList.push_back(&(*Entry));
-            }
+    static double Percent(uint64_t Cycles, uint64_t TotalCycles)
+    {
+        return TotalCycles != 0 ? ((double)Cycles / (double)TotalCycles) * 100 : 0;
+    }
 
-            // Sort the list with a basic bubble sort
-            if (ItemList.size() > 0)
+    static double Milliseconds(const PROFILE_TOTALS & Totals, double CyclesPerMs)
+    {
+        if (Totals.WallTime != 0)
+        {
+            return (double)Totals.WallTime / 1000000.0;
+        }
+        return CyclesPerMs != 0 ? (double)Totals.Cycles / CyclesPerMs : 0;
+    }
+
+    static const char * ExecName(RSP_PROFILE_EXEC Exec)
+    {
+        switch (Exec)
+        {
+        case ProfileExec_HLE: return "hle";
+        case ProfileExec_TaskRecompiler: return "task recompiler";
+        }
+        return "lle";
+    }
+
+    static stdstr BlockName(uint32_t Address)
+    {
+        static const TIMER_NAME TimerNames[] = {
+            {Timer_Compiling, "Compiling"},
+            {Timer_RSP_Running, "RSP: Running"},
+            {Timer_RDP_Running, "RDP: Running"},
+        };
+
+        for (size_t NameID = 0; NameID < (sizeof(TimerNames) / sizeof(TIMER_NAME)); NameID++)
+        {
+            if (Address == (uint32_t)TimerNames[NameID].Timer)
             {
-                for (size_t OuterPass = 0; OuterPass < (ItemList.size() - 1); OuterPass++)
-                {
-                    for (size_t InnerPass = 0; InnerPass < (ItemList.size() - 1); InnerPass++)
-                    {
-                        if (ItemList[InnerPass]->second < ItemList[InnerPass + 1]->second)
-                        {
-                            PROFILE_VALUE * TempPtr = ItemList[InnerPass];
-                            ItemList[InnerPass] = ItemList[InnerPass + 1];
-                            ItemList[InnerPass + 1] = TempPtr;
-                        }
-                    }
-                }
+                return TimerNames[NameID].Name;
             }
+        }
+        return stdstr_f("Function 0x%08X", Address);
+    }
 
-            TIMER_NAME TimerNames[] = {
-                {Timer_Compiling, "Compiling"},
-                {Timer_RSP_Running, "RSP: Running"},
-                {Timer_RDP_Running, "RDP: Running"},
-            };
+    void GenerateTextLog(const char * FileName, double CyclesPerMs)
+    {
+        CLog Log;
+        Log.Open(FileName);
 
-            for (size_t i = 0; i < ItemList.size(); i++)
+        uint64_t TotalCycles;
+        std::vector<BLOCK_ENTRIES::const_iterator> ItemList = SortedByCycles(m_Blocks, TotalCycles);
+        for (size_t i = 0; i < ItemList.size(); i++)
+        {
+            const PROFILE_TOTALS & Totals = ItemList[i]->second;
+            stdstr Name = BlockName(ItemList[i]->first.second);
+            if (ItemList[i]->first.first != 0)
             {
-                float CpuUsage = (float)(((double)ItemList[i]->second / (double)TotalTime) * 100);
-
-                stdstr_f name("Function 0x%08X", ItemList[i]->first);
-                for (int NameID = 0; NameID < (sizeof(TimerNames) / sizeof(TIMER_NAME)); NameID++)
-                {
-                    if (ItemList[i]->first == (uint32_t)TimerNames[NameID].Timer)
-                    {
-                        name = TimerNames[NameID].Name;
-                        break;
-                    }
-                }
-                Log.LogF("%s\t%2.2f\t%llu\t%2.2f\n", name.c_str(), CpuUsage, ItemList[i]->second, ConvertCyclesToMilliseconds(ItemList[i]->second, m_CpuFrequencyGHz));
+                Name += stdstr_f(" [%016llX]", ItemList[i]->first.first);
             }
+            Log.LogF("%s\t%2.2f\t%llu\t%2.2f\n", Name.c_str(), Percent(Totals.Cycles, TotalCycles), Totals.Cycles, Milliseconds(Totals, CyclesPerMs));
         }
-        ResetCounters();
+        Log.LogF("\nIdle loops: %u exits, %llu cycles skipped\n", RSPSystem.IdleLoopExits() - m_IdleLoopExits, RSPSystem.IdleCyclesSkipped() - m_IdleCyclesSkipped);
+    }
+
+    void GenerateCsvLog(const char * FileName, double CyclesPerMs)
+    {
+        CLog Log;
+        Log.SetMaxFileSize(0xFFFFFFFF);
+        Log.Open(FileName);
+        Log.Log("kind,task_type,exec,microcode,address,calls,cycles,ms,percent\n");
+
+        uint64_t TotalCycles;
+        std::vector<TASK_ENTRIES::const_iterator> Tasks = SortedByCycles(m_Tasks, TotalCycles);
+        for (size_t i = 0; i < Tasks.size(); i++)
+        {
+            const PROFILE_TOTALS & Totals = Tasks[i]->second;
+            Log.LogF("task,%u,%s,,,%llu,%llu,%.4f,%.2f\n", Tasks[i]->first.first, ExecName(Tasks[i]->first.second), Totals.Calls, Totals.Cycles, Milliseconds(Totals, CyclesPerMs), Percent(Totals.Cycles, TotalCycles));
+        }
+
+        std::vector<MICROCODE_ENTRIES::const_iterator> Microcodes = SortedByCycles(m_Microcodes, TotalCycles);
+        for (size_t i = 0; i < Microcodes.size(); i++)
+        {
+            const PROFILE_TOTALS & Totals = Microcodes[i]->second;
+            Log.LogF("microcode,%u,,%016llX,,%llu,%llu,%.4f,%.2f\n", Microcodes[i]->first.second, Microcodes[i]->first.first, Totals.Calls, Totals.Cycles, Milliseconds(Totals, CyclesPerMs), Percent(Totals.Cycles, TotalCycles));
+        }
+
+        std::vector<BLOCK_ENTRIES::const_iterator> Blocks = SortedByCycles(m_Blocks, TotalCycles);
+        for (size_t i = 0; i < Blocks.size(); i++)
+        {
+            const PROFILE_TOTALS & Totals = Blocks[i]->second;
+            Log.LogF("block,,,%016llX,%s,%llu,%llu,%.4f,%.2f\n", Blocks[i]->first.first, BlockName(Blocks[i]->first.second).c_str(), Totals.Calls, Totals.Cycles, Milliseconds(Totals, CyclesPerMs), Percent(Totals.Cycles, TotalCycles));
+        }
+    }
+
+    void GenerateJsonLog(const char * FileName, double CyclesPerMs)
+    {
+        CLog Log;
+        Log.SetMaxFileSize(0xFFFFFFFF);
+        Log.Open(FileName);
+        Log.LogF("{\n  \"cycles_per_ms\": %.1f,\n", CyclesPerMs);
+        Log.LogF("  \"idle_loops\": {\"exits\": %u, \"cycles_skipped\": %llu},\n  \"tasks\": [", RSPSystem.IdleLoopExits() - m_IdleLoopExits, RSPSystem.IdleCyclesSkipped() - m_IdleCyclesSkipped);
+
+        uint64_t TotalCycles;
+        std::vector<TASK_ENTRIES::const_iterator> Tasks = SortedByCycles(m_Tasks, TotalCycles);
+        for (size_t i = 0; i < Tasks.size(); i++)
+        {
+            const PROFILE_TOTALS & Totals = Tasks[i]->second;
+            Log.LogF("%s\n    {\"task_type\": %u, \"exec\": \"%s\", \"calls\": %llu, \"cycles\": %llu, \"ms\": %.4f, \"percent\": %.2f}", i == 0 ? "" : ",",
+                     Tasks[i]->first.first, ExecName(Tasks[i]->first.second), Totals.Calls, Totals.Cycles, Milliseconds(Totals, CyclesPerMs), Percent(Totals.Cycles, TotalCycles));
+        }
+        Log.Log("\n  ],\n  \"microcodes\": [");
+
+        std::vector<MICROCODE_ENTRIES::const_iterator> Microcodes = SortedByCycles(m_Microcodes, TotalCycles);
+        for (size_t i = 0; i < Microcodes.size(); i++)
+        {
+            const PROFILE_TOTALS & Totals = Microcodes[i]->second;
+            Log.LogF("%s\n    {\"hash\": \"%016llX\", \"task_type\": %u, \"calls\": %llu, \"cycles\": %llu, \"ms\": %.4f, \"percent\": %.2f}", i == 0 ? "" : ",",
+                     Microcodes[i]->first.first, Microcodes[i]->first.second, Totals.Calls, Totals.Cycles, Milliseconds(Totals, CyclesPerMs), Percent(Totals.Cycles, TotalCycles));
+        }
+        Log.Log("\n  ],\n  \"blocks\": [");
+
+        std::vector<BLOCK_ENTRIES::const_iterator> Blocks = SortedByCycles(m_Blocks, TotalCycles);
+        for (size_t i = 0; i < Blocks.size(); i++)
+        {
+            const PROFILE_TOTALS & Totals = Blocks[i]->second;
+            Log.LogF("%s\n    {\"microcode\": \"%016llX\", \"name\": \"%s\", \"calls\": %llu, \"cycles\": %llu, \"ms\": %.4f, \"percent\": %.2f}", i == 0 ? "" : ",",
+                     Blocks[i]->first.first, BlockName(Blocks[i]->first.second).c_str(), Totals.Calls, Totals.Cycles, Milliseconds(Totals, CyclesPerMs), Percent(Totals.Cycles, TotalCycles));
+        }
+        Log.Log("\n  ]\n}\n");
     }
 };
 
@@ -230,4 +329,33 @@ void StopTimer(void)
 void GenerateTimerResults(void)
 {
     GetProfiler().GenerateLog();
-}
\ No newline at end of file
+}
+
+CRspTaskTimer::CRspTaskTimer(const uint8_t * DMEM, const uint8_t * IMEM) :
+    m_Active(Profiling),
+    m_TaskType(0),
+    m_Microcode(0),
+    m_Exec(ProfileExec_LLE),
+    m_StartCycles(0),
+    m_StartTime(0)
+{
+    if (!m_Active)
+    {
+        return;
+    }
+    m_TaskType = *(const uint32_t *)(DMEM + 0xFC0);
+    m_Microcode = CRspCodeCache::HashIMEM(IMEM, 0x1000);
+    GetProfiler().SetMicrocode(m_Microcode);
+    m_StartTime = ReadWallTime();
+    m_StartCycles = ReadTimeStamp();
+}
+
+CRspTaskTimer::~CRspTaskTimer()
+{
+    if (!m_Active)
+    {
+        return;
+    }
+    uint64_t Cycles = ReadTimeStamp() - m_StartCycles;
+    GetProfiler().AddTask(m_TaskType, m_Microcode, m_Exec, Cycles, ReadWallTime() - m_StartTime);
+}
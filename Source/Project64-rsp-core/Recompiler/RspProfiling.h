@@ -9,7 +9,40 @@ enum SPECIAL_TIMERS
     Timer_RDP_Running = -3,
 };
 
+enum RSP_PROFILE_EXEC
+{
+    ProfileExec_LLE,
+    ProfileExec_HLE,
+    ProfileExec_TaskRecompiler,
+};
+
 void ResetTimerList(void);
 uint32_t StartTimer(uint32_t Address);
 void StopTimer(void);
 void GenerateTimerResults(void);
+
+// Times one call of DoRspCycles as a whole, by task type and by the microcode in IMEM when it
+// started. Does nothing unless profiling is on.
+class CRspTaskTimer
+{
+public:
+    CRspTaskTimer(const uint8_t * DMEM, const uint8_t * IMEM);
+    ~CRspTaskTimer();
+
+    void SetExec(RSP_PROFILE_EXEC Exec)
+    {
+        m_Exec = Exec;
+    }
+
+private:
+    CRspTaskTimer(void);
+    CRspTaskTimer(const CRspTaskTimer &);
+    CRspTaskTimer & operator=(const CRspTaskTimer &);
+
+    bool m_Active;
+    uint32_t m_TaskType;
+    uint64_t m_Microcode;
+    RSP_PROFILE_EXEC m_Exec;
+    uint64_t m_StartCycles;
+    int64_t m_StartTime;
+};
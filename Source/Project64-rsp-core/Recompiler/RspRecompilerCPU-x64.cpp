@@ -3,17 +3,23 @@
 #include "RspRecompilerCPU-x64.h"
 #include "RspCodeBlock.h"
 #include <Common/Log.h>
+#include <Common/Platform.h>
 #include <Common/StdString.h>
 #include <Project64-rsp-core/Recompiler/RspAssembler.h>
+#include <Project64-rsp-core/Recompiler/RspCodeCache.h>
 #include <Project64-rsp-core/Recompiler/RspCodeBlock.h>
 #include <Project64-rsp-core/Recompiler/RspProfiling.h>
 #include <Project64-rsp-core/Settings/RspSettings.h>
+#include <Project64-rsp-core/cpu/RSPCpu.h>
+#include <Project64-rsp-core/cpu/RSPRegisterHandlerPlugin.h>
 #include <Project64-rsp-core/cpu/RspMemory.h>
 #include <Project64-rsp-core/cpu/RspSystem.h>
 #include <Settings/Settings.h>
 
 extern CLog * CPULog;
 
+uint32_t JumpTableSize;
+
 p_Recompfunc RSP_Recomp_Opcode[64];
 p_Recompfunc RSP_Recomp_RegImm[32];
 p_Recompfunc RSP_Recomp_Special[64];
@@ -437,10 +443,106 @@ void CRSPRecompiler::Reset()
     }
 }
 
+void CRSPRecompiler::RunCPU(void)
+{
+    RSP_Running = true;
+    // The CPU can load IMEM between tasks without the RSP seeing it
+    RspCodeCache.IMEMWritten();
+    SetJumpTable(JumpTableSize);
+
+    while (RSP_Running)
+    {
+        // Branches that were left half done by the interpreter are finished by it
+        if (m_System.m_NextInstruction != RSPPIPELINE_NORMAL)
+        {
+            m_System.ExecuteOps(1, (uint32_t)-1);
+            continue;
+        }
+
+        uint32_t Address = *m_System.m_SP_PC_REG & 0xFFC;
+        void * Block = JumpTable[Address >> 2];
+        if (Block == nullptr)
+        {
+            if (Profiling && !IndvidualBlock)
+            {
+                StartTimer((uint32_t)Timer_Compiling);
+            }
+            Block = CompileBlock(Address);
+            if (Profiling && !IndvidualBlock)
+            {
+                StopTimer();
+            }
+        }
+
+        if (Block == nullptr)
+        {
+            m_System.ExecuteOps(1, (uint32_t)-1);
+            continue;
+        }
+
+        if (Profiling && IndvidualBlock)
+        {
+            StartTimer(Address);
+        }
+        ((void (*)(void))Block)();
+        if (Profiling && IndvidualBlock)
+        {
+            StopTimer();
+        }
+    }
+}
+
+void CRSPRecompiler::SetJumpTable(uint32_t End)
+{
+    if (End < 0x800)
+    {
+        End = 0x800;
+    }
+
+    if (End == 0x1000 && ((m_System.m_RSPRegisterHandler->PendingSPMemAddr() & 0x0FFF) & ~7) == 0x80)
+    {
+        End = 0x800;
+    }
+
+    JumpTable = RspCodeCache.Lookup(m_System.m_IMEM, End);
+    Table = RspCodeCache.ActiveMapId();
+}
+
+void * CRSPRecompiler::CompileBlock(uint32_t Address)
+{
+    if ((uint32_t)(RecompPos - RecompCode) > RecompCodeSize - 0x40000)
+    {
+        ResetJumpTables();
+    }
+
+    RspCodeBlock CodeInfo(m_System, Address, RspCodeType_BLOCK, 0x1000, m_BlockFunctions);
+    if (!CodeInfo.IsValid())
+    {
+        return nullptr;
+    }
+    CompileCodeBlock(CodeInfo);
+    JumpTable[Address >> 2] = CodeInfo.GetCompiledLocation();
+    return JumpTable[Address >> 2];
+}
+
+void CRSPRecompiler::ResetJumpTables(void)
+{
+    RspCodeCache.Flush();
+    RecompPos = RecompCode;
+}
+
+// HLE tasks keep pointers to their compiled code, so only the block jump tables are dropped here
+void ClearAllx86Code(void)
+{
+    RspCodeCache.Reset();
+}
+
 void CRSPRecompiler::CompileCodeBlock(RspCodeBlock & block)
 {
     SetupRspAssembler();
     m_CurrentBlock = &block;
+    m_NextInstruction = RSPPIPELINE_NORMAL;
+    m_BranchTargets.clear();
 
     void * funcPtr = RecompPos;
     m_CompilePC = block.GetStartAddress();
@@ -519,6 +621,15 @@ void CRSPRecompiler::CompileCodeBlock(RspCodeBlock & block)
         }
     }
 
+    if (block.CodeType() == RspCodeType_BLOCK)
+    {
+        size_t instructionCount = instructions.size();
+        if (instructionCount < 2 || !instructions[instructionCount - 2].IsBranch())
+        {
+            m_RecompilerOps.CompileBlockExit((instructions[instructionCount - 1].Address() + 4) & 0xFFC);
+        }
+    }
+
     block.SetCompiledLocation(funcPtr);
     m_CodeHolder.relocateToBase((uint64_t)funcPtr);
     size_t codeSize = m_CodeHolder.codeSize();
@@ -579,12 +690,12 @@ void * CRSPRecompiler::CompileHLETask(uint32_t Address, RspCodeBlocks & Function
         m_Assembler->sub(asmjit::x86::rsp, 0x30);
         if (Profiling)
         {
-            m_Assembler->mov(asmjit::x86::rcx, asmjit::imm((uintptr_t)Address));
+            m_Assembler->mov(RspArgReg1, asmjit::imm((uintptr_t)Address));
             m_Assembler->CallFunc(AddressOf(&StartTimer), "StartTimer");
         }
-        m_Assembler->mov(asmjit::x86::rcx, asmjit::imm((uintptr_t)&m_System));
-        m_Assembler->mov(asmjit::x86::rdx, asmjit::imm(0x10000));
-        m_Assembler->mov(asmjit::x86::r8, asmjit::imm(0x118));
+        m_Assembler->mov(RspArgReg1, asmjit::imm((uintptr_t)&m_System));
+        m_Assembler->mov(RspArgReg2, asmjit::imm(0x10000));
+        m_Assembler->mov(RspArgReg3, asmjit::imm(0x118));
         m_Assembler->CallFunc(AddressOf(&CRSPSystem::ExecuteOps), "CRSPSystem::ExecuteOps");
         if (Profiling)
         {
@@ -1,6 +1,10 @@
 #pragma once
 #if defined(__amd64__) || defined(_M_X64)
 
+#if !defined(_MSC_VER) && !defined(_Printf_format_string_)
+#define _Printf_format_string_
+#endif
+
 #include "asmjit.h"
 #include <Project64-rsp-core/Recompiler/RspCodeBlock.h>
 #include <Project64-rsp-core/Recompiler/RspRecompilerOps-x64.h>
@@ -25,6 +29,8 @@ public:
     ~CRSPRecompiler();
 
     void Reset();
+    void RunCPU(void);
+    void SetJumpTable(uint32_t End);
     void * CompileHLETask(uint32_t Address, RspCodeBlocks & Functions, const uint32_t EndBlockAddress);
     void Log(_Printf_format_string_ const char * Text, ...);
 
@@ -38,7 +44,9 @@ private:
     void AddBranchJump(uint32_t Target);
     bool FindBranchJump(uint32_t Target, asmjit::Label & Jump);
     void BuildRecompilerCPU(void);
+    void * CompileBlock(uint32_t Address);
     void CompileCodeBlock(RspCodeBlock & block);
+    void ResetJumpTables(void);
     void handleError(asmjit::Error err, const char * message, asmjit::BaseEmitter * origin);
     void SetupRspAssembler();
 
@@ -54,8 +62,11 @@ private:
     asmjit::CodeHolder m_CodeHolder;
     RspAssembler * m_Assembler;
     BranchTargets m_BranchTargets;
+    RspCodeBlocks m_BlockFunctions;
 };
 
+extern uint32_t JumpTableSize;
+
 #define AddressOf(Addr) CRSPRecompiler::GetAddressOf(5, (Addr))
 
 #endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #if defined(__i386__) || defined(_M_IX86)
 
 #include "RspRecompilerCPU-x86.h"
+#include "RspCodeCache.h"
 #include "RspProfiling.h"
 #include "RspRecompilerOps-x86.h"
 #include "X86.h"
@@ -15,7 +16,6 @@
 #include <Project64-rsp-core/cpu/RspSystem.h>
 #include <Project64-rsp-core/cpu/RspTypes.h>
 #include <float.h>
-#include <zlib/zlib.h>
 
 #pragma warning(disable : 4152) // Non-standard extension, function/data pointer conversion in expression
 
@@ -561,14 +561,10 @@ void CRSPRecompiler::ReOrderSubBlock(RSP_BLOCK * Block)
 
 void CRSPRecompiler::ResetJumpTables(void)
 {
-    extern uint32_t NoOfMaps;
-    extern uint8_t * JumpTables;
-
-    memset(JumpTables, 0, 0x1000 * MaxMaps);
+    RspCodeCache.Flush();
     RecompPos = RecompCode;
     pLastPrimary = nullptr;
     pLastSecondary = nullptr;
-    NoOfMaps = 0;
 }
 
 /*
@@ -648,12 +644,7 @@ void CompilerToggleBuffer(void)
 
 void ClearAllx86Code(void)
 {
-    extern uint32_t NoOfMaps, MapsCRC[32];
-    extern uint8_t * JumpTables;
-
-    memset(&MapsCRC, 0, sizeof(uint32_t) * 0x20);
-    NoOfMaps = 0;
-    memset(JumpTables, 0, 0x1000 * 32);
+    RspCodeCache.Reset();
 
     RecompPos = RecompCode;
 
@@ -989,6 +980,8 @@ void CRSPRecompiler::RunCPU(void)
     uint8_t * Block;
 
     RSP_Running = true;
+    // The CPU can load IMEM between tasks without the RSP seeing it
+    RspCodeCache.IMEMWritten();
     SetJumpTable(JumpTableSize);
 
     while (RSP_Running)
@@ -997,6 +990,11 @@ void CRSPRecompiler::RunCPU(void)
 
         if (Block == NULL)
         {
+            if ((uint32_t)(RecompPos - RecompCode) > RecompCodeSize - 0x40000 ||
+                (pLastSecondary != NULL && (uint32_t)(pLastSecondary - RecompCodeSecondary) > 0x00200000 - 0x40000))
+            {
+                ResetJumpTables();
+            }
             if (Profiling && !IndvidualBlock)
             {
                 StartTimer((uint32_t)Timer_Compiling);
@@ -1218,10 +1216,6 @@ void CRSPRecompiler::Branch_AddRef(uint32_t Target, uint32_t * X86Loc)
 
 void CRSPRecompiler::SetJumpTable(uint32_t End)
 {
-    extern uint32_t NoOfMaps, MapsCRC[32];
-    extern uint8_t * JumpTables;
-
-    uint32_t CRC = crc32(0L, Z_NULL, 0);
     if (End < 0x800)
     {
         End = 0x800;
@@ -1232,24 +1226,8 @@ void CRSPRecompiler::SetJumpTable(uint32_t End)
         End = 0x800;
     }
 
-    CRC = crc32(CRC, RSPInfo.IMEM, End);
-    for (uint32_t i = 0; i < NoOfMaps; i++)
-    {
-        if (CRC == MapsCRC[i])
-        {
-            JumpTable = (void **)(JumpTables + i * 0x1000);
-            Table = i;
-            return;
-        }
-    }
-    if (NoOfMaps == MaxMaps)
-    {
-        ResetJumpTables();
-    }
-    MapsCRC[NoOfMaps] = CRC;
-    JumpTable = (void **)(JumpTables + NoOfMaps * 0x1000);
-    Table = NoOfMaps;
-    NoOfMaps += 1;
+    JumpTable = RspCodeCache.Lookup(RSPInfo.IMEM, End);
+    Table = RspCodeCache.ActiveMapId();
 }
 
 #endif
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <Project64-rsp-core/Recompiler/RspAssembler.h>
 #include <Project64-rsp-core/Recompiler/RspCodeBlock.h>
 #include <Project64-rsp-core/Recompiler/RspProfiling.h>
+#include <Project64-rsp-core/cpu/RSPCpu.h>
 #include <Project64-rsp-core/cpu/RSPInstruction.h>
 #include <Project64-rsp-core/cpu/RspSystem.h>
 #include <Settings/Settings.h>
@@ -19,6 +20,20 @@ extern p_Recompfunc RSP_Recomp_Sc2[32];
 
 uint32_t BranchCompare = 0;
 
+// Generated code keeps &m_Reg in rbx and DMEM in rbp. The frame holds the shadow space, the saved
+// xmm6/xmm7 and the next program counter worked out by a branch before its delay slot runs.
+enum
+{
+    FrameSize = 72,
+    FrameSaveXmm6 = 32,
+    FrameSaveXmm7 = 48,
+    FrameBranchTarget = 64,
+};
+
+// Flags hold lane n in bit (7 - n)
+alignas(16) static const uint16_t FlagBits[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+
+
 CRSPRecompilerOps::CRSPRecompilerOps(CRSPSystem & System, CRSPRecompiler & Recompiler) :
     m_System(System),
     m_Recompiler(Recompiler),
@@ -37,7 +52,693 @@ void CRSPRecompilerOps::Cheat_r4300iOpcode(RSPOp::Func FunctAddress, const char
 {
     m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
     m_Assembler->MoveConstToVariable(&m_System.m_OpCode.Value, "m_OpCode.Value", m_OpCode.Value);
-    m_Assembler->CallThis(&RSPSystem.m_Op, AddressOf(FunctAddress), FunctName);
+    m_Assembler->CallThis(&m_System.m_Op, AddressOf(FunctAddress), FunctName);
+}
+
+asmjit::x86::Mem CRSPRecompilerOps::GprPointer(uint32_t Reg) const
+{
+    return RegPointer(&m_GPR[Reg], 4);
+}
+
+asmjit::x86::Mem CRSPRecompilerOps::RegPointer(const void * Variable, uint32_t Size) const
+{
+    return asmjit::x86::ptr(asmjit::x86::rbx, (int32_t)((const uint8_t *)Variable - (const uint8_t *)&m_Reg), Size);
+}
+
+void CRSPRecompilerOps::CompileBranch(void)
+{
+    RSPInstruction Instruction(m_CompilePC, m_OpCode.Value);
+    if (m_NextInstruction == RSPPIPELINE_NORMAL)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, Instruction.NameAndParam().c_str());
+        uint32_t FallThrough = (m_CompilePC + 8) & 0xFFC;
+        if (Instruction.IsConditionalBranch())
+        {
+            if (m_OpCode.op == RSP_BEQ || m_OpCode.op == RSP_BNE)
+            {
+                m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+                m_Assembler->cmp(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+            }
+            else
+            {
+                m_Assembler->cmp(GprPointer(m_OpCode.rs), 0);
+            }
+            m_Assembler->mov(asmjit::x86::eax, FallThrough);
+            m_Assembler->mov(asmjit::x86::ecx, Instruction.ConditionalBranchTarget() & 0xFFC);
+            switch (m_OpCode.op)
+            {
+            case RSP_BEQ: m_Assembler->cmove(asmjit::x86::eax, asmjit::x86::ecx); break;
+            case RSP_BNE: m_Assembler->cmovne(asmjit::x86::eax, asmjit::x86::ecx); break;
+            case RSP_BLEZ: m_Assembler->cmovle(asmjit::x86::eax, asmjit::x86::ecx); break;
+            case RSP_BGTZ: m_Assembler->cmovg(asmjit::x86::eax, asmjit::x86::ecx); break;
+            default:
+                if (m_OpCode.rt == RSP_REGIMM_BLTZ || m_OpCode.rt == RSP_REGIMM_BLTZAL)
+                {
+                    m_Assembler->cmovl(asmjit::x86::eax, asmjit::x86::ecx);
+                }
+                else
+                {
+                    m_Assembler->cmovge(asmjit::x86::eax, asmjit::x86::ecx);
+                }
+                break;
+            }
+            m_Assembler->mov(asmjit::x86::dword_ptr(asmjit::x86::rsp, FrameBranchTarget), asmjit::x86::eax);
+        }
+        else if (Instruction.IsRegisterJump())
+        {
+            m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+            m_Assembler->and_(asmjit::x86::eax, 0xFFC);
+            m_Assembler->mov(asmjit::x86::dword_ptr(asmjit::x86::rsp, FrameBranchTarget), asmjit::x86::eax);
+        }
+
+        // The link register is written after the branch has read its operands
+        uint32_t LinkReg = 0;
+        if (m_OpCode.op == RSP_JAL || (m_OpCode.op == RSP_REGIMM && (m_OpCode.rt == RSP_REGIMM_BLTZAL || m_OpCode.rt == RSP_REGIMM_BGEZAL)))
+        {
+            LinkReg = 31;
+        }
+        else if (m_OpCode.op == RSP_SPECIAL && m_OpCode.funct == RSP_SPECIAL_JALR)
+        {
+            LinkReg = m_OpCode.rd;
+        }
+        if (LinkReg != 0)
+        {
+            m_Assembler->mov(GprPointer(LinkReg), FallThrough);
+        }
+        m_NextInstruction = RSPPIPELINE_DO_DELAY_SLOT;
+    }
+    else if (m_NextInstruction == RSPPIPELINE_DELAY_SLOT_DONE)
+    {
+        uint32_t Target = (uint32_t)-1;
+        if (Instruction.IsJump() || Instruction.IsStaticCall())
+        {
+            Target = (m_OpCode.target << 2) & 0xFFC;
+            m_Assembler->mov(asmjit::x86::eax, Target);
+        }
+        else
+        {
+            if (Instruction.IsConditionalBranch())
+            {
+                Target = Instruction.ConditionalBranchTarget() & 0xFFC;
+            }
+            m_Assembler->mov(asmjit::x86::eax, asmjit::x86::dword_ptr(asmjit::x86::rsp, FrameBranchTarget));
+        }
+
+        // A branch back to the start of the block loops in place for as long as the RSP is running
+        asmjit::Label LoopLabel;
+        if (Target == m_CurrentBlock->GetStartAddress() && m_Recompiler.FindBranchJump(Target, LoopLabel))
+        {
+            asmjit::Label ExitLabel = m_Assembler->newLabel();
+            if (Instruction.IsConditionalBranch())
+            {
+                m_Assembler->cmp(asmjit::x86::eax, Target);
+                m_Assembler->JneLabel(stdstr_f("Exit-%X", m_CompilePC).c_str(), ExitLabel);
+            }
+            m_Assembler->mov(asmjit::x86::r11, (uint64_t)&RSP_Running);
+            m_Assembler->cmp(asmjit::x86::dword_ptr(asmjit::x86::r11), 0);
+            m_Assembler->JeLabel(stdstr_f("Exit-%X", m_CompilePC).c_str(), ExitLabel);
+            m_Assembler->JmpLabel(stdstr_f("0x%X", Target).c_str(), LoopLabel);
+            m_Assembler->bind(ExitLabel);
+        }
+        m_Assembler->MoveX86regToVariable(m_System.m_SP_PC_REG, "RSP PC", asmjit::x86::eax);
+        ExitCodeBlock();
+    }
+    else
+    {
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+}
+
+void CRSPRecompilerOps::CompileStopCheck(uint32_t ProgramCounter)
+{
+    asmjit::Label ContinueLabel = m_Assembler->newLabel();
+    m_Assembler->mov(asmjit::x86::r11, (uint64_t)&RSP_Running);
+    m_Assembler->cmp(asmjit::x86::dword_ptr(asmjit::x86::r11), 0);
+    m_Assembler->JneLabel(stdstr_f("Continue-%X", m_CompilePC).c_str(), ContinueLabel);
+    CompileBlockExit(ProgramCounter);
+    m_Assembler->bind(ContinueLabel);
+}
+
+void CRSPRecompilerOps::CompileLoad(uint32_t Size, bool SignExtend, RSPOp::Func FunctAddress, const char * FunctName)
+{
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+
+    asmjit::Label UnalignedLabel, DoneLabel;
+    if (m_OpCode.base == 0)
+    {
+        uint32_t Address = (uint32_t)(short)m_OpCode.offset & 0xFFF;
+        if ((Address & (Size - 1)) != 0)
+        {
+            Cheat_r4300iOpcode(FunctAddress, FunctName);
+            return;
+        }
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        m_Assembler->mov(asmjit::x86::eax, Address);
+    }
+    else
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.base));
+        m_Assembler->add(asmjit::x86::eax, (int32_t)(short)m_OpCode.offset);
+        m_Assembler->and_(asmjit::x86::eax, 0xFFF);
+        if (Size > 1)
+        {
+            UnalignedLabel = m_Assembler->newLabel();
+            DoneLabel = m_Assembler->newLabel();
+            m_Assembler->test(asmjit::x86::eax, Size - 1);
+            m_Assembler->JneLabel(stdstr_f("Unaligned-%X", m_CompilePC).c_str(), UnalignedLabel);
+        }
+    }
+
+    asmjit::x86::Mem Value = asmjit::x86::ptr(asmjit::x86::rbp, asmjit::x86::rax, 0, 0, Size);
+    switch (Size)
+    {
+    case 1:
+        m_Assembler->xor_(asmjit::x86::eax, 3);
+        break;
+    case 2:
+        m_Assembler->xor_(asmjit::x86::eax, 2);
+        break;
+    }
+    if (Size == 4)
+    {
+        m_Assembler->mov(asmjit::x86::eax, Value);
+    }
+    else if (SignExtend)
+    {
+        m_Assembler->movsx(asmjit::x86::eax, Value);
+    }
+    else
+    {
+        m_Assembler->movzx(asmjit::x86::eax, Value);
+    }
+    m_Assembler->mov(GprPointer(m_OpCode.rt), asmjit::x86::eax);
+
+    if (UnalignedLabel.isValid())
+    {
+        m_Assembler->JmpLabel(stdstr_f("Done-%X", m_CompilePC).c_str(), DoneLabel);
+        m_Assembler->bind(UnalignedLabel);
+        m_Assembler->MoveConstToVariable(&m_System.m_OpCode.Value, "m_OpCode.Value", m_OpCode.Value);
+        m_Assembler->CallThis(&m_System.m_Op, AddressOf(FunctAddress), FunctName);
+        m_Assembler->bind(DoneLabel);
+    }
+}
+
+void CRSPRecompilerOps::CompileStore(uint32_t Size, RSPOp::Func FunctAddress, const char * FunctName)
+{
+    asmjit::Label UnalignedLabel, DoneLabel;
+    if (m_OpCode.base == 0)
+    {
+        uint32_t Address = (uint32_t)(short)m_OpCode.offset & 0xFFF;
+        if ((Address & (Size - 1)) != 0)
+        {
+            Cheat_r4300iOpcode(FunctAddress, FunctName);
+            return;
+        }
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        m_Assembler->mov(asmjit::x86::eax, Address);
+    }
+    else
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.base));
+        m_Assembler->add(asmjit::x86::eax, (int32_t)(short)m_OpCode.offset);
+        m_Assembler->and_(asmjit::x86::eax, 0xFFF);
+        if (Size > 1)
+        {
+            UnalignedLabel = m_Assembler->newLabel();
+            DoneLabel = m_Assembler->newLabel();
+            m_Assembler->test(asmjit::x86::eax, Size - 1);
+            m_Assembler->JneLabel(stdstr_f("Unaligned-%X", m_CompilePC).c_str(), UnalignedLabel);
+        }
+    }
+
+    m_Assembler->mov(asmjit::x86::ecx, GprPointer(m_OpCode.rt));
+    switch (Size)
+    {
+    case 1:
+        m_Assembler->xor_(asmjit::x86::eax, 3);
+        m_Assembler->mov(asmjit::x86::byte_ptr(asmjit::x86::rbp, asmjit::x86::rax), asmjit::x86::cl);
+        break;
+    case 2:
+        m_Assembler->xor_(asmjit::x86::eax, 2);
+        m_Assembler->mov(asmjit::x86::word_ptr(asmjit::x86::rbp, asmjit::x86::rax), asmjit::x86::cx);
+        break;
+    default:
+        m_Assembler->mov(asmjit::x86::dword_ptr(asmjit::x86::rbp, asmjit::x86::rax), asmjit::x86::ecx);
+        break;
+    }
+
+    if (UnalignedLabel.isValid())
+    {
+        m_Assembler->JmpLabel(stdstr_f("Done-%X", m_CompilePC).c_str(), DoneLabel);
+        m_Assembler->bind(UnalignedLabel);
+        m_Assembler->MoveConstToVariable(&m_System.m_OpCode.Value, "m_OpCode.Value", m_OpCode.Value);
+        m_Assembler->CallThis(&m_System.m_Op, AddressOf(FunctAddress), FunctName);
+        m_Assembler->bind(DoneLabel);
+    }
+}
+
+// Works out the DMEM address of a vector load or store in eax. Returns false when a constant
+// address is not aligned to Size and the interpreter has been called instead, an address read
+// from a register jumps to UnalignedLabel when it is not aligned.
+bool CRSPRecompilerOps::CompileVectorAddress(uint32_t Size, RSPOp::Func FunctAddress, const char * FunctName, asmjit::Label & UnalignedLabel)
+{
+    int32_t Offset = (int32_t)m_OpCode.voffset * (int32_t)Size;
+    if (m_OpCode.base == 0)
+    {
+        uint32_t Address = (uint32_t)Offset & 0xFFF;
+        if ((Address & (Size - 1)) != 0)
+        {
+            Cheat_r4300iOpcode(FunctAddress, FunctName);
+            return false;
+        }
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        m_Assembler->mov(asmjit::x86::eax, Address);
+        return true;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.base));
+    m_Assembler->add(asmjit::x86::eax, Offset);
+    m_Assembler->and_(asmjit::x86::eax, 0xFFF);
+    if (Size > 1)
+    {
+        UnalignedLabel = m_Assembler->newLabel();
+        m_Assembler->test(asmjit::x86::eax, Size - 1);
+        m_Assembler->JneLabel(stdstr_f("Unaligned-%X", m_CompilePC).c_str(), UnalignedLabel);
+    }
+    return true;
+}
+
+void CRSPRecompilerOps::CompileVectorUnaligned(asmjit::Label & UnalignedLabel, RSPOp::Func FunctAddress, const char * FunctName)
+{
+    if (!UnalignedLabel.isValid())
+    {
+        return;
+    }
+    asmjit::Label DoneLabel = m_Assembler->newLabel();
+    m_Assembler->JmpLabel(stdstr_f("Done-%X", m_CompilePC).c_str(), DoneLabel);
+    m_Assembler->bind(UnalignedLabel);
+    m_Assembler->MoveConstToVariable(&m_System.m_OpCode.Value, "m_OpCode.Value", m_OpCode.Value);
+    m_Assembler->CallThis(&m_System.m_Op, AddressOf(FunctAddress), FunctName);
+    m_Assembler->bind(DoneLabel);
+}
+
+// Byte i of a vector register (as numbered by the RSP) is at host offset 15 - i and DMEM words
+// are held in host order, so an aligned access is a copy of whole elements or words. Only an
+// element (del) that starts on a whole element or word is compiled, the rest call the interpreter.
+void CRSPRecompilerOps::CompileVectorLoadStore(uint32_t Size, bool Store, RSPOp::Func FunctAddress, const char * FunctName)
+{
+    uint32_t Element = m_OpCode.del;
+    if ((Element & ((Size < 4 ? Size : 4) - 1)) != 0)
+    {
+        Cheat_r4300iOpcode(FunctAddress, FunctName);
+        return;
+    }
+    asmjit::Label UnalignedLabel;
+    if (!CompileVectorAddress(Size, FunctAddress, FunctName, UnalignedLabel))
+    {
+        return;
+    }
+
+    uint8_t * Vect = (uint8_t *)&m_Reg.m_Vect[m_OpCode.vt];
+    if (Size == 16 && Element == 0)
+    {
+        asmjit::x86::Mem Dmem = asmjit::x86::xmmword_ptr(asmjit::x86::rbp, asmjit::x86::rax);
+        m_Assembler->movdqu(asmjit::x86::xmm0, Store ? RegPointer(Vect, 16) : Dmem);
+        m_Assembler->pshufd(asmjit::x86::xmm0, asmjit::x86::xmm0, 0x1B);
+        m_Assembler->movdqu(Store ? Dmem : RegPointer(Vect, 16), asmjit::x86::xmm0);
+    }
+    else if (Size == 1)
+    {
+        m_Assembler->xor_(asmjit::x86::eax, 3);
+        m_Assembler->mov(asmjit::x86::cl, Store ? RegPointer(Vect + 15 - Element, 1) : asmjit::x86::byte_ptr(asmjit::x86::rbp, asmjit::x86::rax));
+        m_Assembler->mov(Store ? asmjit::x86::byte_ptr(asmjit::x86::rbp, asmjit::x86::rax) : RegPointer(Vect + 15 - Element, 1), asmjit::x86::cl);
+    }
+    else if (Size == 2)
+    {
+        m_Assembler->xor_(asmjit::x86::eax, 2);
+        m_Assembler->mov(asmjit::x86::cx, Store ? RegPointer(Vect + 14 - Element, 2) : asmjit::x86::word_ptr(asmjit::x86::rbp, asmjit::x86::rax));
+        m_Assembler->mov(Store ? asmjit::x86::word_ptr(asmjit::x86::rbp, asmjit::x86::rax) : RegPointer(Vect + 14 - Element, 2), asmjit::x86::cx);
+    }
+    else
+    {
+        // Loads stop at the end of the register, stores wrap around to its start
+        for (uint32_t i = 0; i < Size; i += 4)
+        {
+            if (!Store && Element + i >= 16)
+            {
+                break;
+            }
+            asmjit::x86::Mem Dmem = asmjit::x86::dword_ptr(asmjit::x86::rbp, asmjit::x86::rax, 0, i);
+            asmjit::x86::Mem Reg = RegPointer(Vect + 12 - ((Element + i) & 0xF), 4);
+            m_Assembler->mov(asmjit::x86::ecx, Store ? Reg : Dmem);
+            m_Assembler->mov(Store ? Dmem : Reg, asmjit::x86::ecx);
+        }
+    }
+    CompileVectorUnaligned(UnalignedLabel, FunctAddress, FunctName);
+}
+
+// LPV, LUV, SPV and SUV with element 0 and an aligned address: each byte in DMEM is the top of a
+// 16-bit lane, shifted by 8 (packed) or 7 (unsigned)
+void CRSPRecompilerOps::CompilePackedLoadStore(uint32_t Shift, bool Store, RSPOp::Func FunctAddress, const char * FunctName)
+{
+    if (m_OpCode.del != 0)
+    {
+        Cheat_r4300iOpcode(FunctAddress, FunctName);
+        return;
+    }
+    asmjit::Label UnalignedLabel;
+    if (!CompileVectorAddress(8, FunctAddress, FunctName, UnalignedLabel))
+    {
+        return;
+    }
+
+    asmjit::x86::Mem Dmem = asmjit::x86::qword_ptr(asmjit::x86::rbp, asmjit::x86::rax);
+    asmjit::x86::Mem Vect = RegPointer(&m_Reg.m_Vect[m_OpCode.vt], 16);
+    if (Store)
+    {
+        m_Assembler->movdqu(asmjit::x86::xmm0, Vect);
+        m_Assembler->psrlw(asmjit::x86::xmm0, Shift);
+        if (Shift < 8)
+        {
+            m_Assembler->pcmpeqw(asmjit::x86::xmm1, asmjit::x86::xmm1);
+            m_Assembler->psrlw(asmjit::x86::xmm1, 8);
+            m_Assembler->pand(asmjit::x86::xmm0, asmjit::x86::xmm1);
+        }
+        m_Assembler->packuswb(asmjit::x86::xmm0, asmjit::x86::xmm0);
+        m_Assembler->pshufd(asmjit::x86::xmm0, asmjit::x86::xmm0, 0xE1);
+        m_Assembler->movq(Dmem, asmjit::x86::xmm0);
+    }
+    else
+    {
+        m_Assembler->movq(asmjit::x86::xmm0, Dmem);
+        m_Assembler->pshufd(asmjit::x86::xmm0, asmjit::x86::xmm0, 0xE1);
+        m_Assembler->pxor(asmjit::x86::xmm1, asmjit::x86::xmm1);
+        m_Assembler->punpcklbw(asmjit::x86::xmm1, asmjit::x86::xmm0);
+        if (Shift < 8)
+        {
+            m_Assembler->psrlw(asmjit::x86::xmm1, 8 - Shift);
+        }
+        m_Assembler->movdqu(Vect, asmjit::x86::xmm1);
+    }
+    CompileVectorUnaligned(UnalignedLabel, FunctAddress, FunctName);
+}
+
+void CRSPRecompilerOps::VectorLoad(const asmjit::x86::Xmm & Reg, uint32_t Vect)
+{
+    m_Assembler->movdqu(Reg, RegPointer(&m_Reg.m_Vect[Vect], 16));
+}
+
+void CRSPRecompilerOps::VectorLoadElement(const asmjit::x86::Xmm & Reg, uint32_t Vect, uint32_t Element)
+{
+    VectorLoad(Reg, Vect);
+    if (Element < 2)
+    {
+        return;
+    }
+
+    // Same lanes as RSPVector::ue, the quarter and half selections stay within each 64-bit half
+    const uint8_t * Lane = RSPElementLane[Element];
+    if (Element < 8)
+    {
+        m_Assembler->pshuflw(Reg, Reg, (Lane[0] & 3) | ((Lane[1] & 3) << 2) | ((Lane[2] & 3) << 4) | ((Lane[3] & 3) << 6));
+        m_Assembler->pshufhw(Reg, Reg, (Lane[4] & 3) | ((Lane[5] & 3) << 2) | ((Lane[6] & 3) << 4) | ((Lane[7] & 3) << 6));
+    }
+    else if (Lane[0] < 4)
+    {
+        m_Assembler->pshuflw(Reg, Reg, Lane[0] * 0x55);
+        m_Assembler->pshufd(Reg, Reg, 0x00);
+    }
+    else
+    {
+        m_Assembler->pshufhw(Reg, Reg, (Lane[0] - 4) * 0x55);
+        m_Assembler->pshufd(Reg, Reg, 0xAA);
+    }
+}
+
+void CRSPRecompilerOps::VectorStore(uint32_t Vect, const asmjit::x86::Xmm & Reg)
+{
+    m_Assembler->movdqu(RegPointer(&m_Reg.m_Vect[Vect], 16), Reg);
+}
+
+// Dest = Mask ? a : b, Dest can be a but not Mask or b
+void CRSPRecompilerOps::VectorSelect(const asmjit::x86::Xmm & Dest, const asmjit::x86::Xmm & Mask, const asmjit::x86::Xmm & a, const asmjit::x86::Xmm & b)
+{
+    if (Dest != a)
+    {
+        m_Assembler->movdqa(Dest, a);
+    }
+    m_Assembler->pxor(Dest, b);
+    m_Assembler->pand(Dest, Mask);
+    m_Assembler->pxor(Dest, b);
+}
+
+void CRSPRecompilerOps::FlagToMask(const asmjit::x86::Xmm & Reg, const uint8_t * Flag)
+{
+    m_Assembler->movzx(asmjit::x86::eax, RegPointer(Flag, 1));
+    m_Assembler->movd(Reg, asmjit::x86::eax);
+    m_Assembler->pshuflw(Reg, Reg, 0x00);
+    m_Assembler->pshufd(Reg, Reg, 0x00);
+    m_Assembler->mov(asmjit::x86::r11, (uint64_t)FlagBits);
+    m_Assembler->pand(Reg, asmjit::x86::xmmword_ptr(asmjit::x86::r11));
+    m_Assembler->pcmpeqw(Reg, asmjit::x86::xmmword_ptr(asmjit::x86::r11));
+}
+
+// Uses xmm7 as scratch
+void CRSPRecompilerOps::MaskToFlag(uint8_t * Flag, const asmjit::x86::Xmm & Reg, bool Invert)
+{
+    m_Assembler->mov(asmjit::x86::r11, (uint64_t)FlagBits);
+    m_Assembler->pand(Reg, asmjit::x86::xmmword_ptr(asmjit::x86::r11));
+    m_Assembler->pxor(asmjit::x86::xmm7, asmjit::x86::xmm7);
+    m_Assembler->packuswb(Reg, asmjit::x86::xmm7);
+    m_Assembler->psadbw(Reg, asmjit::x86::xmm7);
+    m_Assembler->movd(asmjit::x86::eax, Reg);
+    if (Invert)
+    {
+        m_Assembler->xor_(asmjit::x86::al, 0xFF);
+    }
+    m_Assembler->mov(RegPointer(Flag, 1), asmjit::x86::al);
+}
+
+// s * t * 2 from xmm0 and xmm1 into xmm5 (low), xmm6 (mid) and xmm7 (high), xmm0 is lost
+void CRSPRecompilerOps::ProductFraction(void)
+{
+    m_Assembler->movdqa(asmjit::x86::xmm5, asmjit::x86::xmm0);
+    m_Assembler->pmullw(asmjit::x86::xmm5, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm6, asmjit::x86::xmm0);
+    m_Assembler->pmulhw(asmjit::x86::xmm6, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm7, asmjit::x86::xmm6);
+    m_Assembler->psraw(asmjit::x86::xmm7, 15);
+    m_Assembler->psllw(asmjit::x86::xmm6, 1);
+    m_Assembler->movdqa(asmjit::x86::xmm0, asmjit::x86::xmm5);
+    m_Assembler->psrlw(asmjit::x86::xmm0, 15);
+    m_Assembler->por(asmjit::x86::xmm6, asmjit::x86::xmm0);
+    m_Assembler->psllw(asmjit::x86::xmm5, 1);
+}
+
+// Signed * unsigned into xmm5 (low), xmm6 (mid) and xmm7 (high)
+void CRSPRecompilerOps::ProductSignedUnsigned(const asmjit::x86::Xmm & Signed, const asmjit::x86::Xmm & Unsigned)
+{
+    m_Assembler->movdqa(asmjit::x86::xmm5, Signed);
+    m_Assembler->pmullw(asmjit::x86::xmm5, Unsigned);
+    m_Assembler->movdqa(asmjit::x86::xmm6, Signed);
+    m_Assembler->pmulhw(asmjit::x86::xmm6, Unsigned);
+    m_Assembler->movdqa(asmjit::x86::xmm7, Unsigned);
+    m_Assembler->psraw(asmjit::x86::xmm7, 15);
+    m_Assembler->pand(asmjit::x86::xmm7, Signed);
+    m_Assembler->paddw(asmjit::x86::xmm6, asmjit::x86::xmm7);
+    m_Assembler->movdqa(asmjit::x86::xmm7, asmjit::x86::xmm6);
+    m_Assembler->psraw(asmjit::x86::xmm7, 15);
+}
+
+// Accumulator planes into xmm2 (low), xmm3 (mid) and xmm4 (high)
+void CRSPRecompilerOps::AccumulatorLoad(void)
+{
+    m_Assembler->movdqu(asmjit::x86::xmm2, RegPointer(&m_Reg.m_ACCUM.Low(0), 16));
+    m_Assembler->movdqu(asmjit::x86::xmm3, RegPointer(&m_Reg.m_ACCUM.Mid(0), 16));
+    m_Assembler->movdqu(asmjit::x86::xmm4, RegPointer(&m_Reg.m_ACCUM.High(0), 16));
+}
+
+// Writes xmm2 - xmm4 back
+void CRSPRecompilerOps::AccumulatorStore(void)
+{
+    m_Assembler->movdqu(RegPointer(&m_Reg.m_ACCUM.Low(0), 16), asmjit::x86::xmm2);
+    m_Assembler->movdqu(RegPointer(&m_Reg.m_ACCUM.Mid(0), 16), asmjit::x86::xmm3);
+    m_Assembler->movdqu(RegPointer(&m_Reg.m_ACCUM.High(0), 16), asmjit::x86::xmm4);
+}
+
+void CRSPRecompilerOps::AccumulatorStoreLow(const asmjit::x86::Xmm & Reg)
+{
+    m_Assembler->movdqu(RegPointer(&m_Reg.m_ACCUM.Low(0), 16), Reg);
+}
+
+// (xmm2, xmm3, xmm4) += (xmm5, xmm6, xmm7) wrapping at 48 bits, skipping the parts that are zero.
+// Uses xmm0, xmm1 and the added registers.
+void CRSPRecompilerOps::AccumulatorAdd(bool AddLow, bool AddMid, bool AddHigh)
+{
+    if (AddLow)
+    {
+        // A lane carried out when the saturated sum is not the wrapped sum
+        m_Assembler->movdqa(asmjit::x86::xmm0, asmjit::x86::xmm2);
+        m_Assembler->paddusw(asmjit::x86::xmm0, asmjit::x86::xmm5);
+        m_Assembler->paddw(asmjit::x86::xmm2, asmjit::x86::xmm5);
+        m_Assembler->pcmpeqw(asmjit::x86::xmm0, asmjit::x86::xmm2);
+    }
+    if (AddMid)
+    {
+        m_Assembler->movdqa(asmjit::x86::xmm1, asmjit::x86::xmm3);
+        m_Assembler->paddusw(asmjit::x86::xmm1, asmjit::x86::xmm6);
+        m_Assembler->paddw(asmjit::x86::xmm3, asmjit::x86::xmm6);
+        m_Assembler->pcmpeqw(asmjit::x86::xmm1, asmjit::x86::xmm3);
+    }
+    if (AddLow || AddMid)
+    {
+        m_Assembler->pcmpeqw(asmjit::x86::xmm5, asmjit::x86::xmm5);
+    }
+    if (AddLow)
+    {
+        m_Assembler->pxor(asmjit::x86::xmm0, asmjit::x86::xmm5);
+    }
+    if (AddMid)
+    {
+        m_Assembler->pxor(asmjit::x86::xmm1, asmjit::x86::xmm5);
+    }
+    if (AddLow)
+    {
+        m_Assembler->psubw(asmjit::x86::xmm3, asmjit::x86::xmm0);
+        m_Assembler->pxor(asmjit::x86::xmm6, asmjit::x86::xmm6);
+        m_Assembler->pcmpeqw(asmjit::x86::xmm6, asmjit::x86::xmm3);
+        m_Assembler->pand(asmjit::x86::xmm6, asmjit::x86::xmm0);
+        if (AddMid)
+        {
+            m_Assembler->por(asmjit::x86::xmm1, asmjit::x86::xmm6);
+        }
+        else
+        {
+            m_Assembler->movdqa(asmjit::x86::xmm1, asmjit::x86::xmm6);
+        }
+    }
+    if (AddHigh)
+    {
+        m_Assembler->paddw(asmjit::x86::xmm4, asmjit::x86::xmm7);
+    }
+    if (AddLow || AddMid)
+    {
+        m_Assembler->psubw(asmjit::x86::xmm4, asmjit::x86::xmm1);
+    }
+}
+
+// Same as CRSPRegisters::AccumulatorSaturate into xmm0, uses xmm1 and xmm5
+void CRSPRecompilerOps::AccumulatorSaturate(bool High)
+{
+    if (High)
+    {
+        m_Assembler->movdqa(asmjit::x86::xmm0, asmjit::x86::xmm3);
+        m_Assembler->punpcklwd(asmjit::x86::xmm0, asmjit::x86::xmm4);
+        m_Assembler->movdqa(asmjit::x86::xmm1, asmjit::x86::xmm3);
+        m_Assembler->punpckhwd(asmjit::x86::xmm1, asmjit::x86::xmm4);
+        m_Assembler->packssdw(asmjit::x86::xmm0, asmjit::x86::xmm1);
+        return;
+    }
+    m_Assembler->movdqa(asmjit::x86::xmm0, asmjit::x86::xmm3);
+    m_Assembler->psraw(asmjit::x86::xmm0, 15);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm0, asmjit::x86::xmm4);
+    m_Assembler->movdqa(asmjit::x86::xmm1, asmjit::x86::xmm4);
+    m_Assembler->psraw(asmjit::x86::xmm1, 15);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm5, asmjit::x86::xmm5);
+    m_Assembler->pxor(asmjit::x86::xmm1, asmjit::x86::xmm5);
+    m_Assembler->movdqa(asmjit::x86::xmm5, asmjit::x86::xmm0);
+    m_Assembler->pand(asmjit::x86::xmm5, asmjit::x86::xmm2);
+    m_Assembler->pandn(asmjit::x86::xmm0, asmjit::x86::xmm1);
+    m_Assembler->por(asmjit::x86::xmm0, asmjit::x86::xmm5);
+}
+
+void CRSPRecompilerOps::VectorLogical(void)
+{
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    switch (m_OpCode.funct)
+    {
+    case RSP_VECTOR_VAND:
+    case RSP_VECTOR_VNAND:
+        m_Assembler->pand(asmjit::x86::xmm0, asmjit::x86::xmm1);
+        break;
+    case RSP_VECTOR_VOR:
+    case RSP_VECTOR_VNOR:
+        m_Assembler->por(asmjit::x86::xmm0, asmjit::x86::xmm1);
+        break;
+    default:
+        m_Assembler->pxor(asmjit::x86::xmm0, asmjit::x86::xmm1);
+        break;
+    }
+    if (m_OpCode.funct == RSP_VECTOR_VNAND || m_OpCode.funct == RSP_VECTOR_VNOR || m_OpCode.funct == RSP_VECTOR_VNXOR)
+    {
+        m_Assembler->pcmpeqw(asmjit::x86::xmm1, asmjit::x86::xmm1);
+        m_Assembler->pxor(asmjit::x86::xmm0, asmjit::x86::xmm1);
+    }
+    AccumulatorStoreLow(asmjit::x86::xmm0);
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
+}
+
+// VLT, VEQ, VNE and VGE: VCC low gets the compare, VCC high and VCO are cleared
+void CRSPRecompilerOps::VectorCompare(void)
+{
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm0);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm3, asmjit::x86::xmm1);
+
+    const asmjit::x86::Xmm * Result = &asmjit::x86::xmm4;
+    switch (m_OpCode.funct)
+    {
+    case RSP_VECTOR_VEQ:
+        // Equal lanes hold the same value in vs and vt
+        FlagToMask(asmjit::x86::xmm2, &m_Reg.m_Flags[0].UB[1]);
+        m_Assembler->pandn(asmjit::x86::xmm2, asmjit::x86::xmm3);
+        Result = &asmjit::x86::xmm1;
+        break;
+    case RSP_VECTOR_VNE:
+        FlagToMask(asmjit::x86::xmm2, &m_Reg.m_Flags[0].UB[1]);
+        m_Assembler->pcmpeqw(asmjit::x86::xmm4, asmjit::x86::xmm4);
+        m_Assembler->pxor(asmjit::x86::xmm3, asmjit::x86::xmm4);
+        m_Assembler->por(asmjit::x86::xmm2, asmjit::x86::xmm3);
+        Result = &asmjit::x86::xmm0;
+        break;
+    case RSP_VECTOR_VLT:
+        // Equal lanes count as less when VCO low and high are both set
+        FlagToMask(asmjit::x86::xmm2, &m_Reg.m_Flags[0].UB[0]);
+        FlagToMask(asmjit::x86::xmm4, &m_Reg.m_Flags[0].UB[1]);
+        m_Assembler->pand(asmjit::x86::xmm2, asmjit::x86::xmm4);
+        m_Assembler->pand(asmjit::x86::xmm3, asmjit::x86::xmm2);
+        m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm1);
+        m_Assembler->pcmpgtw(asmjit::x86::xmm2, asmjit::x86::xmm0);
+        m_Assembler->por(asmjit::x86::xmm2, asmjit::x86::xmm3);
+        VectorSelect(asmjit::x86::xmm4, asmjit::x86::xmm2, asmjit::x86::xmm0, asmjit::x86::xmm1);
+        break;
+    default:
+        // Equal lanes count as greater unless VCO low and high are both set
+        FlagToMask(asmjit::x86::xmm2, &m_Reg.m_Flags[0].UB[0]);
+        FlagToMask(asmjit::x86::xmm4, &m_Reg.m_Flags[0].UB[1]);
+        m_Assembler->pand(asmjit::x86::xmm2, asmjit::x86::xmm4);
+        m_Assembler->pandn(asmjit::x86::xmm2, asmjit::x86::xmm3);
+        m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm0);
+        m_Assembler->pcmpgtw(asmjit::x86::xmm3, asmjit::x86::xmm1);
+        m_Assembler->por(asmjit::x86::xmm2, asmjit::x86::xmm3);
+        VectorSelect(asmjit::x86::xmm4, asmjit::x86::xmm2, asmjit::x86::xmm0, asmjit::x86::xmm1);
+        break;
+    }
+    AccumulatorStoreLow(*Result);
+    VectorStore(m_OpCode.vd, *Result);
+    MaskToFlag(&m_Reg.m_Flags[1].UB[0], asmjit::x86::xmm2, false);
+    m_Assembler->mov(RegPointer(&m_Reg.m_Flags[1].UB[1], 1), 0);
+    m_Assembler->mov(RegPointer(&m_Reg.m_Flags[0].UHW[0], 2), 0);
 }
 
 // Opcode functions
@@ -54,6 +755,11 @@ void CRSPRecompilerOps::REGIMM(void)
 
 void CRSPRecompilerOps::J(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     if (m_NextInstruction == RSPPIPELINE_NORMAL)
     {
         m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
@@ -109,6 +815,11 @@ void CRSPRecompilerOps::J(void)
 
 void CRSPRecompilerOps::JAL(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     if (m_NextInstruction == RSPPIPELINE_NORMAL)
     {
         m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
@@ -138,6 +849,11 @@ void CRSPRecompilerOps::JAL(void)
 
 void CRSPRecompilerOps::BEQ(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     if (m_NextInstruction == RSPPIPELINE_NORMAL)
     {
         RSPInstruction Instruction(m_CompilePC, m_OpCode.Value);
@@ -251,6 +967,11 @@ void CRSPRecompilerOps::BEQ(void)
 
 void CRSPRecompilerOps::BNE(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     if (m_NextInstruction == RSPPIPELINE_NORMAL)
     {
         RSPInstruction Instruction(m_CompilePC, m_OpCode.Value);
@@ -351,6 +1072,11 @@ void CRSPRecompilerOps::BNE(void)
 
 void CRSPRecompilerOps::BLEZ(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     if (m_NextInstruction == RSPPIPELINE_NORMAL)
     {
         RSPInstruction Instruction(m_CompilePC, m_OpCode.Value);
@@ -428,6 +1154,11 @@ void CRSPRecompilerOps::BLEZ(void)
 
 void CRSPRecompilerOps::BGTZ(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     if (m_NextInstruction == RSPPIPELINE_NORMAL)
     {
         RSPInstruction Instruction(m_CompilePC, m_OpCode.Value);
@@ -496,42 +1227,106 @@ void CRSPRecompilerOps::BGTZ(void)
 
 void CRSPRecompilerOps::ADDI(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::ADDI, "RSPOp::ADDI");
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->add(asmjit::x86::eax, (int32_t)(short)m_OpCode.immediate);
+    m_Assembler->mov(GprPointer(m_OpCode.rt), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::ADDIU(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->add(asmjit::x86::eax, (int32_t)(short)m_OpCode.immediate);
+    m_Assembler->mov(GprPointer(m_OpCode.rt), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::SLTI(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->xor_(asmjit::x86::eax, asmjit::x86::eax);
+    m_Assembler->cmp(GprPointer(m_OpCode.rs), (int32_t)(short)m_OpCode.immediate);
+    m_Assembler->setl(asmjit::x86::al);
+    m_Assembler->mov(GprPointer(m_OpCode.rt), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::SLTIU(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->xor_(asmjit::x86::eax, asmjit::x86::eax);
+    m_Assembler->cmp(GprPointer(m_OpCode.rs), (int32_t)(short)m_OpCode.immediate);
+    m_Assembler->setb(asmjit::x86::al);
+    m_Assembler->mov(GprPointer(m_OpCode.rt), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::ANDI(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::ANDI, "RSPOp::ANDI");
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->and_(asmjit::x86::eax, m_OpCode.immediate);
+    m_Assembler->mov(GprPointer(m_OpCode.rt), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::ORI(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::ORI, "RSPOp::ORI");
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->or_(asmjit::x86::eax, m_OpCode.immediate);
+    m_Assembler->mov(GprPointer(m_OpCode.rt), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::XORI(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->xor_(asmjit::x86::eax, m_OpCode.immediate);
+    m_Assembler->mov(GprPointer(m_OpCode.rt), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::LUI(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::LUI, "RSPOp::LUI");
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(GprPointer(m_OpCode.rt), (uint32_t)m_OpCode.immediate << 16);
 }
 
 void CRSPRecompilerOps::COP0(void)
@@ -546,47 +1341,47 @@ void CRSPRecompilerOps::COP2(void)
 
 void CRSPRecompilerOps::LB(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileLoad(1, true, &RSPOp::LB, "RSPOp::LB");
 }
 
 void CRSPRecompilerOps::LH(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::LH, "RSPOp::LH");
+    CompileLoad(2, true, &RSPOp::LH, "RSPOp::LH");
 }
 
 void CRSPRecompilerOps::LW(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::LW, "RSPOp::LW");
+    CompileLoad(4, false, &RSPOp::LW, "RSPOp::LW");
 }
 
 void CRSPRecompilerOps::LBU(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::LBU, "RSPOp::LBU");
+    CompileLoad(1, false, &RSPOp::LBU, "RSPOp::LBU");
 }
 
 void CRSPRecompilerOps::LHU(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::LHU, "RSPOp::LHU");
+    CompileLoad(2, false, &RSPOp::LHU, "RSPOp::LHU");
 }
 
 void CRSPRecompilerOps::LWU(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileLoad(4, false, &RSPOp::LWU, "RSPOp::LWU");
 }
 
 void CRSPRecompilerOps::SB(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileStore(1, &RSPOp::SB, "RSPOp::SB");
 }
 
 void CRSPRecompilerOps::SH(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::SH, "RSPOp::SH");
+    CompileStore(2, &RSPOp::SH, "RSPOp::SH");
 }
 
 void CRSPRecompilerOps::SW(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::SW, "RSPOp::SW");
+    CompileStore(4, &RSPOp::SW, "RSPOp::SW");
 }
 
 void CRSPRecompilerOps::LC2(void)
@@ -608,36 +1403,87 @@ void CRSPRecompilerOps::Special_SLL(void)
         m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
         return;
     }
-    Cheat_r4300iOpcode(&RSPOp::Special_SLL, "RSPOp::Special_SLL");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->shl(asmjit::x86::eax, m_OpCode.sa);
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_SRL(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Special_SRL, "RSPOp::Special_SRL");
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->shr(asmjit::x86::eax, m_OpCode.sa);
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_SRA(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->sar(asmjit::x86::eax, m_OpCode.sa);
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_SLLV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::ecx, GprPointer(m_OpCode.rs));
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->shl(asmjit::x86::eax, asmjit::x86::cl);
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_SRLV(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Special_SRLV, "RSPOp::Special_SRLV");
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::ecx, GprPointer(m_OpCode.rs));
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->shr(asmjit::x86::eax, asmjit::x86::cl);
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_SRAV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::ecx, GprPointer(m_OpCode.rs));
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->sar(asmjit::x86::eax, asmjit::x86::cl);
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_JR(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     //uint8_t * Jump = nullptr;
 
     if (m_NextInstruction == RSPPIPELINE_NORMAL)
@@ -699,82 +1545,192 @@ void CRSPRecompilerOps::Special_JR(void)
 
 void CRSPRecompilerOps::Special_JALR(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     g_Notify->BreakPoint(__FILE__, __LINE__);
 }
 
 void CRSPRecompilerOps::Special_BREAK(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::Special_BREAK, "RSPOp::Special_BREAK");
 }
 
 void CRSPRecompilerOps::Special_ADD(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Special_ADD, "RSPOp::Special_ADD");
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->add(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_ADDU(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->add(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_SUB(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Special_SUB, "RSPOp::Special_SUB");
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->sub(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_SUBU(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->sub(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_AND(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Special_AND, "RSPOp::Special_AND");
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->and_(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_OR(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->or_(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_XOR(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->xor_(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_NOR(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->or_(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->not_(asmjit::x86::eax);
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::eax);
 }
 
 void CRSPRecompilerOps::Special_SLT(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->xor_(asmjit::x86::ecx, asmjit::x86::ecx);
+    m_Assembler->cmp(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->setl(asmjit::x86::cl);
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::ecx);
 }
 
 void CRSPRecompilerOps::Special_SLTU(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rd == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    m_Assembler->mov(asmjit::x86::eax, GprPointer(m_OpCode.rs));
+    m_Assembler->xor_(asmjit::x86::ecx, asmjit::x86::ecx);
+    m_Assembler->cmp(asmjit::x86::eax, GprPointer(m_OpCode.rt));
+    m_Assembler->setb(asmjit::x86::cl);
+    m_Assembler->mov(GprPointer(m_OpCode.rd), asmjit::x86::ecx);
 }
 
 // R4300i Opcodes: RegImm
 void CRSPRecompilerOps::RegImm_BLTZ(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     g_Notify->BreakPoint(__FILE__, __LINE__);
 }
 
 void CRSPRecompilerOps::RegImm_BGEZ(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     g_Notify->BreakPoint(__FILE__, __LINE__);
 }
 
 void CRSPRecompilerOps::RegImm_BLTZAL(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     g_Notify->BreakPoint(__FILE__, __LINE__);
 }
 
 void CRSPRecompilerOps::RegImm_BGEZAL(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        CompileBranch();
+        return;
+    }
     g_Notify->BreakPoint(__FILE__, __LINE__);
 }
 
@@ -782,11 +1738,29 @@ void CRSPRecompilerOps::RegImm_BGEZAL(void)
 
 void CRSPRecompilerOps::Cop0_MF(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        m_Assembler->MoveConstToVariable(m_System.m_SP_PC_REG, "RSP PC", m_CompilePC);
+    }
     Cheat_r4300iOpcode(&RSPOp::Cop0_MF, "RSPOp::Cop0_MF");
+    if (m_OpCode.rt == 0)
+    {
+        m_Assembler->mov(GprPointer(0), 0);
+    }
+
+    // Reading the status registers can stop the RSP
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK && m_NextInstruction == RSPPIPELINE_NORMAL)
+    {
+        CompileStopCheck((m_CompilePC + 4) & 0xFFC);
+    }
 }
 
 void CRSPRecompilerOps::Cop0_MT(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        m_Assembler->MoveConstToVariable(m_System.m_SP_PC_REG, "RSP PC", m_CompilePC);
+    }
     Cheat_r4300iOpcode(&RSPOp::Cop0_MT, "RSPOp::Cop0_MT");
 }
 
@@ -794,12 +1768,22 @@ void CRSPRecompilerOps::Cop0_MT(void)
 
 void CRSPRecompilerOps::Cop2_MF(void)
 {
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
     Cheat_r4300iOpcode(&RSPOp::Cop2_MF, "RSPOp::Cop2_MF");
 }
 
 void CRSPRecompilerOps::Cop2_CF(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    if (m_OpCode.rt == 0)
+    {
+        m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+        return;
+    }
+    Cheat_r4300iOpcode(&RSPOp::Cop2_CF, "RSPOp::Cop2_CF");
 }
 
 void CRSPRecompilerOps::Cop2_MT(void)
@@ -809,7 +1793,7 @@ void CRSPRecompilerOps::Cop2_MT(void)
 
 void CRSPRecompilerOps::Cop2_CT(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::Cop2_CT, "RSPOp::Cop2_CT");
 }
 
 void CRSPRecompilerOps::COP2_VECTOR(void)
@@ -821,253 +1805,544 @@ void CRSPRecompilerOps::COP2_VECTOR(void)
 
 void CRSPRecompilerOps::Vector_VMULF(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VMULF, "RSPOp::Vector_VMULF");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    ProductFraction();
+    m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm5);
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm6);
+    m_Assembler->movdqa(asmjit::x86::xmm4, asmjit::x86::xmm7);
+
+    // Round by adding 0x8000 to the low part
+    m_Assembler->pcmpeqw(asmjit::x86::xmm5, asmjit::x86::xmm5);
+    m_Assembler->psllw(asmjit::x86::xmm5, 15);
+    AccumulatorAdd(true, false, false);
+    AccumulatorSaturate(true);
+    AccumulatorStore();
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
 }
 
 void CRSPRecompilerOps::Vector_VMULU(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VMULU");
 }
 
 void CRSPRecompilerOps::Vector_VRNDN(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VRNDN");
 }
 
 void CRSPRecompilerOps::Vector_VRNDP(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VRNDP");
 }
 
 void CRSPRecompilerOps::Vector_VMULQ(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VMULQ");
 }
 
 void CRSPRecompilerOps::Vector_VMUDL(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VMUDL, "RSPOp::Vector_VMUDL");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm0);
+    m_Assembler->pmulhuw(asmjit::x86::xmm2, asmjit::x86::xmm1);
+    m_Assembler->pxor(asmjit::x86::xmm3, asmjit::x86::xmm3);
+    m_Assembler->pxor(asmjit::x86::xmm4, asmjit::x86::xmm4);
+    m_Assembler->movdqa(asmjit::x86::xmm0, asmjit::x86::xmm2);
+    AccumulatorStore();
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
 }
 
 void CRSPRecompilerOps::Vector_VMUDM(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VMUDM, "RSPOp::Vector_VMUDM");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    ProductSignedUnsigned(asmjit::x86::xmm0, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm5);
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm6);
+    m_Assembler->movdqa(asmjit::x86::xmm4, asmjit::x86::xmm7);
+    m_Assembler->movdqa(asmjit::x86::xmm0, asmjit::x86::xmm3);
+    AccumulatorStore();
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
 }
 
 void CRSPRecompilerOps::Vector_VMUDN(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VMUDN, "RSPOp::Vector_VMUDN");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    ProductSignedUnsigned(asmjit::x86::xmm1, asmjit::x86::xmm0);
+    m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm5);
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm6);
+    m_Assembler->movdqa(asmjit::x86::xmm4, asmjit::x86::xmm7);
+    m_Assembler->movdqa(asmjit::x86::xmm0, asmjit::x86::xmm2);
+    AccumulatorStore();
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
 }
 
 void CRSPRecompilerOps::Vector_VMUDH(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VMUDH, "RSPOp::Vector_VMUDH");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm0);
+    m_Assembler->pmullw(asmjit::x86::xmm3, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm4, asmjit::x86::xmm0);
+    m_Assembler->pmulhw(asmjit::x86::xmm4, asmjit::x86::xmm1);
+    m_Assembler->pxor(asmjit::x86::xmm2, asmjit::x86::xmm2);
+    AccumulatorSaturate(true);
+    AccumulatorStore();
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
 }
 
 void CRSPRecompilerOps::Vector_VMACF(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VMACF, "RSPOp::Vector_VMACF");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    AccumulatorLoad();
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    ProductFraction();
+    AccumulatorAdd(true, true, true);
+    AccumulatorSaturate(true);
+    AccumulatorStore();
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
 }
 
 void CRSPRecompilerOps::Vector_VMACU(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VMACU");
 }
 
 void CRSPRecompilerOps::Vector_VMACQ(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VMACQ");
 }
 
 void CRSPRecompilerOps::Vector_VMADL(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    AccumulatorLoad();
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    m_Assembler->movdqa(asmjit::x86::xmm5, asmjit::x86::xmm0);
+    m_Assembler->pmulhuw(asmjit::x86::xmm5, asmjit::x86::xmm1);
+    AccumulatorAdd(true, false, false);
+    AccumulatorSaturate(false);
+    AccumulatorStore();
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
 }
 
 void CRSPRecompilerOps::Vector_VMADM(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VMADM, "RSPOp::Vector_VMADM");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    AccumulatorLoad();
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    ProductSignedUnsigned(asmjit::x86::xmm0, asmjit::x86::xmm1);
+    AccumulatorAdd(true, true, true);
+    AccumulatorSaturate(true);
+    AccumulatorStore();
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
 }
 
 void CRSPRecompilerOps::Vector_VMADN(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VMADN, "RSPOp::Vector_VMADN");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    AccumulatorLoad();
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    ProductSignedUnsigned(asmjit::x86::xmm1, asmjit::x86::xmm0);
+    AccumulatorAdd(true, true, true);
+    AccumulatorSaturate(false);
+    AccumulatorStore();
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
 }
 
 void CRSPRecompilerOps::Vector_VMADH(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VMADH, "RSPOp::Vector_VMADH");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    AccumulatorLoad();
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    m_Assembler->movdqa(asmjit::x86::xmm6, asmjit::x86::xmm0);
+    m_Assembler->pmullw(asmjit::x86::xmm6, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm7, asmjit::x86::xmm0);
+    m_Assembler->pmulhw(asmjit::x86::xmm7, asmjit::x86::xmm1);
+    AccumulatorAdd(false, true, true);
+    AccumulatorSaturate(true);
+    AccumulatorStore();
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
 }
 
 void CRSPRecompilerOps::Vector_VADD(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VADD, "RSPOp::Vector_VADD");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    FlagToMask(asmjit::x86::xmm2, &m_Reg.m_Flags[0].UB[0]);
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm0);
+    m_Assembler->paddw(asmjit::x86::xmm3, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm4, asmjit::x86::xmm0);
+    m_Assembler->paddsw(asmjit::x86::xmm4, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm5, asmjit::x86::xmm3);
+    m_Assembler->psubw(asmjit::x86::xmm5, asmjit::x86::xmm2);
+    AccumulatorStoreLow(asmjit::x86::xmm5);
+
+    // Once s + t has saturated the carry can not bring it back in range
+    m_Assembler->pcmpeqw(asmjit::x86::xmm3, asmjit::x86::xmm4);
+    m_Assembler->psrlw(asmjit::x86::xmm2, 15);
+    m_Assembler->pand(asmjit::x86::xmm2, asmjit::x86::xmm3);
+    m_Assembler->paddsw(asmjit::x86::xmm4, asmjit::x86::xmm2);
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm4);
+    m_Assembler->mov(RegPointer(&m_Reg.m_Flags[0].UHW[0], 2), 0);
 }
 
 void CRSPRecompilerOps::Vector_VSUB(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VSUB, "RSPOp::Vector_VSUB");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    FlagToMask(asmjit::x86::xmm2, &m_Reg.m_Flags[0].UB[0]);
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm0);
+    m_Assembler->psubw(asmjit::x86::xmm3, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm4, asmjit::x86::xmm0);
+    m_Assembler->psubsw(asmjit::x86::xmm4, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm5, asmjit::x86::xmm3);
+    m_Assembler->paddw(asmjit::x86::xmm5, asmjit::x86::xmm2);
+    AccumulatorStoreLow(asmjit::x86::xmm5);
+
+    // Once s - t has saturated the carry can not bring it back in range
+    m_Assembler->pcmpeqw(asmjit::x86::xmm3, asmjit::x86::xmm4);
+    m_Assembler->psrlw(asmjit::x86::xmm2, 15);
+    m_Assembler->pand(asmjit::x86::xmm2, asmjit::x86::xmm3);
+    m_Assembler->psubsw(asmjit::x86::xmm4, asmjit::x86::xmm2);
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm4);
+    m_Assembler->mov(RegPointer(&m_Reg.m_Flags[0].UHW[0], 2), 0);
 }
 
 void CRSPRecompilerOps::Vector_VABS(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VABS");
 }
 
 void CRSPRecompilerOps::Vector_VADDC(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm0);
+    m_Assembler->paddw(asmjit::x86::xmm2, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm0);
+    m_Assembler->paddusw(asmjit::x86::xmm3, asmjit::x86::xmm1);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm3, asmjit::x86::xmm2);
+    AccumulatorStoreLow(asmjit::x86::xmm2);
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm2);
+    MaskToFlag(&m_Reg.m_Flags[0].UB[0], asmjit::x86::xmm3, true);
+    m_Assembler->mov(RegPointer(&m_Reg.m_Flags[0].UB[1], 1), 0);
 }
 
 void CRSPRecompilerOps::Vector_VSUBC(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VSUBC, "RSPOp::Vector_VSUBC");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm0);
+    m_Assembler->psubw(asmjit::x86::xmm2, asmjit::x86::xmm1);
+
+    // No borrow where t - s saturates to zero
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm1);
+    m_Assembler->psubusw(asmjit::x86::xmm3, asmjit::x86::xmm0);
+    m_Assembler->pxor(asmjit::x86::xmm4, asmjit::x86::xmm4);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm3, asmjit::x86::xmm4);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm0, asmjit::x86::xmm1);
+    AccumulatorStoreLow(asmjit::x86::xmm2);
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm2);
+    MaskToFlag(&m_Reg.m_Flags[0].UB[0], asmjit::x86::xmm3, true);
+    MaskToFlag(&m_Reg.m_Flags[0].UB[1], asmjit::x86::xmm0, true);
 }
 
 void CRSPRecompilerOps::Vector_VSAW(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VSAW, "RSPOp::Vector_VSAW");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    switch (m_OpCode.rs & 0xF)
+    {
+    case 8:
+    case 9:
+    case 10:
+        AccumulatorLoad();
+        VectorStore(m_OpCode.vd, (m_OpCode.rs & 0xF) == 8 ? asmjit::x86::xmm4 : (m_OpCode.rs & 0xF) == 9 ? asmjit::x86::xmm3 : asmjit::x86::xmm2);
+        break;
+    default:
+        m_Assembler->pxor(asmjit::x86::xmm0, asmjit::x86::xmm0);
+        VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
+        break;
+    }
 }
 
 void CRSPRecompilerOps::Vector_VLT(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    VectorCompare();
 }
 
 void CRSPRecompilerOps::Vector_VEQ(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    VectorCompare();
 }
 
 void CRSPRecompilerOps::Vector_VNE(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    VectorCompare();
 }
 
 void CRSPRecompilerOps::Vector_VGE(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VGE, "RSPOp::Vector_VGE");
+    VectorCompare();
 }
 
 void CRSPRecompilerOps::Vector_VCL(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VCL, "RSPOp::Vector_VCL");
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+
+    // Low compare: no unsigned carry out of s + t (or s + t == 0) when VCE is set, s + t == 0 with
+    // no carry when it is not
+    m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm0);
+    m_Assembler->paddw(asmjit::x86::xmm2, asmjit::x86::xmm1);
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm0);
+    m_Assembler->paddusw(asmjit::x86::xmm3, asmjit::x86::xmm1);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm3, asmjit::x86::xmm2);
+    m_Assembler->pxor(asmjit::x86::xmm4, asmjit::x86::xmm4);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm4, asmjit::x86::xmm2);
+    m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm3);
+    m_Assembler->por(asmjit::x86::xmm2, asmjit::x86::xmm4);
+    m_Assembler->pand(asmjit::x86::xmm3, asmjit::x86::xmm4);
+    FlagToMask(asmjit::x86::xmm5, &m_Reg.m_Flags[2].UB[0]);
+    VectorSelect(asmjit::x86::xmm2, asmjit::x86::xmm5, asmjit::x86::xmm2, asmjit::x86::xmm3);
+
+    // High compare: unsigned s >= t
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm1);
+    m_Assembler->psubusw(asmjit::x86::xmm3, asmjit::x86::xmm0);
+    m_Assembler->pxor(asmjit::x86::xmm4, asmjit::x86::xmm4);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm3, asmjit::x86::xmm4);
+
+    // VCC low only changes where VCO low is set and VCO high is clear, VCC high where both are clear
+    FlagToMask(asmjit::x86::xmm4, &m_Reg.m_Flags[0].UB[0]);
+    FlagToMask(asmjit::x86::xmm5, &m_Reg.m_Flags[0].UB[1]);
+    m_Assembler->movdqa(asmjit::x86::xmm6, asmjit::x86::xmm5);
+    m_Assembler->pandn(asmjit::x86::xmm6, asmjit::x86::xmm4);
+    FlagToMask(asmjit::x86::xmm7, &m_Reg.m_Flags[1].UB[0]);
+    VectorSelect(asmjit::x86::xmm2, asmjit::x86::xmm6, asmjit::x86::xmm2, asmjit::x86::xmm7);
+    m_Assembler->movdqa(asmjit::x86::xmm6, asmjit::x86::xmm2);
+    m_Assembler->por(asmjit::x86::xmm5, asmjit::x86::xmm4);
+    FlagToMask(asmjit::x86::xmm7, &m_Reg.m_Flags[1].UB[1]);
+    VectorSelect(asmjit::x86::xmm7, asmjit::x86::xmm5, asmjit::x86::xmm7, asmjit::x86::xmm3);
+    m_Assembler->movdqa(asmjit::x86::xmm5, asmjit::x86::xmm7);
+
+    // xmm4 = VCO low, xmm5 = VCC high, xmm6 = VCC low
+    m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm4);
+    m_Assembler->pandn(asmjit::x86::xmm2, asmjit::x86::xmm5);
+    VectorSelect(asmjit::x86::xmm3, asmjit::x86::xmm2, asmjit::x86::xmm1, asmjit::x86::xmm0);
+    m_Assembler->pxor(asmjit::x86::xmm2, asmjit::x86::xmm2);
+    m_Assembler->psubw(asmjit::x86::xmm2, asmjit::x86::xmm1);
+    m_Assembler->pand(asmjit::x86::xmm4, asmjit::x86::xmm6);
+    VectorSelect(asmjit::x86::xmm2, asmjit::x86::xmm4, asmjit::x86::xmm2, asmjit::x86::xmm3);
+    AccumulatorStoreLow(asmjit::x86::xmm2);
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm2);
+
+    MaskToFlag(&m_Reg.m_Flags[1].UB[0], asmjit::x86::xmm6, false);
+    MaskToFlag(&m_Reg.m_Flags[1].UB[1], asmjit::x86::xmm5, false);
+    m_Assembler->mov(RegPointer(&m_Reg.m_Flags[0].UHW[0], 2), 0);
+    m_Assembler->mov(RegPointer(&m_Reg.m_Flags[2].UB[0], 1), 0);
 }
 
 void CRSPRecompilerOps::Vector_VCH(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+
+    // xmm2 = signs differ, xmm3 = s + t
+    m_Assembler->movdqa(asmjit::x86::xmm2, asmjit::x86::xmm0);
+    m_Assembler->pxor(asmjit::x86::xmm2, asmjit::x86::xmm1);
+    m_Assembler->psraw(asmjit::x86::xmm2, 15);
+    m_Assembler->movdqa(asmjit::x86::xmm3, asmjit::x86::xmm0);
+    m_Assembler->paddw(asmjit::x86::xmm3, asmjit::x86::xmm1);
+
+    // VCE: signs differ and s + t == -1
+    m_Assembler->pcmpeqw(asmjit::x86::xmm4, asmjit::x86::xmm4);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm4, asmjit::x86::xmm3);
+    m_Assembler->pand(asmjit::x86::xmm4, asmjit::x86::xmm2);
+    MaskToFlag(&m_Reg.m_Flags[2].UB[0], asmjit::x86::xmm4, false);
+
+    // xmm3 = s + t when the signs differ, s - t when they are the same
+    m_Assembler->movdqa(asmjit::x86::xmm4, asmjit::x86::xmm0);
+    m_Assembler->psubw(asmjit::x86::xmm4, asmjit::x86::xmm1);
+    VectorSelect(asmjit::x86::xmm3, asmjit::x86::xmm2, asmjit::x86::xmm3, asmjit::x86::xmm4);
+
+    // VCO high: neither the value is 0 nor s == ~t
+    m_Assembler->pxor(asmjit::x86::xmm4, asmjit::x86::xmm4);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm4, asmjit::x86::xmm3);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm5, asmjit::x86::xmm5);
+    m_Assembler->pxor(asmjit::x86::xmm5, asmjit::x86::xmm1);
+    m_Assembler->pcmpeqw(asmjit::x86::xmm5, asmjit::x86::xmm0);
+    m_Assembler->por(asmjit::x86::xmm4, asmjit::x86::xmm5);
+    MaskToFlag(&m_Reg.m_Flags[0].UB[1], asmjit::x86::xmm4, true);
+
+    // xmm4 = value > 0 (not less or equal), xmm5 = value < 0 (not greater or equal), xmm6 = t < 0
+    m_Assembler->movdqa(asmjit::x86::xmm4, asmjit::x86::xmm3);
+    m_Assembler->pxor(asmjit::x86::xmm5, asmjit::x86::xmm5);
+    m_Assembler->pcmpgtw(asmjit::x86::xmm4, asmjit::x86::xmm5);
+    m_Assembler->movdqa(asmjit::x86::xmm5, asmjit::x86::xmm3);
+    m_Assembler->psraw(asmjit::x86::xmm5, 15);
+    m_Assembler->movdqa(asmjit::x86::xmm6, asmjit::x86::xmm1);
+    m_Assembler->psraw(asmjit::x86::xmm6, 15);
+
+    // Signs differ: less or equal ? -t : s, otherwise greater or equal ? t : s
+    m_Assembler->pxor(asmjit::x86::xmm7, asmjit::x86::xmm7);
+    m_Assembler->psubw(asmjit::x86::xmm7, asmjit::x86::xmm1);
+    VectorSelect(asmjit::x86::xmm3, asmjit::x86::xmm4, asmjit::x86::xmm0, asmjit::x86::xmm7);
+    VectorSelect(asmjit::x86::xmm7, asmjit::x86::xmm5, asmjit::x86::xmm0, asmjit::x86::xmm1);
+    m_Assembler->pxor(asmjit::x86::xmm3, asmjit::x86::xmm7);
+    m_Assembler->pand(asmjit::x86::xmm3, asmjit::x86::xmm2);
+    m_Assembler->pxor(asmjit::x86::xmm3, asmjit::x86::xmm7);
+    AccumulatorStoreLow(asmjit::x86::xmm3);
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm3);
+
+    // VCC low: signs differ ? less or equal : t < 0, VCC high: signs differ ? t < 0 : greater or equal
+    m_Assembler->pcmpeqw(asmjit::x86::xmm0, asmjit::x86::xmm0);
+    m_Assembler->pxor(asmjit::x86::xmm4, asmjit::x86::xmm0);
+    m_Assembler->pxor(asmjit::x86::xmm5, asmjit::x86::xmm0);
+    VectorSelect(asmjit::x86::xmm3, asmjit::x86::xmm2, asmjit::x86::xmm4, asmjit::x86::xmm6);
+    MaskToFlag(&m_Reg.m_Flags[1].UB[0], asmjit::x86::xmm3, false);
+    VectorSelect(asmjit::x86::xmm3, asmjit::x86::xmm2, asmjit::x86::xmm6, asmjit::x86::xmm5);
+    MaskToFlag(&m_Reg.m_Flags[1].UB[1], asmjit::x86::xmm3, false);
+    MaskToFlag(&m_Reg.m_Flags[0].UB[0], asmjit::x86::xmm2, false);
 }
 
 void CRSPRecompilerOps::Vector_VCR(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VCR");
 }
 
 void CRSPRecompilerOps::Vector_VMRG(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
+    VectorLoad(asmjit::x86::xmm0, m_OpCode.vs);
+    VectorLoadElement(asmjit::x86::xmm1, m_OpCode.vt, m_OpCode.e);
+    FlagToMask(asmjit::x86::xmm2, &m_Reg.m_Flags[1].UB[0]);
+    m_Assembler->pand(asmjit::x86::xmm0, asmjit::x86::xmm2);
+    m_Assembler->pandn(asmjit::x86::xmm2, asmjit::x86::xmm1);
+    m_Assembler->por(asmjit::x86::xmm0, asmjit::x86::xmm2);
+    AccumulatorStoreLow(asmjit::x86::xmm0);
+    VectorStore(m_OpCode.vd, asmjit::x86::xmm0);
+    m_Assembler->mov(RegPointer(&m_Reg.m_Flags[0].UHW[0], 2), 0);
 }
 
 void CRSPRecompilerOps::Vector_VAND(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VAND, "RSPOp::Vector_VAND");
+    VectorLogical();
 }
 
 void CRSPRecompilerOps::Vector_VNAND(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    VectorLogical();
 }
 
 void CRSPRecompilerOps::Vector_VOR(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    VectorLogical();
 }
 
 void CRSPRecompilerOps::Vector_VNOR(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    VectorLogical();
 }
 
 void CRSPRecompilerOps::Vector_VXOR(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::Vector_VXOR, "RSPOp::Vector_VXOR");
+    VectorLogical();
 }
 
 void CRSPRecompilerOps::Vector_VNXOR(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    VectorLogical();
 }
 
 void CRSPRecompilerOps::Vector_VRCP(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VRCP");
 }
 
 void CRSPRecompilerOps::Vector_VRCPL(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VRCPL");
 }
 
 void CRSPRecompilerOps::Vector_VRCPH(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VRCPH");
 }
 
 void CRSPRecompilerOps::Vector_VMOV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VMOV");
 }
 
 void CRSPRecompilerOps::Vector_VRSQ(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VRSQ");
 }
 
 void CRSPRecompilerOps::Vector_VRSQL(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VRSQL");
 }
 
 void CRSPRecompilerOps::Vector_VRSQH(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(m_System.m_Op.Jump_Vector[m_OpCode.funct], "RSPOp::Vector_VRSQH");
 }
 
 void CRSPRecompilerOps::Vector_VNOOP(void)
 {
+    m_Recompiler.Log("  %X %s", m_CompilePC, RSPInstruction(m_CompilePC, m_OpCode.Value).NameAndParam().c_str());
 }
 
 void CRSPRecompilerOps::Vector_Reserved(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::Vector_Reserved, "RSPOp::Vector_Reserved");
 }
 
 // LC2 functions
 
 void CRSPRecompilerOps::Opcode_LBV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileVectorLoadStore(1, false, &RSPOp::LBV, "RSPOp::LBV");
 }
 
 void CRSPRecompilerOps::Opcode_LSV(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::LSV, "RSPOp::LSV");
+    CompileVectorLoadStore(2, false, &RSPOp::LSV, "RSPOp::LSV");
 }
 
 void CRSPRecompilerOps::Opcode_LLV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileVectorLoadStore(4, false, &RSPOp::LLV, "RSPOp::LLV");
 }
 
 void CRSPRecompilerOps::Opcode_LDV(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::LDV, "RSPOp::LDV");
+    CompileVectorLoadStore(8, false, &RSPOp::LDV, "RSPOp::LDV");
 }
 
 void CRSPRecompilerOps::Opcode_LQV(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::LQV, "RSPOp::LQV");
+    CompileVectorLoadStore(16, false, &RSPOp::LQV, "RSPOp::LQV");
 }
 
 void CRSPRecompilerOps::Opcode_LRV(void)
@@ -1077,109 +2352,121 @@ void CRSPRecompilerOps::Opcode_LRV(void)
 
 void CRSPRecompilerOps::Opcode_LPV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompilePackedLoadStore(8, false, &RSPOp::LPV, "RSPOp::LPV");
 }
 
 void CRSPRecompilerOps::Opcode_LUV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompilePackedLoadStore(7, false, &RSPOp::LUV, "RSPOp::LUV");
 }
 
 void CRSPRecompilerOps::Opcode_LHV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::LHV, "RSPOp::LHV");
 }
 
 void CRSPRecompilerOps::Opcode_LFV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::LFV, "RSPOp::LFV");
 }
 
 void CRSPRecompilerOps::Opcode_LWV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::LWV, "RSPOp::LWV");
 }
 
 void CRSPRecompilerOps::Opcode_LTV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::LTV, "RSPOp::LTV");
 }
 
 // SC2 functions
 
 void CRSPRecompilerOps::Opcode_SBV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompileVectorLoadStore(1, true, &RSPOp::SBV, "RSPOp::SBV");
 }
 
 void CRSPRecompilerOps::Opcode_SSV(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::SSV, "RSPOp::SSV");
+    CompileVectorLoadStore(2, true, &RSPOp::SSV, "RSPOp::SSV");
 }
 
 void CRSPRecompilerOps::Opcode_SLV(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::SLV, "RSPOp::SLV");
+    CompileVectorLoadStore(4, true, &RSPOp::SLV, "RSPOp::SLV");
 }
 
 void CRSPRecompilerOps::Opcode_SDV(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::SDV, "RSPOp::SDV");
+    CompileVectorLoadStore(8, true, &RSPOp::SDV, "RSPOp::SDV");
 }
 
 void CRSPRecompilerOps::Opcode_SQV(void)
 {
-    Cheat_r4300iOpcode(&RSPOp::SQV, "RSPOp::SQV");
+    CompileVectorLoadStore(16, true, &RSPOp::SQV, "RSPOp::SQV");
 }
 
 void CRSPRecompilerOps::Opcode_SRV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::SRV, "RSPOp::SRV");
 }
 
 void CRSPRecompilerOps::Opcode_SPV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompilePackedLoadStore(8, true, &RSPOp::SPV, "RSPOp::SPV");
 }
 
 void CRSPRecompilerOps::Opcode_SUV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    CompilePackedLoadStore(7, true, &RSPOp::SUV, "RSPOp::SUV");
 }
 
 void CRSPRecompilerOps::Opcode_SHV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::SHV, "RSPOp::SHV");
 }
 
 void CRSPRecompilerOps::Opcode_SFV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::SFV, "RSPOp::SFV");
 }
 
 void CRSPRecompilerOps::Opcode_STV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::STV, "RSPOp::STV");
 }
 
 void CRSPRecompilerOps::Opcode_SWV(void)
 {
-    g_Notify->BreakPoint(__FILE__, __LINE__);
+    Cheat_r4300iOpcode(&RSPOp::SWV, "RSPOp::SWV");
 }
 
 // Other functions
 
 void CRSPRecompilerOps::UnknownOpcode(void)
 {
+    if (m_CurrentBlock->CodeType() == RspCodeType_BLOCK)
+    {
+        Cheat_r4300iOpcode(&RSPOp::UnknownOpcode, "RSPOp::UnknownOpcode");
+        return;
+    }
     g_Notify->BreakPoint(__FILE__, __LINE__);
 }
 
 void CRSPRecompilerOps::EnterCodeBlock(void)
 {
-    m_Assembler->sub(asmjit::x86::rsp, 40);
+    m_Assembler->push(asmjit::x86::rbx);
+    m_Assembler->push(asmjit::x86::rbp);
+    m_Assembler->sub(asmjit::x86::rsp, FrameSize);
+    m_Assembler->movdqa(asmjit::x86::xmmword_ptr(asmjit::x86::rsp, FrameSaveXmm6), asmjit::x86::xmm6);
+    m_Assembler->movdqa(asmjit::x86::xmmword_ptr(asmjit::x86::rsp, FrameSaveXmm7), asmjit::x86::xmm7);
+    m_Assembler->mov(asmjit::x86::rbx, (uint64_t)&m_Reg);
+    m_Assembler->mov(asmjit::x86::rbp, (uint64_t)&m_System.m_DMEM);
+    m_Assembler->mov(asmjit::x86::rbp, asmjit::x86::qword_ptr(asmjit::x86::rbp));
     if (Profiling && m_CurrentBlock->CodeType() == RspCodeType_TASK)
     {
-        m_Assembler->mov(asmjit::x86::rcx, asmjit::imm((uintptr_t)m_CompilePC));
+        m_Assembler->mov(RspArgReg1, asmjit::imm((uintptr_t)m_CompilePC));
         m_Assembler->CallFunc(AddressOf(&StartTimer), "StartTimer");
     }
 }
@@ -1190,8 +2477,18 @@ void CRSPRecompilerOps::ExitCodeBlock(void)
     {
         m_Assembler->CallFunc(AddressOf(&StopTimer), "StopTimer");
     }
-    m_Assembler->add(asmjit::x86::rsp, 40);
+    m_Assembler->movdqa(asmjit::x86::xmm6, asmjit::x86::xmmword_ptr(asmjit::x86::rsp, FrameSaveXmm6));
+    m_Assembler->movdqa(asmjit::x86::xmm7, asmjit::x86::xmmword_ptr(asmjit::x86::rsp, FrameSaveXmm7));
+    m_Assembler->add(asmjit::x86::rsp, FrameSize);
+    m_Assembler->pop(asmjit::x86::rbp);
+    m_Assembler->pop(asmjit::x86::rbx);
     m_Assembler->ret();
 }
 
+void CRSPRecompilerOps::CompileBlockExit(uint32_t ProgramCounter)
+{
+    m_Assembler->MoveConstToVariable(m_System.m_SP_PC_REG, "RSP PC", ProgramCounter);
+    ExitCodeBlock();
+}
+
 #endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #if defined(__amd64__) || defined(_M_X64)
 
+#include <Project64-rsp-core/Recompiler/asmjit.h>
 #include <Project64-rsp-core/cpu/RSPInterpreterOps.h>
 
 class CRSPSystem;
@@ -168,9 +169,36 @@ public:
 
     void EnterCodeBlock(void);
     void ExitCodeBlock(void);
+    void CompileBlockExit(uint32_t ProgramCounter);
 
 private:
     void Cheat_r4300iOpcode(RSPOp::Func FunctAddress, const char * FunctName);
+    void CompileBranch(void);
+    void CompileStopCheck(uint32_t ProgramCounter);
+    void CompileLoad(uint32_t Size, bool SignExtend, RSPOp::Func FunctAddress, const char * FunctName);
+    void CompileStore(uint32_t Size, RSPOp::Func FunctAddress, const char * FunctName);
+    bool CompileVectorAddress(uint32_t Size, RSPOp::Func FunctAddress, const char * FunctName, asmjit::Label & UnalignedLabel);
+    void CompileVectorUnaligned(asmjit::Label & UnalignedLabel, RSPOp::Func FunctAddress, const char * FunctName);
+    void CompileVectorLoadStore(uint32_t Size, bool Store, RSPOp::Func FunctAddress, const char * FunctName);
+    void CompilePackedLoadStore(uint32_t Shift, bool Store, RSPOp::Func FunctAddress, const char * FunctName);
+
+    asmjit::x86::Mem GprPointer(uint32_t Reg) const;
+    asmjit::x86::Mem RegPointer(const void * Variable, uint32_t Size) const;
+    void VectorLoad(const asmjit::x86::Xmm & Reg, uint32_t Vect);
+    void VectorLoadElement(const asmjit::x86::Xmm & Reg, uint32_t Vect, uint32_t Element);
+    void VectorStore(uint32_t Vect, const asmjit::x86::Xmm & Reg);
+    void VectorSelect(const asmjit::x86::Xmm & Dest, const asmjit::x86::Xmm & Mask, const asmjit::x86::Xmm & a, const asmjit::x86::Xmm & b);
+    void FlagToMask(const asmjit::x86::Xmm & Reg, const uint8_t * Flag);
+    void MaskToFlag(uint8_t * Flag, const asmjit::x86::Xmm & Reg, bool Invert);
+    void ProductFraction(void);
+    void ProductSignedUnsigned(const asmjit::x86::Xmm & Signed, const asmjit::x86::Xmm & Unsigned);
+    void AccumulatorLoad(void);
+    void AccumulatorStore(void);
+    void AccumulatorStoreLow(const asmjit::x86::Xmm & Reg);
+    void AccumulatorAdd(bool AddLow, bool AddMid, bool AddHigh);
+    void AccumulatorSaturate(bool High);
+    void VectorLogical(void);
+    void VectorCompare(void);
 
     CRSPSystem & m_System;
     CRSPRecompiler & m_Recompiler;
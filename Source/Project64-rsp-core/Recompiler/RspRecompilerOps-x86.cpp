@@ -3778,6 +3778,55 @@ void CRSPRecompilerOps::RSP_MultiElement2Mmx(int MmxReg1, int MmxReg2)
     }
 }
 
+// The accumulator is kept as low, mid and high planes; the upper 32 bits of a lane (high:mid) are
+// what the code below works with in a single register.
+void CRSPRecompilerOps::AccumulatorLoadUpper(uint8_t el, int x86reg)
+{
+    char Reg[256];
+
+    sprintf(Reg, "m_ACCUM.High(%i)", el);
+    MoveSxVariableToX86regHalf(&m_ACCUM.High(el), Reg, x86reg);
+    ShiftLeftSignImmed(x86reg, 16);
+    sprintf(Reg, "m_ACCUM.Mid(%i)", el);
+    MoveVariableToX86regHalf(&m_ACCUM.Mid(el), Reg, x86reg);
+}
+
+// Writes high:mid from x86reg, the register is shifted right by 16
+void CRSPRecompilerOps::AccumulatorStoreUpper(uint8_t el, int x86reg)
+{
+    char Reg[256];
+
+    sprintf(Reg, "m_ACCUM.Mid(%i)", el);
+    MoveX86regHalfToVariable(x86reg, &m_ACCUM.Mid(el), Reg);
+    ShiftRightSignImmed(x86reg, 16);
+    sprintf(Reg, "m_ACCUM.High(%i)", el);
+    MoveX86regHalfToVariable(x86reg, &m_ACCUM.High(el), Reg);
+}
+
+// high:mid += x86reg, TempReg is overwritten
+void CRSPRecompilerOps::AccumulatorAddUpper(uint8_t el, int x86reg, int TempReg)
+{
+    char Reg[256];
+
+    MoveX86RegToX86Reg(x86reg, TempReg);
+    ShiftRightUnsignImmed(TempReg, 16);
+    sprintf(Reg, "m_ACCUM.Mid(%i)", el);
+    AddX86regHalfToVariable(x86reg, &m_ACCUM.Mid(el), Reg);
+    sprintf(Reg, "m_ACCUM.High(%i)", el);
+    AdcX86regHalfToVariable(TempReg, &m_ACCUM.High(el), Reg);
+}
+
+// Adds the 48-bit value EDX:AX to the accumulator, EAX and EDX are overwritten
+void CRSPRecompilerOps::AccumulatorAdd(uint8_t el)
+{
+    char Reg[256];
+
+    sprintf(Reg, "m_ACCUM.Low(%i)", el);
+    AddX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
+    AdcConstToX86reg(0, x86_EDX);
+    AccumulatorAddUpper(el, x86_EDX, x86_EAX);
+}
+
 bool CRSPRecompilerOps::Compile_Vector_VMULF_MMX(void)
 {
     char Reg[256];
@@ -3900,10 +3949,12 @@ void CRSPRecompilerOps::Vector_VMULF(void)
 
         if (bWriteToAccum)
         {
-            MoveX86regToVariable(x86_EAX, &m_ACCUM[el].HW[1], "m_ACCUM[el].HW[1]");
-            // Calculate sign extension into EDX
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), "m_ACCUM.Low(el)");
             MoveX86RegToX86Reg(x86_EAX, x86_EDX);
-            ShiftRightSignImmed(x86_EDX, 31);
+            ShiftRightSignImmed(x86_EDX, 16);
+            MoveX86regHalfToVariable(x86_EDX, &m_ACCUM.Mid(el), "m_ACCUM.Mid(el)");
+            // Calculate sign extension into EDX
+            ShiftRightSignImmed(x86_EDX, 15);
         }
 
         CompConstToX86reg(x86_EAX, 0x80008000);
@@ -3911,7 +3962,7 @@ void CRSPRecompilerOps::Vector_VMULF(void)
         if (bWriteToAccum)
         {
             CondMoveEqual(x86_EDX, x86_EDI);
-            MoveX86regHalfToVariable(x86_EDX, &m_ACCUM[el].HW[3], "m_ACCUM[el].HW[3]");
+            MoveX86regHalfToVariable(x86_EDX, &m_ACCUM.High(el), "m_ACCUM.High(el)");
         }
         if (bWriteToDest)
         {
@@ -4046,18 +4097,20 @@ void CRSPRecompilerOps::Vector_VMUDL(void)
         }
 
         imulX86reg(x86_EBX);
+        ShiftRightUnsignImmed(x86_EAX, 16);
 
         if (bWriteToAccum)
         {
-            sprintf(Reg, "m_ACCUM[%i].UW[0]", el);
-            MoveX86regToVariable(x86_EAX, &m_ACCUM[el].UW[0], Reg);
-            sprintf(Reg, "m_ACCUM[%i].UW[1]", el);
-            MoveX86regToVariable(x86_EDI, &m_ACCUM[el].UW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
+            sprintf(Reg, "m_ACCUM.Mid(%i)", el);
+            MoveX86regHalfToVariable(x86_EDI, &m_ACCUM.Mid(el), Reg);
+            sprintf(Reg, "m_ACCUM.High(%i)", el);
+            MoveX86regHalfToVariable(x86_EDI, &m_ACCUM.High(el), Reg);
         }
 
         if (bWriteToDest)
         {
-            ShiftRightUnsignImmed(x86_EAX, 16);
             sprintf(Reg, "m_Vect[%i].HW[%i]", m_OpCode.sa, el);
             MoveX86regHalfToVariable(x86_EAX, &m_Vect[m_OpCode.vd].s16(el), Reg);
         }
@@ -4231,14 +4284,16 @@ void CRSPRecompilerOps::Vector_VMUDM(void)
         {
             MoveX86RegToX86Reg(x86_EAX, x86_EDX);
             ShiftRightSignImmed(x86_EDX, 16);
-            ShiftLeftSignImmed(x86_EAX, 16);
 
             if (bWriteToAccum)
             {
-                sprintf(Reg, "m_ACCUM[%i].UW[0]", el);
-                MoveX86regToVariable(x86_EAX, &m_ACCUM[el].UW[0], Reg);
-                sprintf(Reg, "m_ACCUM[%i].UW[1]", el);
-                MoveX86regToVariable(x86_EDX, &m_ACCUM[el].UW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
+                ShiftRightSignImmed(x86_EAX, 31);
+                sprintf(Reg, "m_ACCUM.Mid(%i)", el);
+                MoveX86regHalfToVariable(x86_EDX, &m_ACCUM.Mid(el), Reg);
+                sprintf(Reg, "m_ACCUM.High(%i)", el);
+                MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.High(el), Reg);
             }
             if (bWriteToDest)
             {
@@ -4356,13 +4411,10 @@ void CRSPRecompilerOps::Vector_VMUDN(void)
 
         if (bWriteToAccum)
         {
-            MoveX86RegToX86Reg(x86_EAX, x86_EDX);
-            ShiftRightSignImmed(x86_EDX, 16);
-            ShiftLeftSignImmed(x86_EAX, 16);
-            sprintf(Reg, "m_ACCUM[%i].UW[0]", el);
-            MoveX86regToVariable(x86_EAX, &m_ACCUM[el].UW[0], Reg);
-            sprintf(Reg, "m_ACCUM[%i].UW[1]", el);
-            MoveX86regToVariable(x86_EDX, &m_ACCUM[el].UW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
+            ShiftRightSignImmed(x86_EAX, 16);
+            AccumulatorStoreUpper(el, x86_EAX);
         }
     }
     Pop(x86_EBP);
@@ -4499,16 +4551,30 @@ void CRSPRecompilerOps::Vector_VMUDH(void)
         ImulX86RegToX86Reg(x86_ESI, x86_EBX);
         XorX86RegToX86Reg(x86_EDX, x86_EDX);
 
-        MoveOffsetToX86reg((size_t)&m_ACCUM[0].W[0], "m_ACCUM[0].W[0]", x86_EBP);
+        // Low is zero, the products go to mid and high
+        MoveOffsetToX86reg((size_t)&m_ACCUM.Low(0), "m_ACCUM.Low(0)", x86_EBP);
 
         MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 0);
-        MoveX86RegToX86regPointerDisp(x86_EAX, x86_EBP, 4);
-        MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 8);
-        MoveX86RegToX86regPointerDisp(x86_ECX, x86_EBP, 12);
-        MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 16);
-        MoveX86RegToX86regPointerDisp(x86_EDI, x86_EBP, 20);
-        MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 24);
-        MoveX86RegToX86regPointerDisp(x86_ESI, x86_EBP, 28);
+        MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 4);
+
+        MoveOffsetToX86reg((size_t)&m_ACCUM.Mid(0), "m_ACCUM.Mid(0)", x86_EBP);
+
+        MoveX86regHalfToX86regPointerDisp(x86_EAX, x86_EBP, 0);
+        MoveX86regHalfToX86regPointerDisp(x86_ECX, x86_EBP, 2);
+        MoveX86regHalfToX86regPointerDisp(x86_EDI, x86_EBP, 4);
+        MoveX86regHalfToX86regPointerDisp(x86_ESI, x86_EBP, 6);
+
+        ShiftRightSignImmed(x86_EAX, 16);
+        ShiftRightSignImmed(x86_ECX, 16);
+        ShiftRightSignImmed(x86_EDI, 16);
+        ShiftRightSignImmed(x86_ESI, 16);
+
+        MoveOffsetToX86reg((size_t)&m_ACCUM.High(0), "m_ACCUM.High(0)", x86_EBP);
+
+        MoveX86regHalfToX86regPointerDisp(x86_EAX, x86_EBP, 0);
+        MoveX86regHalfToX86regPointerDisp(x86_ECX, x86_EBP, 2);
+        MoveX86regHalfToX86regPointerDisp(x86_EDI, x86_EBP, 4);
+        MoveX86regHalfToX86regPointerDisp(x86_ESI, x86_EBP, 6);
 
         // Pipe lined segment 1
 
@@ -4526,16 +4592,30 @@ void CRSPRecompilerOps::Vector_VMUDH(void)
         ImulX86RegToX86Reg(x86_ESI, x86_EBX);
         XorX86RegToX86Reg(x86_EDX, x86_EDX);
 
-        MoveOffsetToX86reg((size_t)&m_ACCUM[0].W[0], "m_ACCUM[0].W[0]", x86_EBP);
+        // Low is zero, the products go to mid and high
+        MoveOffsetToX86reg((size_t)&m_ACCUM.Low(0), "m_ACCUM.Low(0)", x86_EBP);
 
-        MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 32);
-        MoveX86RegToX86regPointerDisp(x86_EAX, x86_EBP, 36);
-        MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 40);
-        MoveX86RegToX86regPointerDisp(x86_ECX, x86_EBP, 44);
-        MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 48);
-        MoveX86RegToX86regPointerDisp(x86_EDI, x86_EBP, 52);
-        MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 56);
-        MoveX86RegToX86regPointerDisp(x86_ESI, x86_EBP, 60);
+        MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 8);
+        MoveX86RegToX86regPointerDisp(x86_EDX, x86_EBP, 12);
+
+        MoveOffsetToX86reg((size_t)&m_ACCUM.Mid(0), "m_ACCUM.Mid(0)", x86_EBP);
+
+        MoveX86regHalfToX86regPointerDisp(x86_EAX, x86_EBP, 8);
+        MoveX86regHalfToX86regPointerDisp(x86_ECX, x86_EBP, 10);
+        MoveX86regHalfToX86regPointerDisp(x86_EDI, x86_EBP, 12);
+        MoveX86regHalfToX86regPointerDisp(x86_ESI, x86_EBP, 14);
+
+        ShiftRightSignImmed(x86_EAX, 16);
+        ShiftRightSignImmed(x86_ECX, 16);
+        ShiftRightSignImmed(x86_EDI, 16);
+        ShiftRightSignImmed(x86_ESI, 16);
+
+        MoveOffsetToX86reg((size_t)&m_ACCUM.High(0), "m_ACCUM.High(0)", x86_EBP);
+
+        MoveX86regHalfToX86regPointerDisp(x86_EAX, x86_EBP, 8);
+        MoveX86regHalfToX86regPointerDisp(x86_ECX, x86_EBP, 10);
+        MoveX86regHalfToX86regPointerDisp(x86_EDI, x86_EBP, 12);
+        MoveX86regHalfToX86regPointerDisp(x86_ESI, x86_EBP, 14);
 
         Pop(x86_EBP);
     }
@@ -4574,8 +4654,9 @@ void CRSPRecompilerOps::Vector_VMUDH(void)
 
             if (bWriteToAccum)
             {
-                MoveX86regToVariable(x86_EAX, &m_ACCUM[el].W[1], "m_ACCUM[el].W[1]");
-                MoveConstToVariable(0, &m_ACCUM[el].W[0], "m_ACCUM[el].W[0]");
+                MoveConstHalfToVariable(0, &m_ACCUM.Low(el), "m_ACCUM.Low(el)");
+                MoveX86RegToX86Reg(x86_EAX, x86_EDX);
+                AccumulatorStoreUpper(el, x86_EDX);
             }
 
             if (bWriteToDest)
@@ -4641,14 +4722,12 @@ void CRSPRecompilerOps::Vector_VMACF(void)
 
         MoveX86RegToX86Reg(x86_EAX, x86_EDX);
         ShiftRightSignImmed(x86_EDX, 15);
-        ShiftLeftSignImmed(x86_EAX, 17);
-
-        AddX86regToVariable(x86_EAX, &m_ACCUM[el].W[0], "m_ACCUM[el].W[0]");
-        AdcX86regToVariable(x86_EDX, &m_ACCUM[el].W[1], "m_ACCUM[el].W[1]");
+        ShiftLeftSignImmed(x86_EAX, 1);
+        AccumulatorAdd(el);
 
         if (bWriteToDest)
         {
-            MoveVariableToX86reg(&m_ACCUM[el].W[1], "m_ACCUM[el].W[1]", x86_EAX);
+            AccumulatorLoadUpper(el, x86_EAX);
 
             CompX86RegToX86Reg(x86_EAX, x86_ESI);
             CondMoveGreater(x86_EAX, x86_ESI);
@@ -4720,16 +4799,15 @@ void CRSPRecompilerOps::Vector_VMADL(void)
         }
 
         imulX86reg(x86_EBX);
-        sprintf(Reg, "m_ACCUM[%i].W[0]", el);
-        AddX86regToVariable(x86_EAX, &m_ACCUM[el].W[0], Reg);
-        sprintf(Reg, "m_ACCUM[%i].W[1]", el);
-        AdcConstToVariable(&m_ACCUM[el].W[1], Reg, 0);
+        ShiftRightUnsignImmed(x86_EAX, 16);
+        XorX86RegToX86Reg(x86_EDX, x86_EDX);
+        AccumulatorAdd(el);
 
         if (bWriteToDest != false)
         {
             XorX86RegToX86Reg(x86_EDX, x86_EDX);
-            MoveVariableToX86reg(&m_ACCUM[el].W[1], "m_ACCUM[el].W[1]", x86_EAX);
-            MoveZxVariableToX86regHalf(&m_ACCUM[el].HW[1], "m_ACCUM[el].hW[1]", x86_ECX);
+            AccumulatorLoadUpper(el, x86_EAX);
+            MoveZxVariableToX86regHalf(&m_ACCUM.Low(el), "m_ACCUM.Low(el)", x86_ECX);
 
             CompX86RegToX86Reg(x86_EAX, x86_ESI);
             CondMoveGreater(x86_ECX, x86_EBP);
@@ -4818,15 +4896,12 @@ void CRSPRecompilerOps::Vector_VMADM(void)
 
         MoveX86RegToX86Reg(x86_EAX, x86_EDX);
         ShiftRightSignImmed(x86_EDX, 16);
-        ShiftLeftSignImmed(x86_EAX, 16);
-        AddX86regToVariable(x86_EAX, &m_ACCUM[el].W[0], "m_ACCUM[el].W[0]");
-        AdcX86regToVariable(x86_EDX, &m_ACCUM[el].W[1], "m_ACCUM[el].W[1]");
+        AccumulatorAdd(el);
 
         if (bWriteToDest)
         {
             // For compare
-            sprintf(Reg, "m_ACCUM[%i].W[1]", el);
-            MoveVariableToX86reg(&m_ACCUM[el].W[1], "m_ACCUM[el].W[1]", x86_EAX);
+            AccumulatorLoadUpper(el, x86_EAX);
 
             CompX86RegToX86Reg(x86_EAX, x86_ESI);
             CondMoveGreater(x86_EAX, x86_ESI);
@@ -4895,19 +4970,16 @@ void CRSPRecompilerOps::Vector_VMADN(void)
 
         MoveX86RegToX86Reg(x86_EAX, x86_EDX);
         ShiftRightSignImmed(x86_EDX, 16);
-        ShiftLeftSignImmed(x86_EAX, 16);
-        AddX86regToVariable(x86_EAX, &m_ACCUM[el].W[0], "m_ACCUM[el].W[0]");
-        AdcX86regToVariable(x86_EDX, &m_ACCUM[el].W[1], "m_ACCUM[el].W[1]");
+        AccumulatorAdd(el);
 
         if (bWriteToDest)
         {
             // For compare
-            sprintf(Reg, "m_ACCUM[%i].W[1]", el);
-            MoveVariableToX86reg(&m_ACCUM[el].W[1], Reg, x86_EAX);
+            AccumulatorLoadUpper(el, x86_EAX);
 
             // For vector
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveVariableToX86regHalf(&m_ACCUM[el].HW[1], Reg, x86_ECX);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveVariableToX86regHalf(&m_ACCUM.Low(el), Reg, x86_ECX);
 
             // TODO: Weird eh?
             CompConstToX86reg(x86_EAX, 0x7fff);
@@ -4970,14 +5042,10 @@ void CRSPRecompilerOps::Vector_VMADH(void)
         ImulX86RegToX86Reg(x86_EDI, x86_EBX);
         ImulX86RegToX86Reg(x86_ESI, x86_EBX);
 
-        sprintf(Reg, "m_ACCUM[%i].W[1]", 0);
-        AddX86regToVariable(x86_EAX, &m_ACCUM[0].W[1], Reg);
-        sprintf(Reg, "m_ACCUM[%i].W[1]", 1);
-        AddX86regToVariable(x86_ECX, &m_ACCUM[1].W[1], Reg);
-        sprintf(Reg, "m_ACCUM[%i].W[1]", 2);
-        AddX86regToVariable(x86_EDI, &m_ACCUM[2].W[1], Reg);
-        sprintf(Reg, "m_ACCUM[%i].W[1]", 3);
-        AddX86regToVariable(x86_ESI, &m_ACCUM[3].W[1], Reg);
+        AccumulatorAddUpper(0, x86_EAX, x86_EDX);
+        AccumulatorAddUpper(1, x86_ECX, x86_EDX);
+        AccumulatorAddUpper(2, x86_EDI, x86_EDX);
+        AccumulatorAddUpper(3, x86_ESI, x86_EDX);
 
         // Pipe lined segment 1
 
@@ -4991,14 +5059,10 @@ void CRSPRecompilerOps::Vector_VMADH(void)
         ImulX86RegToX86Reg(x86_EDI, x86_EBX);
         ImulX86RegToX86Reg(x86_ESI, x86_EBX);
 
-        sprintf(Reg, "m_ACCUM[%i].W[1]", 4);
-        AddX86regToVariable(x86_EAX, &m_ACCUM[4].W[1], Reg);
-        sprintf(Reg, "m_ACCUM[%i].W[1]", 5);
-        AddX86regToVariable(x86_ECX, &m_ACCUM[5].W[1], Reg);
-        sprintf(Reg, "m_ACCUM[%i].W[1]", 6);
-        AddX86regToVariable(x86_EDI, &m_ACCUM[6].W[1], Reg);
-        sprintf(Reg, "m_ACCUM[%i].W[1]", 7);
-        AddX86regToVariable(x86_ESI, &m_ACCUM[7].W[1], Reg);
+        AccumulatorAddUpper(4, x86_EAX, x86_EDX);
+        AccumulatorAddUpper(5, x86_ECX, x86_EDX);
+        AccumulatorAddUpper(6, x86_EDI, x86_EDX);
+        AccumulatorAddUpper(7, x86_ESI, x86_EDX);
 
         Pop(x86_EBP);
     }
@@ -5043,12 +5107,11 @@ void CRSPRecompilerOps::Vector_VMADH(void)
             }
 
             imulX86reg(x86_EBX);
-            sprintf(Reg, "m_ACCUM[%i].W[1]", el);
-            AddX86regToVariable(x86_EAX, &m_ACCUM[el].W[1], Reg);
+            AccumulatorAddUpper(el, x86_EAX, x86_EDX);
 
             if (bWriteToDest)
             {
-                MoveVariableToX86reg(&m_ACCUM[el].W[1], "m_ACCUM[el].W[1]", x86_EAX);
+                AccumulatorLoadUpper(el, x86_EAX);
 
                 CompX86RegToX86Reg(x86_EAX, x86_ESI);
                 CondMoveGreater(x86_EAX, x86_ESI);
@@ -5185,8 +5248,8 @@ void CRSPRecompilerOps::Vector_VADD(void)
 
         if (bWriteToAccum != false)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[el].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
         }
         if (bWriteToDest != false)
         {
@@ -5323,8 +5386,8 @@ void CRSPRecompilerOps::Vector_VSUB(void)
 
         if (bWriteToAccum != false)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[el].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
         }
 
         if (bWriteToDest != false)
@@ -5488,8 +5551,8 @@ void CRSPRecompilerOps::Vector_VABS(void)
             }
             if (bWriteToAccum)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
             }
         }
         else
@@ -5525,8 +5588,8 @@ void CRSPRecompilerOps::Vector_VABS(void)
             }
             if (bWriteToAccum)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_EDI, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_EDI, &m_ACCUM.Low(el), Reg);
             }
         }
     }
@@ -5590,8 +5653,8 @@ void CRSPRecompilerOps::Vector_VADDC(void)
 
         if (bWriteToAccum != false)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[el].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
         }
 
         if (bWriteToDest != false)
@@ -5660,8 +5723,8 @@ void CRSPRecompilerOps::Vector_VSUBC(void)
 
         if (bWriteToAccum != false)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[el].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
         }
         if (bWriteToDest != false)
         {
@@ -5694,28 +5757,18 @@ void CRSPRecompilerOps::Vector_VSAW(void)
         return;
     }
 
-    sprintf(Reg, "m_ACCUM[1].HW[%i]", Word);
-    MoveVariableToX86regHalf(&m_ACCUM[1].HW[Word], Reg, x86_EAX);
-    sprintf(Reg, "m_ACCUM[3].HW[%i]", Word);
-    MoveVariableToX86regHalf(&m_ACCUM[3].HW[Word], Reg, x86_EBX);
-    sprintf(Reg, "m_ACCUM[5].HW[%i]", Word);
-    MoveVariableToX86regHalf(&m_ACCUM[5].HW[Word], Reg, x86_ECX);
-    sprintf(Reg, "m_ACCUM[7].HW[%i]", Word);
-    MoveVariableToX86regHalf(&m_ACCUM[7].HW[Word], Reg, x86_EDX);
-
-    ShiftLeftSignImmed(x86_EAX, 16);
-    ShiftLeftSignImmed(x86_EBX, 16);
-    ShiftLeftSignImmed(x86_ECX, 16);
-    ShiftLeftSignImmed(x86_EDX, 16);
-
-    sprintf(Reg, "m_ACCUM[0].HW[%i]", Word);
-    MoveVariableToX86regHalf(&m_ACCUM[0].HW[Word], Reg, x86_EAX);
-    sprintf(Reg, "m_ACCUM[2].HW[%i]", Word);
-    MoveVariableToX86regHalf(&m_ACCUM[2].HW[Word], Reg, x86_EBX);
-    sprintf(Reg, "m_ACCUM[4].HW[%i]", Word);
-    MoveVariableToX86regHalf(&m_ACCUM[4].HW[Word], Reg, x86_ECX);
-    sprintf(Reg, "m_ACCUM[6].HW[%i]", Word);
-    MoveVariableToX86regHalf(&m_ACCUM[6].HW[Word], Reg, x86_EDX);
+    // Each part of the accumulator is stored as eight lanes, copy it straight across
+    int16_t * Plane = Word == 3 ? &m_ACCUM.High(0) : Word == 2 ? &m_ACCUM.Mid(0) : &m_ACCUM.Low(0);
+    const char * PlaneName = Word == 3 ? "m_ACCUM.High" : Word == 2 ? "m_ACCUM.Mid" : "m_ACCUM.Low";
+
+    sprintf(Reg, "%s(0)", PlaneName);
+    MoveVariableToX86reg(&Plane[0], Reg, x86_EAX);
+    sprintf(Reg, "%s(2)", PlaneName);
+    MoveVariableToX86reg(&Plane[2], Reg, x86_EBX);
+    sprintf(Reg, "%s(4)", PlaneName);
+    MoveVariableToX86reg(&Plane[4], Reg, x86_ECX);
+    sprintf(Reg, "%s(6)", PlaneName);
+    MoveVariableToX86reg(&Plane[6], Reg, x86_EDX);
 
     sprintf(Reg, "m_Vect[%i].HW[0]", m_OpCode.sa);
     MoveX86regToVariable(x86_EAX, &m_Vect[m_OpCode.vd].s16(0), Reg);
@@ -5765,8 +5818,8 @@ void CRSPRecompilerOps::Vector_VLT(void)
 
             if (bWriteToAccum || bWriteToDest)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_EDX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_EDX, &m_ACCUM.Low(el), Reg);
             }
             OrConstToX86Reg((flag & 0xFF), x86_EBX);
 
@@ -5776,8 +5829,8 @@ void CRSPRecompilerOps::Vector_VLT(void)
 
             if (bWriteToAccum || bWriteToDest)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM.Low(el), Reg);
             }
             JneLabel8("jne", 0);
             jump[2] = (uint8_t *)(RecompPos - 1);
@@ -5796,8 +5849,8 @@ void CRSPRecompilerOps::Vector_VLT(void)
             MoveX86RegToX86Reg(x86_ESI, x86_EDI);
             if (bWriteToAccum || bWriteToDest)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM.Low(el), Reg);
             }
             AndConstToX86Reg(x86_EDI, flag);
             ShiftRightUnsignImmed(x86_EDI, 8);
@@ -5813,11 +5866,11 @@ void CRSPRecompilerOps::Vector_VLT(void)
     {
         for (el = 0; el < 8; el += 2)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveVariableToX86regHalf(&m_ACCUM[el].HW[1], Reg, x86_EAX);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveVariableToX86regHalf(&m_ACCUM.Low(el), Reg, x86_EAX);
 
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el + 1);
-            MoveVariableToX86regHalf(&m_ACCUM[el + 1].HW[1], Reg, x86_ECX);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el + 1);
+            MoveVariableToX86regHalf(&m_ACCUM.Low(el + 1), Reg, x86_ECX);
 
             sprintf(Reg, "m_Vect[%i].HW[%i]", m_OpCode.sa, el);
             MoveX86regHalfToVariable(x86_EAX, &m_Vect[m_OpCode.vd].s16(el), Reg);
@@ -5862,8 +5915,8 @@ void CRSPRecompilerOps::Vector_VEQ(void)
 
             if (bWriteToAccum)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM.Low(el), Reg);
             }
 
             SubX86RegToX86Reg(x86_EDX, x86_ECX);
@@ -5876,8 +5929,8 @@ void CRSPRecompilerOps::Vector_VEQ(void)
         {
             if (bWriteToAccum)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM.Low(el), Reg);
             }
         }
     }
@@ -5937,8 +5990,8 @@ void CRSPRecompilerOps::Vector_VNE(void)
             }
             if (bWriteToAccum)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_EDX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_EDX, &m_ACCUM.Low(el), Reg);
             }
 
             SubX86RegToX86Reg(x86_EDX, x86_ECX);
@@ -5951,8 +6004,8 @@ void CRSPRecompilerOps::Vector_VNE(void)
         {
             if (bWriteToAccum)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_EDX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_EDX, &m_ACCUM.Low(el), Reg);
             }
         }
     }
@@ -6068,8 +6121,8 @@ void CRSPRecompilerOps::Vector_VGE(void)
 
             if (bWriteToAccum || bWriteToDest)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_EDX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_EDX, &m_ACCUM.Low(el), Reg);
             }
             OrConstToX86Reg((flag & 0xFF), x86_EBX);
 
@@ -6079,8 +6132,8 @@ void CRSPRecompilerOps::Vector_VGE(void)
 
             if (bWriteToAccum || bWriteToDest)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM.Low(el), Reg);
             }
 
             JneLabel8("jne", 0);
@@ -6101,8 +6154,8 @@ void CRSPRecompilerOps::Vector_VGE(void)
             MoveX86RegToX86Reg(x86_ESI, x86_EDI);
             if (bWriteToAccum || bWriteToDest)
             {
-                sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM[el].HW[1], Reg);
+                sprintf(Reg, "m_ACCUM.Low(%i)", el);
+                MoveX86regHalfToVariable(x86_ECX, &m_ACCUM.Low(el), Reg);
             }
             AndConstToX86Reg(x86_EDI, flag);
             SubConstFromX86Reg(x86_EDI, flag);
@@ -6119,11 +6172,11 @@ void CRSPRecompilerOps::Vector_VGE(void)
     {
         for (el = 0; el < 8; el += 2)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el + 0);
-            MoveVariableToX86regHalf(&m_ACCUM[el].HW[1], Reg, x86_EAX);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el + 0);
+            MoveVariableToX86regHalf(&m_ACCUM.Low(el), Reg, x86_EAX);
 
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el + 1);
-            MoveVariableToX86regHalf(&m_ACCUM[el + 1].HW[1], Reg, x86_ECX);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el + 1);
+            MoveVariableToX86regHalf(&m_ACCUM.Low(el + 1), Reg, x86_ECX);
 
             sprintf(Reg, "m_Vect[%i].HW[%i]", m_OpCode.sa, el + 0);
             MoveX86regHalfToVariable(x86_EAX, &m_Vect[m_OpCode.vd].s16(el + 0), Reg);
@@ -6179,8 +6232,8 @@ void CRSPRecompilerOps::Vector_VMRG(void)
 
         if (bWriteToAccum)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveX86regHalfToVariable(x86_ECX, &m_ACCUM[el].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_ECX, &m_ACCUM.Low(el), Reg);
         }
         sprintf(Reg, "m_Vect[%i].HW[%i]", m_OpCode.sa, el);
         MoveX86regHalfToVariable(x86_ECX, &m_Vect[m_OpCode.vd].s16(el), Reg);
@@ -6288,8 +6341,8 @@ void CRSPRecompilerOps::Vector_VAND(void)
 
         if (bWriteToAccum != false)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[el].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
         }
     }
 #endif
@@ -6400,8 +6453,8 @@ void CRSPRecompilerOps::Vector_VNAND(void)
 
         if (bWriteToAccum != false)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[el].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
         }
     }
 #endif
@@ -6503,8 +6556,8 @@ void CRSPRecompilerOps::Vector_VOR(void)
 
         if (bWriteToAccum != false)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[el].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
         }
         sprintf(Reg, "m_Vect[%i].HW[%i]", m_OpCode.sa, el);
         MoveX86regHalfToVariable(x86_EAX, &m_Vect[m_OpCode.vd].s16(el), Reg);
@@ -6610,8 +6663,8 @@ void CRSPRecompilerOps::Vector_VNOR(void)
 
         if (bWriteToAccum != false)
         {
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", el);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[el].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", el);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(el), Reg);
         }
         sprintf(Reg, "m_Vect[%i].HW[%i]", m_OpCode.sa, el);
         MoveX86regHalfToVariable(x86_EAX, &m_Vect[m_OpCode.vd].s16(el), Reg);
@@ -6700,8 +6753,8 @@ void CRSPRecompilerOps::Vector_VXOR(void)
                 XorX86RegToX86Reg(x86_EAX, x86_EAX);
                 for (count = 0; count < 8; count++)
                 {
-                    sprintf(Reg, "m_ACCUM[%i].HW[1]", count);
-                    MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[count].HW[1], Reg);
+                    sprintf(Reg, "m_ACCUM.Low(%i)", count);
+                    MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(count), Reg);
                 }
             }
             return;
@@ -6796,8 +6849,8 @@ void CRSPRecompilerOps::Vector_VNXOR(void)
                 OrConstToX86Reg(0xFFFFFFFF, x86_EAX);
                 for (count = 0; count < 8; count++)
                 {
-                    sprintf(Reg, "m_ACCUM[%i].HW[1]", count);
-                    MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[count].HW[1], Reg);
+                    sprintf(Reg, "m_ACCUM.Low(%i)", count);
+                    MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(count), Reg);
                 }
             }
             return;
@@ -6865,8 +6918,8 @@ void CRSPRecompilerOps::Vector_VRCP(void)
                 last = el;
             }
 
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", count);
-            MoveX86regHalfToVariable(x86_ECX, &m_ACCUM[count].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", count);
+            MoveX86regHalfToVariable(x86_ECX, &m_ACCUM.Low(count), Reg);
         }
     }
 
@@ -6941,8 +6994,8 @@ void CRSPRecompilerOps::Vector_VRCPL(void)
                 last = el;
             }
 
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", count);
-            MoveX86regHalfToVariable(x86_ECX, &m_ACCUM[count].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", count);
+            MoveX86regHalfToVariable(x86_ECX, &m_ACCUM.Low(count), Reg);
         }
     }
 
@@ -6985,8 +7038,8 @@ void CRSPRecompilerOps::Vector_VRCPH(void)
                 last = el;
             }
 
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", count);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[count].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", count);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(count), Reg);
         }
     }
 
@@ -7013,8 +7066,8 @@ void CRSPRecompilerOps::Vector_VMOV(void)
         {
             sprintf(Reg, "m_Vect[%i].UHW[%i]", m_OpCode.rt, EleSpec[m_OpCode.e].B[count]);
             MoveVariableToX86regHalf(&m_Vect[m_OpCode.vt].u16(EleSpec[m_OpCode.e].B[count]), Reg, x86_EAX);
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", count);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[count].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", count);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(count), Reg);
         }
     }
 
@@ -7074,8 +7127,8 @@ void CRSPRecompilerOps::Vector_VRSQH(void)
                 last = el;
             }
 
-            sprintf(Reg, "m_ACCUM[%i].HW[1]", count);
-            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM[count].HW[1], Reg);
+            sprintf(Reg, "m_ACCUM.Low(%i)", count);
+            MoveX86regHalfToVariable(x86_EAX, &m_ACCUM.Low(count), Reg);
         }
     }
 
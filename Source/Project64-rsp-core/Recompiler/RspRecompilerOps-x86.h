@@ -187,6 +187,10 @@ private:
     bool WriteToVectorDest2(uint32_t DestReg, int PC, bool RecursiveCall);
     void RSP_Element2Mmx(int MmxReg);
     void RSP_MultiElement2Mmx(int MmxReg1, int MmxReg2);
+    void AccumulatorLoadUpper(uint8_t el, int x86reg);
+    void AccumulatorStoreUpper(uint8_t el, int x86reg);
+    void AccumulatorAddUpper(uint8_t el, int x86reg, int TempReg);
+    void AccumulatorAdd(uint8_t el);
     void CompileBranchExit(uint32_t TargetPC, uint32_t ContinuePC);
     bool Compile_Vector_VMULF_MMX(void);
     bool Compile_Vector_VMUDL_MMX(void);
@@ -229,7 +233,7 @@ private:
     RSPOpcode & m_OpCode;
     uint32_t & m_CompilePC;
     UWORD32 * m_GPR;
-    UDWORD * m_ACCUM;
+    RSPAccumulator & m_ACCUM;
     UWORD32 * m_Flags;
     RSPVector * m_Vect;
 };
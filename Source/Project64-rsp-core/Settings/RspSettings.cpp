@@ -14,7 +14,7 @@ RSPCpuMethod CRSPSettings::m_CPUMethod = RSPCpuMethod::HighLevelEmulation;
 #endif
 
 uint16_t Set_AudioHle = 0, Set_GraphicsHle = 0, Set_MultiThreaded = 0, Set_AllocatedRdramSize = 0, Set_DirectoryLog = 0;
-bool GraphicsHle = true, AudioHle, ConditionalMove, SyncCPU = false, RspMultiThreaded = false, LogAsmCode = false;
+bool GraphicsHle = true, AudioHle, ConditionalMove, SyncCPU = false, CheckSimd = false, RspMultiThreaded = false, LogAsmCode = false;
 bool DebuggingEnabled = false, Profiling, IndvidualBlock, ShowErrors, BreakOnStart = false, LogRDP = false;
 
 void CRSPSettings::EnableDebugging(bool Enabled)
@@ -40,6 +40,7 @@ void CRSPSettings::InitializeRspSetting(void)
     RegisterSetting(Set_IndvidualBlock, Data_DWORD_General, "Individual Block", NULL, IndvidualBlock, NULL);
     RegisterSetting(Set_ShowErrors, Data_DWORD_General, "Show Errors", NULL, ShowErrors, NULL);
     RegisterSetting(Set_SyncCPU, Data_DWORD_General, "Sync CPU", NULL, SyncCPU, NULL);
+    RegisterSetting(Set_CheckSimd, Data_DWORD_General, "Check SIMD", NULL, CheckSimd, NULL);
 
     // Compiler settings
 #if defined(__i386__) || defined(_M_IX86)
@@ -2,13 +2,13 @@
 #include <stdint.h>
 
 extern uint16_t Set_AudioHle, Set_GraphicsHle, Set_AllocatedRdramSize, Set_DirectoryLog;
-extern bool GraphicsHle, AudioHle, ConditionalMove, SyncCPU, RspMultiThreaded;
+extern bool GraphicsHle, AudioHle, ConditionalMove, SyncCPU, CheckSimd, RspMultiThreaded;
 extern bool DebuggingEnabled, Profiling, IndvidualBlock, ShowErrors, BreakOnStart, LogRDP, LogAsmCode;
 
 enum class RSPCpuMethod
 {
     Interpreter = 0,
-#if defined(__i386__) || defined(_M_IX86)
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
     Recompiler = 1,
 #endif
 #if defined(__amd64__) || defined(_M_X64)
@@ -10,6 +10,7 @@ enum
     Set_IndvidualBlock,
     Set_ShowErrors,
     Set_SyncCPU,
+    Set_CheckSimd,
 
     // Compiler settings
     Set_CheckDest,
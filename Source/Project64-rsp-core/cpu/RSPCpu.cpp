@@ -2,11 +2,13 @@
 #include <Common/CriticalSection.h>
 #include <Project64-rsp-core/RSPDebugger.h>
 #include <Project64-rsp-core/RSPInfo.h>
+#include <Project64-rsp-core/Recompiler/RspProfiling.h>
 #include <Project64-rsp-core/Recompiler/RspRecompilerCPU-x86.h>
 #include <Project64-rsp-core/Settings/RspSettings.h>
 #include <Project64-rsp-core/cpu/RSPRegisters.h>
 #include <Project64-rsp-core/cpu/RspSystem.h>
 #include <memory>
+#include <string.h>
 
 class RSPRegisterHandler;
 
@@ -30,23 +32,6 @@ void Build_RSP(void)
         g_RSPDebugger->ResetTimerList();
     }
 
-    EleSpec[0].DW = 0x0001020304050607;  // None
-    EleSpec[1].DW = 0x0001020304050607;  // None
-    EleSpec[2].DW = 0x0000020204040606;  // 0q
-    EleSpec[3].DW = 0x0101030305050707;  // 1q
-    EleSpec[4].DW = 0x0000000004040404;  // 0h
-    EleSpec[5].DW = 0x0101010105050505;  // 1h
-    EleSpec[6].DW = 0x0202020206060606;  // 2h
-    EleSpec[7].DW = 0x0303030307070707;  // 3h
-    EleSpec[8].DW = 0x0000000000000000;  // 0
-    EleSpec[9].DW = 0x0101010101010101;  // 1
-    EleSpec[10].DW = 0x0202020202020202; // 2
-    EleSpec[11].DW = 0x0303030303030303; // 3
-    EleSpec[12].DW = 0x0404040404040404; // 4
-    EleSpec[13].DW = 0x0505050505050505; // 5
-    EleSpec[14].DW = 0x0606060606060606; // 6
-    EleSpec[15].DW = 0x0707070707070707; // 7
-
     Indx[0].DW = 0x0001020304050607;  // None
     Indx[1].DW = 0x0001020304050607;  // None
     Indx[2].DW = 0x0103050700020406;  // 0q
@@ -66,10 +51,11 @@ void Build_RSP(void)
 
     for (uint8_t i = 0, n = sizeof(EleSpec) / sizeof(EleSpec[0]); i < n; i++)
     {
+        // The recompilers' element table is the one the interpreter uses
+        memcpy(EleSpec[i].UB, RSPElementLane[i], sizeof(RSPElementLane[i]));
         for (uint8_t z = 0; z < 8; z++)
         {
             Indx[i].B[z] = 7 - Indx[i].B[z];
-            EleSpec[i].B[z] = 7 - EleSpec[i].B[z];
         }
         for (uint8_t z = 0; z < 4; z++)
         {
@@ -95,11 +81,16 @@ be greater than the number of cycles that the RSP should have performed.
 
 uint32_t DoRspCycles(uint32_t Cycles)
 {
+    CRspTaskTimer TaskTimer(RSPInfo.DMEM, RSPInfo.IMEM);
 #if defined(__amd64__) || defined(_M_X64)
     if (CRSPSettings::CPUMethod() == RSPCpuMethod::RecompilerTasks)
     {
         HLETaskBooter booter = RSPSystem.IsHleTask();
-        if (booter == HLETaskBooter::unknown || !RSPSystem.HleTaskRecompiler(booter))
+        if (booter != HLETaskBooter::unknown && RSPSystem.HleTaskRecompiler(booter))
+        {
+            TaskTimer.SetExec(ProfileExec_TaskRecompiler);
+        }
+        else
         {
             if (g_RSPDebugger != nullptr)
             {
@@ -117,6 +108,7 @@ uint32_t DoRspCycles(uint32_t Cycles)
 #endif
     if (CRSPSettings::CPUMethod() == RSPCpuMethod::HighLevelEmulation && RSPSystem.ProcessHleTask())
     {
+        TaskTimer.SetExec(ProfileExec_HLE);
         return Cycles;
     }
 
@@ -125,7 +117,7 @@ uint32_t DoRspCycles(uint32_t Cycles)
         g_RSPDebugger->RspCyclesStart();
     }
     CGuard Guard(g_CPUCriticalSection);
-#if defined(__i386__) || defined(_M_IX86)
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
     if (CRSPSettings::CPUMethod() == RSPCpuMethod::Recompiler)
     {
         RSPSystem.RunRecompiler();
@@ -134,7 +126,7 @@ uint32_t DoRspCycles(uint32_t Cycles)
     {
 #endif
         RSPSystem.ExecuteOps((uint32_t)-1, (uint32_t)-1);
-#if defined(__i386__) || defined(_M_IX86)
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
     }
 #endif
     if (g_RSPDebugger != nullptr)
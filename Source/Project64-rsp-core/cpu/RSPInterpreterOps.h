@@ -143,6 +143,47 @@ private:
     void Vector_VRSQH(void);
     void Vector_VNOOP(void);
 
+    // Vector functions, SIMD versions (RSPInterpreterOpsSimd.cpp)
+    void BuildVectorSimd(void);
+    void SelectVectorOps(void);
+    void Vector_CheckSimd(void);
+    void Vector_VMULF_SIMD(void);
+    void Vector_VMULU_SIMD(void);
+    void Vector_VRNDP_SIMD(void);
+    void Vector_VMULQ_SIMD(void);
+    void Vector_VMUDL_SIMD(void);
+    void Vector_VMUDM_SIMD(void);
+    void Vector_VMUDN_SIMD(void);
+    void Vector_VMUDH_SIMD(void);
+    void Vector_VMACF_SIMD(void);
+    void Vector_VMACU_SIMD(void);
+    void Vector_VMACQ_SIMD(void);
+    void Vector_VRNDN_SIMD(void);
+    void Vector_VMADL_SIMD(void);
+    void Vector_VMADM_SIMD(void);
+    void Vector_VMADN_SIMD(void);
+    void Vector_VMADH_SIMD(void);
+    void Vector_VADD_SIMD(void);
+    void Vector_VSUB_SIMD(void);
+    void Vector_VABS_SIMD(void);
+    void Vector_VADDC_SIMD(void);
+    void Vector_VSUBC_SIMD(void);
+    void Vector_VSAW_SIMD(void);
+    void Vector_VLT_SIMD(void);
+    void Vector_VEQ_SIMD(void);
+    void Vector_VNE_SIMD(void);
+    void Vector_VGE_SIMD(void);
+    void Vector_VCL_SIMD(void);
+    void Vector_VCH_SIMD(void);
+    void Vector_VCR_SIMD(void);
+    void Vector_VMRG_SIMD(void);
+    void Vector_VAND_SIMD(void);
+    void Vector_VNAND_SIMD(void);
+    void Vector_VOR_SIMD(void);
+    void Vector_VNOR_SIMD(void);
+    void Vector_VXOR_SIMD(void);
+    void Vector_VNXOR_SIMD(void);
+
     // LC2 functions
     void LBV(void);
     void LSV(void);
@@ -175,14 +216,14 @@ private:
     void UnknownOpcode(void);
     uint32_t BranchIf(bool Condition);
 
-    typedef void (RSPOp::*Func)();
-
     Func Jump_Opcode[64];
     Func Jump_RegImm[32];
     Func Jump_Special[64];
     Func Jump_Cop0[32];
     Func Jump_Cop2[32];
     Func Jump_Vector[64];
+    Func Jump_VectorScalar[64];
+    Func Jump_VectorSimd[64];
     Func Jump_Lc2[32];
     Func Jump_Sc2[32];
 
@@ -205,7 +246,7 @@ private:
     uint32_t *& m_DPC_CLOCK_REG;
     uint8_t *& m_DMEM;
     UWORD32 * m_GPR;
-    UDWORD * m_ACCUM;
+    RSPAccumulator & m_ACCUM;
     UWORD32 * m_Flags;
     RSPVector * m_Vect;
     RSPFlag &VCOL, &VCOH;
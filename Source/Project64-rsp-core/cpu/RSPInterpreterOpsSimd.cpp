@@ -0,0 +1,688 @@
+#include <Project64-rsp-core/cpu/RSPInterpreterOps.h>
+#include <Project64-rsp-core/cpu/RSPRegisters.h>
+#include <Project64-rsp-core/cpu/RspLog.h>
+#include <Project64-rsp-core/cpu/RspSimd.h>
+#include <Settings/Settings.h>
+#include <string.h>
+
+#if defined(RSP_SIMD_SSE2)
+#include <tmmintrin.h>
+#endif
+
+// Each vector opcode is done on all eight lanes at once. The accumulator is handled as three
+// planes of 16 bits (low, mid, high) so a 48-bit add is three 16-bit adds with the carries passed
+// along. Every function here gives the same result, accumulator and flags as the scalar version.
+// VRCP, VRSQ and VMOV only work on a single lane and stay scalar.
+
+#if defined(RSP_SIMD)
+
+static bool UseByteShuffle = false;
+
+#if defined(RSP_SIMD_SSE2)
+#if defined(__GNUC__) && !defined(__SSSE3__)
+__attribute__((target("ssse3")))
+#endif
+static RspVec ShuffleBytes(RspVec Value, RspVec Mask)
+{
+    return _mm_shuffle_epi8(Value, Mask);
+}
+#endif
+
+static inline RspVec LoadVector(RSPVector & Vect)
+{
+    return VecLoad(&Vect.u16(0));
+}
+
+static inline void StoreVector(RSPVector & Vect, RspVec Value)
+{
+    VecStore(&Vect.u16(0), Value);
+}
+
+static inline RspVec LoadElement(RSPVector & Vect, uint8_t Element)
+{
+    if (Element < 2)
+    {
+        return VecLoad(&Vect.u16(0));
+    }
+#if defined(RSP_SIMD_NEON)
+    return vreinterpretq_s16_u8(vqtbl1q_u8(vreinterpretq_u8_s16(VecLoad(&Vect.u16(0))), vld1q_u8(RSPElementShuffle[Element])));
+#else
+    if (UseByteShuffle)
+    {
+        return ShuffleBytes(VecLoad(&Vect.u16(0)), VecLoad(RSPElementShuffle[Element]));
+    }
+    uint16_t Value[8];
+    for (uint8_t el = 0; el < 8; el++)
+    {
+        Value[el] = Vect.ue(el, Element);
+    }
+    return VecLoad(Value);
+#endif
+}
+
+static inline void AccumLoad(RSPAccumulator & Accum, RspVec & Low, RspVec & Mid, RspVec & High)
+{
+    Low = VecLoad(&Accum.Low(0));
+    Mid = VecLoad(&Accum.Mid(0));
+    High = VecLoad(&Accum.High(0));
+}
+
+static inline void AccumStore(RSPAccumulator & Accum, RspVec Low, RspVec Mid, RspVec High)
+{
+    VecStore(&Accum.Low(0), Low);
+    VecStore(&Accum.Mid(0), Mid);
+    VecStore(&Accum.High(0), High);
+}
+
+static inline void AccumStoreLow(RSPAccumulator & Accum, RspVec Low)
+{
+    VecStore(&Accum.Low(0), Low);
+}
+
+// (Low, Mid, High) += (AddLow, AddMid, AddHigh), wrapping at 48 bits
+static inline void Add48(RspVec & Low, RspVec & Mid, RspVec & High, RspVec AddLow, RspVec AddMid, RspVec AddHigh)
+{
+    RspVec SumLow = VecAdd(Low, AddLow);
+    RspVec CarryLow = VecCarry(Low, AddLow, SumLow);
+    RspVec SumMid = VecAdd(Mid, AddMid);
+    RspVec CarryMid = VecCarry(Mid, AddMid, SumMid);
+    SumMid = VecSub(SumMid, CarryLow);
+    CarryMid = VecOr(CarryMid, VecAnd(CarryLow, VecCmpEq(SumMid, VecZero())));
+    High = VecSub(VecAdd(High, AddHigh), CarryMid);
+    Mid = SumMid;
+    Low = SumLow;
+}
+
+// Upper 16 bits of a signed 16-bit value times an unsigned 16-bit value
+static inline RspVec MulHiSignedUnsigned(RspVec Signed, RspVec Unsigned)
+{
+    return VecAdd(VecMulHi(Signed, Unsigned), VecAnd(VecSignMask(Unsigned), Signed));
+}
+
+// s * t * 2 as a 48-bit value
+static inline void MulFraction(RspVec s, RspVec t, RspVec & Low, RspVec & Mid, RspVec & High)
+{
+    RspVec ProductLow = VecMulLo(s, t), ProductHigh = VecMulHi(s, t);
+    Low = VecShl1(ProductLow);
+    Mid = VecOr(VecShl1(ProductHigh), VecSrl15(ProductLow));
+    High = VecSignMask(ProductHigh);
+}
+
+// Same as CRSPRegisters::AccumulatorSaturate(el, true)
+static inline RspVec SaturateHigh(RspVec Mid, RspVec High)
+{
+    return VecClamp32(High, Mid);
+}
+
+// Same as CRSPRegisters::AccumulatorSaturate(el, false)
+static inline RspVec SaturateLow(RspVec Low, RspVec Mid, RspVec High)
+{
+    RspVec InRange = VecCmpEq(High, VecSignMask(Mid));
+    return VecSelect(InRange, Low, VecNot(VecSignMask(High)));
+}
+
+void RSPOp::BuildVectorSimd(void)
+{
+    RSP_SIMD_LEVEL Level = RspSimdLevel();
+    if (Level == RspSimd_None)
+    {
+        return;
+    }
+    UseByteShuffle = Level == RspSimd_SSSE3 || Level == RspSimd_NEON;
+
+    Jump_VectorSimd[0] = &RSPOp::Vector_VMULF_SIMD;
+    Jump_VectorSimd[1] = &RSPOp::Vector_VMULU_SIMD;
+    Jump_VectorSimd[2] = &RSPOp::Vector_VRNDP_SIMD;
+    Jump_VectorSimd[3] = &RSPOp::Vector_VMULQ_SIMD;
+    Jump_VectorSimd[4] = &RSPOp::Vector_VMUDL_SIMD;
+    Jump_VectorSimd[5] = &RSPOp::Vector_VMUDM_SIMD;
+    Jump_VectorSimd[6] = &RSPOp::Vector_VMUDN_SIMD;
+    Jump_VectorSimd[7] = &RSPOp::Vector_VMUDH_SIMD;
+    Jump_VectorSimd[8] = &RSPOp::Vector_VMACF_SIMD;
+    Jump_VectorSimd[9] = &RSPOp::Vector_VMACU_SIMD;
+    Jump_VectorSimd[10] = &RSPOp::Vector_VRNDN_SIMD;
+    Jump_VectorSimd[11] = &RSPOp::Vector_VMACQ_SIMD;
+    Jump_VectorSimd[12] = &RSPOp::Vector_VMADL_SIMD;
+    Jump_VectorSimd[13] = &RSPOp::Vector_VMADM_SIMD;
+    Jump_VectorSimd[14] = &RSPOp::Vector_VMADN_SIMD;
+    Jump_VectorSimd[15] = &RSPOp::Vector_VMADH_SIMD;
+    Jump_VectorSimd[16] = &RSPOp::Vector_VADD_SIMD;
+    Jump_VectorSimd[17] = &RSPOp::Vector_VSUB_SIMD;
+    Jump_VectorSimd[19] = &RSPOp::Vector_VABS_SIMD;
+    Jump_VectorSimd[20] = &RSPOp::Vector_VADDC_SIMD;
+    Jump_VectorSimd[21] = &RSPOp::Vector_VSUBC_SIMD;
+    Jump_VectorSimd[29] = &RSPOp::Vector_VSAW_SIMD;
+    Jump_VectorSimd[32] = &RSPOp::Vector_VLT_SIMD;
+    Jump_VectorSimd[33] = &RSPOp::Vector_VEQ_SIMD;
+    Jump_VectorSimd[34] = &RSPOp::Vector_VNE_SIMD;
+    Jump_VectorSimd[35] = &RSPOp::Vector_VGE_SIMD;
+    Jump_VectorSimd[36] = &RSPOp::Vector_VCL_SIMD;
+    Jump_VectorSimd[37] = &RSPOp::Vector_VCH_SIMD;
+    Jump_VectorSimd[38] = &RSPOp::Vector_VCR_SIMD;
+    Jump_VectorSimd[39] = &RSPOp::Vector_VMRG_SIMD;
+    Jump_VectorSimd[40] = &RSPOp::Vector_VAND_SIMD;
+    Jump_VectorSimd[41] = &RSPOp::Vector_VNAND_SIMD;
+    Jump_VectorSimd[42] = &RSPOp::Vector_VOR_SIMD;
+    Jump_VectorSimd[43] = &RSPOp::Vector_VNOR_SIMD;
+    Jump_VectorSimd[44] = &RSPOp::Vector_VXOR_SIMD;
+    Jump_VectorSimd[45] = &RSPOp::Vector_VNXOR_SIMD;
+}
+
+void RSPOp::Vector_VMULF_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low, Mid, High;
+    MulFraction(s, t, Low, Mid, High);
+    Add48(Low, Mid, High, VecSet((int16_t)0x8000), VecZero(), VecZero());
+    AccumStore(m_ACCUM, Low, Mid, High);
+    StoreVector(m_Vect[m_OpCode.vd], SaturateHigh(Mid, High));
+}
+
+void RSPOp::Vector_VMULU_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low, Mid, High;
+    MulFraction(s, t, Low, Mid, High);
+    Add48(Low, Mid, High, VecSet((int16_t)0x8000), VecZero(), VecZero());
+    AccumStore(m_ACCUM, Low, Mid, High);
+    StoreVector(m_Vect[m_OpCode.vd], VecAndNot(VecOr(Mid, VecSignMask(Mid)), VecSignMask(High)));
+}
+
+void RSPOp::Vector_VRNDP_SIMD(void)
+{
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low, Mid, High;
+    AccumLoad(m_ACCUM, Low, Mid, High);
+    RspVec Round = VecNot(VecSignMask(High));
+    RspVec Sign = VecAnd(VecSignMask(t), Round);
+    t = VecAnd(t, Round);
+    if (m_OpCode.vs & 1)
+    {
+        Add48(Low, Mid, High, VecZero(), t, Sign);
+    }
+    else
+    {
+        Add48(Low, Mid, High, t, Sign, Sign);
+    }
+    AccumStore(m_ACCUM, Low, Mid, High);
+    StoreVector(m_Vect[m_OpCode.vd], SaturateHigh(Mid, High));
+}
+
+void RSPOp::Vector_VMULQ_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec ProductLow = VecMulLo(s, t), ProductHigh = VecMulHi(s, t);
+    RspVec Round = VecAnd(VecSignMask(ProductHigh), VecSet(31));
+    RspVec Mid = VecAdd(ProductLow, Round);
+    RspVec High = VecSub(ProductHigh, VecCarry(ProductLow, Round, Mid));
+    AccumStore(m_ACCUM, VecZero(), Mid, High);
+    RspVec Half = VecOr(VecSrl1(Mid), VecShl15(High));
+    StoreVector(m_Vect[m_OpCode.vd], VecAnd(VecClamp32(High, Half), VecSet((int16_t)0xFFF0)));
+}
+
+void RSPOp::Vector_VMUDL_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low = VecMulHiU(s, t);
+    AccumStore(m_ACCUM, Low, VecZero(), VecZero());
+    StoreVector(m_Vect[m_OpCode.vd], Low);
+}
+
+void RSPOp::Vector_VMUDM_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Mid = MulHiSignedUnsigned(s, t);
+    AccumStore(m_ACCUM, VecMulLo(s, t), Mid, VecSignMask(Mid));
+    StoreVector(m_Vect[m_OpCode.vd], Mid);
+}
+
+void RSPOp::Vector_VMUDN_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low = VecMulLo(s, t), Mid = MulHiSignedUnsigned(t, s);
+    AccumStore(m_ACCUM, Low, Mid, VecSignMask(Mid));
+    StoreVector(m_Vect[m_OpCode.vd], Low);
+}
+
+void RSPOp::Vector_VMUDH_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Mid = VecMulLo(s, t), High = VecMulHi(s, t);
+    AccumStore(m_ACCUM, VecZero(), Mid, High);
+    StoreVector(m_Vect[m_OpCode.vd], SaturateHigh(Mid, High));
+}
+
+void RSPOp::Vector_VMACF_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low, Mid, High, ProductLow, ProductMid, ProductHigh;
+    AccumLoad(m_ACCUM, Low, Mid, High);
+    MulFraction(s, t, ProductLow, ProductMid, ProductHigh);
+    Add48(Low, Mid, High, ProductLow, ProductMid, ProductHigh);
+    AccumStore(m_ACCUM, Low, Mid, High);
+    StoreVector(m_Vect[m_OpCode.vd], SaturateHigh(Mid, High));
+}
+
+void RSPOp::Vector_VMACU_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low, Mid, High, ProductLow, ProductMid, ProductHigh;
+    AccumLoad(m_ACCUM, Low, Mid, High);
+    MulFraction(s, t, ProductLow, ProductMid, ProductHigh);
+    Add48(Low, Mid, High, ProductLow, ProductMid, ProductHigh);
+    AccumStore(m_ACCUM, Low, Mid, High);
+    RspVec Overflow = VecOr(VecNot(VecCmpEq(High, VecZero())), VecSignMask(Mid));
+    StoreVector(m_Vect[m_OpCode.vd], VecAndNot(VecOr(Mid, Overflow), VecSignMask(High)));
+}
+
+void RSPOp::Vector_VMACQ_SIMD(void)
+{
+    RspVec Low, Mid, High;
+    AccumLoad(m_ACCUM, Low, Mid, High);
+
+    // Mid is compared unsigned by flipping the sign bit
+    RspVec MidUnsigned = VecXor(Mid, VecSet((int16_t)0x8000));
+    RspVec HighNegOne = VecCmpEq(High, VecSet(-1)), HighZero = VecCmpEq(High, VecZero());
+    RspVec Below = VecOr(VecCmpLt(High, VecSet(-1)), VecAnd(HighNegOne, VecCmpLt(MidUnsigned, VecSet(0x7FE0))));
+    RspVec Above = VecOr(VecCmpGt(High, VecZero()), VecAnd(HighZero, VecCmpGt(MidUnsigned, VecSet((int16_t)0x8020))));
+    RspVec BitClear = VecCmpEq(VecAnd(Mid, VecSet(0x20)), VecZero());
+    Below = VecAnd(Below, BitClear);
+    Above = VecAnd(Above, BitClear);
+
+    RspVec Adjust = VecOr(VecAnd(Below, VecSet(0x20)), VecAnd(Above, VecSet((int16_t)0xFFE0)));
+    RspVec Sum = VecAdd(Mid, Adjust);
+    High = VecSub(VecAdd(High, Above), VecCarry(Mid, Adjust, Sum));
+    Mid = Sum;
+    AccumStore(m_ACCUM, Low, Mid, High);
+
+    RspVec Half = VecOr(VecSrl1(Mid), VecShl15(High));
+    StoreVector(m_Vect[m_OpCode.vd], VecAnd(VecClamp32(High, Half), VecSet((int16_t)0xFFF0)));
+}
+
+void RSPOp::Vector_VRNDN_SIMD(void)
+{
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low, Mid, High;
+    AccumLoad(m_ACCUM, Low, Mid, High);
+    RspVec Round = VecSignMask(High);
+    RspVec Sign = VecAnd(VecSignMask(t), Round);
+    t = VecAnd(t, Round);
+    if (m_OpCode.vs & 1)
+    {
+        Add48(Low, Mid, High, VecZero(), t, Sign);
+    }
+    else
+    {
+        Add48(Low, Mid, High, t, Sign, Sign);
+    }
+    AccumStore(m_ACCUM, Low, Mid, High);
+    StoreVector(m_Vect[m_OpCode.vd], SaturateHigh(Mid, High));
+}
+
+void RSPOp::Vector_VMADL_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low, Mid, High;
+    AccumLoad(m_ACCUM, Low, Mid, High);
+    Add48(Low, Mid, High, VecMulHiU(s, t), VecZero(), VecZero());
+    AccumStore(m_ACCUM, Low, Mid, High);
+    StoreVector(m_Vect[m_OpCode.vd], SaturateLow(Low, Mid, High));
+}
+
+void RSPOp::Vector_VMADM_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low, Mid, High;
+    AccumLoad(m_ACCUM, Low, Mid, High);
+    RspVec ProductMid = MulHiSignedUnsigned(s, t);
+    Add48(Low, Mid, High, VecMulLo(s, t), ProductMid, VecSignMask(ProductMid));
+    AccumStore(m_ACCUM, Low, Mid, High);
+    StoreVector(m_Vect[m_OpCode.vd], SaturateHigh(Mid, High));
+}
+
+void RSPOp::Vector_VMADN_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low, Mid, High;
+    AccumLoad(m_ACCUM, Low, Mid, High);
+    RspVec ProductMid = MulHiSignedUnsigned(t, s);
+    Add48(Low, Mid, High, VecMulLo(s, t), ProductMid, VecSignMask(ProductMid));
+    AccumStore(m_ACCUM, Low, Mid, High);
+    StoreVector(m_Vect[m_OpCode.vd], SaturateLow(Low, Mid, High));
+}
+
+void RSPOp::Vector_VMADH_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Low, Mid, High;
+    AccumLoad(m_ACCUM, Low, Mid, High);
+    Add48(Low, Mid, High, VecZero(), VecMulLo(s, t), VecMulHi(s, t));
+    AccumStore(m_ACCUM, Low, Mid, High);
+    StoreVector(m_Vect[m_OpCode.vd], SaturateHigh(Mid, High));
+}
+
+void RSPOp::Vector_VADD_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Carry = VecFromFlag(VCOL.Value());
+    RspVec Sum = VecAdd(s, t), SumSat = VecAddSat(s, t);
+
+    // Once s + t has saturated adding the carry can not bring it back in range
+    RspVec Overflow = VecNot(VecCmpEq(Sum, SumSat));
+    AccumStoreLow(m_ACCUM, VecSub(Sum, Carry));
+    StoreVector(m_Vect[m_OpCode.vd], VecAddSat(SumSat, VecAndNot(VecSrl15(Carry), Overflow)));
+    VCOL.Clear();
+    VCOH.Clear();
+}
+
+void RSPOp::Vector_VSUB_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Carry = VecFromFlag(VCOL.Value());
+    RspVec Diff = VecSub(s, t), DiffSat = VecSubSat(s, t);
+    RspVec Overflow = VecNot(VecCmpEq(Diff, DiffSat));
+    AccumStoreLow(m_ACCUM, VecAdd(Diff, Carry));
+    StoreVector(m_Vect[m_OpCode.vd], VecSubSat(DiffSat, VecAndNot(VecSrl15(Carry), Overflow)));
+    VCOL.Clear();
+    VCOH.Clear();
+}
+
+void RSPOp::Vector_VABS_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Negative = VecSignMask(s), Zero = VecCmpEq(s, VecZero());
+    RspVec Flipped = VecXor(t, Negative);
+    AccumStoreLow(m_ACCUM, VecAndNot(VecSub(Flipped, Negative), Zero));
+    StoreVector(m_Vect[m_OpCode.vd], VecAndNot(VecSubSat(Flipped, Negative), Zero));
+}
+
+void RSPOp::Vector_VADDC_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Sum = VecAdd(s, t);
+    AccumStoreLow(m_ACCUM, Sum);
+    StoreVector(m_Vect[m_OpCode.vd], Sum);
+    VCOL.SetValue(VecToFlag(VecCarry(s, t, Sum)));
+    VCOH.Clear();
+}
+
+void RSPOp::Vector_VSUBC_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Diff = VecSub(s, t);
+    AccumStoreLow(m_ACCUM, Diff);
+    StoreVector(m_Vect[m_OpCode.vd], Diff);
+    VCOL.SetValue(VecToFlag(VecBorrow(s, t, Diff)));
+    VCOH.SetValue(VecToFlag(VecNot(VecCmpEq(s, t))));
+}
+
+void RSPOp::Vector_VSAW_SIMD(void)
+{
+    RspVec Low, Mid, High;
+    AccumLoad(m_ACCUM, Low, Mid, High);
+    switch ((m_OpCode.rs & 0xF))
+    {
+    case 8:
+        StoreVector(m_Vect[m_OpCode.vd], High);
+        break;
+    case 9:
+        StoreVector(m_Vect[m_OpCode.vd], Mid);
+        break;
+    case 10:
+        StoreVector(m_Vect[m_OpCode.vd], Low);
+        break;
+    default:
+        StoreVector(m_Vect[m_OpCode.vd], VecZero());
+    }
+}
+
+void RSPOp::Vector_VLT_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Carry = VecAnd(VecFromFlag(VCOL.Value()), VecFromFlag(VCOH.Value()));
+    RspVec Less = VecOr(VecCmpLt(s, t), VecAnd(VecCmpEq(s, t), Carry));
+    RspVec Result = VecSelect(Less, s, t);
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+    VCCL.SetValue(VecToFlag(Less));
+    VCCH.Clear();
+    VCOL.Clear();
+    VCOH.Clear();
+}
+
+void RSPOp::Vector_VEQ_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Equal = VecAndNot(VecCmpEq(s, t), VecFromFlag(VCOH.Value()));
+
+    // Lanes that compare equal hold the same value in s and t
+    AccumStoreLow(m_ACCUM, t);
+    StoreVector(m_Vect[m_OpCode.vd], t);
+    VCCL.SetValue(VecToFlag(Equal));
+    VCOL.Clear();
+    VCOH.Clear();
+    VCCH.Clear();
+}
+
+void RSPOp::Vector_VNE_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec NotEqual = VecOr(VecNot(VecCmpEq(s, t)), VecFromFlag(VCOH.Value()));
+
+    // Lanes that compare equal hold the same value in s and t
+    AccumStoreLow(m_ACCUM, s);
+    StoreVector(m_Vect[m_OpCode.vd], s);
+    VCCL.SetValue(VecToFlag(NotEqual));
+    VCCH.Clear();
+    VCOL.Clear();
+    VCOH.Clear();
+}
+
+void RSPOp::Vector_VGE_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Carry = VecAnd(VecFromFlag(VCOL.Value()), VecFromFlag(VCOH.Value()));
+    RspVec Greater = VecOr(VecCmpGt(s, t), VecAndNot(VecCmpEq(s, t), Carry));
+    RspVec Result = VecSelect(Greater, s, t);
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+    VCCL.SetValue(VecToFlag(Greater));
+    VCCH.Clear();
+    VCOL.Clear();
+    VCOH.Clear();
+}
+
+void RSPOp::Vector_VCL_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Col = VecFromFlag(VCOL.Value()), Coh = VecFromFlag(VCOH.Value());
+    RspVec Ccl = VecFromFlag(VCCL.Value()), Cch = VecFromFlag(VCCH.Value());
+    RspVec Ce = VecFromFlag(VCE.Value());
+
+    // Unsigned s + t <= 0x10000 or s + t == 0, and unsigned s >= t
+    RspVec Sum = VecAdd(s, t), Carry = VecCarry(s, t, Sum);
+    RspVec SumZero = VecCmpEq(Sum, VecZero());
+    RspVec LowSet = VecSelect(Ce, VecOr(VecNot(Carry), SumZero), VecAndNot(SumZero, Carry));
+    RspVec HighSet = VecNot(VecBorrow(s, t, VecSub(s, t)));
+
+    Ccl = VecSelect(VecAndNot(Col, Coh), LowSet, Ccl);
+    Cch = VecSelect(VecNot(VecOr(Col, Coh)), HighSet, Cch);
+    RspVec Result = VecSelect(VecAndNot(Cch, Col), t, s);
+    Result = VecSelect(VecAnd(Col, Ccl), VecSub(VecZero(), t), Result);
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+    VCCL.SetValue(VecToFlag(Ccl));
+    VCCH.SetValue(VecToFlag(Cch));
+    VCOL.Clear();
+    VCOH.Clear();
+    VCE.Clear();
+}
+
+void RSPOp::Vector_VCH_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec SignDiffer = VecSignMask(VecXor(s, t)), tNegative = VecSignMask(t);
+    RspVec Sum = VecAdd(s, t);
+    RspVec Value = VecSelect(SignDiffer, Sum, VecSub(s, t));
+    RspVec LessEqual = VecNot(VecCmpGt(Value, VecZero()));
+    RspVec GreaterEqual = VecNot(VecSignMask(Value));
+
+    RspVec Ccl = VecSelect(SignDiffer, LessEqual, tNegative);
+    RspVec Cch = VecSelect(SignDiffer, tNegative, GreaterEqual);
+    RspVec Coh = VecNot(VecOr(VecCmpEq(Value, VecZero()), VecCmpEq(s, VecNot(t))));
+    RspVec Ce = VecAnd(SignDiffer, VecCmpEq(Sum, VecSet(-1)));
+    RspVec Result = VecSelect(SignDiffer, VecSelect(LessEqual, VecSub(VecZero(), t), s), VecSelect(GreaterEqual, t, s));
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+    VCOL.SetValue(VecToFlag(SignDiffer));
+    VCOH.SetValue(VecToFlag(Coh));
+    VCCL.SetValue(VecToFlag(Ccl));
+    VCCH.SetValue(VecToFlag(Cch));
+    VCE.SetValue(VecToFlag(Ce));
+}
+
+void RSPOp::Vector_VCR_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec SignDiffer = VecSignMask(VecXor(s, t)), tNegative = VecSignMask(t);
+
+    // Neither s + t with different signs nor s - t with the same sign can overflow
+    RspVec Ccl = VecSelect(SignDiffer, VecSignMask(VecAdd(s, t)), tNegative);
+    RspVec Cch = VecSelect(SignDiffer, tNegative, VecNot(VecSignMask(VecSub(s, t))));
+    RspVec Result = VecSelect(SignDiffer, VecSelect(Ccl, VecNot(t), s), VecSelect(Cch, t, s));
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+    VCCL.SetValue(VecToFlag(Ccl));
+    VCCH.SetValue(VecToFlag(Cch));
+    VCOL.Clear();
+    VCOH.Clear();
+    VCE.Clear();
+}
+
+void RSPOp::Vector_VMRG_SIMD(void)
+{
+    RspVec s = LoadVector(m_Vect[m_OpCode.vs]);
+    RspVec t = LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e);
+    RspVec Result = VecSelect(VecFromFlag(VCCL.Value()), s, t);
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+    VCOL.Clear();
+    VCOH.Clear();
+}
+
+void RSPOp::Vector_VAND_SIMD(void)
+{
+    RspVec Result = VecAnd(LoadVector(m_Vect[m_OpCode.vs]), LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e));
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+}
+
+void RSPOp::Vector_VNAND_SIMD(void)
+{
+    RspVec Result = VecNot(VecAnd(LoadVector(m_Vect[m_OpCode.vs]), LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e)));
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+}
+
+void RSPOp::Vector_VOR_SIMD(void)
+{
+    RspVec Result = VecOr(LoadVector(m_Vect[m_OpCode.vs]), LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e));
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+}
+
+void RSPOp::Vector_VNOR_SIMD(void)
+{
+    RspVec Result = VecNot(VecOr(LoadVector(m_Vect[m_OpCode.vs]), LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e)));
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+}
+
+void RSPOp::Vector_VXOR_SIMD(void)
+{
+    RspVec Result = VecXor(LoadVector(m_Vect[m_OpCode.vs]), LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e));
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+}
+
+void RSPOp::Vector_VNXOR_SIMD(void)
+{
+    RspVec Result = VecNot(VecXor(LoadVector(m_Vect[m_OpCode.vs]), LoadElement(m_Vect[m_OpCode.vt], m_OpCode.e)));
+    AccumStoreLow(m_ACCUM, Result);
+    StoreVector(m_Vect[m_OpCode.vd], Result);
+}
+
+#else
+
+void RSPOp::BuildVectorSimd(void)
+{
+}
+
+#endif
+
+void RSPOp::SelectVectorOps(void)
+{
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        if (Jump_VectorSimd[i] != nullptr)
+        {
+            Jump_Vector[i] = CheckSimd ? &RSPOp::Vector_CheckSimd : Jump_VectorSimd[i];
+        }
+    }
+}
+
+// Runs the scalar and the SIMD version of the opcode from the same registers, accumulator and
+// flags, and stops on the first opcode where the result, accumulator or flags differ
+void RSPOp::Vector_CheckSimd(void)
+{
+    RSPVector Dest = m_Vect[m_OpCode.vd];
+    RSPAccumulator Accum = m_ACCUM;
+    UWORD32 Flags[4];
+    memcpy(Flags, m_Flags, sizeof(Flags));
+
+    (this->*Jump_VectorScalar[m_OpCode.funct])();
+    RSPVector ScalarDest = m_Vect[m_OpCode.vd];
+    RSPAccumulator ScalarAccum = m_ACCUM;
+    UWORD32 ScalarFlags[4];
+    memcpy(ScalarFlags, m_Flags, sizeof(ScalarFlags));
+
+    m_Vect[m_OpCode.vd] = Dest;
+    m_ACCUM = Accum;
+    memcpy(m_Flags, Flags, sizeof(Flags));
+    (this->*Jump_VectorSimd[m_OpCode.funct])();
+
+    bool DestDiffers = memcmp(&ScalarDest, &m_Vect[m_OpCode.vd], sizeof(ScalarDest)) != 0;
+    bool AccumDiffers = memcmp(&ScalarAccum, &m_ACCUM, sizeof(ScalarAccum)) != 0;
+    bool FlagsDiffer = memcmp(ScalarFlags, m_Flags, sizeof(ScalarFlags)) != 0;
+    if (DestDiffers || AccumDiffers || FlagsDiffer)
+    {
+        CPU_Message("SIMD check failed: vector op %d vd: %d vs: %d vt: %d e: %d%s%s%s", m_OpCode.funct, m_OpCode.vd, m_OpCode.vs, m_OpCode.vt, m_OpCode.e,
+                    DestDiffers ? " result differs" : "", AccumDiffers ? " accumulator differs" : "", FlagsDiffer ? " flags differ" : "");
+        g_Notify->BreakPoint(__FILE__, __LINE__);
+    }
+}
@@ -87,7 +87,7 @@ void CRSPRegisters::Reset(void)
 {
     memset(m_GPR, 0, sizeof(m_GPR));
     memset(m_Flags, 0, sizeof(m_Flags));
-    memset(m_ACCUM, 0, sizeof(m_ACCUM));
+    m_ACCUM.Clear();
     for (size_t i = 0, n = sizeof(m_Vect) / sizeof(m_Vect[0]); i < n; i++)
     {
         m_Vect[i] = RSPVector();
@@ -115,32 +115,30 @@ void CRSPRegisters::Reset(void)
 
 int64_t CRSPRegisters::AccumulatorGet(uint8_t el)
 {
-    return (((int64_t)m_ACCUM[el].HW[3]) << 32) | (((int64_t)m_ACCUM[el].UHW[2]) << 16) | m_ACCUM[el].UHW[1];
+    return m_ACCUM.Get(el);
 }
 
 void CRSPRegisters::AccumulatorSet(uint8_t el, int64_t Accumulator)
 {
-    m_ACCUM[el].HW[3] = (int16_t)(Accumulator >> 32);
-    m_ACCUM[el].HW[2] = (int16_t)(Accumulator >> 16);
-    m_ACCUM[el].HW[1] = (int16_t)(Accumulator);
+    m_ACCUM.Set(el, Accumulator);
 }
 
 uint16_t CRSPRegisters::AccumulatorSaturate(uint8_t el, bool High)
 {
-    if (m_ACCUM[el].HW[3] < 0)
+    if (m_ACCUM.High(el) < 0)
     {
-        if (m_ACCUM[el].UHW[3] != 0xFFFF || m_ACCUM[el].HW[2] >= 0)
+        if ((uint16_t)m_ACCUM.High(el) != 0xFFFF || m_ACCUM.Mid(el) >= 0)
         {
             return High ? 0x8000 : 0x0000;
         }
         else
         {
-            return m_ACCUM[el].UHW[High ? 2 : 1];
+            return (uint16_t)(High ? m_ACCUM.Mid(el) : m_ACCUM.Low(el));
         }
     }
-    if (m_ACCUM[el].UHW[3] != 0 || m_ACCUM[el].HW[2] < 0)
+    if (m_ACCUM.High(el) != 0 || m_ACCUM.Mid(el) < 0)
     {
         return High ? 0x7fff : 0xffff;
     }
-    return m_ACCUM[el].UHW[High ? 2 : 1];
+    return (uint16_t)(High ? m_ACCUM.Mid(el) : m_ACCUM.Low(el));
 }
@@ -126,7 +126,7 @@ public:
 
     UWORD32 m_GPR[32];
     UWORD32 m_Flags[4];
-    UDWORD m_ACCUM[8];
+    RSPAccumulator m_ACCUM;
     RSPVector m_Vect[32];
     uint16_t m_Reciprocals[512];
     uint16_t m_InverseSquareRoots[512];
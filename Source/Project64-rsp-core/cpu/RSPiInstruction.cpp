@@ -3,6 +3,7 @@
 #include <Common/StdString.h>
 #include <Project64-rsp-core/RSPInfo.h>
 #include <Settings/Settings.h>
+#include <string.h>
 
 RSPInstruction::RSPInstruction(uint32_t Address, uint32_t Instruction) :
     m_Address(Address),
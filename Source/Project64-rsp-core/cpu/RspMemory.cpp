@@ -8,9 +8,8 @@
 #include <string.h>
 #include <zlib/zlib.h>
 
-uint32_t NoOfMaps, MapsCRC[MaxMaps];
 uint32_t Table;
-uint8_t *RecompCode, *RecompCodeSecondary, *RecompPos, *JumpTables;
+uint8_t *RecompCode, *RecompCodeSecondary, *RecompPos;
 void ** JumpTable;
 
 extern uint8_t *pLastSecondary, *pLastPrimary;
@@ -19,8 +18,8 @@ int AllocateMemory(void)
 {
     if (RecompCode == nullptr)
     {
-        RecompCode = (uint8_t *)AllocateAddressSpace(0x00800004);
-        RecompCode = (uint8_t *)CommitMemory(RecompCode, 0x00800000, MEM_EXECUTE_READWRITE);
+        RecompCode = (uint8_t *)AllocateAddressSpace(RecompCodeSize + 4);
+        RecompCode = (uint8_t *)CommitMemory(RecompCode, RecompCodeSize, MEM_EXECUTE_READWRITE);
 
         if (RecompCode == nullptr)
         {
@@ -40,31 +39,16 @@ int AllocateMemory(void)
         }
     }
 
-    if (JumpTables == nullptr)
-    {
-        JumpTables = (uint8_t *)AllocateAddressSpace(0x1000 * MaxMaps);
-        JumpTables = (uint8_t *)CommitMemory(JumpTables, 0x1000 * MaxMaps, MEM_READWRITE);
-        if (JumpTables == nullptr)
-        {
-            g_Notify->DisplayError("Not enough memory for jump table!");
-            return false;
-        }
-    }
-
-    JumpTable = (void **)JumpTables;
     RecompPos = RecompCode;
-    NoOfMaps = 0;
     return true;
 }
 
 void FreeMemory(void)
 {
-    FreeAddressSpace(RecompCode, 0x00800004);
-    FreeAddressSpace(JumpTable, 0x1000 * MaxMaps);
+    FreeAddressSpace(RecompCode, RecompCodeSize + 4);
     FreeAddressSpace(RecompCodeSecondary, 0x00200004);
 
     RecompCode = nullptr;
-    JumpTables = nullptr;
     RecompCodeSecondary = nullptr;
 }
 
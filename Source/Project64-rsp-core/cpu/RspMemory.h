@@ -4,7 +4,7 @@
 
 enum
 {
-    MaxMaps = 32
+    RecompCodeSize = 0x00800000,
 };
 
 int AllocateMemory(void);
@@ -0,0 +1,51 @@
+#include "RspSimd.h"
+
+#if defined(RSP_SIMD_SSE2)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+static RSP_SIMD_LEVEL DetectSimdLevel(void)
+{
+#if defined(RSP_SIMD_SSE2)
+    uint32_t Features_ECX = 0, Features_EDX = 0;
+#if defined(_MSC_VER)
+    int cpuInfo[4];
+    __cpuid(cpuInfo, 1);
+    Features_ECX = cpuInfo[2];
+    Features_EDX = cpuInfo[3];
+#else
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        Features_ECX = ecx;
+        Features_EDX = edx;
+    }
+#endif
+    if ((Features_EDX & 0x04000000) == 0)
+    {
+        return RspSimd_None;
+    }
+    return (Features_ECX & 0x00000200) != 0 ? RspSimd_SSSE3 : RspSimd_SSE2;
+#elif defined(RSP_SIMD_NEON)
+    return RspSimd_NEON;
+#else
+    return RspSimd_None;
+#endif
+}
+
+static bool ForceScalar = false;
+
+RSP_SIMD_LEVEL RspSimdLevel(void)
+{
+    static RSP_SIMD_LEVEL Level = DetectSimdLevel();
+    return ForceScalar ? RspSimd_None : Level;
+}
+
+void RspSimdForceScalar(bool Force)
+{
+    ForceScalar = Force;
+}
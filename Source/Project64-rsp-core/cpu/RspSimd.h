@@ -0,0 +1,603 @@
+#pragma once
+#include <stdint.h>
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define RSP_SIMD_NEON
+#elif defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RSP_SIMD_SSE2
+#endif
+
+enum RSP_SIMD_LEVEL
+{
+    RspSimd_None,
+    RspSimd_SSE2,
+    RspSimd_SSSE3,
+    RspSimd_NEON,
+};
+
+// Best vector instruction set of the host, checked once with cpuid
+RSP_SIMD_LEVEL RspSimdLevel(void);
+
+// While set RspSimdLevel reports RspSimd_None, used to run the scalar code when checking the SIMD code
+void RspSimdForceScalar(bool Force);
+
+#if defined(RSP_SIMD_SSE2) || defined(RSP_SIMD_NEON)
+#define RSP_SIMD
+
+// Eight 16-bit lanes, lane n of a vector register is lane n of the RspVec.
+// Masks are all ones or all zeros in each lane.
+#if defined(RSP_SIMD_SSE2)
+typedef __m128i RspVec;
+
+static inline RspVec VecLoad(const void * Src)
+{
+    return _mm_loadu_si128((const __m128i *)Src);
+}
+
+static inline void VecStore(void * Dst, RspVec Value)
+{
+    _mm_storeu_si128((__m128i *)Dst, Value);
+}
+
+static inline RspVec VecZero(void)
+{
+    return _mm_setzero_si128();
+}
+
+static inline RspVec VecSet(int16_t Value)
+{
+    return _mm_set1_epi16(Value);
+}
+
+static inline RspVec VecAnd(RspVec a, RspVec b)
+{
+    return _mm_and_si128(a, b);
+}
+
+// a & ~b
+static inline RspVec VecAndNot(RspVec a, RspVec b)
+{
+    return _mm_andnot_si128(b, a);
+}
+
+static inline RspVec VecOr(RspVec a, RspVec b)
+{
+    return _mm_or_si128(a, b);
+}
+
+static inline RspVec VecXor(RspVec a, RspVec b)
+{
+    return _mm_xor_si128(a, b);
+}
+
+static inline RspVec VecNot(RspVec a)
+{
+    return _mm_xor_si128(a, _mm_cmpeq_epi16(a, a));
+}
+
+static inline RspVec VecAdd(RspVec a, RspVec b)
+{
+    return _mm_add_epi16(a, b);
+}
+
+static inline RspVec VecSub(RspVec a, RspVec b)
+{
+    return _mm_sub_epi16(a, b);
+}
+
+static inline RspVec VecAddSat(RspVec a, RspVec b)
+{
+    return _mm_adds_epi16(a, b);
+}
+
+static inline RspVec VecSubSat(RspVec a, RspVec b)
+{
+    return _mm_subs_epi16(a, b);
+}
+
+static inline RspVec VecCmpEq(RspVec a, RspVec b)
+{
+    return _mm_cmpeq_epi16(a, b);
+}
+
+static inline RspVec VecCmpGt(RspVec a, RspVec b)
+{
+    return _mm_cmpgt_epi16(a, b);
+}
+
+static inline RspVec VecCmpLt(RspVec a, RspVec b)
+{
+    return _mm_cmplt_epi16(a, b);
+}
+
+// Mask ? a : b
+static inline RspVec VecSelect(RspVec Mask, RspVec a, RspVec b)
+{
+    return _mm_or_si128(_mm_and_si128(Mask, a), _mm_andnot_si128(Mask, b));
+}
+
+static inline RspVec VecMulLo(RspVec a, RspVec b)
+{
+    return _mm_mullo_epi16(a, b);
+}
+
+static inline RspVec VecMulHi(RspVec a, RspVec b)
+{
+    return _mm_mulhi_epi16(a, b);
+}
+
+static inline RspVec VecMulHiU(RspVec a, RspVec b)
+{
+    return _mm_mulhi_epu16(a, b);
+}
+
+// Each lane set to all ones if negative, else zero
+static inline RspVec VecSignMask(RspVec a)
+{
+    return _mm_srai_epi16(a, 15);
+}
+
+static inline RspVec VecShl1(RspVec a)
+{
+    return _mm_slli_epi16(a, 1);
+}
+
+static inline RspVec VecShl15(RspVec a)
+{
+    return _mm_slli_epi16(a, 15);
+}
+
+static inline RspVec VecSrl1(RspVec a)
+{
+    return _mm_srli_epi16(a, 1);
+}
+
+static inline RspVec VecSrl15(RspVec a)
+{
+    return _mm_srli_epi16(a, 15);
+}
+
+// Flags hold lane n in bit (7 - n)
+static inline RspVec VecFromFlag(uint8_t Flag)
+{
+    const RspVec Bits = _mm_set_epi16(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    return _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(Flag), Bits), Bits);
+}
+
+static inline uint8_t VecToFlag(RspVec Mask)
+{
+    const RspVec Bits = _mm_set_epi16(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    RspVec Value = _mm_packus_epi16(_mm_and_si128(Mask, Bits), _mm_setzero_si128());
+    return (uint8_t)_mm_cvtsi128_si32(_mm_sad_epu8(Value, _mm_setzero_si128()));
+}
+
+// Lanes 0 <-> 1, 2 <-> 3, ...
+static inline RspVec VecSwapPairs(RspVec a)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(a, 0xB1), 0xB1);
+}
+
+// Lanes Count..7 of a followed by lanes 0..Count-1 of b
+template <int Count>
+static inline RspVec VecConcat(RspVec a, RspVec b)
+{
+    return _mm_or_si128(_mm_srli_si128(a, Count * 2), _mm_slli_si128(b, 16 - Count * 2));
+}
+
+// The eight lanes widened to 32 bits, lanes 0-3 in Lo and 4-7 in Hi
+struct RspVec32
+{
+    __m128i Lo, Hi;
+};
+
+static inline RspVec32 VecWiden(RspVec a)
+{
+    RspVec32 Result = {_mm_srai_epi32(_mm_unpacklo_epi16(a, a), 16), _mm_srai_epi32(_mm_unpackhi_epi16(a, a), 16)};
+    return Result;
+}
+
+static inline RspVec32 VecMulWide(RspVec a, RspVec b)
+{
+    RspVec Low = _mm_mullo_epi16(a, b), High = _mm_mulhi_epi16(a, b);
+    RspVec32 Result = {_mm_unpacklo_epi16(Low, High), _mm_unpackhi_epi16(Low, High)};
+    return Result;
+}
+
+static inline RspVec32 Vec32Set(int32_t Value)
+{
+    RspVec32 Result = {_mm_set1_epi32(Value), _mm_set1_epi32(Value)};
+    return Result;
+}
+
+static inline RspVec32 Vec32Add(RspVec32 a, RspVec32 b)
+{
+    RspVec32 Result = {_mm_add_epi32(a.Lo, b.Lo), _mm_add_epi32(a.Hi, b.Hi)};
+    return Result;
+}
+
+static inline RspVec32 Vec32Sra(RspVec32 a, int Shift)
+{
+    RspVec32 Result = {_mm_srai_epi32(a.Lo, Shift), _mm_srai_epi32(a.Hi, Shift)};
+    return Result;
+}
+
+static inline RspVec32 Vec32Shl(RspVec32 a, int Shift)
+{
+    RspVec32 Result = {_mm_slli_epi32(a.Lo, Shift), _mm_slli_epi32(a.Hi, Shift)};
+    return Result;
+}
+
+// Narrow to 16 bits with signed saturation
+static inline RspVec VecNarrowSat(RspVec32 a)
+{
+    return _mm_packs_epi32(a.Lo, a.Hi);
+}
+
+// Narrow to 16 bits keeping the low half of each lane
+static inline RspVec VecNarrow(RspVec32 a)
+{
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a.Lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(a.Hi, 16), 16));
+}
+
+static inline int32_t Vec32Sum(RspVec32 a)
+{
+    __m128i Sum = _mm_add_epi32(a.Lo, a.Hi);
+    Sum = _mm_add_epi32(Sum, _mm_shuffle_epi32(Sum, 0x4E));
+    Sum = _mm_add_epi32(Sum, _mm_shuffle_epi32(Sum, 0xB1));
+    return _mm_cvtsi128_si32(Sum);
+}
+
+static inline RspVec VecMin(RspVec a, RspVec b)
+{
+    return _mm_min_epi16(a, b);
+}
+
+static inline RspVec VecMax(RspVec a, RspVec b)
+{
+    return _mm_max_epi16(a, b);
+}
+
+static inline RspVec VecShl(RspVec a, int Shift)
+{
+    return _mm_slli_epi16(a, Shift);
+}
+
+static inline RspVec VecSra(RspVec a, int Shift)
+{
+    return _mm_srai_epi16(a, Shift);
+}
+
+// Lanes a0 b0 a1 b1 a2 b2 a3 b3
+static inline RspVec VecZipLo(RspVec a, RspVec b)
+{
+    return _mm_unpacklo_epi16(a, b);
+}
+
+// Lanes a4 b4 a5 b5 a6 b6 a7 b7
+static inline RspVec VecZipHi(RspVec a, RspVec b)
+{
+    return _mm_unpackhi_epi16(a, b);
+}
+
+// Row n lane m becomes row m lane n
+static inline void VecTranspose(RspVec Rows[8])
+{
+    __m128i a0 = _mm_unpacklo_epi16(Rows[0], Rows[1]), a1 = _mm_unpackhi_epi16(Rows[0], Rows[1]);
+    __m128i a2 = _mm_unpacklo_epi16(Rows[2], Rows[3]), a3 = _mm_unpackhi_epi16(Rows[2], Rows[3]);
+    __m128i a4 = _mm_unpacklo_epi16(Rows[4], Rows[5]), a5 = _mm_unpackhi_epi16(Rows[4], Rows[5]);
+    __m128i a6 = _mm_unpacklo_epi16(Rows[6], Rows[7]), a7 = _mm_unpackhi_epi16(Rows[6], Rows[7]);
+    __m128i b0 = _mm_unpacklo_epi32(a0, a2), b1 = _mm_unpackhi_epi32(a0, a2);
+    __m128i b2 = _mm_unpacklo_epi32(a1, a3), b3 = _mm_unpackhi_epi32(a1, a3);
+    __m128i b4 = _mm_unpacklo_epi32(a4, a6), b5 = _mm_unpackhi_epi32(a4, a6);
+    __m128i b6 = _mm_unpacklo_epi32(a5, a7), b7 = _mm_unpackhi_epi32(a5, a7);
+    Rows[0] = _mm_unpacklo_epi64(b0, b4);
+    Rows[1] = _mm_unpackhi_epi64(b0, b4);
+    Rows[2] = _mm_unpacklo_epi64(b1, b5);
+    Rows[3] = _mm_unpackhi_epi64(b1, b5);
+    Rows[4] = _mm_unpacklo_epi64(b2, b6);
+    Rows[5] = _mm_unpackhi_epi64(b2, b6);
+    Rows[6] = _mm_unpacklo_epi64(b3, b7);
+    Rows[7] = _mm_unpackhi_epi64(b3, b7);
+}
+#elif defined(RSP_SIMD_NEON)
+typedef int16x8_t RspVec;
+
+static inline RspVec VecLoad(const void * Src)
+{
+    return vld1q_s16((const int16_t *)Src);
+}
+
+static inline void VecStore(void * Dst, RspVec Value)
+{
+    vst1q_s16((int16_t *)Dst, Value);
+}
+
+static inline RspVec VecZero(void)
+{
+    return vdupq_n_s16(0);
+}
+
+static inline RspVec VecSet(int16_t Value)
+{
+    return vdupq_n_s16(Value);
+}
+
+static inline RspVec VecAnd(RspVec a, RspVec b)
+{
+    return vandq_s16(a, b);
+}
+
+// a & ~b
+static inline RspVec VecAndNot(RspVec a, RspVec b)
+{
+    return vbicq_s16(a, b);
+}
+
+static inline RspVec VecOr(RspVec a, RspVec b)
+{
+    return vorrq_s16(a, b);
+}
+
+static inline RspVec VecXor(RspVec a, RspVec b)
+{
+    return veorq_s16(a, b);
+}
+
+static inline RspVec VecNot(RspVec a)
+{
+    return vmvnq_s16(a);
+}
+
+static inline RspVec VecAdd(RspVec a, RspVec b)
+{
+    return vaddq_s16(a, b);
+}
+
+static inline RspVec VecSub(RspVec a, RspVec b)
+{
+    return vsubq_s16(a, b);
+}
+
+static inline RspVec VecAddSat(RspVec a, RspVec b)
+{
+    return vqaddq_s16(a, b);
+}
+
+static inline RspVec VecSubSat(RspVec a, RspVec b)
+{
+    return vqsubq_s16(a, b);
+}
+
+static inline RspVec VecCmpEq(RspVec a, RspVec b)
+{
+    return vreinterpretq_s16_u16(vceqq_s16(a, b));
+}
+
+static inline RspVec VecCmpGt(RspVec a, RspVec b)
+{
+    return vreinterpretq_s16_u16(vcgtq_s16(a, b));
+}
+
+static inline RspVec VecCmpLt(RspVec a, RspVec b)
+{
+    return vreinterpretq_s16_u16(vcltq_s16(a, b));
+}
+
+// Mask ? a : b
+static inline RspVec VecSelect(RspVec Mask, RspVec a, RspVec b)
+{
+    return vbslq_s16(vreinterpretq_u16_s16(Mask), a, b);
+}
+
+static inline RspVec VecMulLo(RspVec a, RspVec b)
+{
+    return vmulq_s16(a, b);
+}
+
+static inline RspVec VecMulHi(RspVec a, RspVec b)
+{
+    int32x4_t Low = vmull_s16(vget_low_s16(a), vget_low_s16(b));
+    int32x4_t High = vmull_s16(vget_high_s16(a), vget_high_s16(b));
+    return vcombine_s16(vshrn_n_s32(Low, 16), vshrn_n_s32(High, 16));
+}
+
+static inline RspVec VecMulHiU(RspVec a, RspVec b)
+{
+    uint16x8_t ua = vreinterpretq_u16_s16(a), ub = vreinterpretq_u16_s16(b);
+    uint32x4_t Low = vmull_u16(vget_low_u16(ua), vget_low_u16(ub));
+    uint32x4_t High = vmull_u16(vget_high_u16(ua), vget_high_u16(ub));
+    return vreinterpretq_s16_u16(vcombine_u16(vshrn_n_u32(Low, 16), vshrn_n_u32(High, 16)));
+}
+
+// Each lane set to all ones if negative, else zero
+static inline RspVec VecSignMask(RspVec a)
+{
+    return vshrq_n_s16(a, 15);
+}
+
+static inline RspVec VecShl1(RspVec a)
+{
+    return vshlq_n_s16(a, 1);
+}
+
+static inline RspVec VecShl15(RspVec a)
+{
+    return vshlq_n_s16(a, 15);
+}
+
+static inline RspVec VecSrl1(RspVec a)
+{
+    return vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(a), 1));
+}
+
+static inline RspVec VecSrl15(RspVec a)
+{
+    return vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(a), 15));
+}
+
+// Flags hold lane n in bit (7 - n)
+static inline RspVec VecFromFlag(uint8_t Flag)
+{
+    static const uint16_t Bits[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+    return vreinterpretq_s16_u16(vtstq_u16(vdupq_n_u16(Flag), vld1q_u16(Bits)));
+}
+
+static inline uint8_t VecToFlag(RspVec Mask)
+{
+    static const uint16_t Bits[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+    return (uint8_t)vaddvq_u16(vandq_u16(vreinterpretq_u16_s16(Mask), vld1q_u16(Bits)));
+}
+
+// Lanes 0 <-> 1, 2 <-> 3, ...
+static inline RspVec VecSwapPairs(RspVec a)
+{
+    return vrev32q_s16(a);
+}
+
+// Lanes Count..7 of a followed by lanes 0..Count-1 of b
+template <int Count>
+static inline RspVec VecConcat(RspVec a, RspVec b)
+{
+    return vextq_s16(a, b, Count);
+}
+
+// The eight lanes widened to 32 bits, lanes 0-3 in Lo and 4-7 in Hi
+struct RspVec32
+{
+    int32x4_t Lo, Hi;
+};
+
+static inline RspVec32 VecWiden(RspVec a)
+{
+    RspVec32 Result = {vmovl_s16(vget_low_s16(a)), vmovl_s16(vget_high_s16(a))};
+    return Result;
+}
+
+static inline RspVec32 VecMulWide(RspVec a, RspVec b)
+{
+    RspVec32 Result = {vmull_s16(vget_low_s16(a), vget_low_s16(b)), vmull_s16(vget_high_s16(a), vget_high_s16(b))};
+    return Result;
+}
+
+static inline RspVec32 Vec32Set(int32_t Value)
+{
+    RspVec32 Result = {vdupq_n_s32(Value), vdupq_n_s32(Value)};
+    return Result;
+}
+
+static inline RspVec32 Vec32Add(RspVec32 a, RspVec32 b)
+{
+    RspVec32 Result = {vaddq_s32(a.Lo, b.Lo), vaddq_s32(a.Hi, b.Hi)};
+    return Result;
+}
+
+static inline RspVec32 Vec32Sra(RspVec32 a, int Shift)
+{
+    RspVec32 Result = {vshlq_s32(a.Lo, vdupq_n_s32(-Shift)), vshlq_s32(a.Hi, vdupq_n_s32(-Shift))};
+    return Result;
+}
+
+static inline RspVec32 Vec32Shl(RspVec32 a, int Shift)
+{
+    RspVec32 Result = {vshlq_s32(a.Lo, vdupq_n_s32(Shift)), vshlq_s32(a.Hi, vdupq_n_s32(Shift))};
+    return Result;
+}
+
+// Narrow to 16 bits with signed saturation
+static inline RspVec VecNarrowSat(RspVec32 a)
+{
+    return vcombine_s16(vqmovn_s32(a.Lo), vqmovn_s32(a.Hi));
+}
+
+// Narrow to 16 bits keeping the low half of each lane
+static inline RspVec VecNarrow(RspVec32 a)
+{
+    return vcombine_s16(vmovn_s32(a.Lo), vmovn_s32(a.Hi));
+}
+
+static inline int32_t Vec32Sum(RspVec32 a)
+{
+    return vaddvq_s32(vaddq_s32(a.Lo, a.Hi));
+}
+
+static inline RspVec VecMin(RspVec a, RspVec b)
+{
+    return vminq_s16(a, b);
+}
+
+static inline RspVec VecMax(RspVec a, RspVec b)
+{
+    return vmaxq_s16(a, b);
+}
+
+static inline RspVec VecShl(RspVec a, int Shift)
+{
+    return vshlq_s16(a, vdupq_n_s16((int16_t)Shift));
+}
+
+static inline RspVec VecSra(RspVec a, int Shift)
+{
+    return vshlq_s16(a, vdupq_n_s16((int16_t)-Shift));
+}
+
+// Lanes a0 b0 a1 b1 a2 b2 a3 b3
+static inline RspVec VecZipLo(RspVec a, RspVec b)
+{
+    return vzip1q_s16(a, b);
+}
+
+// Lanes a4 b4 a5 b5 a6 b6 a7 b7
+static inline RspVec VecZipHi(RspVec a, RspVec b)
+{
+    return vzip2q_s16(a, b);
+}
+
+// Row n lane m becomes row m lane n
+static inline void VecTranspose(RspVec Rows[8])
+{
+    int32x4_t a0 = vreinterpretq_s32_s16(vzip1q_s16(Rows[0], Rows[1])), a1 = vreinterpretq_s32_s16(vzip2q_s16(Rows[0], Rows[1]));
+    int32x4_t a2 = vreinterpretq_s32_s16(vzip1q_s16(Rows[2], Rows[3])), a3 = vreinterpretq_s32_s16(vzip2q_s16(Rows[2], Rows[3]));
+    int32x4_t a4 = vreinterpretq_s32_s16(vzip1q_s16(Rows[4], Rows[5])), a5 = vreinterpretq_s32_s16(vzip2q_s16(Rows[4], Rows[5]));
+    int32x4_t a6 = vreinterpretq_s32_s16(vzip1q_s16(Rows[6], Rows[7])), a7 = vreinterpretq_s32_s16(vzip2q_s16(Rows[6], Rows[7]));
+    int64x2_t b0 = vreinterpretq_s64_s32(vzip1q_s32(a0, a2)), b1 = vreinterpretq_s64_s32(vzip2q_s32(a0, a2));
+    int64x2_t b2 = vreinterpretq_s64_s32(vzip1q_s32(a1, a3)), b3 = vreinterpretq_s64_s32(vzip2q_s32(a1, a3));
+    int64x2_t b4 = vreinterpretq_s64_s32(vzip1q_s32(a4, a6)), b5 = vreinterpretq_s64_s32(vzip2q_s32(a4, a6));
+    int64x2_t b6 = vreinterpretq_s64_s32(vzip1q_s32(a5, a7)), b7 = vreinterpretq_s64_s32(vzip2q_s32(a5, a7));
+    Rows[0] = vreinterpretq_s16_s64(vzip1q_s64(b0, b4));
+    Rows[1] = vreinterpretq_s16_s64(vzip2q_s64(b0, b4));
+    Rows[2] = vreinterpretq_s16_s64(vzip1q_s64(b1, b5));
+    Rows[3] = vreinterpretq_s16_s64(vzip2q_s64(b1, b5));
+    Rows[4] = vreinterpretq_s16_s64(vzip1q_s64(b2, b6));
+    Rows[5] = vreinterpretq_s16_s64(vzip2q_s64(b2, b6));
+    Rows[6] = vreinterpretq_s16_s64(vzip1q_s64(b3, b7));
+    Rows[7] = vreinterpretq_s16_s64(vzip2q_s64(b3, b7));
+}
+#endif
+
+// Carry out of the unsigned add a + b = Sum, as a mask
+static inline RspVec VecCarry(RspVec a, RspVec b, RspVec Sum)
+{
+    return VecSignMask(VecOr(VecAnd(a, b), VecAndNot(VecOr(a, b), Sum)));
+}
+
+// Borrow out of the unsigned subtract a - b = Diff, as a mask
+static inline RspVec VecBorrow(RspVec a, RspVec b, RspVec Diff)
+{
+    return VecSignMask(VecOr(VecAndNot(b, a), VecAndNot(Diff, VecXor(a, b))));
+}
+
+// Clamp the signed 32-bit value High:Low to 16 bits
+static inline RspVec VecClamp32(RspVec High, RspVec Low)
+{
+    RspVec InRange = VecCmpEq(High, VecSignMask(Low));
+    return VecSelect(InRange, Low, VecXor(VecSignMask(High), VecSet(0x7FFF)));
+}
+
+// High 16 bits of the signed a times the unsigned b
+static inline RspVec VecMulHiSU(RspVec a, RspVec b)
+{
+    return VecAdd(VecMulHi(a, b), VecAnd(VecSignMask(b), a));
+}
+#endif
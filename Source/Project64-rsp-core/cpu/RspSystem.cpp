@@ -6,6 +6,8 @@
 #include <Project64-rsp-core/cpu/RSPRegisters.h>
 #include <Project64-rsp-core/cpu/RspSystem.h>
 #include <Settings/Settings.h>
+#include <stdlib.h>
+#include <string.h>
 
 CRSPSystem RSPSystem;
 
@@ -44,9 +46,18 @@ CRSPSystem::CRSPSystem() :
     ProcessDList(NullProcessDList),
     ProcessRdpList(NullProcessRdpList),
     m_SyncReg(nullptr),
-    m_RdramSize(0)
+    m_RdramSize(0),
+    m_IdlePolled(false),
+    m_IdleTracking(false),
+    m_IdleHead(0),
+    m_IdleTail(0),
+    m_IdleExecuted(0),
+    m_IdleCyclesSkipped(0),
+    m_IdleLoopExits(0)
 {
     m_OpCode.Value = 0;
+    memset(m_IdleGPR, 0, sizeof(m_IdleGPR));
+    memset(m_IdleStatus, 0, sizeof(m_IdleStatus));
 }
 
 CRSPSystem::~CRSPSystem()
@@ -126,6 +137,7 @@ void CRSPSystem::Reset(RSP_INFO & Info)
         m_RSPRegisterHandler = nullptr;
     }
     m_RSPRegisterHandler = new RSPRegisterHandlerPlugin(*this);
+    m_Op.SelectVectorOps();
 
     if (m_SyncSystem != nullptr)
     {
@@ -140,7 +152,7 @@ void CRSPSystem::RomClosed(void)
 {
 }
 
-#if defined(__i386__) || defined(_M_IX86)
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
 void CRSPSystem::RunRecompiler(void)
 {
     m_Recompiler.RunCPU();
@@ -156,6 +168,8 @@ void CRSPSystem::ExecuteOps(uint32_t Cycles, uint32_t TargetPC)
     }
     uint32_t & GprR0 = m_Reg.m_GPR[0].UW;
     uint32_t & ProgramCounter = *m_SP_PC_REG;
+    m_IdlePolled = false;
+    m_IdleTracking = false;
     while (RSP_Running && Cycles > 0)
     {
         if (g_RSPDebugger != nullptr)
@@ -166,6 +180,14 @@ void CRSPSystem::ExecuteOps(uint32_t Cycles, uint32_t TargetPC)
         {
             break;
         }
+        if (m_IdleTracking)
+        {
+            if (((ProgramCounter & 0xFFC) - m_IdleHead) > (m_IdleTail - m_IdleHead))
+            {
+                m_IdleTracking = false;
+            }
+            m_IdleExecuted += 1;
+        }
         m_OpCode.Value = *(uint32_t *)(m_IMEM + (ProgramCounter & 0xFFC));
         (m_Op.*(m_Op.Jump_Opcode[m_OpCode.op]))();
         GprR0 = 0x00000000; // MIPS $zero hard-wired to 0
@@ -185,6 +207,10 @@ void CRSPSystem::ExecuteOps(uint32_t Cycles, uint32_t TargetPC)
             break;
         case RSPPIPELINE_JUMP:
             m_NextInstruction = RSPPIPELINE_NORMAL;
+            if (m_JumpTo <= ProgramCounter && (m_IdlePolled || m_IdleTracking) && SkipIdleLoop(ProgramCounter, Cycles))
+            {
+                RSP_Running = false;
+            }
             ProgramCounter = m_JumpTo;
             break;
         case RSPPIPELINE_SINGLE_STEP:
@@ -200,6 +226,177 @@ void CRSPSystem::ExecuteOps(uint32_t Cycles, uint32_t TargetPC)
     }
 }
 
+// A backward branch has just been taken from the delay slot at Tail. Looks for microcode
+// spinning on SP_STATUS, DMA_FULL, DMA_BUSY or the semaphore: a short loop with no side
+// effects that reached its head twice with exactly the same registers. Nothing but the CPU
+// can change the polled registers, so the rest of the cycle budget is skipped in whole
+// iterations. Without a budget the RSP gives control back, the same as SemaphoreExit does.
+// Returns true when execution should stop.
+bool CRSPSystem::SkipIdleLoop(uint32_t Tail, uint32_t & Cycles)
+{
+    uint32_t Head = m_JumpTo;
+    if (m_IdleTracking && m_IdleHead == Head && m_IdleTail == Tail)
+    {
+        if (IdleStateChanged())
+        {
+            SaveIdleState();
+            return false;
+        }
+        m_IdleTracking = false;
+        if (Cycles == (uint32_t)-1)
+        {
+            m_IdleLoopExits += 1;
+            return true;
+        }
+        uint32_t Skip = Cycles - (Cycles % m_IdleExecuted);
+        Cycles -= Skip;
+        m_IdleCyclesSkipped += Skip;
+        return false;
+    }
+
+    m_IdleTracking = false;
+    if (!m_IdlePolled)
+    {
+        return false;
+    }
+    m_IdlePolled = false;
+    if (!IsIdleLoop(Head, Tail))
+    {
+        return false;
+    }
+    m_IdleHead = Head;
+    m_IdleTail = Tail;
+    m_IdleTracking = true;
+    SaveIdleState();
+    return false;
+}
+
+// Only register to register ALU ops, forward branches and reads of the polled COP0 registers
+// are allowed, so each iteration depends on nothing but the GPRs and those registers.
+bool CRSPSystem::IsIdleLoop(uint32_t Head, uint32_t Tail)
+{
+    if (Tail < Head + 4 || ((Tail - Head) >> 2) >= IdleLoopMaxLength)
+    {
+        return false;
+    }
+    bool Polls = false;
+    for (uint32_t PC = Head; PC <= Tail; PC += 4)
+    {
+        RSPOpcode OpCode;
+        OpCode.Value = *(uint32_t *)(m_IMEM + PC);
+
+        bool Branch = false;
+        uint32_t Target = 0;
+        switch (OpCode.op)
+        {
+        case RSP_SPECIAL:
+            switch (OpCode.funct)
+            {
+            case RSP_SPECIAL_SLL:
+            case RSP_SPECIAL_SRL:
+            case RSP_SPECIAL_SRA:
+            case RSP_SPECIAL_SLLV:
+            case RSP_SPECIAL_SRLV:
+            case RSP_SPECIAL_SRAV:
+            case RSP_SPECIAL_ADD:
+            case RSP_SPECIAL_ADDU:
+            case RSP_SPECIAL_SUB:
+            case RSP_SPECIAL_SUBU:
+            case RSP_SPECIAL_AND:
+            case RSP_SPECIAL_OR:
+            case RSP_SPECIAL_XOR:
+            case RSP_SPECIAL_NOR:
+            case RSP_SPECIAL_SLT:
+            case RSP_SPECIAL_SLTU:
+                break;
+            default:
+                return false;
+            }
+            break;
+        case RSP_REGIMM:
+            if (OpCode.rt != RSP_REGIMM_BLTZ && OpCode.rt != RSP_REGIMM_BGEZ)
+            {
+                return false;
+            }
+            Branch = true;
+            Target = (PC + ((int16_t)OpCode.offset << 2) + 4) & 0xFFC;
+            break;
+        case RSP_BEQ:
+        case RSP_BNE:
+        case RSP_BLEZ:
+        case RSP_BGTZ:
+            Branch = true;
+            Target = (PC + ((int16_t)OpCode.offset << 2) + 4) & 0xFFC;
+            break;
+        case RSP_J:
+            Branch = true;
+            Target = (OpCode.target << 2) & 0xFFC;
+            break;
+        case RSP_ADDI:
+        case RSP_ADDIU:
+        case RSP_SLTI:
+        case RSP_SLTIU:
+        case RSP_ANDI:
+        case RSP_ORI:
+        case RSP_XORI:
+        case RSP_LUI:
+            break;
+        case RSP_CP0:
+            if (OpCode.rs != RSP_COP0_MF || OpCode.rd < 4 || OpCode.rd > 7)
+            {
+                return false;
+            }
+            Polls = true;
+            break;
+        default:
+            return false;
+        }
+
+        if (!Branch)
+        {
+            continue;
+        }
+        if (PC == Tail - 4)
+        {
+            if (Target != Head)
+            {
+                return false;
+            }
+        }
+        else if (PC >= Tail || OpCode.op == RSP_J || Target <= PC || Target > Tail + 4)
+        {
+            return false;
+        }
+    }
+    return Polls;
+}
+
+void CRSPSystem::SaveIdleState(void)
+{
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        m_IdleGPR[i] = m_Reg.m_GPR[i].UW;
+    }
+    m_IdleStatus[0] = *m_SP_STATUS_REG;
+    m_IdleStatus[1] = *m_SP_DMA_FULL_REG;
+    m_IdleStatus[2] = *m_SP_DMA_BUSY_REG;
+    m_IdleStatus[3] = *m_SP_SEMAPHORE_REG;
+    m_IdleExecuted = 0;
+}
+
+bool CRSPSystem::IdleStateChanged(void) const
+{
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        if (m_IdleGPR[i] != m_Reg.m_GPR[i].UW)
+        {
+            return true;
+        }
+    }
+    return m_IdleStatus[0] != *m_SP_STATUS_REG || m_IdleStatus[1] != *m_SP_DMA_FULL_REG ||
+           m_IdleStatus[2] != *m_SP_DMA_BUSY_REG || m_IdleStatus[3] != *m_SP_SEMAPHORE_REG;
+}
+
 void CRSPSystem::SetupSyncCPU()
 {
     if (m_SyncSystem == nullptr)
@@ -343,12 +540,21 @@ void CRSPSystem::BasicSyncCheck(void)
 
 void * CRSPSystem::operator new(size_t size)
 {
+#ifdef _WIN32
     return _aligned_malloc(size, 16);
+#else
+    void * ptr = nullptr;
+    return posix_memalign(&ptr, 16, size) == 0 ? ptr : nullptr;
+#endif
 }
 
 void CRSPSystem::operator delete(void * ptr)
 {
+#ifdef _WIN32
     _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
 }
 
 void CRSPSystem::NullProcessDList(void)
@@ -34,7 +34,7 @@ public:
     void Reset(RSP_INFO & Info);
     void RomClosed(void);
 
-#if defined(__i386__) || defined(_M_IX86)
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
     void RunRecompiler(void);
 #endif
     void ExecuteOps(uint32_t Cycles, uint32_t TargetPC);
@@ -45,10 +45,29 @@ public:
     void * operator new(size_t size);
     void operator delete(void * ptr);
 
+    uint64_t IdleCyclesSkipped(void) const
+    {
+        return m_IdleCyclesSkipped;
+    }
+    uint32_t IdleLoopExits(void) const
+    {
+        return m_IdleLoopExits;
+    }
+
 private:
     CRSPSystem(const CRSPSystem &);
     CRSPSystem & operator=(const CRSPSystem &);
 
+    enum
+    {
+        IdleLoopMaxLength = 16, // Instructions, including the delay slot
+    };
+
+    bool IsIdleLoop(uint32_t Head, uint32_t Tail);
+    bool SkipIdleLoop(uint32_t Tail, uint32_t & Cycles);
+    void SaveIdleState(void);
+    bool IdleStateChanged(void) const;
+
     static void NullProcessDList(void);
     static void NullProcessRdpList(void);
     static void NullCheckInterrupts(void);
@@ -86,6 +105,15 @@ private:
     uint32_t * m_DPC_TMEM_REG;
     uint32_t m_RdramSize;
     uint32_t * m_SyncReg;
+    bool m_IdlePolled;
+    bool m_IdleTracking;
+    uint32_t m_IdleHead;
+    uint32_t m_IdleTail;
+    uint32_t m_IdleExecuted;
+    uint32_t m_IdleGPR[32];
+    uint32_t m_IdleStatus[4];
+    uint64_t m_IdleCyclesSkipped;
+    uint32_t m_IdleLoopExits;
     void (*CheckInterrupts)(void);
     void (*ProcessDList)(void);
     void (*ProcessRdpList)(void);
@@ -1,7 +1,41 @@
 #include "RspTypes.h"
 #include <Project64-rsp-core/Settings/RspSettings.h>
+#include <string.h>
 
-extern UDWORD EleSpec[16];
+// Lane of vt read by each lane, by element specifier. Both tables below are built from this list
+#define RSP_ELEMENT_LANES(LANES)             \
+    LANES(0, 1, 2, 3, 4, 5, 6, 7) /* None */ \
+    LANES(0, 1, 2, 3, 4, 5, 6, 7) /* None */ \
+    LANES(1, 1, 3, 3, 5, 5, 7, 7) /* 0q */   \
+    LANES(0, 0, 2, 2, 4, 4, 6, 6) /* 1q */   \
+    LANES(3, 3, 3, 3, 7, 7, 7, 7) /* 0h */   \
+    LANES(2, 2, 2, 2, 6, 6, 6, 6) /* 1h */   \
+    LANES(1, 1, 1, 1, 5, 5, 5, 5) /* 2h */   \
+    LANES(0, 0, 0, 0, 4, 4, 4, 4) /* 3h */   \
+    LANES(7, 7, 7, 7, 7, 7, 7, 7) /* 0 */    \
+    LANES(6, 6, 6, 6, 6, 6, 6, 6) /* 1 */    \
+    LANES(5, 5, 5, 5, 5, 5, 5, 5) /* 2 */    \
+    LANES(4, 4, 4, 4, 4, 4, 4, 4) /* 3 */    \
+    LANES(3, 3, 3, 3, 3, 3, 3, 3) /* 4 */    \
+    LANES(2, 2, 2, 2, 2, 2, 2, 2) /* 5 */    \
+    LANES(1, 1, 1, 1, 1, 1, 1, 1) /* 6 */    \
+    LANES(0, 0, 0, 0, 0, 0, 0, 0) /* 7 */
+
+#define RSP_LANE_WORDS(a, b, c, d, e, f, g, h) {a, b, c, d, e, f, g, h},
+#define RSP_LANE_BYTES(a, b, c, d, e, f, g, h) {a * 2, a * 2 + 1, b * 2, b * 2 + 1, c * 2, c * 2 + 1, d * 2, d * 2 + 1, \
+                                                e * 2, e * 2 + 1, f * 2, f * 2 + 1, g * 2, g * 2 + 1, h * 2, h * 2 + 1},
+
+const uint8_t RSPElementLane[16][8] = {
+    RSP_ELEMENT_LANES(RSP_LANE_WORDS)
+};
+
+alignas(16) const uint8_t RSPElementShuffle[16][16] = {
+    RSP_ELEMENT_LANES(RSP_LANE_BYTES)
+};
+
+#undef RSP_LANE_BYTES
+#undef RSP_LANE_WORDS
+#undef RSP_ELEMENT_LANES
 
 RSPVector::RSPVector()
 {
@@ -11,14 +45,12 @@ RSPVector::RSPVector()
 
 uint16_t & RSPVector::ue(uint8_t Index, uint8_t Element)
 {
-    Index = EleSpec[Element].B[Index];
-    return ((uint16_t *)&m_Reg)[Index];
+    return ((uint16_t *)&m_Reg)[RSPElementLane[Element][Index]];
 }
 
 int16_t & RSPVector::se(uint8_t Index, uint8_t Element)
 {
-    Index = EleSpec[Element].B[Index];
-    return ((int16_t *)&m_Reg)[Index];
+    return ((int16_t *)&m_Reg)[RSPElementLane[Element][Index]];
 }
 
 int8_t & RSPVector::s8(uint8_t Index)
@@ -51,6 +83,18 @@ uint64_t & RSPVector::u64(uint8_t Index)
     return m_Reg[Index];
 }
 
+RSPAccumulator::RSPAccumulator()
+{
+    Clear();
+}
+
+void RSPAccumulator::Clear(void)
+{
+    memset(m_Low, 0, sizeof(m_Low));
+    memset(m_Mid, 0, sizeof(m_Mid));
+    memset(m_High, 0, sizeof(m_High));
+}
+
 RSPFlag::RSPFlag(uint8_t & Flag) :
     m_Flag(Flag)
 {
@@ -78,3 +122,13 @@ bool RSPFlag::Get(uint8_t Index) const
 {
     return (m_Flag & (1 << (7 - Index))) != 0;
 }
+
+uint8_t RSPFlag::Value(void) const
+{
+    return m_Flag;
+}
+
+void RSPFlag::SetValue(uint8_t Value)
+{
+    m_Flag = Value;
+}
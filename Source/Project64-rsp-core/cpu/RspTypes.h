@@ -24,7 +24,13 @@ typedef union tagUDWORD
     uint8_t UB[8];
 } UDWORD;
 
-class RSPVector
+// Lane of vt read by each lane of a vector op, by element specifier
+extern const uint8_t RSPElementLane[16][8];
+
+// RSPElementLane as byte indexes, for a single byte shuffle of a whole register
+extern const uint8_t RSPElementShuffle[16][16];
+
+class alignas(16) RSPVector
 {
 public:
     RSPVector();
@@ -40,11 +46,47 @@ public:
     uint64_t & u64(uint8_t Index);
 
 private:
-#if defined(_MSC_VER)
-    uint64_t m_Reg[2] alignas(16);
-#else
     uint64_t m_Reg[2];
-#endif
+};
+
+// The 48-bit accumulator of the eight lanes, kept as three planes of 16 bits (low, mid and
+// high) so each plane is one aligned 128-bit value. Lane n of a plane is lane n of a vector
+// register.
+class RSPAccumulator
+{
+public:
+    RSPAccumulator();
+
+    void Clear(void);
+
+    int16_t & Low(uint8_t Index)
+    {
+        return m_Low[Index];
+    }
+    int16_t & Mid(uint8_t Index)
+    {
+        return m_Mid[Index];
+    }
+    int16_t & High(uint8_t Index)
+    {
+        return m_High[Index];
+    }
+
+    int64_t Get(uint8_t Index) const
+    {
+        return (((int64_t)m_High[Index]) << 32) | (((int64_t)(uint16_t)m_Mid[Index]) << 16) | (uint16_t)m_Low[Index];
+    }
+    void Set(uint8_t Index, int64_t Value)
+    {
+        m_High[Index] = (int16_t)(Value >> 32);
+        m_Mid[Index] = (int16_t)(Value >> 16);
+        m_Low[Index] = (int16_t)Value;
+    }
+
+private:
+    alignas(16) int16_t m_Low[8];
+    alignas(16) int16_t m_Mid[8];
+    alignas(16) int16_t m_High[8];
 };
 
 class RSPFlag
@@ -55,6 +97,8 @@ public:
     void Clear(void);
     bool Set(uint8_t Index, bool Value);
     bool Get(uint8_t Index) const;
+    uint8_t Value(void) const;
+    void SetValue(uint8_t Value);
 
 private:
     RSPFlag();
@@ -179,7 +179,7 @@ void FixMenuState(void)
     EnableMenuItem(hRSPMenu, ID_CPUMETHOD_INTERPT, MF_BYCOMMAND | (!CRSPSettings::RomOpen() ? MF_ENABLED : (MF_GRAYED | MF_DISABLED)));
     EnableMenuItem(hRSPMenu, ID_CPUMETHOD_HLE, MF_BYCOMMAND | (!CRSPSettings::RomOpen() ? MF_ENABLED : (MF_GRAYED | MF_DISABLED)));
 
-#if defined(__i386__) || defined(_M_IX86)
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
     CheckMenuItem(hRSPMenu, ID_CPUMETHOD_RECOMPILER, MF_BYCOMMAND | ((RSPCpuMethod)GetSetting(Set_CPUCore) == RSPCpuMethod::Recompiler ? MFS_CHECKED : MF_UNCHECKED));
 #endif
     CheckMenuItem(hRSPMenu, ID_CPUMETHOD_INTERPT, MF_BYCOMMAND | ((RSPCpuMethod)GetSetting(Set_CPUCore) == RSPCpuMethod::Interpreter ? MFS_CHECKED : MF_UNCHECKED));
@@ -419,7 +419,7 @@ void ProcessMenuItem(int32_t ID)
         }
         break;
     }
-#if defined(__i386__) || defined(_M_IX86)
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(_M_X64)
     case ID_CPUMETHOD_RECOMPILER:
         SetSetting(Set_CPUCore, (int)RSPCpuMethod::Recompiler);
         FixMenuState();
@@ -622,6 +622,7 @@ EXPORT void EnableDebugging(int Enabled)
         IndvidualBlock = GetSetting(Set_IndvidualBlock) != 0;
         ShowErrors = GetSetting(Set_ShowErrors) != 0;
         SyncCPU = GetSetting(Set_SyncCPU) != 0;
+        CheckSimd = GetSetting(Set_CheckSimd) != 0;
 
 #if defined(__i386__) || defined(_M_IX86)
         Compiler.bDest = GetSetting(Set_CheckDest) != 0;
@@ -381,6 +381,10 @@ bool CMainMenu::ProcessMessage(HWND hWnd, DWORD /*FromAccelerator*/, DWORD MenuI
         g_BaseSystem->ExternalEvent(SysEvent_LoadMachineState);
         break;
     case ID_SYSTEM_LOAD: OnLodState(hWnd); break;
+    case ID_SYSTEM_REWIND:
+        WriteTrace(TraceUserInterface, TraceDebug, "ID_SYSTEM_REWIND");
+        g_BaseSystem->ExternalEvent(SysEvent_LoadSnapshot);
+        break;
     case ID_SYSTEM_ENHANCEMENT: OnEnhancements(hWnd); break;
     case ID_SYSTEM_CHEAT: OnCheats(hWnd); break;
     case ID_SYSTEM_GSBUTTON:
@@ -999,6 +1003,12 @@ void CMainMenu::FillOutMenu(HMENU hMenu)
     {
         SystemMenu.push_back(MENU_ITEM(ID_SYSTEM_LOAD, MENU_LOAD, m_ShortCuts.ShortCutString(ID_SYSTEM_LOAD, RunningState)));
     }
+    Item.Reset(ID_SYSTEM_REWIND, MENU_REWIND, m_ShortCuts.ShortCutString(ID_SYSTEM_REWIND, RunningState));
+    if (g_Settings->LoadDword(Setting_RewindInterval) == 0)
+    {
+        Item.SetItemEnabled(false);
+    }
+    SystemMenu.push_back(Item);
     SystemMenu.push_back(MENU_ITEM(SPLITER));
     SystemMenu.push_back(MENU_ITEM(SUB_MENU, MENU_CURRENT_SAVE, EMPTY_STDSTR, &CurrentSaveMenu));
     SystemMenu.push_back(MENU_ITEM(SPLITER));
@@ -37,6 +37,7 @@ enum MainMenuID
     ID_SYSTEM_SWAPDISK,
     ID_SYSTEM_RESTORE,
     ID_SYSTEM_LOAD,
+    ID_SYSTEM_REWIND,
     ID_SYSTEM_SAVE,
     ID_SYSTEM_SAVEAS,
     ID_SYSTEM_ENHANCEMENT,
@@ -45,6 +45,7 @@ CGameRecompilePage::CGameRecompilePage(HWND hParent, const RECT & rcDispay)
     {
         ComboBox->AddItem(wGS(CORE_RECOMPILER).c_str(), CPU_Recompiler);
         ComboBox->AddItem(wGS(CORE_INTERPTER).c_str(), CPU_Interpreter);
+        ComboBox->AddItem(wGS(CORE_CACHED_INTERPTER).c_str(), CPU_CachedInterpreter);
         if (g_Settings->LoadBool(Debugger_Enabled))
         {
             ComboBox->AddItem(wGS(CORE_SYNC).c_str(), CPU_SyncCores);
@@ -56,7 +57,7 @@ CGameRecompilePage::CGameRecompilePage(HWND hParent, const RECT & rcDispay)
     {
         ComboBox->AddItem(wGS(FLM_PLOOKUP).c_str(), FuncFind_PhysicalLookup);
         ComboBox->AddItem(wGS(FLM_VLOOKUP).c_str(), FuncFind_VirtualLookup);
-        //ComboBox->AddItem(wGS(FLM_CHANGEMEM).c_str(), FuncFind_ChangeMemory);
+        ComboBox->AddItem(wGS(FLM_CHANGEMEM).c_str(), FuncFind_ChangeMemory);
     }
     UpdatePageSettings();
 }